@@ -0,0 +1,395 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/bacnet/abort/CMakeLists.txt"
+  "/root/repo/test/bacnet/alarm_ack/CMakeLists.txt"
+  "/root/repo/test/bacnet/arf/CMakeLists.txt"
+  "/root/repo/test/bacnet/awf/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacaddr/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacapp/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacdcode/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacdest/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacdevobjpropref/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacerror/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacint/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacpropstates/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacreal/CMakeLists.txt"
+  "/root/repo/test/bacnet/bacstr/CMakeLists.txt"
+  "/root/repo/test/bacnet/bactimevalue/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/bbmd/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/bbmd6/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/binding/address/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/client/bac-data/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/client/bac-discover/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/client/bac-rw/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/acc/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_credential/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_door/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_point/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_rights/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_user/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/access_zone/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/ai/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/ao/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/av/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/bacfile/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/bi/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/bitstring_value/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/blo/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/bo/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/bv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/calendar/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/channel/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/color_object/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/color_temperature/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/command/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/credential_data_input/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/csv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/device/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/iv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/lc/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/lo/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/lsp/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/lsz/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/ms-input/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/mso/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/msv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/nc/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/netport/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/objects/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/osv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/piv/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/schedule/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/structured_view/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/time_value/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/object/trendlog/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/service/h_rpm_a/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/service/h_whois/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/bufpool/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/color_rgb/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/commandable/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/days/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/fifo/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/filename/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/keylist/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/linear/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/propcache/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/ringbuf/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/sbuf/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/sys/tmwheel/CMakeLists.txt"
+  "/root/repo/test/bacnet/basic/tsm/CMakeLists.txt"
+  "/root/repo/test/bacnet/cov/CMakeLists.txt"
+  "/root/repo/test/bacnet/create_object/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/automac/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/bvlc/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/cobs/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/crc/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/dlmux/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/loopback/CMakeLists.txt"
+  "/root/repo/test/bacnet/datalink/mstp/CMakeLists.txt"
+  "/root/repo/test/bacnet/datetime/CMakeLists.txt"
+  "/root/repo/test/bacnet/dcc/CMakeLists.txt"
+  "/root/repo/test/bacnet/delete_object/CMakeLists.txt"
+  "/root/repo/test/bacnet/event/CMakeLists.txt"
+  "/root/repo/test/bacnet/getalarm/CMakeLists.txt"
+  "/root/repo/test/bacnet/getevent/CMakeLists.txt"
+  "/root/repo/test/bacnet/hostnport/CMakeLists.txt"
+  "/root/repo/test/bacnet/iam/CMakeLists.txt"
+  "/root/repo/test/bacnet/ihave/CMakeLists.txt"
+  "/root/repo/test/bacnet/indtext/CMakeLists.txt"
+  "/root/repo/test/bacnet/lighting/CMakeLists.txt"
+  "/root/repo/test/bacnet/list_element/CMakeLists.txt"
+  "/root/repo/test/bacnet/lso/CMakeLists.txt"
+  "/root/repo/test/bacnet/memcopy/CMakeLists.txt"
+  "/root/repo/test/bacnet/npdu/CMakeLists.txt"
+  "/root/repo/test/bacnet/property/CMakeLists.txt"
+  "/root/repo/test/bacnet/ptransfer/CMakeLists.txt"
+  "/root/repo/test/bacnet/rd/CMakeLists.txt"
+  "/root/repo/test/bacnet/reject/CMakeLists.txt"
+  "/root/repo/test/bacnet/rp/CMakeLists.txt"
+  "/root/repo/test/bacnet/rpm/CMakeLists.txt"
+  "/root/repo/test/bacnet/specialevent/CMakeLists.txt"
+  "/root/repo/test/bacnet/timestamp/CMakeLists.txt"
+  "/root/repo/test/bacnet/timesync/CMakeLists.txt"
+  "/root/repo/test/bacnet/weeklyschedule/CMakeLists.txt"
+  "/root/repo/test/bacnet/whohas/CMakeLists.txt"
+  "/root/repo/test/bacnet/whois/CMakeLists.txt"
+  "/root/repo/test/bacnet/wp/CMakeLists.txt"
+  "/root/repo/test/bacnet/wpm/CMakeLists.txt"
+  "/root/repo/test/unit/bacnet/bits/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unit/bacnet/bits/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/abort/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/alarm_ack/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/arf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/awf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacaddr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacapp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacdcode/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacdevobjpropref/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacdest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacerror/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacpropstates/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacreal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bacstr/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/bactimevalue/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/cov/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/create_object/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datetime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/dcc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/delete_object/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/event/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/getalarm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/getevent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/hostnport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/iam/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/ihave/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/indtext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/lighting/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/list_element/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/lso/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/memcopy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/npdu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/property/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/ptransfer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/rd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/reject/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/rp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/rpm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/specialevent/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/timestamp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/timesync/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/whohas/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/whois/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/wp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/wpm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/weeklyschedule/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/binding/address/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/bbmd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/bbmd6/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/client/bac-data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/client/bac-discover/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/client/bac-rw/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/acc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_credential/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_door/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_point/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_rights/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_user/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/access_zone/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/ai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/ao/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/av/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/bacfile/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/bi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/bitstring_value/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/blo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/bo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/bv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/channel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/calendar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/color_object/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/color_temperature/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/command/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/credential_data_input/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/csv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/device/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/iv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/lc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/lo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/lsp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/lsz/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/ms-input/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/mso/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/msv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/netport/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/nc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/objects/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/osv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/piv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/schedule/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/structured_view/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/time_value/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/object/trendlog/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/service/h_rpm_a/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/service/h_whois/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/bufpool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/color_rgb/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/commandable/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/days/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/fifo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/filename/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/keylist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/linear/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/propcache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/ringbuf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/sbuf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/sys/tmwheel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/basic/tsm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/automac/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/cobs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/crc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/bvlc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/loopback/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/mstp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bacnet/datalink/dlmux/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/lcov.dir/DependInfo.cmake"
+  "unit/bacnet/bits/CMakeFiles/test_bits.dir/DependInfo.cmake"
+  "bacnet/abort/CMakeFiles/test_abort.dir/DependInfo.cmake"
+  "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/DependInfo.cmake"
+  "bacnet/arf/CMakeFiles/test_arf.dir/DependInfo.cmake"
+  "bacnet/awf/CMakeFiles/test_awf.dir/DependInfo.cmake"
+  "bacnet/bacaddr/CMakeFiles/test_bacaddr.dir/DependInfo.cmake"
+  "bacnet/bacapp/CMakeFiles/test_bacapp.dir/DependInfo.cmake"
+  "bacnet/bacdcode/CMakeFiles/test_bacdcode.dir/DependInfo.cmake"
+  "bacnet/bacdevobjpropref/CMakeFiles/test_bacdevobjpropref.dir/DependInfo.cmake"
+  "bacnet/bacdest/CMakeFiles/test_bacdest.dir/DependInfo.cmake"
+  "bacnet/bacerror/CMakeFiles/test_bacerror.dir/DependInfo.cmake"
+  "bacnet/bacint/CMakeFiles/test_bacint.dir/DependInfo.cmake"
+  "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/DependInfo.cmake"
+  "bacnet/bacreal/CMakeFiles/test_bacreal.dir/DependInfo.cmake"
+  "bacnet/bacstr/CMakeFiles/test_bacstr.dir/DependInfo.cmake"
+  "bacnet/bactimevalue/CMakeFiles/test_bactimevalue.dir/DependInfo.cmake"
+  "bacnet/cov/CMakeFiles/test_cov.dir/DependInfo.cmake"
+  "bacnet/create_object/CMakeFiles/test_create_object.dir/DependInfo.cmake"
+  "bacnet/datetime/CMakeFiles/test_datetime.dir/DependInfo.cmake"
+  "bacnet/dcc/CMakeFiles/test_dcc.dir/DependInfo.cmake"
+  "bacnet/delete_object/CMakeFiles/test_delete_object.dir/DependInfo.cmake"
+  "bacnet/event/CMakeFiles/test_event.dir/DependInfo.cmake"
+  "bacnet/getalarm/CMakeFiles/test_getalarm.dir/DependInfo.cmake"
+  "bacnet/getevent/CMakeFiles/test_getevent.dir/DependInfo.cmake"
+  "bacnet/hostnport/CMakeFiles/test_hostnport.dir/DependInfo.cmake"
+  "bacnet/iam/CMakeFiles/test_iam.dir/DependInfo.cmake"
+  "bacnet/ihave/CMakeFiles/test_ihave.dir/DependInfo.cmake"
+  "bacnet/indtext/CMakeFiles/test_indtext.dir/DependInfo.cmake"
+  "bacnet/lighting/CMakeFiles/test_lighting.dir/DependInfo.cmake"
+  "bacnet/list_element/CMakeFiles/test_list_element.dir/DependInfo.cmake"
+  "bacnet/lso/CMakeFiles/test_lso.dir/DependInfo.cmake"
+  "bacnet/memcopy/CMakeFiles/test_memcopy.dir/DependInfo.cmake"
+  "bacnet/npdu/CMakeFiles/test_npdu.dir/DependInfo.cmake"
+  "bacnet/property/CMakeFiles/test_property.dir/DependInfo.cmake"
+  "bacnet/ptransfer/CMakeFiles/test_ptransfer.dir/DependInfo.cmake"
+  "bacnet/rd/CMakeFiles/test_rd.dir/DependInfo.cmake"
+  "bacnet/reject/CMakeFiles/test_reject.dir/DependInfo.cmake"
+  "bacnet/rp/CMakeFiles/test_rp.dir/DependInfo.cmake"
+  "bacnet/rpm/CMakeFiles/test_rpm.dir/DependInfo.cmake"
+  "bacnet/specialevent/CMakeFiles/test_specialevent.dir/DependInfo.cmake"
+  "bacnet/timestamp/CMakeFiles/test_timestamp.dir/DependInfo.cmake"
+  "bacnet/timesync/CMakeFiles/test_timesync.dir/DependInfo.cmake"
+  "bacnet/whohas/CMakeFiles/test_whohas.dir/DependInfo.cmake"
+  "bacnet/whois/CMakeFiles/test_whois.dir/DependInfo.cmake"
+  "bacnet/wp/CMakeFiles/test_wp.dir/DependInfo.cmake"
+  "bacnet/wpm/CMakeFiles/test_wpm.dir/DependInfo.cmake"
+  "bacnet/weeklyschedule/CMakeFiles/test_weeklyschedule.dir/DependInfo.cmake"
+  "bacnet/basic/binding/address/CMakeFiles/test_address.dir/DependInfo.cmake"
+  "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/DependInfo.cmake"
+  "bacnet/basic/bbmd6/CMakeFiles/test_bbmd6.dir/DependInfo.cmake"
+  "bacnet/basic/client/bac-data/CMakeFiles/test_bac-data.dir/DependInfo.cmake"
+  "bacnet/basic/client/bac-discover/CMakeFiles/test_bac-discover.dir/DependInfo.cmake"
+  "bacnet/basic/client/bac-rw/CMakeFiles/test_bac-rw.dir/DependInfo.cmake"
+  "bacnet/basic/object/acc/CMakeFiles/test_acc.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_credential/CMakeFiles/test_access_credential.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_door/CMakeFiles/test_access_door.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_point/CMakeFiles/test_access_point.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_rights/CMakeFiles/test_access_rights.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_user/CMakeFiles/test_access_user.dir/DependInfo.cmake"
+  "bacnet/basic/object/access_zone/CMakeFiles/test_access_zone.dir/DependInfo.cmake"
+  "bacnet/basic/object/ai/CMakeFiles/test_ai.dir/DependInfo.cmake"
+  "bacnet/basic/object/ao/CMakeFiles/test_ao.dir/DependInfo.cmake"
+  "bacnet/basic/object/av/CMakeFiles/test_av.dir/DependInfo.cmake"
+  "bacnet/basic/object/bacfile/CMakeFiles/test_bacfile.dir/DependInfo.cmake"
+  "bacnet/basic/object/bi/CMakeFiles/test_bi.dir/DependInfo.cmake"
+  "bacnet/basic/object/bitstring_value/CMakeFiles/test_bitstring_value.dir/DependInfo.cmake"
+  "bacnet/basic/object/blo/CMakeFiles/test_blo.dir/DependInfo.cmake"
+  "bacnet/basic/object/bo/CMakeFiles/test_bo.dir/DependInfo.cmake"
+  "bacnet/basic/object/bv/CMakeFiles/test_bv.dir/DependInfo.cmake"
+  "bacnet/basic/object/channel/CMakeFiles/test_channel.dir/DependInfo.cmake"
+  "bacnet/basic/object/calendar/CMakeFiles/test_calendar.dir/DependInfo.cmake"
+  "bacnet/basic/object/color_object/CMakeFiles/test_color_object.dir/DependInfo.cmake"
+  "bacnet/basic/object/color_temperature/CMakeFiles/test_color_temperature.dir/DependInfo.cmake"
+  "bacnet/basic/object/command/CMakeFiles/test_command.dir/DependInfo.cmake"
+  "bacnet/basic/object/credential_data_input/CMakeFiles/test_credential_data_input.dir/DependInfo.cmake"
+  "bacnet/basic/object/csv/CMakeFiles/test_csv.dir/DependInfo.cmake"
+  "bacnet/basic/object/device/CMakeFiles/test_device.dir/DependInfo.cmake"
+  "bacnet/basic/object/iv/CMakeFiles/test_iv.dir/DependInfo.cmake"
+  "bacnet/basic/object/lc/CMakeFiles/test_lc.dir/DependInfo.cmake"
+  "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/DependInfo.cmake"
+  "bacnet/basic/object/lsp/CMakeFiles/test_lsp.dir/DependInfo.cmake"
+  "bacnet/basic/object/lsz/CMakeFiles/test_lsz.dir/DependInfo.cmake"
+  "bacnet/basic/object/ms-input/CMakeFiles/test_ms-input.dir/DependInfo.cmake"
+  "bacnet/basic/object/mso/CMakeFiles/test_mso.dir/DependInfo.cmake"
+  "bacnet/basic/object/msv/CMakeFiles/test_msv.dir/DependInfo.cmake"
+  "bacnet/basic/object/netport/CMakeFiles/test_netport.dir/DependInfo.cmake"
+  "bacnet/basic/object/nc/CMakeFiles/test_nc.dir/DependInfo.cmake"
+  "bacnet/basic/object/objects/CMakeFiles/test_objects.dir/DependInfo.cmake"
+  "bacnet/basic/object/osv/CMakeFiles/test_osv.dir/DependInfo.cmake"
+  "bacnet/basic/object/piv/CMakeFiles/test_piv.dir/DependInfo.cmake"
+  "bacnet/basic/object/schedule/CMakeFiles/test_schedule.dir/DependInfo.cmake"
+  "bacnet/basic/object/structured_view/CMakeFiles/test_structured_view.dir/DependInfo.cmake"
+  "bacnet/basic/object/time_value/CMakeFiles/test_time_value.dir/DependInfo.cmake"
+  "bacnet/basic/object/trendlog/CMakeFiles/test_trendlog.dir/DependInfo.cmake"
+  "bacnet/basic/service/h_rpm_a/CMakeFiles/test_h_rpm_a.dir/DependInfo.cmake"
+  "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/DependInfo.cmake"
+  "bacnet/basic/sys/bufpool/CMakeFiles/test_bufpool.dir/DependInfo.cmake"
+  "bacnet/basic/sys/color_rgb/CMakeFiles/test_color_rgb.dir/DependInfo.cmake"
+  "bacnet/basic/sys/commandable/CMakeFiles/test_commandable.dir/DependInfo.cmake"
+  "bacnet/basic/sys/days/CMakeFiles/test_days.dir/DependInfo.cmake"
+  "bacnet/basic/sys/fifo/CMakeFiles/test_fifo.dir/DependInfo.cmake"
+  "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/DependInfo.cmake"
+  "bacnet/basic/sys/keylist/CMakeFiles/test_keylist.dir/DependInfo.cmake"
+  "bacnet/basic/sys/linear/CMakeFiles/test_linear.dir/DependInfo.cmake"
+  "bacnet/basic/sys/propcache/CMakeFiles/test_propcache.dir/DependInfo.cmake"
+  "bacnet/basic/sys/ringbuf/CMakeFiles/test_ringbuf.dir/DependInfo.cmake"
+  "bacnet/basic/sys/sbuf/CMakeFiles/test_sbuf.dir/DependInfo.cmake"
+  "bacnet/basic/sys/tmwheel/CMakeFiles/test_tmwheel.dir/DependInfo.cmake"
+  "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/DependInfo.cmake"
+  "bacnet/datalink/automac/CMakeFiles/test_automac.dir/DependInfo.cmake"
+  "bacnet/datalink/cobs/CMakeFiles/test_cobs.dir/DependInfo.cmake"
+  "bacnet/datalink/crc/CMakeFiles/test_crc.dir/DependInfo.cmake"
+  "bacnet/datalink/bvlc/CMakeFiles/test_bvlc.dir/DependInfo.cmake"
+  "bacnet/datalink/loopback/CMakeFiles/test_loopback.dir/DependInfo.cmake"
+  "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/DependInfo.cmake"
+  "bacnet/datalink/dlmux/CMakeFiles/test_dlmux.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lcov"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/lcov.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
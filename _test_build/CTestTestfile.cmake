@@ -0,0 +1,586 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_test_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(build_bits "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bits")
+set_tests_properties(build_bits PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bits "unit/bacnet/bits/test_bits")
+set_tests_properties(test_bits PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_abort "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_abort")
+set_tests_properties(build_abort PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_abort "bacnet/abort/test_abort")
+set_tests_properties(test_abort PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_alarm_ack "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_alarm_ack")
+set_tests_properties(build_alarm_ack PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_alarm_ack "bacnet/alarm_ack/test_alarm_ack")
+set_tests_properties(test_alarm_ack PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_arf "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_arf")
+set_tests_properties(build_arf PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_arf "bacnet/arf/test_arf")
+set_tests_properties(test_arf PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_awf "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_awf")
+set_tests_properties(build_awf PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_awf "bacnet/awf/test_awf")
+set_tests_properties(test_awf PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacaddr "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacaddr")
+set_tests_properties(build_bacaddr PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacaddr "bacnet/bacaddr/test_bacaddr")
+set_tests_properties(test_bacaddr PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacapp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacapp")
+set_tests_properties(build_bacapp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacapp "bacnet/bacapp/test_bacapp")
+set_tests_properties(test_bacapp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacdcode "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacdcode")
+set_tests_properties(build_bacdcode PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacdcode "bacnet/bacdcode/test_bacdcode")
+set_tests_properties(test_bacdcode PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacdevobjpropref "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacdevobjpropref")
+set_tests_properties(build_bacdevobjpropref PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacdevobjpropref "bacnet/bacdevobjpropref/test_bacdevobjpropref")
+set_tests_properties(test_bacdevobjpropref PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacdest "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacdest")
+set_tests_properties(build_bacdest PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacdest "bacnet/bacdest/test_bacdest")
+set_tests_properties(test_bacdest PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacerror "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacerror")
+set_tests_properties(build_bacerror PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacerror "bacnet/bacerror/test_bacerror")
+set_tests_properties(test_bacerror PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacint "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacint")
+set_tests_properties(build_bacint PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacint "bacnet/bacint/test_bacint")
+set_tests_properties(test_bacint PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacpropstates "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacpropstates")
+set_tests_properties(build_bacpropstates PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacpropstates "bacnet/bacpropstates/test_bacpropstates")
+set_tests_properties(test_bacpropstates PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacreal "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacreal")
+set_tests_properties(build_bacreal PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacreal "bacnet/bacreal/test_bacreal")
+set_tests_properties(test_bacreal PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacstr "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacstr")
+set_tests_properties(build_bacstr PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacstr "bacnet/bacstr/test_bacstr")
+set_tests_properties(test_bacstr PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bactimevalue "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bactimevalue")
+set_tests_properties(build_bactimevalue PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bactimevalue "bacnet/bactimevalue/test_bactimevalue")
+set_tests_properties(test_bactimevalue PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_cov "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_cov")
+set_tests_properties(build_cov PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_cov "bacnet/cov/test_cov")
+set_tests_properties(test_cov PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_create_object "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_create_object")
+set_tests_properties(build_create_object PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_create_object "bacnet/create_object/test_create_object")
+set_tests_properties(test_create_object PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_datetime "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_datetime")
+set_tests_properties(build_datetime PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_datetime "bacnet/datetime/test_datetime")
+set_tests_properties(test_datetime PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_dcc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_dcc")
+set_tests_properties(build_dcc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_dcc "bacnet/dcc/test_dcc")
+set_tests_properties(test_dcc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_delete_object "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_delete_object")
+set_tests_properties(build_delete_object PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_delete_object "bacnet/delete_object/test_delete_object")
+set_tests_properties(test_delete_object PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_event "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_event")
+set_tests_properties(build_event PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_event "bacnet/event/test_event")
+set_tests_properties(test_event PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_getalarm "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_getalarm")
+set_tests_properties(build_getalarm PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_getalarm "bacnet/getalarm/test_getalarm")
+set_tests_properties(test_getalarm PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_getevent "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_getevent")
+set_tests_properties(build_getevent PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_getevent "bacnet/getevent/test_getevent")
+set_tests_properties(test_getevent PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_hostnport "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_hostnport")
+set_tests_properties(build_hostnport PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_hostnport "bacnet/hostnport/test_hostnport")
+set_tests_properties(test_hostnport PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_iam "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_iam")
+set_tests_properties(build_iam PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_iam "bacnet/iam/test_iam")
+set_tests_properties(test_iam PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ihave "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ihave")
+set_tests_properties(build_ihave PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ihave "bacnet/ihave/test_ihave")
+set_tests_properties(test_ihave PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_indtext "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_indtext")
+set_tests_properties(build_indtext PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_indtext "bacnet/indtext/test_indtext")
+set_tests_properties(test_indtext PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lighting "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lighting")
+set_tests_properties(build_lighting PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lighting "bacnet/lighting/test_lighting")
+set_tests_properties(test_lighting PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_list_element "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_list_element")
+set_tests_properties(build_list_element PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_list_element "bacnet/list_element/test_list_element")
+set_tests_properties(test_list_element PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lso "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lso")
+set_tests_properties(build_lso PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lso "bacnet/lso/test_lso")
+set_tests_properties(test_lso PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_memcopy "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_memcopy")
+set_tests_properties(build_memcopy PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_memcopy "bacnet/memcopy/test_memcopy")
+set_tests_properties(test_memcopy PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_npdu "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_npdu")
+set_tests_properties(build_npdu PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_npdu "bacnet/npdu/test_npdu")
+set_tests_properties(test_npdu PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_property "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_property")
+set_tests_properties(build_property PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_property "bacnet/property/test_property")
+set_tests_properties(test_property PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ptransfer "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ptransfer")
+set_tests_properties(build_ptransfer PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ptransfer "bacnet/ptransfer/test_ptransfer")
+set_tests_properties(test_ptransfer PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_rd "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_rd")
+set_tests_properties(build_rd PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_rd "bacnet/rd/test_rd")
+set_tests_properties(test_rd PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_reject "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_reject")
+set_tests_properties(build_reject PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_reject "bacnet/reject/test_reject")
+set_tests_properties(test_reject PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_rp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_rp")
+set_tests_properties(build_rp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_rp "bacnet/rp/test_rp")
+set_tests_properties(test_rp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_rpm "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_rpm")
+set_tests_properties(build_rpm PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_rpm "bacnet/rpm/test_rpm")
+set_tests_properties(test_rpm PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_specialevent "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_specialevent")
+set_tests_properties(build_specialevent PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_specialevent "bacnet/specialevent/test_specialevent")
+set_tests_properties(test_specialevent PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_timestamp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_timestamp")
+set_tests_properties(build_timestamp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_timestamp "bacnet/timestamp/test_timestamp")
+set_tests_properties(test_timestamp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_timesync "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_timesync")
+set_tests_properties(build_timesync PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_timesync "bacnet/timesync/test_timesync")
+set_tests_properties(test_timesync PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_whohas "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_whohas")
+set_tests_properties(build_whohas PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_whohas "bacnet/whohas/test_whohas")
+set_tests_properties(test_whohas PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_whois "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_whois")
+set_tests_properties(build_whois PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_whois "bacnet/whois/test_whois")
+set_tests_properties(test_whois PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_wp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_wp")
+set_tests_properties(build_wp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_wp "bacnet/wp/test_wp")
+set_tests_properties(test_wp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_wpm "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_wpm")
+set_tests_properties(build_wpm PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_wpm "bacnet/wpm/test_wpm")
+set_tests_properties(test_wpm PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_weeklyschedule "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_weeklyschedule")
+set_tests_properties(build_weeklyschedule PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_weeklyschedule "bacnet/weeklyschedule/test_weeklyschedule")
+set_tests_properties(test_weeklyschedule PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_address "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_address")
+set_tests_properties(build_address PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_address "bacnet/basic/binding/address/test_address")
+set_tests_properties(test_address PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bbmd "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bbmd")
+set_tests_properties(build_bbmd PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bbmd "bacnet/basic/bbmd/test_bbmd")
+set_tests_properties(test_bbmd PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bbmd6 "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bbmd6")
+set_tests_properties(build_bbmd6 PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bbmd6 "bacnet/basic/bbmd6/test_bbmd6")
+set_tests_properties(test_bbmd6 PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bac-data "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bac-data")
+set_tests_properties(build_bac-data PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bac-data "bacnet/basic/client/bac-data/test_bac-data")
+set_tests_properties(test_bac-data PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bac-discover "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bac-discover")
+set_tests_properties(build_bac-discover PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bac-discover "bacnet/basic/client/bac-discover/test_bac-discover")
+set_tests_properties(test_bac-discover PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bac-rw "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bac-rw")
+set_tests_properties(build_bac-rw PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bac-rw "bacnet/basic/client/bac-rw/test_bac-rw")
+set_tests_properties(test_bac-rw PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_acc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_acc")
+set_tests_properties(build_acc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_acc "bacnet/basic/object/acc/test_acc")
+set_tests_properties(test_acc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_credential "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_credential")
+set_tests_properties(build_access_credential PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_credential "bacnet/basic/object/access_credential/test_access_credential")
+set_tests_properties(test_access_credential PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_door "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_door")
+set_tests_properties(build_access_door PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_door "bacnet/basic/object/access_door/test_access_door")
+set_tests_properties(test_access_door PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_point "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_point")
+set_tests_properties(build_access_point PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_point "bacnet/basic/object/access_point/test_access_point")
+set_tests_properties(test_access_point PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_rights "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_rights")
+set_tests_properties(build_access_rights PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_rights "bacnet/basic/object/access_rights/test_access_rights")
+set_tests_properties(test_access_rights PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_user "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_user")
+set_tests_properties(build_access_user PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_user "bacnet/basic/object/access_user/test_access_user")
+set_tests_properties(test_access_user PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_access_zone "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_access_zone")
+set_tests_properties(build_access_zone PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_access_zone "bacnet/basic/object/access_zone/test_access_zone")
+set_tests_properties(test_access_zone PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ai "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ai")
+set_tests_properties(build_ai PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ai "bacnet/basic/object/ai/test_ai")
+set_tests_properties(test_ai PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ao "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ao")
+set_tests_properties(build_ao PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ao "bacnet/basic/object/ao/test_ao")
+set_tests_properties(test_ao PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_av "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_av")
+set_tests_properties(build_av PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_av "bacnet/basic/object/av/test_av")
+set_tests_properties(test_av PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bacfile "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bacfile")
+set_tests_properties(build_bacfile PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bacfile "bacnet/basic/object/bacfile/test_bacfile")
+set_tests_properties(test_bacfile PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bi "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bi")
+set_tests_properties(build_bi PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bi "bacnet/basic/object/bi/test_bi")
+set_tests_properties(test_bi PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bitstring_value "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bitstring_value")
+set_tests_properties(build_bitstring_value PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bitstring_value "bacnet/basic/object/bitstring_value/test_bitstring_value")
+set_tests_properties(test_bitstring_value PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_blo "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_blo")
+set_tests_properties(build_blo PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_blo "bacnet/basic/object/blo/test_blo")
+set_tests_properties(test_blo PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bo "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bo")
+set_tests_properties(build_bo PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bo "bacnet/basic/object/bo/test_bo")
+set_tests_properties(test_bo PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bv")
+set_tests_properties(build_bv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bv "bacnet/basic/object/bv/test_bv")
+set_tests_properties(test_bv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_channel "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_channel")
+set_tests_properties(build_channel PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_channel "bacnet/basic/object/channel/test_channel")
+set_tests_properties(test_channel PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_calendar "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_calendar")
+set_tests_properties(build_calendar PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_calendar "bacnet/basic/object/calendar/test_calendar")
+set_tests_properties(test_calendar PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_color_object "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_color_object")
+set_tests_properties(build_color_object PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_color_object "bacnet/basic/object/color_object/test_color_object")
+set_tests_properties(test_color_object PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_color_temperature "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_color_temperature")
+set_tests_properties(build_color_temperature PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_color_temperature "bacnet/basic/object/color_temperature/test_color_temperature")
+set_tests_properties(test_color_temperature PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_command "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_command")
+set_tests_properties(build_command PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_command "bacnet/basic/object/command/test_command")
+set_tests_properties(test_command PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_credential_data_input "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_credential_data_input")
+set_tests_properties(build_credential_data_input PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_credential_data_input "bacnet/basic/object/credential_data_input/test_credential_data_input")
+set_tests_properties(test_credential_data_input PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_csv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_csv")
+set_tests_properties(build_csv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_csv "bacnet/basic/object/csv/test_csv")
+set_tests_properties(test_csv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_device "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_device")
+set_tests_properties(build_device PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_device "bacnet/basic/object/device/test_device")
+set_tests_properties(test_device PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_iv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_iv")
+set_tests_properties(build_iv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_iv "bacnet/basic/object/iv/test_iv")
+set_tests_properties(test_iv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lc")
+set_tests_properties(build_lc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lc "bacnet/basic/object/lc/test_lc")
+set_tests_properties(test_lc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lo "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lo")
+set_tests_properties(build_lo PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lo "bacnet/basic/object/lo/test_lo")
+set_tests_properties(test_lo PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lsp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lsp")
+set_tests_properties(build_lsp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lsp "bacnet/basic/object/lsp/test_lsp")
+set_tests_properties(test_lsp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_lsz "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_lsz")
+set_tests_properties(build_lsz PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_lsz "bacnet/basic/object/lsz/test_lsz")
+set_tests_properties(test_lsz PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ms-input "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ms-input")
+set_tests_properties(build_ms-input PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ms-input "bacnet/basic/object/ms-input/test_ms-input")
+set_tests_properties(test_ms-input PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_mso "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_mso")
+set_tests_properties(build_mso PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_mso "bacnet/basic/object/mso/test_mso")
+set_tests_properties(test_mso PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_msv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_msv")
+set_tests_properties(build_msv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_msv "bacnet/basic/object/msv/test_msv")
+set_tests_properties(test_msv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_netport "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_netport")
+set_tests_properties(build_netport PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_netport "bacnet/basic/object/netport/test_netport")
+set_tests_properties(test_netport PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_nc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_nc")
+set_tests_properties(build_nc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_nc "bacnet/basic/object/nc/test_nc")
+set_tests_properties(test_nc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_objects "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_objects")
+set_tests_properties(build_objects PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_objects "bacnet/basic/object/objects/test_objects")
+set_tests_properties(test_objects PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_osv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_osv")
+set_tests_properties(build_osv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_osv "bacnet/basic/object/osv/test_osv")
+set_tests_properties(test_osv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_piv "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_piv")
+set_tests_properties(build_piv PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_piv "bacnet/basic/object/piv/test_piv")
+set_tests_properties(test_piv PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_schedule "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_schedule")
+set_tests_properties(build_schedule PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_schedule "bacnet/basic/object/schedule/test_schedule")
+set_tests_properties(test_schedule PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_structured_view "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_structured_view")
+set_tests_properties(build_structured_view PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_structured_view "bacnet/basic/object/structured_view/test_structured_view")
+set_tests_properties(test_structured_view PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_time_value "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_time_value")
+set_tests_properties(build_time_value PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_time_value "bacnet/basic/object/time_value/test_time_value")
+set_tests_properties(test_time_value PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_trendlog "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_trendlog")
+set_tests_properties(build_trendlog PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_trendlog "bacnet/basic/object/trendlog/test_trendlog")
+set_tests_properties(test_trendlog PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_h_rpm_a "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_h_rpm_a")
+set_tests_properties(build_h_rpm_a PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_h_rpm_a "bacnet/basic/service/h_rpm_a/test_h_rpm_a")
+set_tests_properties(test_h_rpm_a PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_h_whois "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_h_whois")
+set_tests_properties(build_h_whois PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_h_whois "bacnet/basic/service/h_whois/test_h_whois")
+set_tests_properties(test_h_whois PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bufpool "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bufpool")
+set_tests_properties(build_bufpool PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bufpool "bacnet/basic/sys/bufpool/test_bufpool")
+set_tests_properties(test_bufpool PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_color_rgb "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_color_rgb")
+set_tests_properties(build_color_rgb PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_color_rgb "bacnet/basic/sys/color_rgb/test_color_rgb")
+set_tests_properties(test_color_rgb PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_commandable "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_commandable")
+set_tests_properties(build_commandable PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_commandable "bacnet/basic/sys/commandable/test_commandable")
+set_tests_properties(test_commandable PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_days "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_days")
+set_tests_properties(build_days PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_days "bacnet/basic/sys/days/test_days")
+set_tests_properties(test_days PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_fifo "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_fifo")
+set_tests_properties(build_fifo PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_fifo "bacnet/basic/sys/fifo/test_fifo")
+set_tests_properties(test_fifo PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_filename "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_filename")
+set_tests_properties(build_filename PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_filename "bacnet/basic/sys/filename/test_filename")
+set_tests_properties(test_filename PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_keylist "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_keylist")
+set_tests_properties(build_keylist PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_keylist "bacnet/basic/sys/keylist/test_keylist")
+set_tests_properties(test_keylist PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_linear "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_linear")
+set_tests_properties(build_linear PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_linear "bacnet/basic/sys/linear/test_linear")
+set_tests_properties(test_linear PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_propcache "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_propcache")
+set_tests_properties(build_propcache PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_propcache "bacnet/basic/sys/propcache/test_propcache")
+set_tests_properties(test_propcache PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_ringbuf "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_ringbuf")
+set_tests_properties(build_ringbuf PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_ringbuf "bacnet/basic/sys/ringbuf/test_ringbuf")
+set_tests_properties(test_ringbuf PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_sbuf "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_sbuf")
+set_tests_properties(build_sbuf PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_sbuf "bacnet/basic/sys/sbuf/test_sbuf")
+set_tests_properties(test_sbuf PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_tmwheel "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_tmwheel")
+set_tests_properties(build_tmwheel PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_tmwheel "bacnet/basic/sys/tmwheel/test_tmwheel")
+set_tests_properties(test_tmwheel PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_tsm "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_tsm")
+set_tests_properties(build_tsm PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_tsm "bacnet/basic/tsm/test_tsm")
+set_tests_properties(test_tsm PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_automac "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_automac")
+set_tests_properties(build_automac PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_automac "bacnet/datalink/automac/test_automac")
+set_tests_properties(test_automac PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_cobs "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_cobs")
+set_tests_properties(build_cobs PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_cobs "bacnet/datalink/cobs/test_cobs")
+set_tests_properties(test_cobs PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_crc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_crc")
+set_tests_properties(build_crc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_crc "bacnet/datalink/crc/test_crc")
+set_tests_properties(test_crc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_bvlc "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_bvlc")
+set_tests_properties(build_bvlc PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_bvlc "bacnet/datalink/bvlc/test_bvlc")
+set_tests_properties(test_bvlc PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_loopback "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_loopback")
+set_tests_properties(build_loopback PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_loopback "bacnet/datalink/loopback/test_loopback")
+set_tests_properties(test_loopback PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_mstp "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_mstp")
+set_tests_properties(build_mstp PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_mstp "bacnet/datalink/mstp/test_mstp")
+set_tests_properties(test_mstp PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(build_dlmux "/usr/bin/cmake" "--build" "/root/repo/_test_build" "--config" "$<CONFIG>" "--target" "test_dlmux")
+set_tests_properties(build_dlmux PROPERTIES  FIXTURES_SETUP "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;196;add_test;/root/repo/test/CMakeLists.txt;0;")
+add_test(test_dlmux "bacnet/datalink/dlmux/test_dlmux")
+set_tests_properties(test_dlmux PROPERTIES  FIXTURES_REQUIRED "test_fixture" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;202;add_test;/root/repo/test/CMakeLists.txt;0;")
+subdirs("unit/bacnet/bits")
+subdirs("bacnet/abort")
+subdirs("bacnet/alarm_ack")
+subdirs("bacnet/arf")
+subdirs("bacnet/awf")
+subdirs("bacnet/bacaddr")
+subdirs("bacnet/bacapp")
+subdirs("bacnet/bacdcode")
+subdirs("bacnet/bacdevobjpropref")
+subdirs("bacnet/bacdest")
+subdirs("bacnet/bacerror")
+subdirs("bacnet/bacint")
+subdirs("bacnet/bacpropstates")
+subdirs("bacnet/bacreal")
+subdirs("bacnet/bacstr")
+subdirs("bacnet/bactimevalue")
+subdirs("bacnet/cov")
+subdirs("bacnet/create_object")
+subdirs("bacnet/datetime")
+subdirs("bacnet/dcc")
+subdirs("bacnet/delete_object")
+subdirs("bacnet/event")
+subdirs("bacnet/getalarm")
+subdirs("bacnet/getevent")
+subdirs("bacnet/hostnport")
+subdirs("bacnet/iam")
+subdirs("bacnet/ihave")
+subdirs("bacnet/indtext")
+subdirs("bacnet/lighting")
+subdirs("bacnet/list_element")
+subdirs("bacnet/lso")
+subdirs("bacnet/memcopy")
+subdirs("bacnet/npdu")
+subdirs("bacnet/property")
+subdirs("bacnet/ptransfer")
+subdirs("bacnet/rd")
+subdirs("bacnet/reject")
+subdirs("bacnet/rp")
+subdirs("bacnet/rpm")
+subdirs("bacnet/specialevent")
+subdirs("bacnet/timestamp")
+subdirs("bacnet/timesync")
+subdirs("bacnet/whohas")
+subdirs("bacnet/whois")
+subdirs("bacnet/wp")
+subdirs("bacnet/wpm")
+subdirs("bacnet/weeklyschedule")
+subdirs("bacnet/basic/binding/address")
+subdirs("bacnet/basic/bbmd")
+subdirs("bacnet/basic/bbmd6")
+subdirs("bacnet/basic/client/bac-data")
+subdirs("bacnet/basic/client/bac-discover")
+subdirs("bacnet/basic/client/bac-rw")
+subdirs("bacnet/basic/object/acc")
+subdirs("bacnet/basic/object/access_credential")
+subdirs("bacnet/basic/object/access_door")
+subdirs("bacnet/basic/object/access_point")
+subdirs("bacnet/basic/object/access_rights")
+subdirs("bacnet/basic/object/access_user")
+subdirs("bacnet/basic/object/access_zone")
+subdirs("bacnet/basic/object/ai")
+subdirs("bacnet/basic/object/ao")
+subdirs("bacnet/basic/object/av")
+subdirs("bacnet/basic/object/bacfile")
+subdirs("bacnet/basic/object/bi")
+subdirs("bacnet/basic/object/bitstring_value")
+subdirs("bacnet/basic/object/blo")
+subdirs("bacnet/basic/object/bo")
+subdirs("bacnet/basic/object/bv")
+subdirs("bacnet/basic/object/channel")
+subdirs("bacnet/basic/object/calendar")
+subdirs("bacnet/basic/object/color_object")
+subdirs("bacnet/basic/object/color_temperature")
+subdirs("bacnet/basic/object/command")
+subdirs("bacnet/basic/object/credential_data_input")
+subdirs("bacnet/basic/object/csv")
+subdirs("bacnet/basic/object/device")
+subdirs("bacnet/basic/object/iv")
+subdirs("bacnet/basic/object/lc")
+subdirs("bacnet/basic/object/lo")
+subdirs("bacnet/basic/object/lsp")
+subdirs("bacnet/basic/object/lsz")
+subdirs("bacnet/basic/object/ms-input")
+subdirs("bacnet/basic/object/mso")
+subdirs("bacnet/basic/object/msv")
+subdirs("bacnet/basic/object/netport")
+subdirs("bacnet/basic/object/nc")
+subdirs("bacnet/basic/object/objects")
+subdirs("bacnet/basic/object/osv")
+subdirs("bacnet/basic/object/piv")
+subdirs("bacnet/basic/object/schedule")
+subdirs("bacnet/basic/object/structured_view")
+subdirs("bacnet/basic/object/time_value")
+subdirs("bacnet/basic/object/trendlog")
+subdirs("bacnet/basic/service/h_rpm_a")
+subdirs("bacnet/basic/service/h_whois")
+subdirs("bacnet/basic/sys/bufpool")
+subdirs("bacnet/basic/sys/color_rgb")
+subdirs("bacnet/basic/sys/commandable")
+subdirs("bacnet/basic/sys/days")
+subdirs("bacnet/basic/sys/fifo")
+subdirs("bacnet/basic/sys/filename")
+subdirs("bacnet/basic/sys/keylist")
+subdirs("bacnet/basic/sys/linear")
+subdirs("bacnet/basic/sys/propcache")
+subdirs("bacnet/basic/sys/ringbuf")
+subdirs("bacnet/basic/sys/sbuf")
+subdirs("bacnet/basic/sys/tmwheel")
+subdirs("bacnet/basic/tsm")
+subdirs("bacnet/datalink/automac")
+subdirs("bacnet/datalink/cobs")
+subdirs("bacnet/datalink/crc")
+subdirs("bacnet/datalink/bvlc")
+subdirs("bacnet/datalink/loopback")
+subdirs("bacnet/datalink/mstp")
+subdirs("bacnet/datalink/dlmux")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_abort.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_abort.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_abort.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_abort.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_abort.dir/root/repo/src/bacnet/abort.c.o"
+  "CMakeFiles/test_abort.dir/root/repo/src/bacnet/abort.c.o.d"
+  "CMakeFiles/test_abort.dir/src/main.c.o"
+  "CMakeFiles/test_abort.dir/src/main.c.o.d"
+  "test_abort"
+  "test_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
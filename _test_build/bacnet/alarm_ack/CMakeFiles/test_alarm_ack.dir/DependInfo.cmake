@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/alarm_ack.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/alarm_ack.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/alarm_ack.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/days.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/basic/sys/days.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "/root/repo/src/bacnet/datetime.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/datetime.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "/root/repo/src/bacnet/timestamp.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/timestamp.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "/root/repo/test/bacnet/alarm_ack/src/main.c" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/src/main.c.o" "gcc" "bacnet/alarm_ack/CMakeFiles/test_alarm_ack.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bacaddr.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bacaddr.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bacaddr.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacaddr.c.o"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bacaddr.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bacaddr.dir/src/main.c.o"
+  "CMakeFiles/test_bacaddr.dir/src/main.c.o.d"
+  "test_bacaddr"
+  "test_bacaddr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bacaddr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
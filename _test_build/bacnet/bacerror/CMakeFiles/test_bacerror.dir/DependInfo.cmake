@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/test/bacnet/bacerror/src/main.c" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/src/main.c.o" "gcc" "bacnet/bacerror/CMakeFiles/test_bacerror.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
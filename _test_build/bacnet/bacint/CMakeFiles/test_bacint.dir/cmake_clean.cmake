@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bacint.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bacint.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bacint.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bacint.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bacint.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_bacint.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_bacint.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bacint.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bacint.dir/src/main.c.o"
+  "CMakeFiles/test_bacint.dir/src/main.c.o.d"
+  "test_bacint"
+  "test_bacint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bacint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
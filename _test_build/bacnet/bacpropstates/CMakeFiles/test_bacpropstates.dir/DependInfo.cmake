@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacpropstates.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacpropstates.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacpropstates.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/test/bacnet/bacpropstates/src/main.c" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/src/main.c.o" "gcc" "bacnet/bacpropstates/CMakeFiles/test_bacpropstates.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bacreal.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bacreal.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bacreal.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bacreal.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_bacreal.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_bacreal.dir/src/main.c.o"
+  "CMakeFiles/test_bacreal.dir/src/main.c.o.d"
+  "test_bacreal"
+  "test_bacreal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bacreal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bacstr.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bacstr.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bacstr.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bacstr.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bacstr.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bacstr.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bacstr.dir/src/main.c.o"
+  "CMakeFiles/test_bacstr.dir/src/main.c.o.d"
+  "test_bacstr"
+  "test_bacstr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bacstr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/bbmd/h_bbmd.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/bbmd/h_bbmd.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/bbmd/h_bbmd.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/debug.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/debug.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/debug.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/keylist.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/keylist.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "/root/repo/src/bacnet/datalink/bvlc.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/datalink/bvlc.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/datalink/bvlc.c.o.d"
+  "/root/repo/src/bacnet/hostnport.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/hostnport.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "/root/repo/src/bacnet/iam.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/iam.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/iam.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/test/bacnet/basic/bbmd/src/main.c" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/src/main.c.o" "gcc" "bacnet/basic/bbmd/CMakeFiles/test_bbmd.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/bbmd6/h_bbmd6.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/bbmd6/h_bbmd6.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/bbmd6/vmac.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/bbmd6/vmac.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/debug.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/debug.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/keylist.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/datalink/bvlc6.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/datalink/bvlc6.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/iam.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/iam.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/npdu.c.o"
+  "CMakeFiles/test_bbmd6.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "CMakeFiles/test_bbmd6.dir/src/main.c.o"
+  "CMakeFiles/test_bbmd6.dir/src/main.c.o.d"
+  "test_bbmd6"
+  "test_bbmd6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bbmd6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
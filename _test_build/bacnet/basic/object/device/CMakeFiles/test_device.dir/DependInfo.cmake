@@ -0,0 +1,98 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/abort.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/abort.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/abort.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacapp.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacapp.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacdest.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdest.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "/root/repo/src/bacnet/bacdevobjpropref.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdevobjpropref.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/bactext.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bactext.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "/root/repo/src/bacnet/bactimevalue.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bactimevalue.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "/root/repo/src/bacnet/basic/binding/address.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/binding/address.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/binding/address.c.o.d"
+  "/root/repo/src/bacnet/basic/object/acc.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/acc.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/acc.c.o.d"
+  "/root/repo/src/bacnet/basic/object/ai.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ai.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ai.c.o.d"
+  "/root/repo/src/bacnet/basic/object/ao.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ao.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ao.c.o.d"
+  "/root/repo/src/bacnet/basic/object/av.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/av.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/av.c.o.d"
+  "/root/repo/src/bacnet/basic/object/bi.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bi.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bi.c.o.d"
+  "/root/repo/src/bacnet/basic/object/bitstring_value.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bitstring_value.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bitstring_value.c.o.d"
+  "/root/repo/src/bacnet/basic/object/blo.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/blo.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/blo.c.o.d"
+  "/root/repo/src/bacnet/basic/object/bo.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bo.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bo.c.o.d"
+  "/root/repo/src/bacnet/basic/object/bv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/calendar.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/calendar.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/calendar.c.o.d"
+  "/root/repo/src/bacnet/basic/object/channel.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/channel.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/channel.c.o.d"
+  "/root/repo/src/bacnet/basic/object/color_object.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_object.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_object.c.o.d"
+  "/root/repo/src/bacnet/basic/object/color_temperature.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_temperature.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_temperature.c.o.d"
+  "/root/repo/src/bacnet/basic/object/command.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/command.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/command.c.o.d"
+  "/root/repo/src/bacnet/basic/object/csv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/csv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/csv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/device.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/device.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/device.c.o.d"
+  "/root/repo/src/bacnet/basic/object/iv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/iv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/iv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/lc.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lc.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lc.c.o.d"
+  "/root/repo/src/bacnet/basic/object/lo.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lo.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lo.c.o.d"
+  "/root/repo/src/bacnet/basic/object/lsp.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsp.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsp.c.o.d"
+  "/root/repo/src/bacnet/basic/object/lsz.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsz.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsz.c.o.d"
+  "/root/repo/src/bacnet/basic/object/ms-input.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ms-input.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ms-input.c.o.d"
+  "/root/repo/src/bacnet/basic/object/mso.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/mso.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/mso.c.o.d"
+  "/root/repo/src/bacnet/basic/object/msv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/msv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/msv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/netport.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/netport.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/netport.c.o.d"
+  "/root/repo/src/bacnet/basic/object/osv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/osv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/osv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/piv.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/piv.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/piv.c.o.d"
+  "/root/repo/src/bacnet/basic/object/schedule.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/schedule.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/schedule.c.o.d"
+  "/root/repo/src/bacnet/basic/object/structured_view.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/structured_view.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/structured_view.c.o.d"
+  "/root/repo/src/bacnet/basic/object/time_value.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/time_value.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/time_value.c.o.d"
+  "/root/repo/src/bacnet/basic/object/trendlog.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/trendlog.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/trendlog.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_apdu.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_cov.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_cov.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_cov.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_wp.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_wp.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_wp.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bufpool.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/commandable.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/commandable.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/commandable.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/days.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/days.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/debug.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/debug.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/debug.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/keylist.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/keylist.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/linear.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/linear.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/linear.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/propcache.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/propcache.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/propcache.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/tmwheel.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "/root/repo/src/bacnet/basic/tsm/tsm.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o.d"
+  "/root/repo/src/bacnet/calendar_entry.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/calendar_entry.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "/root/repo/src/bacnet/cov.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/cov.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/cov.c.o.d"
+  "/root/repo/src/bacnet/dailyschedule.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/dailyschedule.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "/root/repo/src/bacnet/datalink/bvlc.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/datalink/bvlc.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/datalink/bvlc.c.o.d"
+  "/root/repo/src/bacnet/datetime.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/datetime.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "/root/repo/src/bacnet/dcc.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/dcc.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/dcc.c.o.d"
+  "/root/repo/src/bacnet/hostnport.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/hostnport.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/lighting.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/lighting.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "/root/repo/src/bacnet/memcopy.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/memcopy.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/memcopy.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/src/bacnet/property.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/property.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/property.c.o.d"
+  "/root/repo/src/bacnet/proplist.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/proplist.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/proplist.c.o.d"
+  "/root/repo/src/bacnet/reject.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/reject.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/reject.c.o.d"
+  "/root/repo/src/bacnet/special_event.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/special_event.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "/root/repo/src/bacnet/timestamp.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/timestamp.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "/root/repo/src/bacnet/weeklyschedule.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/weeklyschedule.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "/root/repo/src/bacnet/wp.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/wp.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/wp.c.o.d"
+  "/root/repo/src/bacnet/wpm.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/wpm.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/root/repo/src/bacnet/wpm.c.o.d"
+  "/root/repo/test/bacnet/basic/object/device/src/main.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/src/main.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/src/main.c.o.d"
+  "/root/repo/test/bacnet/basic/object/device/stubs.c" "bacnet/basic/object/device/CMakeFiles/test_device.dir/stubs.c.o" "gcc" "bacnet/basic/object/device/CMakeFiles/test_device.dir/stubs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
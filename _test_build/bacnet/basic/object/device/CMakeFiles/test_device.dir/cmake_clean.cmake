@@ -0,0 +1,169 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_device.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/abort.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/abort.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacaddr.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacapp.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdest.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdevobjpropref.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacerror.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bactext.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bactimevalue.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/binding/address.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/binding/address.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/acc.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/acc.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ai.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ai.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ao.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ao.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/av.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/av.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bi.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bi.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bitstring_value.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bitstring_value.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/blo.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/blo.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bo.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bo.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/bv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/calendar.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/calendar.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/channel.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/channel.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_object.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_object.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_temperature.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/color_temperature.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/command.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/command.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/csv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/csv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/device.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/device.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/iv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/iv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lc.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lc.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lo.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lo.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsp.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsp.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsz.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/lsz.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ms-input.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/ms-input.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/mso.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/mso.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/msv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/msv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/netport.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/netport.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/osv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/osv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/piv.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/piv.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/schedule.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/schedule.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/structured_view.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/structured_view.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/time_value.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/time_value.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/trendlog.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/object/trendlog.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_cov.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_cov.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_wp.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/service/h_wp.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/commandable.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/commandable.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/days.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/debug.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/debug.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/keylist.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/linear.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/linear.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/propcache.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/propcache.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/calendar_entry.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/cov.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/cov.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/dailyschedule.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/datalink/bvlc.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/datalink/bvlc.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/datetime.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/dcc.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/dcc.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/hostnport.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/lighting.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/memcopy.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/memcopy.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/npdu.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/property.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/property.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/proplist.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/proplist.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/reject.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/reject.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/special_event.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/timestamp.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/weeklyschedule.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/wp.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/wp.c.o.d"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/wpm.c.o"
+  "CMakeFiles/test_device.dir/root/repo/src/bacnet/wpm.c.o.d"
+  "CMakeFiles/test_device.dir/src/main.c.o"
+  "CMakeFiles/test_device.dir/src/main.c.o.d"
+  "CMakeFiles/test_device.dir/stubs.c.o"
+  "CMakeFiles/test_device.dir/stubs.c.o.d"
+  "test_device"
+  "test_device.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
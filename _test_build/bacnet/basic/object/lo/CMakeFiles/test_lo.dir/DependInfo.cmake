@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/test/bacnet/basic/object/mock/device_mock.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/mock/device_mock.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/__/mock/device_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacapp.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacapp.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacdest.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdest.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "/root/repo/src/bacnet/bacdevobjpropref.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdevobjpropref.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/bactext.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bactext.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "/root/repo/src/bacnet/bactimevalue.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bactimevalue.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "/root/repo/src/bacnet/basic/object/lo.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/object/lo.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/object/lo.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/color_rgb.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/color_rgb.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/color_rgb.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/commandable.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/commandable.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/commandable.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/days.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/days.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/keylist.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/keylist.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/linear.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/linear.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/linear.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/tmwheel.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "/root/repo/src/bacnet/calendar_entry.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/calendar_entry.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "/root/repo/src/bacnet/dailyschedule.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/dailyschedule.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "/root/repo/src/bacnet/datetime.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/datetime.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "/root/repo/src/bacnet/hostnport.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/hostnport.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/lighting.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/lighting.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "/root/repo/src/bacnet/special_event.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/special_event.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "/root/repo/src/bacnet/timestamp.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/timestamp.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "/root/repo/src/bacnet/weeklyschedule.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/weeklyschedule.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "/root/repo/src/bacnet/wp.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/wp.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/root/repo/src/bacnet/wp.c.o.d"
+  "/root/repo/test/bacnet/basic/object/lo/src/main.c" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/src/main.c.o" "gcc" "bacnet/basic/object/lo/CMakeFiles/test_lo.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_objects.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_objects.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_objects.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_objects.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_objects.dir/root/repo/src/bacnet/basic/object/objects.c.o"
+  "CMakeFiles/test_objects.dir/root/repo/src/bacnet/basic/object/objects.c.o.d"
+  "CMakeFiles/test_objects.dir/root/repo/src/bacnet/basic/sys/keylist.c.o"
+  "CMakeFiles/test_objects.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "CMakeFiles/test_objects.dir/src/main.c.o"
+  "CMakeFiles/test_objects.dir/src/main.c.o.d"
+  "test_objects"
+  "test_objects.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_objects.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_trendlog.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_trendlog.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_trendlog.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_trendlog.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_trendlog.dir/__/mock/device_mock.c.o"
+  "CMakeFiles/test_trendlog.dir/__/mock/device_mock.c.o.d"
+  "CMakeFiles/test_trendlog.dir/__/property_test.c.o"
+  "CMakeFiles/test_trendlog.dir/__/property_test.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacaddr.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacapp.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdest.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdevobjpropref.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bactext.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bactimevalue.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/object/trendlog.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/object/trendlog.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/sys/days.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/calendar_entry.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/dailyschedule.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/datetime.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/hostnport.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/lighting.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/proplist.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/proplist.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/special_event.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/timestamp.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/weeklyschedule.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/wp.c.o"
+  "CMakeFiles/test_trendlog.dir/root/repo/src/bacnet/wp.c.o.d"
+  "CMakeFiles/test_trendlog.dir/src/main.c.o"
+  "CMakeFiles/test_trendlog.dir/src/main.c.o.d"
+  "test_trendlog"
+  "test_trendlog.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_trendlog.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
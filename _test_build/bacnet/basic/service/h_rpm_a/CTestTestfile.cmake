@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/bacnet/basic/service/h_rpm_a
+# Build directory: /root/repo/_test_build/bacnet/basic/service/h_rpm_a
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/__/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/__/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_whois.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/service/h_whois.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/service/h_whois.c.o.d"
+  "/root/repo/src/bacnet/basic/service/s_iam.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/service/s_iam.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/service/s_iam.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/iam.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/iam.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/iam.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/src/bacnet/whois.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/whois.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/root/repo/src/bacnet/whois.c.o.d"
+  "/root/repo/test/bacnet/basic/service/h_whois/src/main.c" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/src/main.c.o" "gcc" "bacnet/basic/service/h_whois/CMakeFiles/test_h_whois.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
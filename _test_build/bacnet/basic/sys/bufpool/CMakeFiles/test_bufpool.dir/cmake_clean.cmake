@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bufpool.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bufpool.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bufpool.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bufpool.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bufpool.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o"
+  "CMakeFiles/test_bufpool.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "CMakeFiles/test_bufpool.dir/src/main.c.o"
+  "CMakeFiles/test_bufpool.dir/src/main.c.o.d"
+  "test_bufpool"
+  "test_bufpool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bufpool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_color_rgb.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_color_rgb.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_color_rgb.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_color_rgb.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_color_rgb.dir/root/repo/src/bacnet/basic/sys/color_rgb.c.o"
+  "CMakeFiles/test_color_rgb.dir/root/repo/src/bacnet/basic/sys/color_rgb.c.o.d"
+  "CMakeFiles/test_color_rgb.dir/src/main.c.o"
+  "CMakeFiles/test_color_rgb.dir/src/main.c.o.d"
+  "test_color_rgb"
+  "test_color_rgb.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_color_rgb.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
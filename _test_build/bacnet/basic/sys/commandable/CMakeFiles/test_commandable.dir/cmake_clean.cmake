@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_commandable.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_commandable.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_commandable.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_commandable.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_commandable.dir/root/repo/src/bacnet/basic/sys/commandable.c.o"
+  "CMakeFiles/test_commandable.dir/root/repo/src/bacnet/basic/sys/commandable.c.o.d"
+  "CMakeFiles/test_commandable.dir/src/main.c.o"
+  "CMakeFiles/test_commandable.dir/src/main.c.o.d"
+  "test_commandable"
+  "test_commandable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_commandable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_days.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_days.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_days.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_days.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_days.dir/root/repo/src/bacnet/basic/sys/days.c.o"
+  "CMakeFiles/test_days.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "CMakeFiles/test_days.dir/src/main.c.o"
+  "CMakeFiles/test_days.dir/src/main.c.o.d"
+  "test_days"
+  "test_days.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_days.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fifo.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_fifo.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_fifo.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_fifo.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_fifo.dir/root/repo/src/bacnet/basic/sys/fifo.c.o"
+  "CMakeFiles/test_fifo.dir/root/repo/src/bacnet/basic/sys/fifo.c.o.d"
+  "CMakeFiles/test_fifo.dir/src/main.c.o"
+  "CMakeFiles/test_fifo.dir/src/main.c.o.d"
+  "test_fifo"
+  "test_fifo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_fifo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/filename.c" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/root/repo/src/bacnet/basic/sys/filename.c.o" "gcc" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/root/repo/src/bacnet/basic/sys/filename.c.o.d"
+  "/root/repo/test/bacnet/basic/sys/filename/src/main.c" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/src/main.c.o" "gcc" "bacnet/basic/sys/filename/CMakeFiles/test_filename.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_filename.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_filename.dir/root/repo/src/bacnet/basic/sys/filename.c.o"
+  "CMakeFiles/test_filename.dir/root/repo/src/bacnet/basic/sys/filename.c.o.d"
+  "CMakeFiles/test_filename.dir/src/main.c.o"
+  "CMakeFiles/test_filename.dir/src/main.c.o.d"
+  "test_filename"
+  "test_filename.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_filename.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_keylist.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_keylist.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_keylist.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_keylist.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_keylist.dir/root/repo/src/bacnet/basic/sys/keylist.c.o"
+  "CMakeFiles/test_keylist.dir/root/repo/src/bacnet/basic/sys/keylist.c.o.d"
+  "CMakeFiles/test_keylist.dir/src/main.c.o"
+  "CMakeFiles/test_keylist.dir/src/main.c.o.d"
+  "test_keylist"
+  "test_keylist.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_keylist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
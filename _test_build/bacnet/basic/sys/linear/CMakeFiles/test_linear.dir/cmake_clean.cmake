@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_linear.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_linear.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_linear.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_linear.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_linear.dir/root/repo/src/bacnet/basic/sys/linear.c.o"
+  "CMakeFiles/test_linear.dir/root/repo/src/bacnet/basic/sys/linear.c.o.d"
+  "CMakeFiles/test_linear.dir/src/main.c.o"
+  "CMakeFiles/test_linear.dir/src/main.c.o.d"
+  "test_linear"
+  "test_linear.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_linear.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
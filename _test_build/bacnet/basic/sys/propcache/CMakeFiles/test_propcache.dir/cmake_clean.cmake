@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_propcache.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_propcache.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_propcache.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_propcache.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_propcache.dir/root/repo/src/bacnet/basic/sys/propcache.c.o"
+  "CMakeFiles/test_propcache.dir/root/repo/src/bacnet/basic/sys/propcache.c.o.d"
+  "CMakeFiles/test_propcache.dir/src/main.c.o"
+  "CMakeFiles/test_propcache.dir/src/main.c.o.d"
+  "test_propcache"
+  "test_propcache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_propcache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ringbuf.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_ringbuf.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_ringbuf.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_ringbuf.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_ringbuf.dir/root/repo/src/bacnet/basic/sys/ringbuf.c.o"
+  "CMakeFiles/test_ringbuf.dir/root/repo/src/bacnet/basic/sys/ringbuf.c.o.d"
+  "CMakeFiles/test_ringbuf.dir/src/main.c.o"
+  "CMakeFiles/test_ringbuf.dir/src/main.c.o.d"
+  "test_ringbuf"
+  "test_ringbuf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_ringbuf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
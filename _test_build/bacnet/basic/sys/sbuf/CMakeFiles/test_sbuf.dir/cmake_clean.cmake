@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sbuf.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_sbuf.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_sbuf.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_sbuf.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_sbuf.dir/root/repo/src/bacnet/basic/sys/sbuf.c.o"
+  "CMakeFiles/test_sbuf.dir/root/repo/src/bacnet/basic/sys/sbuf.c.o.d"
+  "CMakeFiles/test_sbuf.dir/src/main.c.o"
+  "CMakeFiles/test_sbuf.dir/src/main.c.o.d"
+  "test_sbuf"
+  "test_sbuf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_sbuf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tmwheel.dir/__/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_tmwheel.dir/__/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_tmwheel.dir/__/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_tmwheel.dir/__/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_tmwheel.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o"
+  "CMakeFiles/test_tmwheel.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "CMakeFiles/test_tmwheel.dir/src/main.c.o"
+  "CMakeFiles/test_tmwheel.dir/src/main.c.o.d"
+  "test_tmwheel"
+  "test_tmwheel.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_tmwheel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
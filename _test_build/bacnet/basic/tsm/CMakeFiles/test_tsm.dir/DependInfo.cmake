@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_apdu.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bufpool.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/tmwheel.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "/root/repo/src/bacnet/basic/tsm/tsm.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o.d"
+  "/root/repo/src/bacnet/dcc.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/dcc.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/dcc.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/test/bacnet/basic/tsm/src/main.c" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/src/main.c.o" "gcc" "bacnet/basic/tsm/CMakeFiles/test_tsm.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
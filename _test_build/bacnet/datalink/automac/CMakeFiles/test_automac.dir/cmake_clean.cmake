@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_automac.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_automac.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_automac.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_automac.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_automac.dir/root/repo/src/bacnet/datalink/automac.c.o"
+  "CMakeFiles/test_automac.dir/root/repo/src/bacnet/datalink/automac.c.o.d"
+  "CMakeFiles/test_automac.dir/src/main.c.o"
+  "CMakeFiles/test_automac.dir/src/main.c.o.d"
+  "test_automac"
+  "test_automac.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_automac.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bvlc.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bvlc.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bvlc.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bvlc.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bactext.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/basic/sys/days.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/datalink/bvlc.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/datalink/bvlc.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/hostnport.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_bvlc.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_bvlc.dir/src/main.c.o"
+  "CMakeFiles/test_bvlc.dir/src/main.c.o.d"
+  "test_bvlc"
+  "test_bvlc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bvlc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cobs.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_cobs.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_cobs.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_cobs.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_cobs.dir/root/repo/src/bacnet/datalink/cobs.c.o"
+  "CMakeFiles/test_cobs.dir/root/repo/src/bacnet/datalink/cobs.c.o.d"
+  "CMakeFiles/test_cobs.dir/src/main.c.o"
+  "CMakeFiles/test_cobs.dir/src/main.c.o.d"
+  "test_cobs"
+  "test_cobs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_cobs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_crc.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_crc.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_crc.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_crc.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_crc.dir/root/repo/src/bacnet/datalink/crc.c.o"
+  "CMakeFiles/test_crc.dir/root/repo/src/bacnet/datalink/crc.c.o.d"
+  "CMakeFiles/test_crc.dir/src/main.c.o"
+  "CMakeFiles/test_crc.dir/src/main.c.o.d"
+  "test_crc"
+  "test_crc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_crc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dlmux.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_dlmux.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_dlmux.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_dlmux.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_dlmux.dir/root/repo/ports/linux/dlmux.c.o"
+  "CMakeFiles/test_dlmux.dir/root/repo/ports/linux/dlmux.c.o.d"
+  "CMakeFiles/test_dlmux.dir/src/main.c.o"
+  "CMakeFiles/test_dlmux.dir/src/main.c.o.d"
+  "test_dlmux"
+  "test_dlmux.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_dlmux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_loopback.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_loopback.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_loopback.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_loopback.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_loopback.dir/root/repo/src/bacnet/basic/sys/ringbuf.c.o"
+  "CMakeFiles/test_loopback.dir/root/repo/src/bacnet/basic/sys/ringbuf.c.o.d"
+  "CMakeFiles/test_loopback.dir/root/repo/src/bacnet/datalink/loopback.c.o"
+  "CMakeFiles/test_loopback.dir/root/repo/src/bacnet/datalink/loopback.c.o.d"
+  "CMakeFiles/test_loopback.dir/src/main.c.o"
+  "CMakeFiles/test_loopback.dir/src/main.c.o.d"
+  "test_loopback"
+  "test_loopback.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_loopback.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/fifo.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/fifo.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/fifo.c.o.d"
+  "/root/repo/src/bacnet/datalink/cobs.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/cobs.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/cobs.c.o.d"
+  "/root/repo/src/bacnet/datalink/crc.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/crc.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/crc.c.o.d"
+  "/root/repo/src/bacnet/datalink/mstp.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstp.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstp.c.o.d"
+  "/root/repo/src/bacnet/datalink/mstptext.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstptext.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstptext.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/test/bacnet/datalink/mstp/src/main.c" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/src/main.c.o" "gcc" "bacnet/datalink/mstp/CMakeFiles/test_mstp.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
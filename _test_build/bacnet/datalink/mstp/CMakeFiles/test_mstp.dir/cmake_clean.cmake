@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_mstp.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/fifo.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/basic/sys/fifo.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/cobs.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/cobs.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/crc.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/crc.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstp.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstp.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstptext.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/datalink/mstptext.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/npdu.c.o"
+  "CMakeFiles/test_mstp.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "CMakeFiles/test_mstp.dir/src/main.c.o"
+  "CMakeFiles/test_mstp.dir/src/main.c.o.d"
+  "test_mstp"
+  "test_mstp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_mstp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
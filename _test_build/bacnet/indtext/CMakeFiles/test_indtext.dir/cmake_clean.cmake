@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_indtext.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_indtext.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_indtext.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_indtext.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_indtext.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_indtext.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_indtext.dir/src/main.c.o"
+  "CMakeFiles/test_indtext.dir/src/main.c.o.d"
+  "test_indtext"
+  "test_indtext.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_indtext.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
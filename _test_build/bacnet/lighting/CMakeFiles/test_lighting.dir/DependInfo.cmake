@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/bactext.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bactext.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/lighting.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/lighting.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "/root/repo/test/bacnet/lighting/src/main.c" "bacnet/lighting/CMakeFiles/test_lighting.dir/src/main.c.o" "gcc" "bacnet/lighting/CMakeFiles/test_lighting.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_lighting.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bactext.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/indtext.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/lighting.c.o"
+  "CMakeFiles/test_lighting.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "CMakeFiles/test_lighting.dir/src/main.c.o"
+  "CMakeFiles/test_lighting.dir/src/main.c.o.d"
+  "test_lighting"
+  "test_lighting.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_lighting.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
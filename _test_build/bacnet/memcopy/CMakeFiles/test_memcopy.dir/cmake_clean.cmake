@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memcopy.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_memcopy.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_memcopy.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_memcopy.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_memcopy.dir/root/repo/src/bacnet/memcopy.c.o"
+  "CMakeFiles/test_memcopy.dir/root/repo/src/bacnet/memcopy.c.o.d"
+  "CMakeFiles/test_memcopy.dir/src/main.c.o"
+  "CMakeFiles/test_memcopy.dir/src/main.c.o.d"
+  "test_memcopy"
+  "test_memcopy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_memcopy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/basic/service/h_apdu.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bufpool.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/tmwheel.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "/root/repo/src/bacnet/basic/tsm/tsm.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o.d"
+  "/root/repo/src/bacnet/dcc.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/dcc.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/dcc.c.o.d"
+  "/root/repo/src/bacnet/npdu.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/npdu.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "/root/repo/test/bacnet/npdu/src/main.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/src/main.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/src/main.c.o.d"
+  "/root/repo/test/bacnet/npdu/stubs.c" "bacnet/npdu/CMakeFiles/test_npdu.dir/stubs.c.o" "gcc" "bacnet/npdu/CMakeFiles/test_npdu.dir/stubs.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_npdu.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacaddr.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacerror.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/service/h_apdu.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/bufpool.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/sys/tmwheel.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/basic/tsm/tsm.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/dcc.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/dcc.c.o.d"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/npdu.c.o"
+  "CMakeFiles/test_npdu.dir/root/repo/src/bacnet/npdu.c.o.d"
+  "CMakeFiles/test_npdu.dir/src/main.c.o"
+  "CMakeFiles/test_npdu.dir/src/main.c.o.d"
+  "CMakeFiles/test_npdu.dir/stubs.c.o"
+  "CMakeFiles/test_npdu.dir/stubs.c.o.d"
+  "test_npdu"
+  "test_npdu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_npdu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_property.dir/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_property.dir/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_property.dir/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_property.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacdcode.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacint.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacreal.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacstr.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/basic/sys/bigend.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/property.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/property.c.o.d"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/proplist.c.o"
+  "CMakeFiles/test_property.dir/root/repo/src/bacnet/proplist.c.o.d"
+  "CMakeFiles/test_property.dir/src/main.c.o"
+  "CMakeFiles/test_property.dir/src/main.c.o.d"
+  "test_property"
+  "test_property.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_property.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacapp.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacapp.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacdest.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdest.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "/root/repo/src/bacnet/bacdevobjpropref.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdevobjpropref.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "/root/repo/src/bacnet/bacerror.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacerror.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacerror.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/bactext.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bactext.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "/root/repo/src/bacnet/bactimevalue.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bactimevalue.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/days.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/basic/sys/days.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "/root/repo/src/bacnet/calendar_entry.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/calendar_entry.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "/root/repo/src/bacnet/dailyschedule.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/dailyschedule.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "/root/repo/src/bacnet/datetime.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/datetime.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "/root/repo/src/bacnet/hostnport.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/hostnport.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/lighting.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/lighting.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "/root/repo/src/bacnet/memcopy.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/memcopy.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/memcopy.c.o.d"
+  "/root/repo/src/bacnet/rpm.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/rpm.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/rpm.c.o.d"
+  "/root/repo/src/bacnet/special_event.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/special_event.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "/root/repo/src/bacnet/timestamp.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/timestamp.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "/root/repo/src/bacnet/weeklyschedule.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/weeklyschedule.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "/root/repo/test/bacnet/rpm/src/main.c" "bacnet/rpm/CMakeFiles/test_rpm.dir/src/main.c.o" "gcc" "bacnet/rpm/CMakeFiles/test_rpm.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/ztest/src/ztest.c" "bacnet/wp/CMakeFiles/test_wp.dir/__/__/ztest/src/ztest.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/__/__/ztest/src/ztest.c.o.d"
+  "/root/repo/test/ztest/src/ztest_mock.c" "bacnet/wp/CMakeFiles/test_wp.dir/__/__/ztest/src/ztest_mock.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/__/__/ztest/src/ztest_mock.c.o.d"
+  "/root/repo/src/bacnet/bacaddr.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacaddr.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacaddr.c.o.d"
+  "/root/repo/src/bacnet/bacapp.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacapp.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacapp.c.o.d"
+  "/root/repo/src/bacnet/bacdcode.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdcode.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdcode.c.o.d"
+  "/root/repo/src/bacnet/bacdest.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdest.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdest.c.o.d"
+  "/root/repo/src/bacnet/bacdevobjpropref.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdevobjpropref.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacdevobjpropref.c.o.d"
+  "/root/repo/src/bacnet/bacint.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacint.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacint.c.o.d"
+  "/root/repo/src/bacnet/bacreal.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacreal.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacreal.c.o.d"
+  "/root/repo/src/bacnet/bacstr.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacstr.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bacstr.c.o.d"
+  "/root/repo/src/bacnet/bactext.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bactext.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bactext.c.o.d"
+  "/root/repo/src/bacnet/bactimevalue.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bactimevalue.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/bactimevalue.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/bigend.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/basic/sys/bigend.c.o.d"
+  "/root/repo/src/bacnet/basic/sys/days.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/basic/sys/days.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/basic/sys/days.c.o.d"
+  "/root/repo/src/bacnet/calendar_entry.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/calendar_entry.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/calendar_entry.c.o.d"
+  "/root/repo/src/bacnet/dailyschedule.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/dailyschedule.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/dailyschedule.c.o.d"
+  "/root/repo/src/bacnet/datetime.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/datetime.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/datetime.c.o.d"
+  "/root/repo/src/bacnet/hostnport.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/hostnport.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/hostnport.c.o.d"
+  "/root/repo/src/bacnet/indtext.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/indtext.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/indtext.c.o.d"
+  "/root/repo/src/bacnet/lighting.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/lighting.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/lighting.c.o.d"
+  "/root/repo/src/bacnet/special_event.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/special_event.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/special_event.c.o.d"
+  "/root/repo/src/bacnet/timestamp.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/timestamp.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/timestamp.c.o.d"
+  "/root/repo/src/bacnet/weeklyschedule.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/weeklyschedule.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/weeklyschedule.c.o.d"
+  "/root/repo/src/bacnet/wp.c" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/wp.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/root/repo/src/bacnet/wp.c.o.d"
+  "/root/repo/test/bacnet/wp/src/main.c" "bacnet/wp/CMakeFiles/test_wp.dir/src/main.c.o" "gcc" "bacnet/wp/CMakeFiles/test_wp.dir/src/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,175 @@
+# Install script for directory: /root/repo/test
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_test_build/unit/bacnet/bits/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/abort/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/alarm_ack/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/arf/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/awf/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacaddr/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacapp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacdcode/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacdevobjpropref/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacdest/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacerror/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacint/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacpropstates/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacreal/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bacstr/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/bactimevalue/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/cov/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/create_object/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datetime/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/dcc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/delete_object/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/event/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/getalarm/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/getevent/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/hostnport/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/iam/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/ihave/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/indtext/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/lighting/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/list_element/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/lso/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/memcopy/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/npdu/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/property/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/ptransfer/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/rd/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/reject/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/rp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/rpm/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/specialevent/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/timestamp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/timesync/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/whohas/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/whois/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/wp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/wpm/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/weeklyschedule/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/binding/address/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/bbmd/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/bbmd6/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/client/bac-data/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/client/bac-discover/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/client/bac-rw/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/acc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_credential/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_door/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_point/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_rights/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_user/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/access_zone/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/ai/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/ao/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/av/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/bacfile/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/bi/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/bitstring_value/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/blo/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/bo/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/bv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/channel/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/calendar/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/color_object/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/color_temperature/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/command/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/credential_data_input/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/csv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/device/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/iv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/lc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/lo/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/lsp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/lsz/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/ms-input/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/mso/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/msv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/netport/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/nc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/objects/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/osv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/piv/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/schedule/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/structured_view/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/time_value/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/object/trendlog/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/service/h_rpm_a/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/service/h_whois/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/bufpool/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/color_rgb/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/commandable/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/days/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/fifo/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/filename/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/keylist/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/linear/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/propcache/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/ringbuf/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/sbuf/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/sys/tmwheel/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/basic/tsm/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/automac/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/cobs/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/crc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/bvlc/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/loopback/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/mstp/cmake_install.cmake")
+  include("/root/repo/_test_build/bacnet/datalink/dlmux/cmake_install.cmake")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_test_build/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
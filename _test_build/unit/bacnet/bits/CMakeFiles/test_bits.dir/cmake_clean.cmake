@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bits.dir/__/__/__/ztest/src/ztest.c.o"
+  "CMakeFiles/test_bits.dir/__/__/__/ztest/src/ztest.c.o.d"
+  "CMakeFiles/test_bits.dir/__/__/__/ztest/src/ztest_mock.c.o"
+  "CMakeFiles/test_bits.dir/__/__/__/ztest/src/ztest_mock.c.o.d"
+  "CMakeFiles/test_bits.dir/src/main.c.o"
+  "CMakeFiles/test_bits.dir/src/main.c.o.d"
+  "test_bits"
+  "test_bits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,426 @@
+/**
+ * @file
+ * @brief Benchmark of BACnet tag and value decoding throughput
+ *
+ * Decodes a corpus of ReadProperty-ACK and ReadPropertyMultiple-ACK
+ * service data with the generic per-element decoders and with the
+ * table driven tag decoder and bulk array decoders, and prints the
+ * throughput of each.  Also selects a single property value from the
+ * ReadPropertyMultiple-ACK by decoding every value, and by skip-scanning
+ * the tag headers.
+ *
+ * @date October 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/bacapp.h"
+#include "bacnet/bacdcode.h"
+#include "bacnet/bacint.h"
+#include "bacnet/rpm.h"
+#include "bacnet/version.h"
+
+#define CORPUS_OBJECT_LIST_SIZE 200
+#define CORPUS_RPM_OBJECTS 20
+
+struct corpus_apdu {
+    const char *name;
+    uint8_t apdu[MAX_APDU];
+    int apdu_len;
+};
+
+/* service data captured from a ReadProperty-ACK of a Priority_Array */
+static struct corpus_apdu Priority_Array = { "priority-array", { 0 }, 0 };
+/* service data captured from a ReadProperty-ACK of an Object_List */
+static struct corpus_apdu Object_List = { "object-list", { 0 }, 0 };
+/* service data captured from a ReadPropertyMultiple-ACK of AI objects */
+static struct corpus_apdu RPM_Ack = { "rpm-ack", { 0 }, 0 };
+
+/**
+ * @brief Build the corpus of APDU service data
+ */
+static void corpus_init(void)
+{
+    BACNET_BIT_STRING bit_string = { 0 };
+    BACNET_CHARACTER_STRING char_string = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    uint8_t *apdu;
+    unsigned i;
+    int len = 0;
+
+    apdu = Priority_Array.apdu;
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        if ((i == 7) || (i == 15)) {
+            len += encode_application_real(&apdu[len], 72.5f + (float)i);
+        } else {
+            len += encode_application_null(&apdu[len]);
+        }
+    }
+    Priority_Array.apdu_len = len;
+    apdu = Object_List.apdu;
+    len = 0;
+    for (i = 0; i < CORPUS_OBJECT_LIST_SIZE; i++) {
+        len += encode_application_object_id(
+            &apdu[len], (BACNET_OBJECT_TYPE)(i % 5), 1000 + i);
+    }
+    Object_List.apdu_len = len;
+    apdu = RPM_Ack.apdu;
+    len = 0;
+    bitstring_init(&bit_string);
+    bitstring_set_bit(&bit_string, STATUS_FLAG_IN_ALARM, false);
+    bitstring_set_bit(&bit_string, STATUS_FLAG_FAULT, false);
+    bitstring_set_bit(&bit_string, STATUS_FLAG_OVERRIDDEN, false);
+    bitstring_set_bit(&bit_string, STATUS_FLAG_OUT_OF_SERVICE, false);
+    characterstring_init_ansi(&char_string, "Zone Temperature");
+    for (i = 0; i < CORPUS_RPM_OBJECTS; i++) {
+        rpmdata.object_type = OBJECT_ANALOG_INPUT;
+        rpmdata.object_instance = i;
+        len += rpm_ack_encode_apdu_object_begin(&apdu[len], &rpmdata);
+        len += rpm_ack_encode_apdu_object_property(
+            &apdu[len], PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+        len += encode_opening_tag(&apdu[len], 4);
+        len += encode_application_real(&apdu[len], 20.0f + (float)i);
+        len += encode_closing_tag(&apdu[len], 4);
+        len += rpm_ack_encode_apdu_object_property(
+            &apdu[len], PROP_STATUS_FLAGS, BACNET_ARRAY_ALL);
+        len += encode_opening_tag(&apdu[len], 4);
+        len += encode_application_bitstring(&apdu[len], &bit_string);
+        len += encode_closing_tag(&apdu[len], 4);
+        len += rpm_ack_encode_apdu_object_property(
+            &apdu[len], PROP_UNITS, BACNET_ARRAY_ALL);
+        len += encode_opening_tag(&apdu[len], 4);
+        len += encode_application_enumerated(&apdu[len], UNITS_DEGREES_CELSIUS);
+        len += encode_closing_tag(&apdu[len], 4);
+        len += rpm_ack_encode_apdu_object_property(
+            &apdu[len], PROP_OBJECT_NAME, BACNET_ARRAY_ALL);
+        len += encode_opening_tag(&apdu[len], 4);
+        len += encode_application_character_string(&apdu[len], &char_string);
+        len += encode_closing_tag(&apdu[len], 4);
+        len += rpm_ack_encode_apdu_object_end(&apdu[len]);
+    }
+    RPM_Ack.apdu_len = len;
+}
+
+/**
+ * @brief Reference tag decoder: the branchy per-octet tag decoder
+ *  that the table driven bacnet_tag_decode() replaced
+ * @return the number of apdu bytes consumed, or zero if malformed
+ */
+static int reference_tag_decode(uint8_t *apdu, uint32_t apdu_size,
+    BACNET_TAG *tag)
+{
+    int len = 0;
+    uint8_t tag_number = 0;
+    uint16_t value16 = 0;
+    uint32_t value32 = 0;
+    uint32_t len_value_type = 0;
+
+    if (apdu && (apdu_size > 0)) {
+        len = bacnet_tag_number_decode(&apdu[0], apdu_size, &tag_number);
+    }
+    if (len > 0) {
+        if (IS_EXTENDED_VALUE(apdu[0])) {
+            if (apdu_size > len) {
+                apdu_size -= len;
+                if ((apdu[len] == 255) && (apdu_size >= 5)) {
+                    len++;
+                    len += decode_unsigned32(&apdu[len], &value32);
+                    len_value_type = value32;
+                } else if ((apdu[len] == 254) && (apdu_size >= 3)) {
+                    len++;
+                    len += decode_unsigned16(&apdu[len], &value16);
+                    len_value_type = value16;
+                } else if ((apdu[len] < 254) && (apdu_size >= 1)) {
+                    len_value_type = apdu[len];
+                    len++;
+                } else {
+                    len = 0;
+                }
+            } else {
+                len = 0;
+            }
+        } else if (IS_OPENING_TAG(apdu[0])) {
+            /* reserved value */
+        } else if (IS_CLOSING_TAG(apdu[0])) {
+            /* reserved value */
+        } else {
+            len_value_type = apdu[0] & 0x07;
+        }
+        if ((len > 0) && tag) {
+            tag->number = tag_number;
+            tag->application = !IS_CONTEXT_SPECIFIC(apdu[0]);
+            tag->context = IS_CONTEXT_SPECIFIC(apdu[0]) &&
+                !IS_OPENING_TAG(apdu[0]) && !IS_CLOSING_TAG(apdu[0]);
+            tag->opening =
+                IS_CONTEXT_SPECIFIC(apdu[0]) && IS_OPENING_TAG(apdu[0]);
+            tag->closing =
+                IS_CONTEXT_SPECIFIC(apdu[0]) && IS_CLOSING_TAG(apdu[0]);
+            tag->len_value_type = len_value_type;
+        }
+    }
+
+    return len;
+}
+
+/* called through pointers so that neither decoder is inlined here */
+static int (*volatile Reference_Tag_Decode)(uint8_t *, uint32_t, BACNET_TAG *) =
+    reference_tag_decode;
+static int (*volatile Fast_Tag_Decode)(uint8_t *, uint32_t, BACNET_TAG *) =
+    bacnet_tag_decode;
+
+/**
+ * @brief Walk every tag header with the reference tag decoder
+ * @return number of tags decoded
+ */
+static unsigned reference_tag_walk(uint8_t *apdu, int apdu_len)
+{
+    BACNET_TAG tag = { 0 };
+    unsigned count = 0;
+    int len = 0, tag_len;
+
+    while (len < apdu_len) {
+        tag_len = Reference_Tag_Decode(&apdu[len], apdu_len - len, &tag);
+        if (tag_len <= 0) {
+            break;
+        }
+        len += tag_len;
+        if (!tag.opening && !tag.closing) {
+            len += tag.len_value_type;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Walk every tag header with the table driven tag decoder
+ * @return number of tags decoded
+ */
+static unsigned fast_tag_walk(uint8_t *apdu, int apdu_len)
+{
+    BACNET_TAG tag = { 0 };
+    unsigned count = 0;
+    int len = 0, tag_len;
+
+    while (len < apdu_len) {
+        tag_len = Fast_Tag_Decode(&apdu[len], apdu_len - len, &tag);
+        if (tag_len <= 0) {
+            break;
+        }
+        len += tag_len;
+        if (!tag.opening && !tag.closing) {
+            len += tag.len_value_type;
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Decode every value with the generic application data decoder
+ * @return number of values decoded
+ */
+static unsigned generic_value_decode(uint8_t *apdu, int apdu_len)
+{
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    unsigned count = 0;
+    int len = 0, value_len;
+
+    while (len < apdu_len) {
+        value_len =
+            bacapp_decode_application_data(&apdu[len], apdu_len - len, &value);
+        if (value_len <= 0) {
+            break;
+        }
+        len += value_len;
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Decode the Priority_Array with the bulk REAL array decoder
+ * @return number of values decoded
+ */
+static unsigned bulk_priority_array_decode(uint8_t *apdu, int apdu_len)
+{
+    float value[BACNET_MAX_PRIORITY];
+    bool null_value[BACNET_MAX_PRIORITY];
+    uint32_t count = 0;
+
+    bacnet_real_application_array_decode(
+        apdu, apdu_len, value, null_value, BACNET_MAX_PRIORITY, &count);
+
+    return count;
+}
+
+/**
+ * @brief Decode the Object_List with the bulk object identifier decoder
+ * @return number of values decoded
+ */
+static unsigned bulk_object_list_decode(uint8_t *apdu, int apdu_len)
+{
+    BACNET_OBJECT_ID value[CORPUS_OBJECT_LIST_SIZE];
+    uint32_t count = 0;
+
+    bacnet_object_id_application_array_decode(
+        apdu, apdu_len, value, CORPUS_OBJECT_LIST_SIZE, &count);
+
+    return count;
+}
+
+/* property value selected from the ReadPropertyMultiple-ACK */
+static bool Selected_Value;
+
+/**
+ * @brief Decode every property value of the ReadPropertyMultiple-ACK
+ *  and keep the Present_Value of the last object
+ */
+static void select_property_ack(
+    uint32_t device_id, BACNET_READ_PROPERTY_DATA *rp_data)
+{
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+
+    (void)device_id;
+    bacapp_decode_application_data(
+        rp_data->application_data, rp_data->application_data_len, &value);
+    if ((rp_data->object_instance == (CORPUS_RPM_OBJECTS - 1)) &&
+        (rp_data->object_property == PROP_PRESENT_VALUE)) {
+        Selected_Value = (value.tag == BACNET_APPLICATION_TAG_REAL);
+    }
+}
+
+/**
+ * @brief Select one value by decoding the whole ReadPropertyMultiple-ACK
+ * @return number of values selected
+ */
+static unsigned generic_value_select(uint8_t *apdu, int apdu_len)
+{
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+
+    Selected_Value = false;
+    rpm_ack_object_property_process(
+        apdu, apdu_len, 0, &rp_data, select_property_ack);
+
+    return Selected_Value ? 1 : 0;
+}
+
+/**
+ * @brief Select one value by skip-scanning the ReadPropertyMultiple-ACK
+ * @return number of values selected
+ */
+static unsigned skip_scan_value_select(uint8_t *apdu, int apdu_len)
+{
+    int len = 0, value_len = 0;
+    float value = 0.0f;
+
+    len = rpm_ack_property_value_find(apdu, apdu_len, OBJECT_ANALOG_INPUT,
+        CORPUS_RPM_OBJECTS - 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL,
+        &value_len);
+    if (len > 0) {
+        len = bacnet_real_application_decode(&apdu[len], value_len, &value);
+    }
+
+    return (len > 0) ? 1 : 0;
+}
+
+/**
+ * @brief Run one decoder over a corpus APDU repeatedly
+ * @param corpus - the APDU to decode
+ * @param decoder - the decoder to measure
+ * @param iterations - number of times to decode the APDU
+ * @param items - number of items decoded per iteration
+ * @return elapsed seconds
+ */
+static double benchmark_run(struct corpus_apdu *corpus,
+    unsigned (*decoder)(uint8_t *, int),
+    unsigned long iterations,
+    unsigned *items)
+{
+    clock_t start;
+    unsigned long i;
+    unsigned count = 0;
+
+    start = clock();
+    for (i = 0; i < iterations; i++) {
+        count = decoder(corpus->apdu, corpus->apdu_len);
+    }
+    *items = count;
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Measure and print a baseline and an optimized decoder
+ */
+static void benchmark_compare(const char *test,
+    struct corpus_apdu *corpus,
+    unsigned (*baseline)(uint8_t *, int),
+    unsigned (*optimized)(uint8_t *, int),
+    unsigned long iterations)
+{
+    double baseline_seconds, optimized_seconds;
+    unsigned baseline_items = 0, optimized_items = 0;
+
+    baseline_seconds =
+        benchmark_run(corpus, baseline, iterations, &baseline_items);
+    optimized_seconds =
+        benchmark_run(corpus, optimized, iterations, &optimized_items);
+    if (baseline_items != optimized_items) {
+        printf("%s %s: item count mismatch %u != %u\n", test, corpus->name,
+            baseline_items, optimized_items);
+    }
+    printf("%-8s %-15s %5d bytes %4u items: "
+           "baseline %10.0f items/s, optimized %10.0f items/s, "
+           "speedup %.2fx\n",
+        test, corpus->name, corpus->apdu_len, optimized_items,
+        (baseline_seconds > 0.0)
+            ? (double)baseline_items * iterations / baseline_seconds
+            : 0.0,
+        (optimized_seconds > 0.0)
+            ? (double)optimized_items * iterations / optimized_seconds
+            : 0.0,
+        (optimized_seconds > 0.0) ? baseline_seconds / optimized_seconds
+                                  : 0.0);
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long iterations = 100000UL;
+
+    if (argc > 1) {
+        iterations = strtoul(argv[1], NULL, 0);
+    }
+    if (iterations == 0) {
+        printf("Usage: %s [iterations]\n"
+               "Measure BACnet decoding throughput over a corpus of "
+               "service data.\n",
+            argv[0]);
+        return 1;
+    }
+    printf("BACnet Stack Version %s decode benchmark, %lu iterations\n",
+        BACNET_VERSION_TEXT, iterations);
+    corpus_init();
+    benchmark_compare("tags", &RPM_Ack, reference_tag_walk, fast_tag_walk,
+        iterations / 10);
+    benchmark_compare("tags", &Object_List, reference_tag_walk, fast_tag_walk,
+        iterations / 10);
+    benchmark_compare("values", &Priority_Array, generic_value_decode,
+        bulk_priority_array_decode, iterations);
+    benchmark_compare("values", &Object_List, generic_value_decode,
+        bulk_object_list_decode, iterations / 10);
+    benchmark_compare("select", &RPM_Ack, generic_value_select,
+        skip_scan_value_select, iterations / 10);
+
+    return 0;
+}
@@ -0,0 +1,685 @@
+/**
+ * @file
+ * @brief End to end benchmark of the BACnet server services
+ *
+ * Runs a synthetic device and a client in one process, connected by the
+ * in-memory loopback datalink, so the measurements are the overhead of
+ * the stack itself: the NPDU and APDU handlers, the service handlers,
+ * the device object, and the encoders and decoders.  The device has a
+ * configurable number of Analog Input, Analog Output, Binary Value,
+ * Multi-state Value objects and the Trend Log objects.  The results are
+ * printed as JSON so that they can be compared between builds.
+ *
+ * @date October 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/apdu.h"
+#include "bacnet/bacdcode.h"
+#include "bacnet/cov.h"
+#include "bacnet/npdu.h"
+#include "bacnet/readrange.h"
+#include "bacnet/rp.h"
+#include "bacnet/rpm.h"
+#include "bacnet/version.h"
+#include "bacnet/whois.h"
+#include "bacnet/wp.h"
+#include "bacnet/basic/object/ai.h"
+#include "bacnet/basic/object/ao.h"
+#include "bacnet/basic/object/bv.h"
+#include "bacnet/basic/object/device.h"
+#include "bacnet/basic/object/msv.h"
+#include "bacnet/basic/object/trendlog.h"
+#include "bacnet/basic/services.h"
+#include "bacnet/datalink/datalink.h"
+#include "bacnet/datalink/loopback.h"
+
+#if !defined(BACDL_LOOPBACK)
+#error "build with BACDL_CUSTOM and BACDL_LOOPBACK defined"
+#endif
+
+#define BENCH_SERVER_MAC 1
+#define BENCH_CLIENT_MAC 2
+#define BENCH_DEVICE_INSTANCE 260001
+/* objects read by each ReadPropertyMultiple */
+#define BENCH_RPM_OBJECTS 10
+/* Who-Is requests sent before the device answers them */
+#define BENCH_WHO_IS_BURST 8
+/* records read by each ReadRange */
+#define BENCH_READ_RANGE_COUNT 50
+
+struct bench_result {
+    const char *name;
+    unsigned long operations;
+    unsigned long items;
+    unsigned long errors;
+    double seconds;
+    double latency_max;
+};
+
+struct bench_config {
+    unsigned analog_inputs;
+    unsigned analog_outputs;
+    unsigned binary_values;
+    unsigned multistate_values;
+    unsigned long iterations;
+};
+
+static struct bench_config Config = { 100, 100, 100, 100, 10000UL };
+static uint8_t Server_Rx_Buffer[MAX_MPDU];
+static uint8_t Client_Rx_Buffer[MAX_MPDU];
+static uint8_t Client_Tx_Buffer[MAX_MPDU];
+static BACNET_ADDRESS Server_Address;
+static BACNET_ADDRESS Client_Address;
+static uint8_t Invoke_ID;
+
+/**
+ * @brief Get a monotonic time with the best available resolution
+ * @return seconds
+ */
+static double bench_clock(void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1000000000.0);
+#else
+    return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+/**
+ * @brief Account the time taken by some operations
+ * @param result - where the time is accounted
+ * @param start - time when the operations started
+ * @param operations - number of operations done since the start
+ */
+static void bench_elapsed(
+    struct bench_result *result, double start, unsigned long operations)
+{
+    double elapsed;
+
+    elapsed = bench_clock() - start;
+    result->seconds += elapsed;
+    result->operations += operations;
+    if (operations > 0) {
+        elapsed /= (double)operations;
+    }
+    if (elapsed > result->latency_max) {
+        result->latency_max = elapsed;
+    }
+}
+
+/**
+ * @brief Handle every frame queued at the device port
+ * @return number of frames handled
+ */
+static unsigned server_task(void)
+{
+    BACNET_ADDRESS src = { 0 };
+    uint16_t pdu_len;
+    unsigned count = 0;
+
+    loopback_port_select(BENCH_SERVER_MAC);
+    for (;;) {
+        pdu_len = datalink_receive(
+            &src, Server_Rx_Buffer, sizeof(Server_Rx_Buffer), 0);
+        if (pdu_len == 0) {
+            break;
+        }
+        npdu_handler(&src, Server_Rx_Buffer, pdu_len);
+        count++;
+    }
+    loopback_port_select(BENCH_CLIENT_MAC);
+
+    return count;
+}
+
+/**
+ * @brief Receive every frame queued at the client port and check its type
+ * @param pdu_type - expected APDU type, such as PDU_TYPE_COMPLEX_ACK
+ * @param result - counts frames of another type as errors
+ * @return number of frames of the expected type
+ */
+static unsigned client_receive(uint8_t pdu_type, struct bench_result *result)
+{
+    BACNET_ADDRESS src = { 0 }, dest = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint16_t pdu_len;
+    int offset;
+    unsigned count = 0;
+
+    for (;;) {
+        pdu_len = datalink_receive(
+            &src, Client_Rx_Buffer, sizeof(Client_Rx_Buffer), 0);
+        if (pdu_len == 0) {
+            break;
+        }
+        offset = bacnet_npdu_decode(
+            Client_Rx_Buffer, pdu_len, &dest, &src, &npdu_data);
+        if ((offset > 0) && (offset < pdu_len) &&
+            ((Client_Rx_Buffer[offset] & 0xF0) == pdu_type)) {
+            count++;
+        } else {
+            result->errors++;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Encode the NPDU header of a request from the client
+ * @param dest - destination of the request
+ * @param expecting_reply - true for a confirmed service request
+ * @return length of the header in Client_Tx_Buffer
+ */
+static int client_npdu_encode(BACNET_ADDRESS *dest, bool expecting_reply)
+{
+    BACNET_NPDU_DATA npdu_data = { 0 };
+
+    npdu_encode_npdu_data(&npdu_data, expecting_reply, MESSAGE_PRIORITY_NORMAL);
+
+    return npdu_encode_pdu(
+        Client_Tx_Buffer, dest, &Client_Address, &npdu_data);
+}
+
+/**
+ * @brief Send a request from the client
+ * @param dest - destination of the request
+ * @param pdu_len - length of the request in Client_Tx_Buffer
+ * @return true if the request was sent
+ */
+static bool client_send(BACNET_ADDRESS *dest, int pdu_len)
+{
+    BACNET_NPDU_DATA npdu_data = { 0 };
+
+    if (pdu_len <= 0) {
+        return false;
+    }
+
+    return datalink_send_pdu(
+               dest, &npdu_data, Client_Tx_Buffer, (unsigned)pdu_len) > 0;
+}
+
+/**
+ * @brief Send a confirmed request, let the device answer it, and take
+ *  the answer, measuring the round trip
+ * @param pdu_len - length of the request in Client_Tx_Buffer
+ * @param pdu_type - expected type of the answer
+ * @param result - where the operation is counted
+ */
+static void client_transaction(
+    int pdu_len, uint8_t pdu_type, struct bench_result *result)
+{
+    double start;
+
+    start = bench_clock();
+    if (client_send(&Server_Address, pdu_len)) {
+        server_task();
+        if (client_receive(pdu_type, result) != 1) {
+            result->errors++;
+        }
+    } else {
+        result->errors++;
+    }
+    bench_elapsed(result, start, 1);
+}
+
+/**
+ * @brief Get the type and instance of the Nth object of the device
+ *  that is read by the ReadProperty benchmark
+ * @param n - any number; the objects are read in turn
+ * @param object_type [out] type of the object
+ * @return instance of the object
+ */
+static uint32_t bench_object(unsigned long n, BACNET_OBJECT_TYPE *object_type)
+{
+    unsigned total = Config.analog_inputs + Config.analog_outputs +
+        Config.binary_values + Config.multistate_values;
+    unsigned index;
+
+    index = (unsigned)(n % total);
+    if (index < Config.analog_inputs) {
+        *object_type = OBJECT_ANALOG_INPUT;
+        return index;
+    }
+    index -= Config.analog_inputs;
+    if (index < Config.analog_outputs) {
+        *object_type = OBJECT_ANALOG_OUTPUT;
+        return index;
+    }
+    index -= Config.analog_outputs;
+    if (index < Config.binary_values) {
+        *object_type = OBJECT_BINARY_VALUE;
+        return index;
+    }
+    index -= Config.binary_values;
+    *object_type = OBJECT_MULTI_STATE_VALUE;
+
+    return index;
+}
+
+/**
+ * @brief ReadProperty of the Present_Value of each object in turn
+ */
+static void bench_read_property(struct bench_result *result)
+{
+    BACNET_READ_PROPERTY_DATA rpdata = { 0 };
+    unsigned long i;
+    int len;
+
+    result->name = "read-property";
+    for (i = 0; i < Config.iterations; i++) {
+        rpdata.object_instance = bench_object(i, &rpdata.object_type);
+        rpdata.object_property = PROP_PRESENT_VALUE;
+        rpdata.array_index = BACNET_ARRAY_ALL;
+        len = client_npdu_encode(&Server_Address, true);
+        len += rp_encode_apdu(&Client_Tx_Buffer[len], Invoke_ID++, &rpdata);
+        client_transaction(len, PDU_TYPE_COMPLEX_ACK, result);
+        result->items++;
+    }
+}
+
+/**
+ * @brief ReadPropertyMultiple of three properties of several Analog Inputs
+ */
+static void bench_read_property_multiple(struct bench_result *result)
+{
+    BACNET_READ_ACCESS_DATA rpmdata[BENCH_RPM_OBJECTS] = { 0 };
+    BACNET_PROPERTY_REFERENCE properties[3] = { 0 };
+    unsigned long i;
+    unsigned n, objects;
+    int len;
+
+    result->name = "read-property-multiple";
+    if (Config.analog_inputs == 0) {
+        return;
+    }
+    objects = BENCH_RPM_OBJECTS;
+    if (objects > Config.analog_inputs) {
+        objects = Config.analog_inputs;
+    }
+    properties[0].propertyIdentifier = PROP_PRESENT_VALUE;
+    properties[0].propertyArrayIndex = BACNET_ARRAY_ALL;
+    properties[0].next = &properties[1];
+    properties[1].propertyIdentifier = PROP_STATUS_FLAGS;
+    properties[1].propertyArrayIndex = BACNET_ARRAY_ALL;
+    properties[1].next = &properties[2];
+    properties[2].propertyIdentifier = PROP_OBJECT_NAME;
+    properties[2].propertyArrayIndex = BACNET_ARRAY_ALL;
+    properties[2].next = NULL;
+    for (n = 0; n < objects; n++) {
+        rpmdata[n].object_type = OBJECT_ANALOG_INPUT;
+        rpmdata[n].listOfProperties = &properties[0];
+        rpmdata[n].next = (n + 1 < objects) ? &rpmdata[n + 1] : NULL;
+    }
+    for (i = 0; i < Config.iterations; i++) {
+        for (n = 0; n < objects; n++) {
+            rpmdata[n].object_instance =
+                (uint32_t)((i * objects + n) % Config.analog_inputs);
+        }
+        len = client_npdu_encode(&Server_Address, true);
+        len += rpm_encode_apdu(&Client_Tx_Buffer[len],
+            sizeof(Client_Tx_Buffer) - (size_t)len, Invoke_ID++, rpmdata);
+        client_transaction(len, PDU_TYPE_COMPLEX_ACK, result);
+        result->items += objects * 3;
+    }
+}
+
+/**
+ * @brief ReadPropertyMultiple of ALL properties of one Analog Input
+ */
+static void bench_read_property_multiple_all(struct bench_result *result)
+{
+    BACNET_READ_ACCESS_DATA rpmdata = { 0 };
+    BACNET_PROPERTY_REFERENCE property = { 0 };
+    unsigned long i;
+    int len;
+
+    result->name = "read-property-multiple-all";
+    if (Config.analog_inputs == 0) {
+        return;
+    }
+    property.propertyIdentifier = PROP_ALL;
+    property.propertyArrayIndex = BACNET_ARRAY_ALL;
+    rpmdata.object_type = OBJECT_ANALOG_INPUT;
+    rpmdata.listOfProperties = &property;
+    for (i = 0; i < Config.iterations; i++) {
+        rpmdata.object_instance = (uint32_t)(i % Config.analog_inputs);
+        len = client_npdu_encode(&Server_Address, true);
+        len += rpm_encode_apdu(&Client_Tx_Buffer[len],
+            sizeof(Client_Tx_Buffer) - (size_t)len, Invoke_ID++, &rpmdata);
+        client_transaction(len, PDU_TYPE_COMPLEX_ACK, result);
+        result->items++;
+    }
+}
+
+/**
+ * @brief WriteProperty of the Present_Value of each Analog Output in turn
+ */
+static void bench_write_property(struct bench_result *result)
+{
+    static BACNET_WRITE_PROPERTY_DATA wpdata;
+    unsigned long i;
+    int len;
+
+    result->name = "write-property";
+    if (Config.analog_outputs == 0) {
+        return;
+    }
+    for (i = 0; i < Config.iterations; i++) {
+        memset(&wpdata, 0, sizeof(wpdata));
+        wpdata.object_type = OBJECT_ANALOG_OUTPUT;
+        wpdata.object_instance = (uint32_t)(i % Config.analog_outputs);
+        wpdata.object_property = PROP_PRESENT_VALUE;
+        wpdata.array_index = BACNET_ARRAY_ALL;
+        wpdata.priority = 8;
+        wpdata.application_data_len = encode_application_real(
+            wpdata.application_data, (float)(i % 100));
+        len = client_npdu_encode(&Server_Address, true);
+        len += wp_encode_apdu(&Client_Tx_Buffer[len], Invoke_ID++, &wpdata);
+        client_transaction(len, PDU_TYPE_SIMPLE_ACK, result);
+        result->items++;
+    }
+}
+
+/**
+ * @brief ReadRange by position of the records of the Trend Logs
+ */
+static void bench_read_range(struct bench_result *result)
+{
+    BACNET_READ_RANGE_DATA rrdata = { 0 };
+    unsigned long i;
+    unsigned count;
+    int len;
+
+    result->name = "read-range";
+    count = Trend_Log_Count();
+    if (count == 0) {
+        return;
+    }
+    for (i = 0; i < Config.iterations; i++) {
+        memset(&rrdata, 0, sizeof(rrdata));
+        rrdata.object_type = OBJECT_TRENDLOG;
+        rrdata.object_instance = Trend_Log_Index_To_Instance(i % count);
+        rrdata.object_property = PROP_LOG_BUFFER;
+        rrdata.array_index = BACNET_ARRAY_ALL;
+        rrdata.RequestType = RR_BY_POSITION;
+        rrdata.Range.RefIndex =
+            1 + (uint32_t)((i * 37) % (TL_MAX_ENTRIES - BENCH_READ_RANGE_COUNT));
+        rrdata.Count = BENCH_READ_RANGE_COUNT;
+        len = client_npdu_encode(&Server_Address, true);
+        len += rr_encode_apdu(&Client_Tx_Buffer[len], Invoke_ID++, &rrdata);
+        client_transaction(len, PDU_TYPE_COMPLEX_ACK, result);
+        result->items += BENCH_READ_RANGE_COUNT;
+    }
+}
+
+/**
+ * @brief Bursts of global Who-Is requests answered with I-Am
+ */
+static void bench_who_is(struct bench_result *result)
+{
+    BACNET_ADDRESS dest = { 0 };
+    unsigned long i;
+    unsigned n, received;
+    double start;
+    int len;
+
+    result->name = "who-is";
+    datalink_get_broadcast_address(&dest);
+    for (i = 0; i < Config.iterations; i += BENCH_WHO_IS_BURST) {
+        start = bench_clock();
+        for (n = 0; n < BENCH_WHO_IS_BURST; n++) {
+            len = client_npdu_encode(&dest, false);
+            len += whois_encode_apdu(&Client_Tx_Buffer[len], -1, -1);
+            if (!client_send(&dest, len)) {
+                result->errors++;
+            }
+        }
+        server_task();
+        received = client_receive(PDU_TYPE_UNCONFIRMED_SERVICE_REQUEST, result);
+        if (received != BENCH_WHO_IS_BURST) {
+            result->errors++;
+        }
+        bench_elapsed(result, start, BENCH_WHO_IS_BURST);
+        result->items += received;
+    }
+}
+
+/**
+ * @brief Let the device send its pending COV notifications, and take them
+ * @param result - counts frames that are not notifications as errors
+ * @return number of notifications received
+ */
+static unsigned cov_notifications(struct bench_result *result)
+{
+    unsigned count = 0;
+    bool idle;
+
+    do {
+        loopback_port_select(BENCH_SERVER_MAC);
+        idle = handler_cov_fsm();
+        loopback_port_select(BENCH_CLIENT_MAC);
+        count += client_receive(PDU_TYPE_UNCONFIRMED_SERVICE_REQUEST, result);
+    } while (!idle);
+
+    return count;
+}
+
+/**
+ * @brief COV notifications sent to a subscription on each Analog Input
+ *  when every Present_Value changes
+ */
+static void bench_cov(struct bench_result *result)
+{
+    BACNET_SUBSCRIBE_COV_DATA cov_data = { 0 };
+    struct bench_result subscribe = { 0 };
+    unsigned long i, rounds;
+    unsigned n, subscriptions = 0;
+    double start;
+    int len;
+
+    result->name = "cov-notification";
+    for (n = 0; n < Config.analog_inputs; n++) {
+        memset(&cov_data, 0, sizeof(cov_data));
+        cov_data.subscriberProcessIdentifier = 1 + n;
+        cov_data.monitoredObjectIdentifier.type = OBJECT_ANALOG_INPUT;
+        cov_data.monitoredObjectIdentifier.instance = n;
+        cov_data.issueConfirmedNotifications = false;
+        cov_data.lifetime = 0;
+        len = client_npdu_encode(&Server_Address, true);
+        len += cov_subscribe_encode_apdu(&Client_Tx_Buffer[len],
+            sizeof(Client_Tx_Buffer) - (unsigned)len, Invoke_ID++,
+            &cov_data);
+        client_transaction(len, PDU_TYPE_SIMPLE_ACK, &subscribe);
+        if (subscribe.errors) {
+            /* the subscription list is full */
+            break;
+        }
+        subscriptions++;
+    }
+    if (subscriptions == 0) {
+        return;
+    }
+    /* the initial notification of each subscription is not measured */
+    cov_notifications(&subscribe);
+    rounds = Config.iterations / subscriptions;
+    if (rounds == 0) {
+        rounds = 1;
+    }
+    for (i = 0; i < rounds; i++) {
+        start = bench_clock();
+        for (n = 0; n < subscriptions; n++) {
+            /* never the initial value, and different each round */
+            Analog_Input_Present_Value_Set(
+                n, (float)(n + (1000 * (1 + (i % 2)))));
+        }
+        result->items += cov_notifications(result);
+        bench_elapsed(result, start, subscriptions);
+    }
+    if (result->items < result->operations) {
+        result->errors += result->operations - result->items;
+    }
+}
+
+/**
+ * @brief Print one benchmark result as a JSON object
+ */
+static void bench_result_print(struct bench_result *result, bool last)
+{
+    printf("    {\n");
+    printf("      \"name\": \"%s\",\n", result->name);
+    printf("      \"operations\": %lu,\n", result->operations);
+    printf("      \"items\": %lu,\n", result->items);
+    printf("      \"errors\": %lu,\n", result->errors);
+    printf("      \"seconds\": %.6f,\n", result->seconds);
+    printf("      \"operations_per_second\": %.1f,\n",
+        (result->seconds > 0.0) ? (double)result->operations / result->seconds
+                                : 0.0);
+    printf("      \"latency_mean_us\": %.3f,\n",
+        result->operations
+            ? 1000000.0 * result->seconds / (double)result->operations
+            : 0.0);
+    printf("      \"latency_max_us\": %.3f\n", 1000000.0 * result->latency_max);
+    printf("    }%s\n", last ? "" : ",");
+}
+
+/**
+ * @brief Create the objects of the synthetic device
+ */
+static void bench_device_init(void)
+{
+    unsigned i;
+
+    Device_Init(NULL);
+    Device_Set_Object_Instance_Number(BENCH_DEVICE_INSTANCE);
+    for (i = 0; i < Config.analog_inputs; i++) {
+        Analog_Input_Create(i);
+        Analog_Input_Present_Value_Set(i, (float)i);
+    }
+    for (i = 0; i < Config.analog_outputs; i++) {
+        Analog_Output_Create(i);
+    }
+    for (i = 0; i < Config.binary_values; i++) {
+        Binary_Value_Create(i);
+    }
+    for (i = 0; i < Config.multistate_values; i++) {
+        Multistate_Value_Create(i);
+    }
+    apdu_set_unrecognized_service_handler_handler(handler_unrecognized_service);
+    apdu_set_unconfirmed_handler(SERVICE_UNCONFIRMED_WHO_IS, handler_who_is);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_READ_PROPERTY, handler_read_property);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_READ_PROP_MULTIPLE, handler_read_property_multiple);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_WRITE_PROPERTY, handler_write_property);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_READ_RANGE, handler_read_range);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_SUBSCRIBE_COV, handler_cov_subscribe);
+    handler_cov_init();
+}
+
+static void print_usage(const char *filename)
+{
+    printf("Usage: %s [--ai N][--ao N][--bv N][--msv N][--iterations N]\n",
+        filename);
+}
+
+static void print_help(const char *filename)
+{
+    printf("Measure the BACnet server services end to end over an\n"
+           "in-memory datalink, and print the results as JSON.\n"
+           "--ai N, --ao N, --bv N, --msv N\n"
+           "Number of Analog Input, Analog Output, Binary Value, and\n"
+           "Multi-state Value objects in the device. Default is 100.\n"
+           "--iterations N\n"
+           "Number of operations of each benchmark. Default is 10000.\n");
+    (void)filename;
+}
+
+int main(int argc, char *argv[])
+{
+    struct bench_result results[7] = { 0 };
+    unsigned count = 0, i;
+    int argi;
+
+    for (argi = 1; argi < argc; argi++) {
+        if ((strcmp(argv[argi], "--help") == 0) || (argi + 1 >= argc)) {
+            print_usage(argv[0]);
+            print_help(argv[0]);
+            return 0;
+        }
+        if (strcmp(argv[argi], "--ai") == 0) {
+            Config.analog_inputs = (unsigned)strtoul(argv[++argi], NULL, 0);
+        } else if (strcmp(argv[argi], "--ao") == 0) {
+            Config.analog_outputs = (unsigned)strtoul(argv[++argi], NULL, 0);
+        } else if (strcmp(argv[argi], "--bv") == 0) {
+            Config.binary_values = (unsigned)strtoul(argv[++argi], NULL, 0);
+        } else if (strcmp(argv[argi], "--msv") == 0) {
+            Config.multistate_values =
+                (unsigned)strtoul(argv[++argi], NULL, 0);
+        } else if (strcmp(argv[argi], "--iterations") == 0) {
+            Config.iterations = strtoul(argv[++argi], NULL, 0);
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if ((Config.iterations == 0) ||
+        ((Config.analog_inputs + Config.analog_outputs +
+             Config.binary_values + Config.multistate_values) == 0)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    bench_device_init();
+    if (!datalink_init("1") || !datalink_init("2")) {
+        fprintf(stderr, "unable to open the loopback ports\n");
+        return 1;
+    }
+    loopback_port_select(BENCH_SERVER_MAC);
+    loopback_get_my_address(&Server_Address);
+    loopback_port_select(BENCH_CLIENT_MAC);
+    loopback_get_my_address(&Client_Address);
+    bench_read_property(&results[count++]);
+    bench_read_property_multiple(&results[count++]);
+    bench_read_property_multiple_all(&results[count++]);
+    bench_write_property(&results[count++]);
+    bench_read_range(&results[count++]);
+    bench_who_is(&results[count++]);
+    bench_cov(&results[count++]);
+    printf("{\n");
+    printf("  \"benchmark\": \"bench-services\",\n");
+    printf("  \"version\": \"%s\",\n", BACNET_VERSION_TEXT);
+    printf("  \"objects\": {\n");
+    printf("    \"analog_input\": %u,\n", Config.analog_inputs);
+    printf("    \"analog_output\": %u,\n", Config.analog_outputs);
+    printf("    \"binary_value\": %u,\n", Config.binary_values);
+    printf("    \"multi_state_value\": %u,\n", Config.multistate_values);
+    printf("    \"trend_log\": %u\n", Trend_Log_Count());
+    printf("  },\n");
+    printf("  \"iterations\": %lu,\n", Config.iterations);
+    printf("  \"results\": [\n");
+    for (i = 0; i < count; i++) {
+        bench_result_print(&results[i], (i + 1) == count);
+    }
+    printf("  ]\n");
+    printf("}\n");
+    datalink_cleanup();
+
+    return 0;
+}
@@ -45,6 +45,7 @@
 #include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/datalink/datalink.h"
 #include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/basic/sys/color_rgb.h"
 #include "bacnet/basic/sys/filename.h"
 #include "bacnet/basic/sys/linear.h"
@@ -449,6 +450,8 @@ int main(int argc, char *argv[])
             if (mstimer_expired(&BACnet_Object_Timer)) {
                 mstimer_reset(&BACnet_Object_Timer);
                 milliseconds = mstimer_interval(&BACnet_Object_Timer);
+                /* lighting output fades and ramps */
+                tmwheel_run();
                 Device_Timer(milliseconds);
                 blinkt_show();
             }
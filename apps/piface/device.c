@@ -99,7 +99,7 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Binary_Lighting_Output_Create, Binary_Lighting_Output_Delete,
-        Binary_Lighting_Output_Timer },
+        NULL /* Timer - uses the timer wheel */ },
     { OBJECT_BINARY_OUTPUT, Binary_Output_Init, Binary_Output_Count,
         Binary_Output_Index_To_Instance, Binary_Output_Valid_Instance,
         Binary_Output_Object_Name, Binary_Output_Read_Property,
@@ -296,6 +296,9 @@ static uint32_t Interval_Offset_Minutes;
 /* Max_Info_Frames - rely on MS/TP subsystem, if there is one */
 /* Device_Address_Binding - required, but relies on binding cache */
 static uint32_t Database_Revision = 0;
+/* nesting of write batches, during which side effects are held */
+static unsigned Write_Batch_Depth;
+static bool Database_Revision_Pending;
 /* Configuration_Files */
 /* Last_Restore_Time */
 /* Backup_Failure_Timeout */
@@ -674,11 +677,16 @@ void Device_Set_Database_Revision(uint32_t revision)
 /*
  * Shortcut for incrementing database revision as this is potentially
  * the most common operation if changing object names and ids is
- * implemented.
+ * implemented.  During a write batch, the database revision is
+ * incremented once when the batch ends.
  */
 void Device_Inc_Database_Revision(void)
 {
-    Database_Revision++;
+    if (Write_Batch_Depth) {
+        Database_Revision_Pending = true;
+    } else {
+        Database_Revision++;
+    }
 }
 
 /** Get the total count of objects supported by this Device Object.
@@ -1662,6 +1670,69 @@ bool Device_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     return (status);
 }
 
+/**
+ * @brief Begin a batch of writes.  Until the batch ends, the database
+ *  revision is incremented at most once, and the present value write
+ *  callbacks of the output objects are held, so that each written
+ *  object is reported once.  Batches may be nested.
+ */
+void Device_Write_Property_Batch_Begin(void)
+{
+    if (Write_Batch_Depth == 0) {
+        Database_Revision_Pending = false;
+        Binary_Output_Write_Present_Value_Defer(true);
+    }
+    Write_Batch_Depth++;
+}
+
+/**
+ * @brief End a batch of writes, and apply the side effects that were held
+ *  when the outermost batch ends.
+ */
+void Device_Write_Property_Batch_End(void)
+{
+    if (Write_Batch_Depth == 0) {
+        return;
+    }
+    Write_Batch_Depth--;
+    if (Write_Batch_Depth == 0) {
+        Binary_Output_Write_Present_Value_Defer(false);
+        if (Database_Revision_Pending) {
+            Database_Revision_Pending = false;
+            Database_Revision++;
+        }
+    }
+}
+
+/**
+ * @brief Write a list of property values as one batch, stopping at the
+ *  first write that fails.  Like WritePropertyMultiple, the writes before
+ *  a failure remain written.
+ * @param wp_data [in,out] array of property values to write, where the
+ *  failed write is given its error class and error code
+ * @param count - number of elements in the array
+ * @return number of successful writes, which is the index of the
+ *  failed write if less than count
+ */
+unsigned Device_Write_Property_Batch(
+    BACNET_WRITE_PROPERTY_DATA *wp_data, unsigned count)
+{
+    unsigned index = 0;
+
+    if (!wp_data) {
+        return 0;
+    }
+    Device_Write_Property_Batch_Begin();
+    for (index = 0; index < count; index++) {
+        if (!Device_Write_Property(&wp_data[index])) {
+            break;
+        }
+    }
+    Device_Write_Property_Batch_End();
+
+    return index;
+}
+
 /**
  * @brief AddListElement from an object list property
  * @param list_element [in] Pointer to the BACnet_List_Element_Data structure,
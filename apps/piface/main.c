@@ -30,6 +30,7 @@
 #include "bacnet/getevent.h"
 #include "bacport.h"
 #include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/version.h"
 /* include the device object */
@@ -349,6 +350,8 @@ int main(int argc, char *argv[])
         if (mstimer_expired(&BACnet_Object_Timer)) {
             mstimer_reset(&BACnet_Object_Timer);
             milliseconds = mstimer_interval(&BACnet_Object_Timer);
+            /* binary lighting output egress */
+            tmwheel_run();
             Device_Timer(milliseconds);
         }
         piface_task();
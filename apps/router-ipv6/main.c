@@ -59,6 +59,9 @@
 #include "bacnet/datalink/bip.h"
 #include "bacnet/datalink/bvlc.h"
 #include "bacnet/basic/bbmd/h_bbmd.h"
+#if defined(__linux__)
+#include "bacnet/datalink/dlmux.h"
+#endif
 
 /* current version of the BACnet stack */
 static const char *BACnet_Version = BACNET_VERSION_TEXT;
@@ -98,8 +101,10 @@ static DNET *Router_Table_Head;
 static uint16_t BIP_Net;
 static uint16_t BIP6_Net;
 /* buffer for receiving packets from the directly connected ports */
+#if !defined(__linux__)
 static uint8_t BIP_Rx_Buffer[BIP_MPDU_MAX];
 static uint8_t BIP6_Rx_Buffer[BIP6_MPDU_MAX];
+#endif
 /* buffer for transmitting from any port */
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
 static uint8_t Tx_Buffer[MAX(BIP_MPDU_MAX, BIP6_MPDU_MAX)];
@@ -1073,6 +1078,21 @@ static void datalink_init(void)
     /* configure the next entry in the table */
     bip6_get_my_address(&my_address);
     port_add(BIP6_Net, &my_address);
+#if defined(__linux__)
+    /* wait on both ports at once rather than taking turns */
+    if (!dlmux_init(my_routing_npdu_handler)) {
+        exit(1);
+    }
+    atexit(dlmux_cleanup);
+    if (!dlmux_port_add(BIP_Net, bip_receive, bip_send_pdu, bip_get_socket(),
+            bip_get_broadcast_socket())) {
+        exit(1);
+    }
+    if (!dlmux_port_add(BIP6_Net, bip6_receive, bip6_send_pdu,
+            bip6_get_socket(), -1)) {
+        exit(1);
+    }
+#endif
 }
 
 /**
@@ -1155,8 +1175,10 @@ uint32_t Device_Object_Instance_Number(void)
  */
 int main(int argc, char *argv[])
 {
+#if !defined(__linux__)
     BACNET_ADDRESS src = { 0 }; /* address where message came from */
     uint16_t pdu_len = 0;
+#endif
     time_t last_seconds = 0;
     time_t current_seconds = 0;
     uint32_t elapsed_seconds = 0;
@@ -1180,6 +1202,10 @@ int main(int argc, char *argv[])
     for (;;) {
         /* input */
         current_seconds = time(NULL);
+#if defined(__linux__)
+        /* handles the packets from either port as they arrive */
+        dlmux_task(1000);
+#else
         /* returns 0 bytes on timeout */
         pdu_len =
             bip_receive(&src, &BIP_Rx_Buffer[0], sizeof(BIP_Rx_Buffer), 5);
@@ -1197,6 +1223,7 @@ int main(int argc, char *argv[])
             my_routing_npdu_handler(
                 BIP6_Net, &src, &BIP6_Rx_Buffer[0], pdu_len);
         }
+#endif
         /* at least one second has passed */
         elapsed_seconds = (uint32_t)(current_seconds - last_seconds);
         if (elapsed_seconds) {
@@ -173,6 +173,7 @@ static void print_usage(const char *filename)
 {
     printf("Usage: %s [--dnet]\n", filename);
     printf("       [--discover-seconds][--print-seconds][--print-summary]\n");
+    printf("       [--snapshot filename]\n");
     printf("       [--version][--help]\n");
 }
 
@@ -188,6 +189,11 @@ static void print_help(const char *filename)
            "Number of seconds to wait before printing list of devices.\n");
     printf("--print-summary:\n"
            "Print only the list of devices.\n");
+    printf("--snapshot filename:\n"
+           "Load the discovered devices from the file at startup, and\n"
+           "save them to the file each time the devices are printed.\n"
+           "Devices in the file are only read again when their\n"
+           "Database_Revision or Last_Restore_Time has changed.\n");
     printf("--dnet N\n"
            "Optional BACnet network number N for directed requests.\n"
            "Valid range is from 0 to 65535 where 0 is the local connection\n"
@@ -212,6 +218,7 @@ int main(int argc, char *argv[])
     unsigned long print_seconds = 60;
     unsigned long discover_seconds = 60;
     uint16_t dnet = 0;
+    const char *snapshot_filename = NULL;
 
     filename = filename_remove_path(argv[0]);
     for (argi = 1; argi < argc; argi++) {
@@ -239,6 +246,10 @@ int main(int argc, char *argv[])
             }
         } else if (strcmp(argv[argi], "--print-summary") == 0) {
             Print_Summary = true;
+        } else if (strcmp(argv[argi], "--snapshot") == 0) {
+            if (++argi < argc) {
+                snapshot_filename = argv[argi];
+            }
         } else if (strcmp(argv[argi], "--dnet") == 0) {
             if (++argi < argc) {
                 long_value = strtol(argv[argi], NULL, 0);
@@ -275,6 +286,12 @@ int main(int argc, char *argv[])
     bacnet_discover_seconds_set(discover_seconds);
     bacnet_discover_init();
     atexit(bacnet_discover_cleanup);
+    if (snapshot_filename) {
+        if (bacnet_discover_snapshot_load(snapshot_filename)) {
+            debug_aprintf("Snapshot: loaded %d devices from %s\n",
+                bacnet_discover_device_count(), snapshot_filename);
+        }
+    }
     mstimer_set(&BACnet_Print_Timer, print_seconds * 1000UL);
     /* loop forever */
     for (;;) {
@@ -283,6 +300,9 @@ int main(int argc, char *argv[])
         if (mstimer_expired(&BACnet_Print_Timer)) {
             mstimer_reset(&BACnet_Print_Timer);
             print_discovered_devices();
+            if (snapshot_filename) {
+                bacnet_discover_snapshot_save(snapshot_filename);
+            }
         }
     }
 
@@ -43,7 +43,7 @@
 #include "bacnet/basic/binding/address.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/filename.h"
-#include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/datalink/datalink.h"
 #include "bacnet/datalink/dlenv.h"
@@ -51,13 +51,16 @@
 #include "bacnet/basic/object/device.h"
 /* objects that have tasks inside them */
 #if (BACNET_PROTOCOL_REVISION >= 14)
+#include "bacnet/basic/object/channel.h"
 #include "bacnet/basic/object/lo.h"
 #endif
 #if (BACNET_PROTOCOL_REVISION >= 24)
 #include "bacnet/basic/object/color_object.h"
 #include "bacnet/basic/object/color_temperature.h"
 #endif
+#include "bacnet/basic/object/calendar.h"
 #include "bacnet/basic/object/lc.h"
+#include "bacnet/basic/object/schedule.h"
 #include "bacnet/basic/object/trendlog.h"
 #include "bacnet/basic/object/structured_view.h"
 #if defined(INTRINSIC_REPORTING)
@@ -80,17 +83,15 @@
 /* current version of the BACnet stack */
 static const char *BACnet_Version = BACNET_VERSION_TEXT;
 /* task timer for various BACnet timeouts */
-static struct mstimer BACnet_Task_Timer;
-/* task timer for TSM timeouts */
-static struct mstimer BACnet_TSM_Timer;
-/* task timer for address binding timeouts */
-static struct mstimer BACnet_Address_Timer;
+static struct tmwheel_timer BACnet_Task_Timer;
 #if defined(INTRINSIC_REPORTING)
 /* task timer for notification recipient timeouts */
-static struct mstimer BACnet_Notification_Timer;
+static struct tmwheel_timer BACnet_Notification_Timer;
 #endif
-/* task timer for objects */
-static struct mstimer BACnet_Object_Timer;
+/* task timer for COV notifications */
+static struct tmwheel_timer BACnet_COV_Timer;
+/* longest time to wait for a packet, in milliseconds */
+#define BACNET_RECEIVE_TIMEOUT_MAX 1000UL
 /** Buffer used for receiving */
 static uint8_t Rx_Buf[MAX_MPDU] = { 0 };
 
@@ -171,6 +172,63 @@ static void Structured_View_Update(void)
     Structured_View_Node_Type_Set(instance, BACNET_NODE_ROOM);
 }
 
+/**
+ * @brief Handle the 1 second tasks
+ * @param timer - timer that expired
+ * @param context - not used
+ */
+static void task_timer_handler(struct tmwheel_timer *timer, void *context)
+{
+    uint32_t elapsed_seconds = tmwheel_timer_interval(timer) / 1000;
+    BACNET_DATE_TIME bdatetime;
+
+    (void)context;
+    tmwheel_timer_reset(timer);
+    dcc_timer_seconds(elapsed_seconds);
+    datalink_maintenance_timer(elapsed_seconds);
+    dlenv_maintenance_timer(elapsed_seconds);
+    trend_log_timer(elapsed_seconds);
+    datetime_local(&bdatetime.date, &bdatetime.time, NULL, NULL);
+    (void)Load_Control_Task(&bdatetime);
+    (void)Calendar_Task(&bdatetime);
+#if defined(INTRINSIC_REPORTING)
+    Device_local_reporting();
+#endif
+#if defined(BACNET_TIME_MASTER)
+    Device_getCurrentDateTime(&bdatetime);
+    handler_timesync_task(&bdatetime);
+#endif
+}
+
+/**
+ * @brief Run one pass of the COV task over all of the subscriptions
+ * @param timer - timer that expired
+ * @param context - not used
+ */
+static void cov_timer_handler(struct tmwheel_timer *timer, void *context)
+{
+    (void)context;
+    tmwheel_timer_reset(timer);
+    while (!handler_cov_fsm()) {
+        /* the task is idle again when the pass is complete */
+    }
+}
+
+#if defined(INTRINSIC_REPORTING)
+/**
+ * @brief Handle the notification recipient rescan
+ * @param timer - timer that expired
+ * @param context - not used
+ */
+static void notification_timer_handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    (void)context;
+    tmwheel_timer_reset(timer);
+    Notification_Class_find_recipient();
+}
+#endif
+
 /** Initialize the handlers we will utilize.
  * @see Device_Init, apdu_set_unconfirmed_handler, apdu_set_confirmed_handler
  */
@@ -193,6 +251,10 @@ static void Init_Service_Handlers(void)
     Structured_View_Update();
     /* we need to handle who-is to support dynamic device binding */
     apdu_set_unconfirmed_handler(SERVICE_UNCONFIRMED_WHO_IS, handler_who_is);
+    /* coalesce overlapping Who-Is within 100ms, and answer a burst of
+       10 Who-Is per source address, then 10 per second */
+    handler_who_is_coalesce_window_set(100);
+    handler_who_is_rate_limit_set(10, 100);
     apdu_set_unconfirmed_handler(SERVICE_UNCONFIRMED_WHO_HAS, handler_who_has);
 
 #if 0
@@ -261,13 +323,18 @@ static void Init_Service_Handlers(void)
         SERVICE_CONFIRMED_CREATE_OBJECT, handler_create_object);
     apdu_set_confirmed_handler(
         SERVICE_CONFIRMED_DELETE_OBJECT, handler_delete_object);
-    /* configure the cyclic timers */
-    mstimer_set(&BACnet_Task_Timer, 1000UL);
-    mstimer_set(&BACnet_TSM_Timer, 50UL);
-    mstimer_set(&BACnet_Address_Timer, 60UL*1000UL);
-    mstimer_set(&BACnet_Object_Timer, 100UL);
+    /* configure the cyclic timers - the TSM requests, address bindings,
+       COV subscriptions, schedules, event outbox and lighting and color
+       objects arm their own timers */
+    tmwheel_timer_init(&BACnet_Task_Timer, task_timer_handler, NULL);
+    tmwheel_timer_set(&BACnet_Task_Timer, 1000UL);
+    tmwheel_timer_init(&BACnet_COV_Timer, cov_timer_handler, NULL);
+    tmwheel_timer_set(&BACnet_COV_Timer, 100UL);
 #if defined(INTRINSIC_REPORTING)
-    mstimer_set(&BACnet_Notification_Timer, NC_RESCAN_RECIPIENTS_SECS*1000UL);
+    tmwheel_timer_init(
+        &BACnet_Notification_Timer, notification_timer_handler, NULL);
+    tmwheel_timer_set(
+        &BACnet_Notification_Timer, NC_RESCAN_RECIPIENTS_SECS * 1000UL);
 #endif
 }
 
@@ -300,7 +367,7 @@ static void print_help(const char *filename)
  *      datalink_receive, npdu_handler,
  *      dcc_timer_seconds, datalink_maintenance_timer,
  *      Load_Control_State_Machine_Handler, handler_cov_task,
- *      tsm_timer_milliseconds
+ *      tmwheel_init, tmwheel_next, tmwheel_run
  *
  * @param argc [in] Arg count.
  * @param argv [in] Takes one argument: the Device Instance #.
@@ -310,13 +377,8 @@ int main(int argc, char *argv[])
 {
     BACNET_ADDRESS src = { 0 }; /* address where message came from */
     uint16_t pdu_len = 0;
-    unsigned timeout = 1; /* milliseconds */
-    uint32_t elapsed_milliseconds = 0;
-    uint32_t elapsed_seconds = 0;
+    unsigned timeout = 0; /* milliseconds */
     BACNET_CHARACTER_STRING DeviceName;
-#if defined(BACNET_TIME_MASTER)
-    BACNET_DATE_TIME bdatetime;
-#endif
 #if defined(BAC_UCI)
     int uciId = 0;
     struct uci_context *ctx;
@@ -365,6 +427,8 @@ int main(int argc, char *argv[])
            "BACnet Device ID: %u\n"
            "Max APDU: %d\n",
         BACnet_Version, Device_Object_Instance_Number(), MAX_APDU);
+    /* the timer wheel holds the deadlines of the modules */
+    tmwheel_init();
     /* load any static address bindings to show up
        in our device bindings list */
     address_init();
@@ -395,56 +459,16 @@ int main(int argc, char *argv[])
     Send_I_Am(&Handler_Transmit_Buffer[0]);
     /* loop forever */
     for (;;) {
-        /* input */
+        /* input - wait for a packet or the next timer */
+        timeout = (unsigned)tmwheel_next(BACNET_RECEIVE_TIMEOUT_MAX);
         pdu_len = datalink_receive(&src, &Rx_Buf[0], MAX_MPDU, timeout);
 
         /* process */
         if (pdu_len) {
             npdu_handler(&src, &Rx_Buf[0], pdu_len);
         }
-        if (mstimer_expired(&BACnet_Task_Timer)) {
-            mstimer_reset(&BACnet_Task_Timer);
-            elapsed_milliseconds = mstimer_interval(&BACnet_Task_Timer);
-            elapsed_seconds = elapsed_milliseconds/1000;
-            /* 1 second tasks */
-            dcc_timer_seconds(elapsed_seconds);
-            datalink_maintenance_timer(elapsed_seconds);
-            dlenv_maintenance_timer(elapsed_seconds);
-            handler_cov_timer_seconds(elapsed_seconds);
-            Load_Control_State_Machine_Handler();
-            trend_log_timer(elapsed_seconds);
-#if defined(INTRINSIC_REPORTING)
-            Device_local_reporting();
-#endif
-#if defined(BACNET_TIME_MASTER)
-            Device_getCurrentDateTime(&bdatetime);
-            handler_timesync_task(&bdatetime);
-#endif
-        }
-        if (mstimer_expired(&BACnet_TSM_Timer)) {
-            mstimer_reset(&BACnet_TSM_Timer);
-            elapsed_milliseconds = mstimer_interval(&BACnet_TSM_Timer);
-            tsm_timer_milliseconds(elapsed_milliseconds);
-        }
-        if (mstimer_expired(&BACnet_Address_Timer)) {
-            mstimer_reset(&BACnet_Address_Timer);
-            elapsed_milliseconds = mstimer_interval(&BACnet_Address_Timer);
-            elapsed_seconds = elapsed_milliseconds/1000;
-            address_cache_timer(elapsed_seconds);
-        }
-        handler_cov_task();
-#if defined(INTRINSIC_REPORTING)
-        if (mstimer_expired(&BACnet_Notification_Timer)) {
-            mstimer_reset(&BACnet_Notification_Timer);
-            Notification_Class_find_recipient();
-        }
-#endif
         /* output */
-        if (mstimer_expired(&BACnet_Object_Timer)) {
-            mstimer_reset(&BACnet_Object_Timer);
-            elapsed_milliseconds = mstimer_interval(&BACnet_Object_Timer);
-            Device_Timer(elapsed_milliseconds);
-        }
+        tmwheel_run();
     }
 
     return 0;
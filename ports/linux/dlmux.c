@@ -0,0 +1,270 @@
+/**
+ * @file
+ * @brief Datalink multiplexer for Linux using epoll to wait on the
+ *  file descriptors of every registered datalink at the same time
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ * @ingroup DLMUX
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/datalink/dlmux.h"
+
+/* room for the largest datalink header in front of the NPDU,
+   since some datalinks receive the whole frame before stripping it */
+#define DLMUX_HEADER_MAX 32
+
+struct dlmux_port {
+    uint16_t net;
+    dlmux_receive_function receive;
+    dlmux_send_pdu_function send_pdu;
+    int fd;
+    int broadcast_fd;
+};
+
+static struct dlmux_port DLMUX_Port[DLMUX_PORTS_MAX];
+static unsigned DLMUX_Port_Count;
+/* ports without a file descriptor need to be polled */
+static unsigned DLMUX_Polled_Count;
+static int DLMUX_Epoll_FD = -1;
+static dlmux_npdu_function DLMUX_Handler;
+static uint8_t DLMUX_Rx_Buffer[DLMUX_HEADER_MAX + MAX_PDU];
+
+/**
+ * @brief Add a file descriptor to the epoll set for a port
+ * @param fd - file descriptor that becomes readable when a frame arrives
+ * @param index - port index returned with the event
+ * @return true if the file descriptor is in the set
+ */
+static bool dlmux_epoll_add(int fd, unsigned index)
+{
+    struct epoll_event event = { 0 };
+
+    event.events = EPOLLIN;
+    event.data.u32 = index;
+    if (epoll_ctl(DLMUX_Epoll_FD, EPOLL_CTL_ADD, fd, &event) == 0) {
+        return true;
+    }
+    /* the broadcast socket may be the same as the unicast socket */
+    if (errno == EEXIST) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Receive the pending NPDUs from one port and pass them along
+ * @param index - port index
+ * @return number of NPDUs handled
+ */
+static int dlmux_port_receive(unsigned index)
+{
+    struct dlmux_port *port = &DLMUX_Port[index];
+    BACNET_ADDRESS src = { 0 };
+    uint16_t pdu_len = 0;
+    int count = 0;
+
+    while (count < DLMUX_RECEIVE_BURST) {
+        /* the descriptor is readable, so do not block */
+        pdu_len = port->receive(
+            &src, &DLMUX_Rx_Buffer[0], sizeof(DLMUX_Rx_Buffer), 0);
+        if (pdu_len == 0) {
+            break;
+        }
+        if (DLMUX_Handler) {
+            DLMUX_Handler(port->net, &src, &DLMUX_Rx_Buffer[0], pdu_len);
+        }
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * @brief Initialize the datalink multiplexer
+ * @param handler - function called with each NPDU received on any port
+ * @return true if the multiplexer was initialized
+ */
+bool dlmux_init(dlmux_npdu_function handler)
+{
+    dlmux_cleanup();
+    DLMUX_Epoll_FD = epoll_create1(EPOLL_CLOEXEC);
+    if (DLMUX_Epoll_FD < 0) {
+        return false;
+    }
+    DLMUX_Handler = handler;
+
+    return true;
+}
+
+/**
+ * @brief Register a datalink as a port of the multiplexer.
+ *  The datalink must already be initialized.
+ * @param net - BACnet network number of the port, 1..65534
+ * @param receive - datalink receive function
+ * @param send_pdu - datalink send function
+ * @param fd - file descriptor that is readable when a frame arrives,
+ *  or -1 to poll the port
+ * @param broadcast_fd - second file descriptor, such as a separate
+ *  broadcast socket, or -1 if there is none
+ * @return true if the port was added
+ */
+bool dlmux_port_add(uint16_t net,
+    dlmux_receive_function receive,
+    dlmux_send_pdu_function send_pdu,
+    int fd,
+    int broadcast_fd)
+{
+    unsigned index = DLMUX_Port_Count;
+    unsigned i;
+
+    if ((DLMUX_Epoll_FD < 0) || (index >= DLMUX_PORTS_MAX) || !receive ||
+        (net == 0) || (net == BACNET_BROADCAST_NETWORK)) {
+        return false;
+    }
+    for (i = 0; i < DLMUX_Port_Count; i++) {
+        if (DLMUX_Port[i].net == net) {
+            return false;
+        }
+    }
+    if ((fd >= 0) && !dlmux_epoll_add(fd, index)) {
+        return false;
+    }
+    if ((broadcast_fd >= 0) && !dlmux_epoll_add(broadcast_fd, index)) {
+        if (fd >= 0) {
+            epoll_ctl(DLMUX_Epoll_FD, EPOLL_CTL_DEL, fd, NULL);
+        }
+        return false;
+    }
+    DLMUX_Port[index].net = net;
+    DLMUX_Port[index].receive = receive;
+    DLMUX_Port[index].send_pdu = send_pdu;
+    DLMUX_Port[index].fd = fd;
+    DLMUX_Port[index].broadcast_fd = broadcast_fd;
+    if ((fd < 0) && (broadcast_fd < 0)) {
+        DLMUX_Polled_Count++;
+    }
+    DLMUX_Port_Count++;
+
+    return true;
+}
+
+/**
+ * @brief Get the number of registered ports
+ * @return number of registered ports
+ */
+unsigned dlmux_port_count(void)
+{
+    return DLMUX_Port_Count;
+}
+
+/**
+ * @brief Get the network number of a registered port
+ * @param index - port index, 0..dlmux_port_count()-1
+ * @return network number of the port, or 0 if the index is not valid
+ */
+uint16_t dlmux_port_net(unsigned index)
+{
+    if (index < DLMUX_Port_Count) {
+        return DLMUX_Port[index].net;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Send an NPDU out of the port attached to a network
+ * @param net - network number of the port, or 0 for every port
+ * @param dest - destination address on that port
+ * @param npdu_data - network information
+ * @param pdu - NPDU data to send
+ * @param pdu_len - number of bytes of NPDU data
+ * @return number of bytes sent, or -1 if the port was not found
+ *  or the send failed
+ */
+int dlmux_send_pdu(uint16_t net,
+    BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    int bytes_sent = -1;
+    int len;
+    unsigned i;
+
+    for (i = 0; i < DLMUX_Port_Count; i++) {
+        if (((net == 0) || (DLMUX_Port[i].net == net)) &&
+            DLMUX_Port[i].send_pdu) {
+            len = DLMUX_Port[i].send_pdu(dest, npdu_data, pdu, pdu_len);
+            if (len > bytes_sent) {
+                bytes_sent = len;
+            }
+        }
+    }
+
+    return bytes_sent;
+}
+
+/**
+ * @brief Wait for frames on all of the ports and handle them.
+ *  Ready ports are drained first, then any polled ports are checked.
+ * @param timeout - longest time to wait, in milliseconds
+ * @return number of NPDUs handled, or -1 on error
+ */
+int dlmux_task(unsigned timeout)
+{
+    struct epoll_event events[DLMUX_PORTS_MAX * 2];
+    bool ready[DLMUX_PORTS_MAX] = { false };
+    int wait_ms = (int)timeout;
+    int count = 0;
+    int n, i;
+
+    if (DLMUX_Epoll_FD < 0) {
+        return -1;
+    }
+    if ((DLMUX_Polled_Count > 0) && (timeout > DLMUX_POLL_MILLISECONDS)) {
+        wait_ms = DLMUX_POLL_MILLISECONDS;
+    }
+    n = epoll_wait(
+        DLMUX_Epoll_FD, events, sizeof(events) / sizeof(events[0]), wait_ms);
+    if (n < 0) {
+        /* a signal is not an error */
+        return (errno == EINTR) ? 0 : -1;
+    }
+    /* a port with two sockets may appear twice */
+    for (i = 0; i < n; i++) {
+        if (events[i].data.u32 < DLMUX_Port_Count) {
+            ready[events[i].data.u32] = true;
+        }
+    }
+    for (i = 0; i < (int)DLMUX_Port_Count; i++) {
+        if (ready[i] ||
+            ((DLMUX_Port[i].fd < 0) && (DLMUX_Port[i].broadcast_fd < 0))) {
+            count += dlmux_port_receive(i);
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Remove all of the ports and release the epoll descriptor.
+ *  The datalinks themselves are not closed.
+ */
+void dlmux_cleanup(void)
+{
+    if (DLMUX_Epoll_FD >= 0) {
+        close(DLMUX_Epoll_FD);
+        DLMUX_Epoll_FD = -1;
+    }
+    DLMUX_Port_Count = 0;
+    DLMUX_Polled_Count = 0;
+    DLMUX_Handler = NULL;
+}
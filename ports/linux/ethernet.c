@@ -55,6 +55,15 @@ uint8_t Ethernet_MAC_Address[MAX_MAC_LEN] = { 0 };
 static int eth802_sockfd = -1; /* 802.2 file handle */
 static struct sockaddr eth_addr = { 0 }; /* used for binding 802.2 */
 
+/**
+ * @brief Return the active 802.2 socket
+ * @return The active 802.2 socket, or -1 if uninitialized
+ */
+int ethernet_get_socket(void)
+{
+    return eth802_sockfd;
+}
+
 bool ethernet_valid(void)
 {
     return (eth802_sockfd >= 0);
@@ -272,6 +272,15 @@ void bip6_set_port(uint16_t port)
     BIP6_Broadcast_Addr.port = port;
 }
 
+/**
+ * @brief Return the active BACnet/IPv6 socket
+ * @return The active BACnet/IPv6 socket, or -1 if uninitialized
+ */
+int bip6_get_socket(void)
+{
+    return (int)BIP6_Socket;
+}
+
 /**
  * Get the BACnet IPv6 UDP port number
  *
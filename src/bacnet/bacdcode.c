@@ -89,6 +89,42 @@
    B'111'   interpreted as Type   = Closing Tag
 */
 
+/* Initial tag octet lookup table.  Each entry holds the small value
+   (B'000'..B'100' Length/Value/Type) in the lowest bits and flags for
+   the tag class, opening/closing, and extended number/value. */
+#define TAG_OCTET_VALUE_MASK 0x07
+#define TAG_OCTET_EXTENDED_VALUE 0x08
+#define TAG_OCTET_EXTENDED_NUMBER 0x10
+#define TAG_OCTET_CONTEXT 0x20
+#define TAG_OCTET_OPENING 0x40
+#define TAG_OCTET_CLOSING 0x80
+#define TAG_OCTET(x)                                                       \
+    ((IS_EXTENDED_TAG_NUMBER(x) ? TAG_OCTET_EXTENDED_NUMBER : 0) |         \
+        (IS_EXTENDED_VALUE(x)                                              \
+                ? TAG_OCTET_EXTENDED_VALUE                                 \
+                : ((IS_OPENING_TAG(x) || IS_CLOSING_TAG(x))                \
+                          ? 0                                              \
+                          : ((x)&TAG_OCTET_VALUE_MASK))) |                 \
+        (IS_CONTEXT_SPECIFIC(x)                                            \
+                ? (IS_OPENING_TAG(x)                                       \
+                          ? TAG_OCTET_OPENING                              \
+                          : (IS_CLOSING_TAG(x) ? TAG_OCTET_CLOSING         \
+                                               : TAG_OCTET_CONTEXT))       \
+                : 0))
+#define TAG_OCTET_ROW(x)                                                   \
+    TAG_OCTET((x) + 0x0), TAG_OCTET((x) + 0x1), TAG_OCTET((x) + 0x2),      \
+        TAG_OCTET((x) + 0x3), TAG_OCTET((x) + 0x4), TAG_OCTET((x) + 0x5),  \
+        TAG_OCTET((x) + 0x6), TAG_OCTET((x) + 0x7), TAG_OCTET((x) + 0x8),  \
+        TAG_OCTET((x) + 0x9), TAG_OCTET((x) + 0xA), TAG_OCTET((x) + 0xB),  \
+        TAG_OCTET((x) + 0xC), TAG_OCTET((x) + 0xD), TAG_OCTET((x) + 0xE),  \
+        TAG_OCTET((x) + 0xF)
+static const uint8_t Tag_Octet_Table[256] = { TAG_OCTET_ROW(0x00),
+    TAG_OCTET_ROW(0x10), TAG_OCTET_ROW(0x20), TAG_OCTET_ROW(0x30),
+    TAG_OCTET_ROW(0x40), TAG_OCTET_ROW(0x50), TAG_OCTET_ROW(0x60),
+    TAG_OCTET_ROW(0x70), TAG_OCTET_ROW(0x80), TAG_OCTET_ROW(0x90),
+    TAG_OCTET_ROW(0xA0), TAG_OCTET_ROW(0xB0), TAG_OCTET_ROW(0xC0),
+    TAG_OCTET_ROW(0xD0), TAG_OCTET_ROW(0xE0), TAG_OCTET_ROW(0xF0) };
+
 /**
  * Encode the max APDU value and return the encoded octed.
  *
@@ -534,75 +570,66 @@ int bacnet_tag_encode(uint8_t *apdu, uint32_t apdu_size, BACNET_TAG *tag)
  */
 int bacnet_tag_decode(uint8_t *apdu, uint32_t apdu_size, BACNET_TAG *tag)
 {
-    int len = 0;
+    uint32_t len = 1;
+    uint8_t flags = 0;
     uint8_t tag_number = 0;
-    bool application_tag = false;
-    bool context_tag = false;
-    bool opening_tag = false;
-    bool closing_tag = false;
     uint32_t len_value_type = 0;
 
-    if (apdu && (apdu_size > 0)) {
-        len = bacnet_tag_number_decode(&apdu[0], apdu_size, &tag_number);
+    if (!apdu || (apdu_size == 0)) {
+        return 0;
     }
-    if (len > 0) {
-        if (IS_EXTENDED_VALUE(apdu[0])) {
-            if (apdu_size > len) {
-                apdu_size -= len;
-                if ((apdu[len] == 255) && (apdu_size >= 5)) {
-                    /* tagged as uint32_t */
-                    uint32_t value32;
-                    len++;
-                    len += decode_unsigned32(&apdu[len], &value32);
-                    len_value_type = value32;
-                } else if ((apdu[len] == 254) && (apdu_size >= 3)) {
-                    /* tagged as uint16_t */
-                    uint16_t value16;
-                    len++;
-                    len += decode_unsigned16(&apdu[len], &value16);
-                    len_value_type = value16;
-                } else if ((apdu[len] < 254) && (apdu_size >= 1)) {
-                    /* no tag - must be uint8_t */
-                    len_value_type = apdu[len];
-                    len++;
-                } else {
-                    /* packet is malformed */
-                    len = 0;
-                }
-            } else {
-                /* packet is malformed */
-                len = 0;
-            }
-        } else if (IS_OPENING_TAG(apdu[0])) {
-            /* reserved value */
-        } else if (IS_CLOSING_TAG(apdu[0])) {
-            /* reserved value */
-        } else {
-            /* small value */
-            len_value_type = apdu[0] & 0x07;
+    flags = Tag_Octet_Table[apdu[0]];
+    if (flags & TAG_OCTET_EXTENDED_NUMBER) {
+        if (apdu_size < 2) {
+            /* malformed */
+            return 0;
         }
-        if (IS_CONTEXT_SPECIFIC(apdu[0])) {
-            if (IS_OPENING_TAG(apdu[0])) {
-                opening_tag = true;
-            } else if (IS_CLOSING_TAG(apdu[0])) {
-                closing_tag = true;
-            } else {
-                context_tag = true;
-            }
-        } else {
-            application_tag = true;
+        /* extended tag */
+        tag_number = apdu[1];
+        len = 2;
+    } else {
+        tag_number = (uint8_t)(apdu[0] >> 4);
+    }
+    if (flags & TAG_OCTET_EXTENDED_VALUE) {
+        if (apdu_size <= len) {
+            /* packet is malformed */
+            return 0;
         }
-        if ((len > 0) && tag) {
-            tag->number = tag_number;
-            tag->application = application_tag;
-            tag->context = context_tag;
-            tag->opening = opening_tag;
-            tag->closing = closing_tag;
-            tag->len_value_type = len_value_type;
+        if (apdu[len] < 254) {
+            /* no tag - must be uint8_t */
+            len_value_type = apdu[len];
+            len++;
+        } else if ((apdu[len] == 254) && ((apdu_size - len) >= 3)) {
+            /* tagged as uint16_t */
+            len_value_type =
+                ((uint32_t)apdu[len + 1] << 8) | (uint32_t)apdu[len + 2];
+            len += 3;
+        } else if ((apdu[len] == 255) && ((apdu_size - len) >= 5)) {
+            /* tagged as uint32_t */
+            len_value_type = ((uint32_t)apdu[len + 1] << 24) |
+                ((uint32_t)apdu[len + 2] << 16) |
+                ((uint32_t)apdu[len + 3] << 8) | (uint32_t)apdu[len + 4];
+            len += 5;
+        } else {
+            /* packet is malformed */
+            return 0;
         }
+    } else {
+        /* small value, or zero for opening and closing tags */
+        len_value_type = flags & TAG_OCTET_VALUE_MASK;
+    }
+    if (tag) {
+        tag->number = tag_number;
+        tag->application = (flags &
+                               (TAG_OCTET_CONTEXT | TAG_OCTET_OPENING |
+                                   TAG_OCTET_CLOSING)) == 0;
+        tag->context = (flags & TAG_OCTET_CONTEXT) != 0;
+        tag->opening = (flags & TAG_OCTET_OPENING) != 0;
+        tag->closing = (flags & TAG_OCTET_CLOSING) != 0;
+        tag->len_value_type = len_value_type;
     }
 
-    return len;
+    return (int)len;
 }
 
 /**
@@ -4525,3 +4552,389 @@ int bacnet_array_encode(uint32_t object_instance,
 
     return apdu_len;
 }
+
+/**
+ * @brief Decode the tag of one element of an array of application
+ *  tagged values of a single datatype, where NULL may mark an element
+ *  without a value (e.g. a relinquished slot of a Priority_Array)
+ * @param apdu - buffer of data to be decoded
+ * @param apdu_size - number of bytes in the buffer
+ * @param tag_number - application tag number of the array datatype
+ * @param null_value - decoded true if the element is NULL, or NULL
+ *  if NULL elements are not expected
+ * @param len_value - decoded length of the element value
+ * @return number of bytes decoded, zero if the element is not of the
+ *  array datatype, or #BACNET_STATUS_ERROR (-1) if malformed
+ */
+static int bacnet_application_array_tag_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    uint8_t tag_number,
+    bool *null_value,
+    uint32_t *len_value)
+{
+    int len = 0;
+    BACNET_TAG tag = { 0 };
+
+    len = bacnet_tag_decode(apdu, apdu_size, &tag);
+    if (len <= 0) {
+        return BACNET_STATUS_ERROR;
+    }
+    if (!tag.application) {
+        return 0;
+    }
+    if (tag.number == tag_number) {
+        if (null_value) {
+            *null_value = false;
+        }
+        *len_value = tag.len_value_type;
+    } else if (null_value && (tag.number == BACNET_APPLICATION_TAG_NULL)) {
+        *null_value = true;
+        *len_value = 0;
+    } else {
+        len = 0;
+    }
+
+    return len;
+}
+
+/**
+ * @brief Decode an array of application tagged BACnet Unsigned values,
+ *  stopping at the first element of another datatype (e.g. a closing tag)
+ * @param apdu - buffer of data to be decoded
+ * @param apdu_size - number of bytes in the buffer
+ * @param value - array of decoded values, or NULL for length
+ * @param null_value - array of flags set for NULL elements, or NULL
+ *  to stop at a NULL element
+ * @param value_size - number of elements in the value arrays
+ * @param value_count - number of elements decoded, if not NULL
+ * @return number of bytes decoded, or #BACNET_STATUS_ERROR (-1)
+ *  if malformed
+ */
+int bacnet_unsigned_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    BACNET_UNSIGNED_INTEGER *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count)
+{
+    int apdu_len = 0;
+    int len = 0;
+    uint32_t count = 0;
+    uint32_t len_value = 0;
+
+    while ((count < value_size) && (apdu_len < apdu_size)) {
+        len = bacnet_application_array_tag_decode(&apdu[apdu_len],
+            apdu_size - apdu_len, BACNET_APPLICATION_TAG_UNSIGNED_INT,
+            null_value ? &null_value[count] : NULL, &len_value);
+        if (len < 0) {
+            return BACNET_STATUS_ERROR;
+        } else if (len == 0) {
+            break;
+        }
+        apdu_len += len;
+        if (null_value && null_value[count]) {
+            if (value) {
+                value[count] = 0;
+            }
+        } else {
+            len = bacnet_unsigned_decode(&apdu[apdu_len], apdu_size - apdu_len,
+                len_value, value ? &value[count] : NULL);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+        }
+        count++;
+    }
+    if (value_count) {
+        *value_count = count;
+    }
+
+    return apdu_len;
+}
+
+/**
+ * @brief Decode an array of application tagged BACnet Enumerated values,
+ *  stopping at the first element of another datatype (e.g. a closing tag)
+ * @param apdu - buffer of data to be decoded
+ * @param apdu_size - number of bytes in the buffer
+ * @param value - array of decoded values, or NULL for length
+ * @param null_value - array of flags set for NULL elements, or NULL
+ *  to stop at a NULL element
+ * @param value_size - number of elements in the value arrays
+ * @param value_count - number of elements decoded, if not NULL
+ * @return number of bytes decoded, or #BACNET_STATUS_ERROR (-1)
+ *  if malformed
+ */
+int bacnet_enumerated_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    uint32_t *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count)
+{
+    int apdu_len = 0;
+    int len = 0;
+    uint32_t count = 0;
+    uint32_t len_value = 0;
+
+    while ((count < value_size) && (apdu_len < apdu_size)) {
+        len = bacnet_application_array_tag_decode(&apdu[apdu_len],
+            apdu_size - apdu_len, BACNET_APPLICATION_TAG_ENUMERATED,
+            null_value ? &null_value[count] : NULL, &len_value);
+        if (len < 0) {
+            return BACNET_STATUS_ERROR;
+        } else if (len == 0) {
+            break;
+        }
+        apdu_len += len;
+        if (null_value && null_value[count]) {
+            if (value) {
+                value[count] = 0;
+            }
+        } else {
+            len = bacnet_enumerated_decode(&apdu[apdu_len],
+                apdu_size - apdu_len, len_value,
+                value ? &value[count] : NULL);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+        }
+        count++;
+    }
+    if (value_count) {
+        *value_count = count;
+    }
+
+    return apdu_len;
+}
+
+/**
+ * @brief Decode an array of application tagged BACnet Real values,
+ *  stopping at the first element of another datatype (e.g. a closing tag)
+ * @param apdu - buffer of data to be decoded
+ * @param apdu_size - number of bytes in the buffer
+ * @param value - array of decoded values, or NULL for length
+ * @param null_value - array of flags set for NULL elements, or NULL
+ *  to stop at a NULL element
+ * @param value_size - number of elements in the value arrays
+ * @param value_count - number of elements decoded, if not NULL
+ * @return number of bytes decoded, or #BACNET_STATUS_ERROR (-1)
+ *  if malformed
+ */
+int bacnet_real_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    float *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count)
+{
+    int apdu_len = 0;
+    int len = 0;
+    uint32_t count = 0;
+    uint32_t len_value = 0;
+
+    while ((count < value_size) && (apdu_len < apdu_size)) {
+        len = bacnet_application_array_tag_decode(&apdu[apdu_len],
+            apdu_size - apdu_len, BACNET_APPLICATION_TAG_REAL,
+            null_value ? &null_value[count] : NULL, &len_value);
+        if (len < 0) {
+            return BACNET_STATUS_ERROR;
+        } else if (len == 0) {
+            break;
+        }
+        apdu_len += len;
+        if (null_value && null_value[count]) {
+            if (value) {
+                value[count] = 0.0f;
+            }
+        } else {
+            len = bacnet_real_decode(&apdu[apdu_len], apdu_size - apdu_len,
+                len_value, value ? &value[count] : NULL);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+        }
+        count++;
+    }
+    if (value_count) {
+        *value_count = count;
+    }
+
+    return apdu_len;
+}
+
+/**
+ * @brief Decode an array of application tagged BACnet Object Identifier
+ *  values, such as an Object_List, stopping at the first element of
+ *  another datatype (e.g. a closing tag)
+ * @param apdu - buffer of data to be decoded
+ * @param apdu_size - number of bytes in the buffer
+ * @param value - array of decoded values, or NULL for length
+ * @param value_size - number of elements in the value array
+ * @param value_count - number of elements decoded, if not NULL
+ * @return number of bytes decoded, or #BACNET_STATUS_ERROR (-1)
+ *  if malformed
+ */
+int bacnet_object_id_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    BACNET_OBJECT_ID *value,
+    uint32_t value_size,
+    uint32_t *value_count)
+{
+    int apdu_len = 0;
+    int len = 0;
+    uint32_t count = 0;
+    uint32_t len_value = 0;
+
+    while ((count < value_size) && (apdu_len < apdu_size)) {
+        len = bacnet_application_array_tag_decode(&apdu[apdu_len],
+            apdu_size - apdu_len, BACNET_APPLICATION_TAG_OBJECT_ID, NULL,
+            &len_value);
+        if (len < 0) {
+            return BACNET_STATUS_ERROR;
+        } else if (len == 0) {
+            break;
+        }
+        apdu_len += len;
+        len = bacnet_object_id_decode(&apdu[apdu_len], apdu_size - apdu_len,
+            len_value, value ? &value[count].type : NULL,
+            value ? &value[count].instance : NULL);
+        if ((len <= 0) || (len != len_value)) {
+            return BACNET_STATUS_ERROR;
+        }
+        apdu_len += len;
+        count++;
+    }
+    if (value_count) {
+        *value_count = count;
+    }
+
+    return apdu_len;
+}
+
+/**
+ * @brief Skip over one complete element using only the tag headers.
+ *  A primitive element is skipped using the length in its tag, and
+ *  a constructed element is skipped from its opening tag through the
+ *  matching closing tag, so no value is ever decoded or copied.
+ * @param apdu - buffer of data to be skipped
+ * @param apdu_size - number of bytes in the buffer
+ * @return number of bytes in the element, zero if the buffer starts
+ *  with a closing tag (the end of the enclosing list), or
+ *  #BACNET_STATUS_ERROR (-1) if malformed
+ */
+int bacnet_element_skip(uint8_t *apdu, uint32_t apdu_size)
+{
+    int len = 0;
+    uint32_t apdu_len = 0;
+    uint32_t len_value = 0;
+    uint32_t depth = 0;
+    uint8_t opening_tag_number = 0;
+    BACNET_TAG tag = { 0 };
+
+    if (!apdu) {
+        return BACNET_STATUS_ERROR;
+    }
+    do {
+        len = bacnet_tag_decode(&apdu[apdu_len], apdu_size - apdu_len, &tag);
+        if (len <= 0) {
+            return BACNET_STATUS_ERROR;
+        }
+        if (tag.opening) {
+            if (depth == 0) {
+                opening_tag_number = tag.number;
+            }
+            depth++;
+            len_value = 0;
+        } else if (tag.closing) {
+            if (depth == 0) {
+                /* end of the enclosing list - nothing to skip */
+                return 0;
+            }
+            depth--;
+            if ((depth == 0) && (tag.number != opening_tag_number)) {
+                return BACNET_STATUS_ERROR;
+            }
+            len_value = 0;
+        } else if (tag.application &&
+            (tag.number == BACNET_APPLICATION_TAG_BOOLEAN)) {
+            /* application tagged boolean value is in the tag itself */
+            len_value = 0;
+        } else {
+            len_value = tag.len_value_type;
+        }
+        apdu_len += len;
+        if (len_value > (apdu_size - apdu_len)) {
+            return BACNET_STATUS_ERROR;
+        }
+        apdu_len += len_value;
+    } while (depth > 0);
+
+    return (int)apdu_len;
+}
+
+/**
+ * @brief Skip over a number of complete elements, for example to seek
+ *  to one element of an encoded BACnetARRAY or BACnetLIST
+ * @param apdu - buffer of data to be skipped
+ * @param apdu_size - number of bytes in the buffer
+ * @param count - number of elements to skip
+ * @return number of bytes skipped, or #BACNET_STATUS_ERROR (-1) if
+ *  malformed or fewer than count elements are in the buffer
+ */
+int bacnet_elements_skip(uint8_t *apdu, uint32_t apdu_size, uint32_t count)
+{
+    int len = 0;
+    uint32_t apdu_len = 0;
+
+    while (count > 0) {
+        len = bacnet_element_skip(&apdu[apdu_len], apdu_size - apdu_len);
+        if (len <= 0) {
+            return BACNET_STATUS_ERROR;
+        }
+        apdu_len += len;
+        count--;
+    }
+
+    return (int)apdu_len;
+}
+
+/**
+ * @brief Determine the length of the data enclosed by an opening tag
+ *  and its matching closing tag, using only the tag headers
+ * @param apdu - buffer starting with the opening tag
+ * @param apdu_size - number of bytes in the buffer
+ * @param tag_number - context tag number of the opening tag
+ * @param tag_len - number of bytes in the opening tag, or NULL
+ * @return number of bytes between the opening and closing tags, or
+ *  #BACNET_STATUS_ERROR (-1) if the opening tag is missing or the
+ *  data is malformed
+ */
+int bacnet_enclosed_data_length(uint8_t *apdu,
+    uint32_t apdu_size,
+    uint8_t tag_number,
+    int *tag_len)
+{
+    int len = 0;
+    int opening_len = 0;
+    int closing_len = 0;
+
+    if (!bacnet_is_opening_tag_number(apdu, apdu_size, tag_number,
+            &opening_len)) {
+        return BACNET_STATUS_ERROR;
+    }
+    len = bacnet_element_skip(apdu, apdu_size);
+    if (len <= 0) {
+        return BACNET_STATUS_ERROR;
+    }
+    /* closing tag for the same tag number is the same size */
+    closing_len = opening_len;
+    if (tag_len) {
+        *tag_len = opening_len;
+    }
+
+    return len - opening_len - closing_len;
+}
@@ -553,6 +553,44 @@ int bacnet_array_encode(uint32_t object_instance,
     uint8_t *apdu,
     int max_apdu);
 
+BACNET_STACK_EXPORT
+int bacnet_unsigned_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    BACNET_UNSIGNED_INTEGER *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count);
+BACNET_STACK_EXPORT
+int bacnet_enumerated_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    uint32_t *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count);
+BACNET_STACK_EXPORT
+int bacnet_real_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    float *value,
+    bool *null_value,
+    uint32_t value_size,
+    uint32_t *value_count);
+BACNET_STACK_EXPORT
+int bacnet_object_id_application_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    BACNET_OBJECT_ID *value,
+    uint32_t value_size,
+    uint32_t *value_count);
+
+BACNET_STACK_EXPORT
+int bacnet_element_skip(uint8_t *apdu, uint32_t apdu_size);
+BACNET_STACK_EXPORT
+int bacnet_elements_skip(uint8_t *apdu, uint32_t apdu_size, uint32_t count);
+BACNET_STACK_EXPORT
+int bacnet_enclosed_data_length(uint8_t *apdu,
+    uint32_t apdu_size,
+    uint8_t tag_number,
+    int *tag_len);
+
 /* from clause 20.2.1.2 Tag Number */
 /* true if extended tag numbering is used */
 #define IS_EXTENDED_TAG_NUMBER(x) (((x)&0xF0) == 0xF0)
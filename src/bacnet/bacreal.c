@@ -51,23 +51,16 @@
 int decode_real(uint8_t *apdu, float *real_value)
 {
     union {
-        uint8_t byte[4];
+        uint32_t value;
         float real_value;
     } my_data;
 
     if (apdu) {
-        /* NOTE: assumes the compiler stores float as IEEE-754 float */
-        if (big_endian()) {
-            my_data.byte[0] = apdu[0];
-            my_data.byte[1] = apdu[1];
-            my_data.byte[2] = apdu[2];
-            my_data.byte[3] = apdu[3];
-        } else {
-            my_data.byte[0] = apdu[3];
-            my_data.byte[1] = apdu[2];
-            my_data.byte[2] = apdu[1];
-            my_data.byte[3] = apdu[0];
-        }
+        /* NOTE: assumes the compiler stores float as IEEE-754 float
+           in the same byte order as a 32-bit integer, so the big-endian
+           load is a few shifts without a byte order test */
+        my_data.value = ((uint32_t)apdu[0] << 24) | ((uint32_t)apdu[1] << 16) |
+            ((uint32_t)apdu[2] << 8) | (uint32_t)apdu[3];
         if (real_value) {
             *real_value = my_data.real_value;
         }
@@ -93,24 +86,18 @@ int decode_real_safe(uint8_t *apdu, uint32_t len_value, float *real_value)
 int encode_bacnet_real(float value, uint8_t *apdu)
 {
     union {
-        uint8_t byte[4];
+        uint32_t value;
         float real_value;
     } my_data;
 
-    /* NOTE: assumes the compiler stores float as IEEE-754 float */
+    /* NOTE: assumes the compiler stores float as IEEE-754 float
+       in the same byte order as a 32-bit integer */
     my_data.real_value = value;
     if (apdu) {
-        if (big_endian()) {
-            apdu[0] = my_data.byte[0];
-            apdu[1] = my_data.byte[1];
-            apdu[2] = my_data.byte[2];
-            apdu[3] = my_data.byte[3];
-        } else {
-            apdu[0] = my_data.byte[3];
-            apdu[1] = my_data.byte[2];
-            apdu[2] = my_data.byte[1];
-            apdu[3] = my_data.byte[0];
-        }
+        apdu[0] = (uint8_t)(my_data.value >> 24);
+        apdu[1] = (uint8_t)(my_data.value >> 16);
+        apdu[2] = (uint8_t)(my_data.value >> 8);
+        apdu[3] = (uint8_t)my_data.value;
     }
 
     return 4;
@@ -122,6 +109,24 @@ int encode_bacnet_real(float value, uint8_t *apdu)
 /* returns the number of apdu bytes consumed */
 int decode_double(uint8_t *apdu, double *double_value)
 {
+#ifdef UINT64_MAX
+    union {
+        uint64_t value;
+        double double_value;
+    } my_data;
+
+    if (apdu) {
+        /* NOTE: assumes the compiler stores double as IEEE-754 double
+           in the same byte order as a 64-bit integer */
+        my_data.value = ((uint64_t)apdu[0] << 56) | ((uint64_t)apdu[1] << 48) |
+            ((uint64_t)apdu[2] << 40) | ((uint64_t)apdu[3] << 32) |
+            ((uint64_t)apdu[4] << 24) | ((uint64_t)apdu[5] << 16) |
+            ((uint64_t)apdu[6] << 8) | (uint64_t)apdu[7];
+        if (double_value) {
+            *double_value = my_data.double_value;
+        }
+    }
+#else
     union {
         uint8_t byte[8];
         double double_value;
@@ -152,6 +157,7 @@ int decode_double(uint8_t *apdu, double *double_value)
             *double_value = my_data.double_value;
         }
     }
+#endif
 
     return 8;
 }
@@ -172,6 +178,26 @@ int decode_double_safe(uint8_t *apdu, uint32_t len_value, double *double_value)
 /* returns the number of apdu bytes consumed */
 int encode_bacnet_double(double value, uint8_t *apdu)
 {
+#ifdef UINT64_MAX
+    union {
+        uint64_t value;
+        double double_value;
+    } my_data;
+
+    /* NOTE: assumes the compiler stores double as IEEE-754 double
+       in the same byte order as a 64-bit integer */
+    my_data.double_value = value;
+    if (apdu) {
+        apdu[0] = (uint8_t)(my_data.value >> 56);
+        apdu[1] = (uint8_t)(my_data.value >> 48);
+        apdu[2] = (uint8_t)(my_data.value >> 40);
+        apdu[3] = (uint8_t)(my_data.value >> 32);
+        apdu[4] = (uint8_t)(my_data.value >> 24);
+        apdu[5] = (uint8_t)(my_data.value >> 16);
+        apdu[6] = (uint8_t)(my_data.value >> 8);
+        apdu[7] = (uint8_t)my_data.value;
+    }
+#else
     union {
         uint8_t byte[8];
         double double_value;
@@ -200,6 +226,7 @@ int encode_bacnet_double(double value, uint8_t *apdu)
             apdu[7] = my_data.byte[0];
         }
     }
+#endif
 
     return 8;
 }
@@ -43,6 +43,9 @@
 #include "bacnet/bacdcode.h"
 #include "bacnet/readrange.h"
 #include "bacnet/basic/binding/address.h"
+#include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/tmwheel.h"
+#include "bacnet/basic/tsm/tsm.h"
 
 /* we are likely compiling the demo command line tools if print enabled */
 #if !defined(BACNET_ADDRESS_CACHE_FILE)
@@ -68,11 +71,34 @@ static uint32_t Own_Device_ID = 0xFFFFFFFF;
 #if !defined(MAX_ADDRESS_CACHE)
 #define MAX_ADDRESS_CACHE 255
 #endif
+/* number of timeouts in a row, of requests larger than any confirmed
+   request, before the max APDU of the path is lowered */
+#if !defined(ADDRESS_MAX_APDU_TIMEOUTS)
+#define ADDRESS_MAX_APDU_TIMEOUTS 3
+#endif
+/* smallest max APDU of the path that timeouts alone can lead to:
+   480 is the max APDU of MS/TP, use 206 for smaller data links */
+#if !defined(ADDRESS_MAX_APDU_TIMEOUT_MIN)
+#define ADDRESS_MAX_APDU_TIMEOUT_MIN 480
+#endif
+/* seconds until a learned max APDU of the path is forgotten, so that
+   the next large request probes the path again */
+#if !defined(ADDRESS_MAX_APDU_PATH_SECONDS)
+#define ADDRESS_MAX_APDU_PATH_SECONDS 3600UL
+#endif
 
 static struct Address_Cache_Entry {
     uint8_t Flags;
     uint32_t device_id;
     unsigned max_apdu;
+    /* largest APDU learned to get through the path, or 0 if none */
+    unsigned max_apdu_path;
+    /* largest APDU that was confirmed over the path */
+    unsigned max_apdu_confirmed;
+    /* mstimer_now() value when max_apdu_path was learned */
+    unsigned long max_apdu_path_time;
+    /* timeouts in a row of APDUs larger than max_apdu_confirmed */
+    uint8_t max_apdu_timeouts;
     BACNET_ADDRESS address;
     uint32_t TimeToLive;
 } Address_Cache[MAX_ADDRESS_CACHE];
@@ -97,6 +123,152 @@ static struct Address_Cache_Entry {
 #define BAC_ADDR_SHORT_TIME BAC_ADDR_SECS_1HOUR
 #define BAC_ADDR_FOREVER 0xFFFFFFFF /* Permanent entry */
 
+/* deadline of the next entry to expire */
+static struct tmwheel_timer Address_TTL_Timer;
+/* mstimer_now() value when the entries were last aged */
+static unsigned long Address_TTL_Time;
+
+/**
+ * Age the time to live of the entries, and remove the expired entries.
+ *
+ * @param uSeconds  Number of seconds the entries have aged
+ */
+static void address_cache_age(uint32_t uSeconds)
+{
+    struct Address_Cache_Entry *pMatch;
+    unsigned index;
+
+    for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
+        pMatch = &Address_Cache[index];
+        if (((pMatch->Flags & (BAC_ADDR_IN_USE | BAC_ADDR_RESERVED)) != 0) &&
+            ((pMatch->Flags & BAC_ADDR_STATIC) ==
+                0)) { /* Check all entries holding a slot except statics
+                       */
+            if (pMatch->TimeToLive >= uSeconds) {
+                pMatch->TimeToLive -= uSeconds;
+            } else {
+                pMatch->Flags = 0;
+            }
+        }
+    }
+}
+
+/**
+ * Age the entries by the whole seconds since they were last aged,
+ * before a time to live is changed or read.
+ */
+static void address_ttl_update(void)
+{
+    unsigned long elapsed = mstimer_now() - Address_TTL_Time;
+
+    if (elapsed >= 1000UL) {
+        Address_TTL_Time += (elapsed / 1000UL) * 1000UL;
+        address_cache_age((uint32_t)(elapsed / 1000UL));
+    }
+}
+
+/**
+ * Arm the timer for the next entry to expire.  An entry is removed
+ * when it has aged for longer than its time to live.  Entries that
+ * live longer than a day are checked again after a day.
+ */
+static void address_ttl_schedule(void)
+{
+    const struct Address_Cache_Entry *pMatch;
+    uint32_t ttl = BAC_ADDR_SECS_1DAY;
+    unsigned long elapsed, interval;
+    bool found = false;
+    unsigned index;
+
+    for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
+        pMatch = &Address_Cache[index];
+        if (((pMatch->Flags & (BAC_ADDR_IN_USE | BAC_ADDR_RESERVED)) != 0) &&
+            ((pMatch->Flags & BAC_ADDR_STATIC) == 0)) {
+            found = true;
+            if (pMatch->TimeToLive < ttl) {
+                ttl = pMatch->TimeToLive;
+            }
+        }
+    }
+    if (!found) {
+        /* nothing ages until an entry is added */
+        Address_TTL_Time = mstimer_now();
+        tmwheel_timer_cancel(&Address_TTL_Timer);
+        return;
+    }
+    elapsed = mstimer_now() - Address_TTL_Time;
+    interval = (ttl + 1UL) * 1000UL;
+    if (interval > elapsed) {
+        interval -= elapsed;
+    } else {
+        interval = 0;
+    }
+    tmwheel_timer_set(&Address_TTL_Timer, interval);
+}
+
+/**
+ * Remove the expired entries when the timer of the next entry to
+ * expire fires.
+ *
+ * @param timer  Timer that expired
+ * @param context  Not used
+ */
+static void address_ttl_timer_handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    (void)timer;
+    (void)context;
+    address_ttl_update();
+    address_ttl_schedule();
+}
+
+/**
+ * Set the address and max APDU of an entry.  What was learned about
+ * the path is kept, unless the entry is new or its address changed.
+ *
+ * @param pMatch  Cache entry
+ * @param max_apdu  Maximum APDU size from the device
+ * @param src  Address of the device
+ * @param new_entry  true if the entry did not have an address
+ */
+static void address_entry_set(struct Address_Cache_Entry *pMatch,
+    unsigned max_apdu,
+    BACNET_ADDRESS *src,
+    bool new_entry)
+{
+    if (new_entry || !bacnet_address_same(&pMatch->address, src)) {
+        pMatch->max_apdu_path = 0;
+        pMatch->max_apdu_confirmed = 0;
+        pMatch->max_apdu_timeouts = 0;
+    }
+    bacnet_address_copy(&pMatch->address, src);
+    pMatch->max_apdu = max_apdu;
+}
+
+/**
+ * Get the max APDU to use for requests to an entry: the max APDU of
+ * the device, or less if the path to it was learned to be smaller.
+ * A learned size that is older than ADDRESS_MAX_APDU_PATH_SECONDS is
+ * forgotten, so that the next larger request probes the path again.
+ *
+ * @param pMatch  Cache entry
+ * @return max APDU size to use
+ */
+static unsigned address_entry_max_apdu(struct Address_Cache_Entry *pMatch)
+{
+    if (pMatch->max_apdu_path &&
+        ((mstimer_now() - pMatch->max_apdu_path_time) >=
+            (ADDRESS_MAX_APDU_PATH_SECONDS * 1000UL))) {
+        pMatch->max_apdu_path = 0;
+        pMatch->max_apdu_timeouts = 0;
+    }
+    if (pMatch->max_apdu_path && (pMatch->max_apdu_path < pMatch->max_apdu)) {
+        return pMatch->max_apdu_path;
+    }
+
+    return pMatch->max_apdu;
+}
+
 /**
  * @brief Set the index of the first (top) address being protected.
  *
@@ -289,9 +461,14 @@ void address_init(void)
         pMatch = &Address_Cache[index];
         pMatch->Flags = 0;
     }
+    tmwheel_timer_cancel(&Address_TTL_Timer);
+    tmwheel_timer_init(&Address_TTL_Timer, address_ttl_timer_handler, NULL);
+    Address_TTL_Time = mstimer_now();
 #ifdef BACNET_ADDRESS_CACHE_FILE
     address_file_init(Address_Cache_Filename);
 #endif
+    address_ttl_schedule();
+    tsm_set_max_apdu_handler(address_max_apdu_learn);
     return;
 }
 
@@ -307,6 +484,9 @@ void address_init_partial(void)
     struct Address_Cache_Entry *pMatch;
     unsigned index;
 
+    tmwheel_timer_cancel(&Address_TTL_Timer);
+    tmwheel_timer_init(&Address_TTL_Timer, address_ttl_timer_handler, NULL);
+    Address_TTL_Time = mstimer_now();
     for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
         pMatch = &Address_Cache[index];
         if ((pMatch->Flags & BAC_ADDR_IN_USE) != 0) {
@@ -325,6 +505,8 @@ void address_init_partial(void)
 #ifdef BACNET_ADDRESS_CACHE_FILE
     address_file_init(Address_Cache_Filename);
 #endif
+    address_ttl_schedule();
+    tsm_set_max_apdu_handler(address_max_apdu_learn);
 
     return;
 }
@@ -345,6 +527,7 @@ void address_set_device_TTL(
     struct Address_Cache_Entry *pMatch;
     unsigned index;
 
+    address_ttl_update();
     for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
         pMatch = &Address_Cache[index];
         if (((pMatch->Flags & BAC_ADDR_IN_USE) != 0) &&
@@ -365,6 +548,7 @@ void address_set_device_TTL(
             break; /* Exit now if found at all - bound or unbound */
         }
     }
+    address_ttl_schedule();
 }
 
 /**
@@ -389,7 +573,7 @@ bool address_get_by_device(
                 /* If bound then fetch data */
                 bacnet_address_copy(src, &pMatch->address);
                 if (max_apdu) {
-                    *max_apdu = pMatch->max_apdu;
+                    *max_apdu = address_entry_max_apdu(pMatch);
                 }
                 /* Prove we found it */
                 found = true;
@@ -450,6 +634,7 @@ void address_add(uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
     if (Own_Device_ID == device_id) {
         return;
     }
+    address_ttl_update();
 
     /* Note: Previously this function would ignore bind request
        marked entries and in fact would probably overwrite the first
@@ -463,8 +648,8 @@ void address_add(uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
         /* Device already in the list, then update the values. */
         if (((pMatch->Flags & BAC_ADDR_IN_USE) != 0) &&
             (pMatch->device_id == device_id)) {
-            bacnet_address_copy(&pMatch->address, src);
-            pMatch->max_apdu = max_apdu;
+            address_entry_set(pMatch, max_apdu, src,
+                (pMatch->Flags & BAC_ADDR_BIND_REQ) != 0);
             /* Pick the right time to live */
             if ((pMatch->Flags & BAC_ADDR_BIND_REQ) != 0) {
                 /* Bind requested so long time */
@@ -492,8 +677,7 @@ void address_add(uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
             if ((pMatch->Flags & BAC_ADDR_IN_USE) == 0) {
                 pMatch->Flags = BAC_ADDR_IN_USE;
                 pMatch->device_id = device_id;
-                pMatch->max_apdu = max_apdu;
-                bacnet_address_copy(&pMatch->address, src);
+                address_entry_set(pMatch, max_apdu, src, true);
                 /* Opportunistic entry so leave on short fuse */
                 pMatch->TimeToLive = BAC_ADDR_SHORT_TIME;
                 found = true;
@@ -508,20 +692,18 @@ void address_add(uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
         if (pMatch != NULL) {
             pMatch->Flags = BAC_ADDR_IN_USE;
             pMatch->device_id = device_id;
-            pMatch->max_apdu = max_apdu;
-            bacnet_address_copy(&pMatch->address, src);
+            address_entry_set(pMatch, max_apdu, src, true);
             /* Opportunistic entry so leave on short fuse */
             pMatch->TimeToLive = BAC_ADDR_SHORT_TIME;
         }
     }
+    address_ttl_schedule();
     return;
 }
 
 /**
- * Check if the device is in the list. If yes, return the values.
- * Otherwise add the device to the list.
- * Returns true if device is already bound.
- * Also returns the address and max apdu if already bound.
+ * Look up or add a device, as address_device_bind_request() does,
+ * without aging the entries.
  *
  * @param device_id  Pointer to the device id variable for return.
  * @param device_ttl  Pointer to a variable taking the time to live in seconds.
@@ -530,7 +712,7 @@ void address_add(uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
  *
  * @return true if device is already bound
  */
-bool address_device_bind_request(uint32_t device_id,
+static bool address_device_bind(uint32_t device_id,
     uint32_t *device_ttl,
     unsigned *max_apdu,
     BACNET_ADDRESS *src)
@@ -551,7 +733,7 @@ bool address_device_bind_request(uint32_t device_id,
                     bacnet_address_copy(src, &pMatch->address);
                 }
                 if (max_apdu) {
-                    *max_apdu = pMatch->max_apdu;
+                    *max_apdu = address_entry_max_apdu(pMatch);
                 }
                 if (device_ttl) {
                     *device_ttl = pMatch->TimeToLive;
@@ -596,6 +778,33 @@ bool address_device_bind_request(uint32_t device_id,
     return (false);
 }
 
+/**
+ * Check if the device is in the list. If yes, return the values.
+ * Otherwise add the device to the list.
+ * Returns true if device is already bound.
+ * Also returns the address and max apdu if already bound.
+ *
+ * @param device_id  Pointer to the device id variable for return.
+ * @param device_ttl  Pointer to a variable taking the time to live in seconds.
+ * @param max_apdu  Max APDU size of the device.
+ * @param src  Pointer to the BACnet address.
+ *
+ * @return true if device is already bound
+ */
+bool address_device_bind_request(uint32_t device_id,
+    uint32_t *device_ttl,
+    unsigned *max_apdu,
+    BACNET_ADDRESS *src)
+{
+    bool found;
+
+    address_ttl_update();
+    found = address_device_bind(device_id, device_ttl, max_apdu, src);
+    address_ttl_schedule();
+
+    return found;
+}
+
 /**
  * Check if the device is in the list. If yes, return the values.
  * Otherwise add the device to the list.
@@ -627,13 +836,14 @@ void address_add_binding(
     struct Address_Cache_Entry *pMatch;
     unsigned index;
 
+    address_ttl_update();
     /* existing device or bind request - update address */
     for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
         pMatch = &Address_Cache[index];
         if (((pMatch->Flags & BAC_ADDR_IN_USE) != 0) &&
             (pMatch->device_id == device_id)) {
-            bacnet_address_copy(&pMatch->address, src);
-            pMatch->max_apdu = max_apdu;
+            address_entry_set(pMatch, max_apdu, src,
+                (pMatch->Flags & BAC_ADDR_BIND_REQ) != 0);
             /* Clear bind request flag in case it was set */
             pMatch->Flags &= ~BAC_ADDR_BIND_REQ;
             /* Only update TTL if not static */
@@ -644,9 +854,91 @@ void address_add_binding(
             break;
         }
     }
+    address_ttl_schedule();
     return;
 }
 
+/**
+ * Learn the max APDU of the path to a device from the outcome of a
+ * confirmed request.  A router on the path, such as one to an MS/TP
+ * network, may not carry the max APDU that the device accepts.
+ * A request that was too long limits later requests to the next smaller
+ * standard max APDU size, but not below a size that was confirmed.
+ * Requests larger than any confirmed one that time out
+ * ADDRESS_MAX_APDU_TIMEOUTS times in a row do the same, but not below
+ * ADDRESS_MAX_APDU_TIMEOUT_MIN, since a timeout may have other causes.
+ * The limit is used by address_get_by_device() and
+ * address_device_bind_request(), and is forgotten when the device
+ * address changes or ADDRESS_MAX_APDU_PATH_SECONDS after it was learned.
+ *
+ * @param dest  Address the request was sent to
+ * @param apdu_len  Length of the request APDU, without the NPDU header
+ * @param status  Whether the request was delivered, too long, or lost
+ */
+void address_max_apdu_learn(
+    BACNET_ADDRESS *dest, uint16_t apdu_len, BACNET_TSM_PDU_STATUS status)
+{
+    /* standard max APDU sizes, 50 being the smallest allowed */
+    static const uint16_t max_apdu_sizes[] = { 1024, 480, 206, 128 };
+    struct Address_Cache_Entry *pMatch;
+    unsigned next_size = 50;
+    unsigned limit;
+    unsigned index;
+
+    if (!dest || (apdu_len == 0)) {
+        return;
+    }
+    for (index = 0; index < sizeof(max_apdu_sizes) / sizeof(max_apdu_sizes[0]);
+         index++) {
+        if (max_apdu_sizes[index] < apdu_len) {
+            next_size = max_apdu_sizes[index];
+            break;
+        }
+    }
+    for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
+        pMatch = &Address_Cache[index];
+        if (((pMatch->Flags & (BAC_ADDR_IN_USE | BAC_ADDR_BIND_REQ)) !=
+                BAC_ADDR_IN_USE) ||
+            !bacnet_address_same(&pMatch->address, dest)) {
+            continue;
+        }
+        limit = next_size;
+        if (status == TSM_PDU_DELIVERED) {
+            if (apdu_len > pMatch->max_apdu_confirmed) {
+                pMatch->max_apdu_confirmed = apdu_len;
+            }
+            if (pMatch->max_apdu_path && (apdu_len > pMatch->max_apdu_path)) {
+                pMatch->max_apdu_path = apdu_len;
+            }
+            pMatch->max_apdu_timeouts = 0;
+            continue;
+        } else if (status == TSM_PDU_TIMEOUT) {
+            /* a timeout only counts when smaller requests got through */
+            if ((pMatch->max_apdu_confirmed == 0) ||
+                (apdu_len <= pMatch->max_apdu_confirmed) ||
+                (apdu_len <= ADDRESS_MAX_APDU_TIMEOUT_MIN)) {
+                continue;
+            }
+            pMatch->max_apdu_timeouts++;
+            if (pMatch->max_apdu_timeouts < ADDRESS_MAX_APDU_TIMEOUTS) {
+                continue;
+            }
+            if (limit < ADDRESS_MAX_APDU_TIMEOUT_MIN) {
+                limit = ADDRESS_MAX_APDU_TIMEOUT_MIN;
+            }
+        }
+        if ((pMatch->max_apdu_confirmed < apdu_len) &&
+            (pMatch->max_apdu_confirmed > limit)) {
+            limit = pMatch->max_apdu_confirmed;
+        }
+        if ((pMatch->max_apdu_path == 0) || (limit < pMatch->max_apdu_path)) {
+            pMatch->max_apdu_path = limit;
+        }
+        pMatch->max_apdu_path_time = mstimer_now();
+        pMatch->max_apdu_timeouts = 0;
+    }
+}
+
 /**
  * Return the device information from the given index in the table.
  *
@@ -998,29 +1290,21 @@ int rr_address_list_encode(uint8_t *apdu, BACNET_READ_RANGE_DATA *pRequest)
 
 /**
  * Scan the cache and eliminate any expired entries. Should be called
- * periodically to ensure the cache is managed correctly. If this function
- * is never called at all the whole cache is effectivly rendered static and
- * entries never expire unless explicitly deleted.
+ * periodically by applications that do not call tmwheel_run(), which
+ * removes each entry when it expires. If neither is called, the whole
+ * cache is effectivly rendered static and entries never expire unless
+ * explicitly deleted.
+ *
+ * The entries are aged by the mstimer_now() time since they were last
+ * aged, so calling both this function and tmwheel_run() does not age
+ * them twice.
  *
  * @param uSeconds  Approximate number of seconds since last call to this
  * function
  */
 void address_cache_timer(uint16_t uSeconds)
 {
-    struct Address_Cache_Entry *pMatch;
-    unsigned index;
-
-    for (index = 0; index < MAX_ADDRESS_CACHE; index++) {
-        pMatch = &Address_Cache[index];
-        if (((pMatch->Flags & (BAC_ADDR_IN_USE | BAC_ADDR_RESERVED)) != 0) &&
-            ((pMatch->Flags & BAC_ADDR_STATIC) ==
-                0)) { /* Check all entries holding a slot except statics
-                       */
-            if (pMatch->TimeToLive >= uSeconds) {
-                pMatch->TimeToLive -= uSeconds;
-            } else {
-                pMatch->Flags = 0;
-            }
-        }
-    }
+    (void)uSeconds;
+    address_ttl_update();
+    address_ttl_schedule();
 }
@@ -32,6 +32,7 @@
 /* BACnet Stack API */
 #include "bacnet/bacaddr.h"
 #include "bacnet/readrange.h"
+#include "bacnet/basic/tsm/tsm.h"
 
 /* refactored utility functions - see bacaddr.c module */
 #define address_mac_init(m,a,l) bacnet_address_mac_init(m,a,l)
@@ -109,6 +110,12 @@ extern "C" {
         unsigned max_apdu,
         BACNET_ADDRESS * src);
 
+    BACNET_STACK_EXPORT
+    void address_max_apdu_learn(
+        BACNET_ADDRESS * dest,
+        uint16_t apdu_len,
+        BACNET_TSM_PDU_STATUS status);
+
     BACNET_STACK_EXPORT
     int address_list_encode(
         uint8_t * apdu,
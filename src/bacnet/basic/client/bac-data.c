@@ -4,93 +4,231 @@
  * @date 2013
  * @brief Store properties from other BACnet devices
  *
+ * The remote points are kept in a chained hash table keyed by device,
+ * object, and property, and each point is allocated on its own so that
+ * the table grows with the number of points.  Each point is subscribed
+ * with SubscribeCOV (or SubscribeCOVProperty for properties other than
+ * Present_Value) and the subscription is renewed before the lifetime
+ * expires.  Points whose device refuses the subscription are polled
+ * using ReadPropertyMultiple requests that batch the due points of
+ * the same device, and fall back to ReadProperty if RPM is refused.
+ *
+ * Each device keeps a queue of its due points and one confirmed request
+ * in progress, matched by its invoke ID, so that requests to different
+ * devices overlap.
+ *
+ * Points are added from the task thread.  The stored values may be
+ * read from any thread without a lock: points are linked into the hash
+ * table after they are filled in and are never moved, and each point
+ * carries a sequence counter that is odd while its value is written.
+ *
  * SPDX-License-Identifier: MIT
  */
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
+#include "bacnet/apdu.h"
+#include "bacnet/bacdcode.h"
+#include "bacnet/cov.h"
+#include "bacnet/rpm.h"
+#include "bacnet/basic/binding/address.h"
+#include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/keylist.h"
 #include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/tsm/tsm.h"
 /* us */
 #include "bacnet/basic/client/bac-rw.h"
 #include "bacnet/basic/client/bac-data.h"
 
-/* number of objects data stored */
-#ifndef BACNET_DATA_OBJECT_MAX
-#define BACNET_DATA_OBJECT_MAX 16
+/* number of hash table buckets - must be a power of 2.  The table
+   holds any number of points; more buckets keep the chains short. */
+#ifndef BACNET_DATA_HASH_SIZE
+#define BACNET_DATA_HASH_SIZE 1024
+#endif
+#if (BACNET_DATA_HASH_SIZE & (BACNET_DATA_HASH_SIZE - 1))
+#error "BACNET_DATA_HASH_SIZE must be a power of 2"
+#endif
+/* number of points polled in one ReadPropertyMultiple request */
+#ifndef BACNET_DATA_RPM_MAX
+#define BACNET_DATA_RPM_MAX 16
 #endif
-/* Polling interval timer */
-static struct mstimer Object_Poll_Timer;
+/* number of points examined for expired timers in each call to the task */
+#ifndef BACNET_DATA_TASK_SCAN
+#define BACNET_DATA_TASK_SCAN 256
+#endif
+/* our subscriber process identifier */
+#ifndef BACNET_DATA_COV_PROCESS_ID
+#define BACNET_DATA_COV_PROCESS_ID 1
+#endif
+/* memory barrier for the lock-free readers */
+#if defined(__GNUC__)
+#define BACNET_DATA_BARRIER() __sync_synchronize()
+#else
+#define BACNET_DATA_BARRIER()
+#endif
+
+/* Polling interval */
+static unsigned int Poll_Seconds = 60;
+/* COV subscription lifetime - zero to poll only */
+static unsigned int COV_Lifetime_Seconds = 300;
 /* property R/W process interval timer */
 static struct mstimer Read_Write_Timer;
 
+/* states for each remote point */
+typedef enum {
+    BACNET_DATA_STATE_SUBSCRIBE,
+    BACNET_DATA_STATE_SUBSCRIBING,
+    BACNET_DATA_STATE_SUBSCRIBED,
+    BACNET_DATA_STATE_POLL,
+    BACNET_DATA_STATE_POLLING
+} BACNET_DATA_STATE;
+
+/* the confirmed request in progress for a device */
+typedef enum {
+    BACNET_DATA_REQUEST_NONE,
+    BACNET_DATA_REQUEST_SUBSCRIBE,
+    BACNET_DATA_REQUEST_RPM
+} BACNET_DATA_REQUEST_KIND;
+
+struct bacnet_data_device;
+
 /* variables for remote BACnet Object Data */
-typedef struct bacnet_object_data {
+typedef struct bacnet_data_object {
+    /* odd while the point is being written */
+    volatile uint32_t Sequence;
     uint32_t Device_ID;
     uint16_t Object_Type;
     uint32_t Object_ID;
-    struct bacnet_present_value {
-        /* application tag data type for writing */
-        uint8_t tag;
-        union {
-            bool Boolean;
-            float Real;
-            uint32_t Unsigned_Int;
-            int32_t Signed_Int;
-            uint32_t Enumerated;
-        } type;
-    } Present_Value;
-    bool refresh;
+    BACNET_PROPERTY_ID Object_Property;
+    BACNET_DATA_VALUE Value;
+    bool Valid;
+    bool COV_Refused;
+    bool RPM_Refused;
+    /* true while the point is in the queue of its device */
+    bool Queued;
+    uint8_t State;
+    /* time of the next subscription, renewal, or poll */
+    struct mstimer Timer;
+    struct bacnet_data_device *Device;
+    /* next point in the same hash bucket */
+    struct bacnet_data_object *volatile Hash_Next;
+    /* next point in the list of every point */
+    struct bacnet_data_object *Next;
+    /* next point in the queue of due points of the device */
+    struct bacnet_data_object *Queue_Next;
 } BACNET_DATA_OBJECT;
-static BACNET_DATA_OBJECT Object_Table[BACNET_DATA_OBJECT_MAX];
+
+/* variables for each remote device */
+typedef struct bacnet_data_device {
+    uint32_t Device_ID;
+    /* due points, oldest first */
+    BACNET_DATA_OBJECT *Queue_Head;
+    BACNET_DATA_OBJECT *Queue_Tail;
+    /* the confirmed request in progress */
+    BACNET_DATA_REQUEST_KIND Request_Kind;
+    uint8_t Request_Invoke_ID;
+    bool Request_Ack;
+    unsigned Request_Count;
+    BACNET_DATA_OBJECT *Request_Object[BACNET_DATA_RPM_MAX];
+    /* time of the next Who-Is or request attempt */
+    struct mstimer Timer;
+} BACNET_DATA_DEVICE;
+
+static BACNET_DATA_OBJECT *volatile Object_Hash[BACNET_DATA_HASH_SIZE];
+static BACNET_DATA_OBJECT *Object_List;
+static BACNET_DATA_OBJECT *Object_List_Tail;
+static BACNET_DATA_OBJECT *Object_Scan;
+/* remote devices keyed by device instance */
+static OS_Keylist Device_List;
+
+/* COV notification callback nodes */
+static BACNET_COV_NOTIFICATION Unconfirmed_COV_Notification;
+static BACNET_COV_NOTIFICATION Confirmed_COV_Notification;
+/* ReadPropertyMultiple ACK callback node */
+static BACNET_READ_WRITE_RPM_ACK_NODE RPM_Ack_Node;
+
+/**
+ * @brief Compute the hash table bucket of a remote point
+ * @param  device_instance - object-instance number of the device object
+ * @param  object_type - BACnet object type
+ * @param  object_instance - object-instance number of the object
+ * @param  object_property - property identifier
+ * @return the bucket of the point
+ */
+static unsigned bacnet_data_hash(uint32_t device_instance,
+    uint16_t object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property)
+{
+    uint32_t hash;
+
+    hash = device_instance * 0x9E3779B1UL;
+    hash ^= (((uint32_t)object_type << 22) ^ object_instance) * 0x85EBCA77UL;
+    hash ^= (uint32_t)object_property * 0xC2B2AE3DUL;
+    hash ^= hash >> 16;
+
+    return hash & (BACNET_DATA_HASH_SIZE - 1);
+}
 
 /**
- * @brief Find the index of a BACnet object type of a given instance.
+ * @brief Find a remote point
  * @param  device_instance - object-instance number of the device object
+ * @param  object_type - BACnet object type
  * @param  object_instance - object-instance number of the object
- * @return The index of the object sought, or BACNET_STATUS_ERROR if
- *  not found.
+ * @param  object_property - property identifier
+ * @return The point sought, or NULL if not found.
  */
-static int bacnet_data_object_index_find(
-    uint32_t device_instance, uint16_t object_type, uint32_t object_instance)
+static BACNET_DATA_OBJECT *bacnet_data_object_find(uint32_t device_instance,
+    uint16_t object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property)
 {
-    BACNET_DATA_OBJECT *object = NULL;
-    unsigned i = 0;
+    BACNET_DATA_OBJECT *object;
 
-    for (i = 0; i < BACNET_DATA_OBJECT_MAX; i++) {
-        object = &Object_Table[i];
+    object = Object_Hash[bacnet_data_hash(
+        device_instance, object_type, object_instance, object_property)];
+    while (object) {
         if ((object->Device_ID == device_instance) &&
             (object->Object_Type == object_type) &&
-            (object->Object_ID == object_instance)) {
-            return i;
+            (object->Object_ID == object_instance) &&
+            (object->Object_Property == object_property)) {
+            break;
         }
+        object = object->Hash_Next;
     }
 
-    return BACNET_STATUS_ERROR;
+    return object;
 }
 
 /**
- * @brief Find a free index of an BACnet value object type
- * @return The index of a free element, or BACNET_STATUS_ERROR if
- *  no free elements exist
+ * @brief Free every remote point and device
  */
-static int bacnet_data_object_index_find_free(void)
+static void bacnet_data_object_cleanup(void)
 {
-    BACNET_DATA_OBJECT *object = NULL;
-    unsigned i = 0;
+    BACNET_DATA_OBJECT *object;
+    BACNET_DATA_DEVICE *device;
 
-    for (i = 0; i < BACNET_DATA_OBJECT_MAX; i++) {
-        object = &Object_Table[i];
-        if ((object->Device_ID >= BACNET_MAX_INSTANCE) &&
-            (object->Object_Type == MAX_BACNET_OBJECT_TYPE) &&
-            (object->Object_ID >= BACNET_MAX_INSTANCE)) {
-            return i;
-        }
+    memset((void *)Object_Hash, 0, sizeof(Object_Hash));
+    while (Object_List) {
+        object = Object_List;
+        Object_List = object->Next;
+        free(object);
+    }
+    Object_List_Tail = NULL;
+    Object_Scan = NULL;
+    if (Device_List) {
+        do {
+            device = Keylist_Data_Pop(Device_List);
+            free(device);
+        } while (device);
+        Keylist_Delete(Device_List);
+        Device_List = NULL;
     }
-
-    return BACNET_STATUS_ERROR;
 }
 
 /**
@@ -98,53 +236,104 @@ static int bacnet_data_object_index_find_free(void)
  */
 static void bacnet_data_object_init(void)
 {
-    unsigned i = 0;
-    BACNET_DATA_OBJECT *object = NULL;
+    bacnet_data_object_cleanup();
+    Device_List = Keylist_Create();
+}
 
-    for (i = 0; i < BACNET_DATA_OBJECT_MAX; i++) {
-        object = &Object_Table[i];
-        object->Device_ID = BACNET_MAX_INSTANCE;
-        object->Object_Type = MAX_BACNET_OBJECT_TYPE;
-        object->Object_ID = BACNET_MAX_INSTANCE;
+/**
+ * @brief Set a timer that expires after an interval, where zero
+ *  expires right away
+ * @param timer - timer to set
+ * @param milliseconds - time until the timer expires, or zero for now
+ */
+static void bacnet_data_timer_set(
+    struct mstimer *timer, unsigned long milliseconds)
+{
+    /* an mstimer with a zero interval never expires */
+    if (milliseconds == 0) {
+        milliseconds = 1;
     }
+    mstimer_set(timer, milliseconds);
 }
 
-static void bacnet_data_object_store(int index,
-    BACNET_READ_PROPERTY_DATA *rp_data,
-    BACNET_APPLICATION_DATA_VALUE *value)
+/**
+ * @brief Set the time until the next action of a remote point
+ * @param object - remote point
+ * @param milliseconds - time until the action, or zero for now
+ */
+static void bacnet_data_object_timer_set(
+    BACNET_DATA_OBJECT *object, unsigned long milliseconds)
 {
-    BACNET_DATA_OBJECT *object = NULL;
+    bacnet_data_timer_set(&object->Timer, milliseconds);
+}
+
+/**
+ * @brief Store a decoded value in a remote point
+ * @param object - remote point
+ * @param value - decoded application data value
+ * @param cov - true if the value came from a COV notification
+ */
+static void bacnet_data_object_store(
+    BACNET_DATA_OBJECT *object, BACNET_APPLICATION_DATA_VALUE *value, bool cov)
+{
+    BACNET_DATA_VALUE data = { 0 };
+    uint8_t i, bits_used;
 
-    assert(rp_data != NULL);
     assert(value != NULL);
-    if ((index < BACNET_DATA_OBJECT_MAX) && (!value->context_specific)) {
-        object = &Object_Table[index];
-        switch (rp_data->object_property) {
-            case PROP_PRESENT_VALUE:
-                if (value->tag == BACNET_APPLICATION_TAG_REAL) {
-                    object->Present_Value.tag = value->tag;
-                    object->Present_Value.type.Real = value->type.Real;
-                }
-                if (value->tag == BACNET_APPLICATION_TAG_UNSIGNED_INT) {
-                    object->Present_Value.tag = value->tag;
-                    object->Present_Value.type.Unsigned_Int =
-                        value->type.Unsigned_Int;
-                }
-                if (value->tag == BACNET_APPLICATION_TAG_ENUMERATED) {
-                    object->Present_Value.tag = value->tag;
-                    object->Present_Value.type.Enumerated =
-                        value->type.Enumerated;
+    if ((!object) || (value->context_specific)) {
+        return;
+    }
+    data.tag = value->tag;
+    data.cov = cov;
+    switch (value->tag) {
+        case BACNET_APPLICATION_TAG_NULL:
+            break;
+        case BACNET_APPLICATION_TAG_BOOLEAN:
+            data.type.Boolean = value->type.Boolean;
+            break;
+        case BACNET_APPLICATION_TAG_UNSIGNED_INT:
+            data.type.Unsigned_Int = value->type.Unsigned_Int;
+            break;
+        case BACNET_APPLICATION_TAG_SIGNED_INT:
+            data.type.Signed_Int = value->type.Signed_Int;
+            break;
+        case BACNET_APPLICATION_TAG_REAL:
+            data.type.Real = value->type.Real;
+            break;
+#if defined(BACAPP_DOUBLE)
+        case BACNET_APPLICATION_TAG_DOUBLE:
+            data.type.Double = value->type.Double;
+            break;
+#endif
+        case BACNET_APPLICATION_TAG_ENUMERATED:
+            data.type.Enumerated = value->type.Enumerated;
+            break;
+        case BACNET_APPLICATION_TAG_BIT_STRING:
+            bits_used = bitstring_bits_used(&value->type.Bit_String);
+            if (bits_used > 32) {
+                bits_used = 32;
+            }
+            for (i = 0; i < bits_used; i++) {
+                if (bitstring_bit(&value->type.Bit_String, i)) {
+                    data.type.Bit_String |= (1UL << i);
                 }
-                break;
-            default:
-                break;
-        }
-        object->refresh = false;
+            }
+            break;
+        default:
+            /* only scalar values are cached */
+            return;
     }
+    object->Sequence++;
+    BACNET_DATA_BARRIER();
+    object->Value = data;
+    object->Valid = true;
+    BACNET_DATA_BARRIER();
+    object->Sequence++;
 }
 
 /**
- * @brief Find the index of an analog value object type of a given instance.
+ * @brief Save the value from a ReadProperty-ACK into a remote point
+ * @param device_instance - device instance of the source of the data
  * @param rp_data [in] Pointer to the BACNET_READ_PROPERTY_DATA structure,
  *  which is packed with the information from the ReadProperty request.
  * @param value [in] pointer to the BACNET_APPLICATION_DATA_VALUE structure
@@ -154,8 +343,6 @@ void bacnet_data_value_save(uint32_t device_instance,
     BACNET_READ_PROPERTY_DATA *rp_data,
     BACNET_APPLICATION_DATA_VALUE *value)
 {
-    int index = 0;
-
     if (!rp_data) {
         return;
     }
@@ -163,41 +350,482 @@ void bacnet_data_value_save(uint32_t device_instance,
         return;
     }
     if (value) {
-        switch (rp_data->object_type) {
-            case OBJECT_ANALOG_INPUT:
-            case OBJECT_ANALOG_OUTPUT:
-            case OBJECT_ANALOG_VALUE:
-            case OBJECT_BINARY_INPUT:
-            case OBJECT_BINARY_OUTPUT:
-            case OBJECT_BINARY_VALUE:
-            case OBJECT_MULTI_STATE_INPUT:
-            case OBJECT_MULTI_STATE_OUTPUT:
-            case OBJECT_MULTI_STATE_VALUE:
-                index = bacnet_data_object_index_find(device_instance,
-                    rp_data->object_type, rp_data->object_instance);
-                if (index != BACNET_STATUS_ERROR) {
-                    bacnet_data_object_store(index, rp_data, value);
+        bacnet_data_object_store(
+            bacnet_data_object_find(device_instance, rp_data->object_type,
+                rp_data->object_instance, rp_data->object_property),
+            value, false);
+    }
+}
+
+/**
+ * @brief Save the values from a COV notification into the remote points
+ * @param cov_data - decoded COV notification
+ */
+static void bacnet_data_cov_notification(BACNET_COV_DATA *cov_data)
+{
+    BACNET_PROPERTY_VALUE *property_value;
+
+    if (!cov_data) {
+        return;
+    }
+    property_value = cov_data->listOfValues;
+    while (property_value) {
+        bacnet_data_object_store(
+            bacnet_data_object_find(cov_data->initiatingDeviceIdentifier,
+                cov_data->monitoredObjectIdentifier.type,
+                cov_data->monitoredObjectIdentifier.instance,
+                property_value->propertyIdentifier),
+            &property_value->value, true);
+        property_value = property_value->next;
+    }
+}
+
+/**
+ * @brief Save one property from a ReadPropertyMultiple-ACK
+ * @param device_id [in] The device ID of the source of the message
+ * @param rp_data [in] The property data from the ACK
+ */
+static void bacnet_data_rpm_ack_process(
+    uint32_t device_id, BACNET_READ_PROPERTY_DATA *rp_data)
+{
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    int len;
+
+    if (rp_data->error_code != ERROR_CODE_SUCCESS) {
+        return;
+    }
+    len = bacapp_decode_application_data(rp_data->application_data,
+        rp_data->application_data_len, &value);
+    if (len > 0) {
+        bacnet_data_value_save(device_id, rp_data, &value);
+    }
+}
+
+/**
+ * @brief Find the device whose request in progress is acknowledged
+ * @param src [in] BACNET_ADDRESS of the source of the message
+ * @param kind - kind of request that is acknowledged
+ * @param invoke_id - invoke ID of the acknowledged request
+ * @return the device, or NULL if the request is not one of ours
+ */
+static BACNET_DATA_DEVICE *bacnet_data_request_device(
+    BACNET_ADDRESS *src, BACNET_DATA_REQUEST_KIND kind, uint8_t invoke_id)
+{
+    BACNET_DATA_DEVICE *device = NULL;
+    uint32_t device_id = 0;
+
+    if (address_get_device_id(src, &device_id)) {
+        device = Keylist_Data(Device_List, device_id);
+    }
+    if (device && (device->Request_Kind == kind) &&
+        (device->Request_Invoke_ID == invoke_id)) {
+        return device;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Save the data from the ReadPropertyMultiple ACK of our polling
+ *  request
+ * @param apdu [in] The contents of the service request.
+ * @param apdu_len [in] The length of the service_request.
+ * @param src [in] BACNET_ADDRESS of the source of the message
+ * @param service_data [in] The BACNET_CONFIRMED_SERVICE_DATA information
+ * decoded from the APDU header of this message.
+ * @return true if the ACK answered one of our requests
+ */
+static bool bacnet_data_rpm_ack_handler(uint8_t *apdu,
+    uint16_t apdu_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_ACK_DATA *service_data)
+{
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    BACNET_DATA_DEVICE *device;
+
+    device = bacnet_data_request_device(
+        src, BACNET_DATA_REQUEST_RPM, service_data->invoke_id);
+    if (!device) {
+        return false;
+    }
+    device->Request_Ack = true;
+    rpm_ack_object_property_process(apdu, apdu_len, device->Device_ID,
+        &rp_data, bacnet_data_rpm_ack_process);
+
+    return true;
+}
+
+/**
+ * @brief Handler for a SubscribeCOV or SubscribeCOVProperty Simple ACK
+ * @param src [in] BACNET_ADDRESS of the source of the message
+ * @param invoke_id [in] the invokeID from the acknowledged message
+ */
+static void bacnet_data_subscribe_ack_handler(
+    BACNET_ADDRESS *src, uint8_t invoke_id)
+{
+    BACNET_DATA_DEVICE *device;
+
+    device = bacnet_data_request_device(
+        src, BACNET_DATA_REQUEST_SUBSCRIBE, invoke_id);
+    if (device) {
+        device->Request_Ack = true;
+    }
+}
+
+/**
+ * @brief Determine if a remote point supports a COV subscription
+ * @param object - remote point
+ * @return true if a subscription should be attempted
+ */
+static bool bacnet_data_object_cov_enabled(BACNET_DATA_OBJECT *object)
+{
+    return (COV_Lifetime_Seconds > 0) && (!object->COV_Refused);
+}
+
+/**
+ * @brief Add a due remote point to the queue of its device
+ * @param object - remote point
+ */
+static void bacnet_data_object_enqueue(BACNET_DATA_OBJECT *object)
+{
+    BACNET_DATA_DEVICE *device = object->Device;
+
+    if (object->State == BACNET_DATA_STATE_SUBSCRIBED) {
+        /* time to renew */
+        object->State = BACNET_DATA_STATE_SUBSCRIBE;
+    }
+    if ((object->State == BACNET_DATA_STATE_SUBSCRIBE) &&
+        (!bacnet_data_object_cov_enabled(object))) {
+        object->State = BACNET_DATA_STATE_POLL;
+    }
+    object->Queued = true;
+    object->Queue_Next = NULL;
+    if (device->Queue_Tail) {
+        device->Queue_Tail->Queue_Next = object;
+    } else {
+        device->Queue_Head = object;
+    }
+    device->Queue_Tail = object;
+}
+
+/**
+ * @brief Remove the points that are no longer due from the queue of
+ *  a device
+ * @param device - remote device
+ */
+static void bacnet_data_device_queue_purge(BACNET_DATA_DEVICE *device)
+{
+    BACNET_DATA_OBJECT *object, *prior = NULL;
+
+    object = device->Queue_Head;
+    device->Queue_Head = NULL;
+    device->Queue_Tail = NULL;
+    while (object) {
+        if (mstimer_expired(&object->Timer) &&
+            (object->State != BACNET_DATA_STATE_SUBSCRIBING) &&
+            (object->State != BACNET_DATA_STATE_POLLING)) {
+            if (prior) {
+                prior->Queue_Next = object;
+            } else {
+                device->Queue_Head = object;
+            }
+            prior = object;
+            device->Queue_Tail = object;
+        } else {
+            object->Queued = false;
+        }
+        object = object->Queue_Next;
+    }
+    if (prior) {
+        prior->Queue_Next = NULL;
+    }
+}
+
+/**
+ * @brief Send a SubscribeCOV or SubscribeCOVProperty for a remote point
+ * @param object - remote point
+ * @return invoke ID of the request, or zero if not sent
+ */
+static uint8_t bacnet_data_subscribe_send(BACNET_DATA_OBJECT *object)
+{
+    BACNET_SUBSCRIBE_COV_DATA cov_data = { 0 };
+
+    cov_data.subscriberProcessIdentifier = BACNET_DATA_COV_PROCESS_ID;
+    cov_data.monitoredObjectIdentifier.type = object->Object_Type;
+    cov_data.monitoredObjectIdentifier.instance = object->Object_ID;
+    cov_data.cancellationRequest = false;
+    cov_data.issueConfirmedNotifications = false;
+    cov_data.lifetime = COV_Lifetime_Seconds;
+    if (object->Object_Property != PROP_PRESENT_VALUE) {
+        cov_data.covSubscribeToProperty = true;
+        cov_data.monitoredProperty.propertyIdentifier =
+            object->Object_Property;
+        cov_data.monitoredProperty.propertyArrayIndex = BACNET_ARRAY_ALL;
+    }
+
+    return Send_COV_Subscribe(object->Device_ID, &cov_data);
+}
+
+/**
+ * @brief Send a ReadPropertyMultiple for the queued points of a device
+ *  that are polled
+ * @param device - remote device
+ * @param max_apdu - maximum APDU accepted by the device
+ * @return invoke ID of the request, or zero if not sent
+ */
+static uint8_t bacnet_data_rpm_send(
+    BACNET_DATA_DEVICE *device, unsigned max_apdu)
+{
+    BACNET_READ_ACCESS_DATA read_access_data[BACNET_DATA_RPM_MAX];
+    BACNET_PROPERTY_REFERENCE property_list[BACNET_DATA_RPM_MAX];
+    BACNET_READ_ACCESS_DATA *rad, *rad_tail = NULL;
+    BACNET_PROPERTY_REFERENCE *property;
+    BACNET_DATA_OBJECT *object;
+    uint8_t pdu[MAX_PDU];
+    unsigned count = 0, rad_count = 0, limit, j;
+
+    /* each object with one property encodes in about 14 octets */
+    limit = (max_apdu > 20) ? ((max_apdu - 20) / 14) : 1;
+    if (limit > BACNET_DATA_RPM_MAX) {
+        limit = BACNET_DATA_RPM_MAX;
+    }
+    object = device->Queue_Head;
+    while (object && (count < limit)) {
+        if ((object->State == BACNET_DATA_STATE_POLL) &&
+            (!object->RPM_Refused)) {
+            property = &property_list[count];
+            property->propertyIdentifier = object->Object_Property;
+            property->propertyArrayIndex = BACNET_ARRAY_ALL;
+            property->value = NULL;
+            property->next = NULL;
+            /* group the properties of the same object */
+            rad = NULL;
+            for (j = 0; j < rad_count; j++) {
+                if ((read_access_data[j].object_type == object->Object_Type) &&
+                    (read_access_data[j].object_instance ==
+                        object->Object_ID)) {
+                    rad = &read_access_data[j];
+                    break;
+                }
+            }
+            if (rad) {
+                property->next = rad->listOfProperties;
+                rad->listOfProperties = property;
+            } else {
+                rad = &read_access_data[rad_count];
+                rad_count++;
+                rad->object_type = object->Object_Type;
+                rad->object_instance = object->Object_ID;
+                rad->listOfProperties = property;
+                rad->next = NULL;
+                if (rad_tail) {
+                    rad_tail->next = rad;
                 }
-                break;
-            case OBJECT_DEVICE:
-            default:
-                break;
+                rad_tail = rad;
+            }
+            device->Request_Object[count] = object;
+            count++;
         }
+        object = object->Queue_Next;
+    }
+    device->Request_Count = count;
+    if (count == 0) {
+        return 0;
     }
+
+    return Send_Read_Property_Multiple_Request(
+        pdu, sizeof(pdu), device->Device_ID, &read_access_data[0]);
 }
 
 /**
- * @brief Handles the BACnet Data Analog Value processing
- * @param object - BACnet object structure data pointer
+ * @brief Start the next request for the queued points of a device
+ * @param device - remote device
  */
-static void bacnet_data_object_process(BACNET_DATA_OBJECT *object)
+static void bacnet_data_device_process(BACNET_DATA_DEVICE *device)
 {
-    if (object && (object->Device_ID < BACNET_MAX_INSTANCE) &&
-        (object->Object_ID < BACNET_MAX_INSTANCE)) {
-        bacnet_read_property_queue(object->Device_ID,
-            (BACNET_OBJECT_TYPE)object->Object_Type, object->Object_ID,
-            PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+    BACNET_DATA_OBJECT *object = device->Queue_Head;
+    BACNET_ADDRESS dest = { 0 };
+    unsigned max_apdu = 0;
+    uint8_t invoke_id = 0;
+    unsigned i;
+
+    if (!address_bind_request(device->Device_ID, &max_apdu, &dest)) {
+        /* one Who-Is for the device each APDU timeout while binding */
+        Send_WhoIs(device->Device_ID, device->Device_ID);
+        bacnet_data_timer_set(&device->Timer, apdu_timeout());
+        return;
+    }
+    if (object->State == BACNET_DATA_STATE_SUBSCRIBE) {
+        invoke_id = bacnet_data_subscribe_send(object);
+        if (invoke_id) {
+            object->State = BACNET_DATA_STATE_SUBSCRIBING;
+            device->Request_Kind = BACNET_DATA_REQUEST_SUBSCRIBE;
+            device->Request_Count = 1;
+            device->Request_Object[0] = object;
+        }
+    } else if (object->RPM_Refused) {
+        if (bacnet_read_property_queue(object->Device_ID,
+                (BACNET_OBJECT_TYPE)object->Object_Type, object->Object_ID,
+                object->Object_Property, BACNET_ARRAY_ALL)) {
+            bacnet_data_object_timer_set(object, Poll_Seconds * 1000UL);
+            bacnet_data_device_queue_purge(device);
+        }
+        return;
+    } else {
+        invoke_id = bacnet_data_rpm_send(device, max_apdu);
+        if (invoke_id) {
+            for (i = 0; i < device->Request_Count; i++) {
+                device->Request_Object[i]->State = BACNET_DATA_STATE_POLLING;
+            }
+            device->Request_Kind = BACNET_DATA_REQUEST_RPM;
+        }
+    }
+    if (invoke_id) {
+        device->Request_Invoke_ID = invoke_id;
+        device->Request_Ack = false;
+        bacnet_data_device_queue_purge(device);
+    } else {
+        /* no invoke ID available, or the request did not fit */
+        device->Request_Count = 0;
+        bacnet_data_timer_set(&device->Timer, apdu_timeout());
+    }
+}
+
+/**
+ * @brief Update the points of the confirmed request of a device that
+ *  completed
+ * @param device - remote device
+ * @param ack - true if the request was acknowledged
+ * @param timeout - true if the request timed out
+ */
+static void bacnet_data_request_complete(
+    BACNET_DATA_DEVICE *device, bool ack, bool timeout)
+{
+    BACNET_DATA_OBJECT *object;
+    unsigned i;
+
+    for (i = 0; i < device->Request_Count; i++) {
+        object = device->Request_Object[i];
+        if (device->Request_Kind == BACNET_DATA_REQUEST_SUBSCRIBE) {
+            if (ack) {
+                /* renew at 80 percent of the lifetime */
+                object->State = BACNET_DATA_STATE_SUBSCRIBED;
+                bacnet_data_object_timer_set(object,
+                    (COV_Lifetime_Seconds - (COV_Lifetime_Seconds / 5)) *
+                        1000UL);
+            } else if (timeout) {
+                /* device is offline - try again after a poll interval */
+                object->State = BACNET_DATA_STATE_SUBSCRIBE;
+                bacnet_data_object_timer_set(object, Poll_Seconds * 1000UL);
+            } else {
+                /* error, reject, or abort - poll it now */
+                object->COV_Refused = true;
+                object->State = BACNET_DATA_STATE_POLL;
+                bacnet_data_object_timer_set(object, 0);
+            }
+        } else {
+            object->State = BACNET_DATA_STATE_POLL;
+            if (ack || timeout) {
+                bacnet_data_object_timer_set(object, Poll_Seconds * 1000UL);
+            } else {
+                /* RPM is refused - use ReadProperty for this point */
+                object->RPM_Refused = true;
+                bacnet_data_object_timer_set(object, 0);
+            }
+        }
+    }
+    device->Request_Kind = BACNET_DATA_REQUEST_NONE;
+    device->Request_Count = 0;
+}
+
+/**
+ * @brief Find a remote device, or add it if it is not yet stored
+ * @param device_id - ID of the remote device
+ * @return the device, or NULL if it could not be added
+ */
+static BACNET_DATA_DEVICE *bacnet_data_device_add(uint32_t device_id)
+{
+    BACNET_DATA_DEVICE *device;
+
+    device = Keylist_Data(Device_List, device_id);
+    if (!device) {
+        device = calloc(1, sizeof(BACNET_DATA_DEVICE));
+        if (device) {
+            device->Device_ID = device_id;
+            bacnet_data_timer_set(&device->Timer, 0);
+            if (Keylist_Data_Add(Device_List, device_id, device) < 0) {
+                free(device);
+                device = NULL;
+            }
+        }
+    }
+
+    return device;
+}
+
+/**
+ * @brief Adds a BACnet Data remote property point
+ * @param device_id - ID of the destination device
+ * @param object_type - Type of the object whose property is to be read.
+ * @param object_instance - Instance # of the object to be read.
+ * @param object_property - Property to be read, but not ALL, REQUIRED, or
+ *  OPTIONAL.
+ * @return true if added or existing, false if not added or existing
+ */
+bool bacnet_data_property_add(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property)
+{
+    BACNET_DATA_OBJECT *object = NULL;
+    BACNET_DATA_DEVICE *device = NULL;
+    unsigned bucket;
+
+    if ((device_id >= BACNET_MAX_INSTANCE) ||
+        (object_instance > BACNET_MAX_INSTANCE) ||
+        (object_property == PROP_ALL) || (object_property == PROP_REQUIRED) ||
+        (object_property == PROP_OPTIONAL)) {
+        return false;
+    }
+    object = bacnet_data_object_find(
+        device_id, object_type, object_instance, object_property);
+    if (object) {
+        if ((object->State == BACNET_DATA_STATE_POLL) ||
+            (object->State == BACNET_DATA_STATE_SUBSCRIBE)) {
+            /* refresh */
+            bacnet_data_object_timer_set(object, 0);
+        }
+        return true;
+    }
+    device = bacnet_data_device_add(device_id);
+    if (!device) {
+        return false;
     }
+    object = calloc(1, sizeof(BACNET_DATA_OBJECT));
+    if (!object) {
+        return false;
+    }
+    object->Device_ID = device_id;
+    object->Object_Type = object_type;
+    object->Object_ID = object_instance;
+    object->Object_Property = object_property;
+    object->State = BACNET_DATA_STATE_SUBSCRIBE;
+    object->Device = device;
+    bacnet_data_object_timer_set(object, 0);
+    if (Object_List_Tail) {
+        Object_List_Tail->Next = object;
+    } else {
+        Object_List = object;
+    }
+    Object_List_Tail = object;
+    /* publish the point last for the lock-free readers */
+    bucket = bacnet_data_hash(
+        device_id, object_type, object_instance, object_property);
+    object->Hash_Next = Object_Hash[bucket];
+    BACNET_DATA_BARRIER();
+    Object_Hash[bucket] = object;
+
+    return true;
 }
 
 /**
@@ -211,9 +839,7 @@ bool bacnet_data_object_add(uint32_t device_id,
     BACNET_OBJECT_TYPE object_type,
     uint32_t object_instance)
 {
-    BACNET_DATA_OBJECT *object = NULL;
     bool status = false;
-    int index = 0;
 
     switch (object_type) {
         case OBJECT_ANALOG_INPUT:
@@ -225,23 +851,8 @@ bool bacnet_data_object_add(uint32_t device_id,
         case OBJECT_MULTI_STATE_INPUT:
         case OBJECT_MULTI_STATE_OUTPUT:
         case OBJECT_MULTI_STATE_VALUE:
-            index = bacnet_data_object_index_find(
-                device_id, object_type, object_instance);
-            if (index == BACNET_STATUS_ERROR) {
-                index = bacnet_data_object_index_find_free();
-                if (index != BACNET_STATUS_ERROR) {
-                    object = &Object_Table[index];
-                    object->Device_ID = device_id;
-                    object->Object_Type = object_type;
-                    object->Object_ID = object_instance;
-                    object->refresh = true;
-                    status = true;
-                }
-            } else {
-                object = &Object_Table[index];
-                object->refresh = true;
-                status = true;
-            }
+            status = bacnet_data_property_add(
+                device_id, object_type, object_instance, PROP_PRESENT_VALUE);
             break;
         case OBJECT_DEVICE:
         default:
@@ -251,6 +862,73 @@ bool bacnet_data_object_add(uint32_t device_id,
     return status;
 }
 
+/**
+ * @brief Reads a stored property value without locking
+ * @param device_id - ID of the destination device
+ * @param object_type - BACnet object type
+ * @param object_instance - Instance # of the object
+ * @param object_property - property identifier
+ * @param value [out] property value stored if available
+ * @return true if the point exists and a value has been received
+ */
+bool bacnet_data_value(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_DATA_VALUE *value)
+{
+    BACNET_DATA_OBJECT *object = NULL;
+    BACNET_DATA_VALUE data;
+    uint32_t sequence;
+    bool valid;
+
+    object = bacnet_data_object_find(
+        device_id, object_type, object_instance, object_property);
+    if (!object) {
+        return false;
+    }
+    do {
+        sequence = object->Sequence;
+        BACNET_DATA_BARRIER();
+        data = object->Value;
+        valid = object->Valid;
+        BACNET_DATA_BARRIER();
+    } while ((sequence & 1) || (sequence != object->Sequence));
+    if (valid && value) {
+        *value = data;
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Reads a Present_Value that has been stored, and adds the
+ *  point if it is not yet stored
+ * @param device_id - ID of the destination device
+ * @param object_type - BACnet object type
+ * @param object_instance - Instance # of the object to be read.
+ * @param value [out] property value stored if available
+ * @return true if found
+ */
+static bool bacnet_data_present_value(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_DATA_VALUE *value)
+{
+    if (!bacnet_data_object_find(
+            device_id, object_type, object_instance, PROP_PRESENT_VALUE)) {
+        /* add to our object table if not found */
+        bacnet_data_object_add(device_id, object_type, object_instance);
+        return false;
+    }
+    if (!bacnet_data_value(device_id, object_type, object_instance,
+            PROP_PRESENT_VALUE, value)) {
+        memset(value, 0, sizeof(*value));
+    }
+
+    return true;
+}
+
 /**
  * @brief Reads a Property value that has been stored
  * @param device_id - ID of the destination device
@@ -264,21 +942,13 @@ bool bacnet_data_analog_present_value(uint32_t device_id,
     uint32_t object_instance,
     float *float_value)
 {
+    BACNET_DATA_VALUE value;
     bool status = false;
-    int index = 0;
-    BACNET_DATA_OBJECT *object = NULL;
 
-    index =
-        bacnet_data_object_index_find(device_id, object_type, object_instance);
-    if (index == BACNET_STATUS_ERROR) {
-        /* add to our object table if not found */
-        bacnet_data_object_add(device_id, object_type, object_instance);
-    } else {
-        status = true;
-        if (float_value) {
-            object = &Object_Table[index];
-            *float_value = object->Present_Value.type.Real;
-        }
+    status = bacnet_data_present_value(
+        device_id, object_type, object_instance, &value);
+    if (status && float_value) {
+        *float_value = value.type.Real;
     }
 
     return status;
@@ -297,25 +967,16 @@ bool bacnet_data_binary_present_value(uint32_t device_id,
     uint32_t object_instance,
     bool *bool_value)
 {
+    BACNET_DATA_VALUE value;
     bool status = false;
-    int index = 0;
-    BACNET_DATA_OBJECT *object = NULL;
 
-    index =
-        bacnet_data_object_index_find(device_id, object_type, object_instance);
-    if (index == BACNET_STATUS_ERROR) {
-        /* add to our object table if not found */
-        bacnet_data_object_add(
-            device_id, (BACNET_OBJECT_TYPE)object_type, object_instance);
-    } else {
-        status = true;
-        if (bool_value) {
-            object = &Object_Table[index];
-            if (object->Present_Value.type.Enumerated == BINARY_INACTIVE) {
-                *bool_value = false;
-            } else {
-                *bool_value = true;
-            }
+    status = bacnet_data_present_value(
+        device_id, (BACNET_OBJECT_TYPE)object_type, object_instance, &value);
+    if (status && bool_value) {
+        if (value.type.Enumerated == BINARY_INACTIVE) {
+            *bool_value = false;
+        } else {
+            *bool_value = true;
         }
     }
 
@@ -335,22 +996,13 @@ bool bacnet_data_multistate_present_value(uint32_t device_id,
     uint32_t object_instance,
     uint32_t *unsigned_value)
 {
+    BACNET_DATA_VALUE value;
     bool status = false;
-    int index = 0;
-    BACNET_DATA_OBJECT *object = NULL;
 
-    index =
-        bacnet_data_object_index_find(device_id, object_type, object_instance);
-    if (index == BACNET_STATUS_ERROR) {
-        /* add to our object table if not found */
-        bacnet_data_object_add(
-            device_id, (BACNET_OBJECT_TYPE)object_type, object_instance);
-    } else {
-        status = true;
-        if (unsigned_value) {
-            object = &Object_Table[index];
-            *unsigned_value = object->Present_Value.type.Unsigned_Int;
-        }
+    status = bacnet_data_present_value(
+        device_id, (BACNET_OBJECT_TYPE)object_type, object_instance, &value);
+    if (status && unsigned_value) {
+        *unsigned_value = (uint32_t)value.type.Unsigned_Int;
     }
 
     return status;
@@ -361,30 +1013,42 @@ bool bacnet_data_multistate_present_value(uint32_t device_id,
  */
 void bacnet_data_task(void)
 {
-    static unsigned object_index = 0;
     BACNET_DATA_OBJECT *object = NULL;
+    BACNET_DATA_DEVICE *device = NULL;
     unsigned i = 0;
+    int index = 0;
 
-    if (mstimer_expired(&Object_Poll_Timer)) {
-        mstimer_reset(&Object_Poll_Timer);
-        for (i = 0; i < BACNET_DATA_OBJECT_MAX; i++) {
-            object = &Object_Table[i];
-            object->refresh = true;
-        }
-    }
     if (mstimer_expired(&Read_Write_Timer)) {
         mstimer_reset(&Read_Write_Timer);
         bacnet_read_write_task();
     }
-    if (bacnet_read_write_idle()) {
-        object = &Object_Table[object_index];
-        if (object->refresh) {
-            object->refresh = false;
-            bacnet_data_object_process(object);
+    /* queue the points that are due on their devices */
+    for (i = 0; (i < BACNET_DATA_TASK_SCAN) && Object_List; i++) {
+        if (!Object_Scan) {
+            Object_Scan = Object_List;
         }
-        object_index++;
-        if (object_index >= BACNET_DATA_OBJECT_MAX) {
-            object_index = 0;
+        object = Object_Scan;
+        Object_Scan = object->Next;
+        if ((!object->Queued) &&
+            (object->State != BACNET_DATA_STATE_SUBSCRIBING) &&
+            (object->State != BACNET_DATA_STATE_POLLING) &&
+            mstimer_expired(&object->Timer)) {
+            bacnet_data_object_enqueue(object);
+        }
+    }
+    /* one confirmed request at a time for each device */
+    for (index = 0; index < Keylist_Count(Device_List); index++) {
+        device = Keylist_Data_Index(Device_List, index);
+        if (device->Request_Kind != BACNET_DATA_REQUEST_NONE) {
+            if (tsm_invoke_id_free(device->Request_Invoke_ID)) {
+                bacnet_data_request_complete(
+                    device, device->Request_Ack, false);
+            } else if (tsm_invoke_id_failed(device->Request_Invoke_ID)) {
+                tsm_free_invoke_id(device->Request_Invoke_ID);
+                bacnet_data_request_complete(device, false, true);
+            }
+        } else if (device->Queue_Head && mstimer_expired(&device->Timer)) {
+            bacnet_data_device_process(device);
         }
     }
 }
@@ -395,7 +1059,7 @@ void bacnet_data_task(void)
  */
 void bacnet_data_poll_seconds_set(unsigned int seconds)
 {
-    mstimer_set(&Object_Poll_Timer, seconds * 1000);
+    Poll_Seconds = seconds;
 }
 
 /**
@@ -404,7 +1068,25 @@ void bacnet_data_poll_seconds_set(unsigned int seconds)
  */
 unsigned int bacnet_data_poll_seconds(void)
 {
-    return mstimer_interval(&Object_Poll_Timer) * 1000;
+    return Poll_Seconds;
+}
+
+/**
+ * @brief Set the lifetime of the COV subscriptions
+ * @param seconds - subscription lifetime, or zero to poll all points
+ */
+void bacnet_data_cov_lifetime_set(unsigned int seconds)
+{
+    COV_Lifetime_Seconds = seconds;
+}
+
+/**
+ * @brief Get the lifetime of the COV subscriptions
+ * @return subscription lifetime in seconds
+ */
+unsigned int bacnet_data_cov_lifetime(void)
+{
+    return COV_Lifetime_Seconds;
 }
 
 /**
@@ -414,8 +1096,23 @@ void bacnet_data_init(void)
 {
     bacnet_data_object_init();
     bacnet_read_write_init();
-    /* start the cyclic poll timer */
-    mstimer_set(&Object_Poll_Timer, 1 * 60 * 1000);
     mstimer_set(&Read_Write_Timer, 10);
     bacnet_read_write_value_callback_set(bacnet_data_value_save);
+    /* the polled values, and the SubscribeCOV acknowledgements */
+    RPM_Ack_Node.callback = bacnet_data_rpm_ack_handler;
+    bacnet_read_write_rpm_ack_callback_add(&RPM_Ack_Node);
+    apdu_set_confirmed_simple_ack_handler(
+        SERVICE_CONFIRMED_SUBSCRIBE_COV, bacnet_data_subscribe_ack_handler);
+    apdu_set_confirmed_simple_ack_handler(
+        SERVICE_CONFIRMED_SUBSCRIBE_COV_PROPERTY,
+        bacnet_data_subscribe_ack_handler);
+    /* the values from the subscriptions */
+    apdu_set_unconfirmed_handler(
+        SERVICE_UNCONFIRMED_COV_NOTIFICATION, handler_ucov_notification);
+    apdu_set_confirmed_handler(
+        SERVICE_CONFIRMED_COV_NOTIFICATION, handler_ccov_notification);
+    Unconfirmed_COV_Notification.callback = bacnet_data_cov_notification;
+    handler_ucov_notification_add(&Unconfirmed_COV_Notification);
+    Confirmed_COV_Notification.callback = bacnet_data_cov_notification;
+    handler_ccov_notification_add(&Confirmed_COV_Notification);
 }
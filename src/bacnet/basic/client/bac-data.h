@@ -22,6 +22,24 @@ struct bacnet_status_flags_t {
     bool out_of_service : 1;
 };
 
+/* a cached remote property value */
+typedef struct bacnet_data_value_t {
+    /* application tag of the value */
+    uint8_t tag;
+    union {
+        bool Boolean;
+        BACNET_UNSIGNED_INTEGER Unsigned_Int;
+        int32_t Signed_Int;
+        float Real;
+        double Double;
+        uint32_t Enumerated;
+        /* the first 32 bits of a bit string */
+        uint32_t Bit_String;
+    } type;
+    /* true if the value came from a COV notification */
+    bool cov;
+} BACNET_DATA_VALUE;
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -43,6 +61,21 @@ bool bacnet_data_object_add(uint32_t device_id,
     BACNET_OBJECT_TYPE object_type,
     uint32_t object_instance);
 BACNET_STACK_EXPORT
+bool bacnet_data_property_add(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property);
+BACNET_STACK_EXPORT
+bool bacnet_data_value(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_DATA_VALUE *value);
+BACNET_STACK_EXPORT
+void bacnet_data_cov_lifetime_set(unsigned int seconds);
+BACNET_STACK_EXPORT
+unsigned int bacnet_data_cov_lifetime(void);
+BACNET_STACK_EXPORT
 bool bacnet_data_analog_present_value(uint32_t device_id,
     BACNET_OBJECT_TYPE object_type,
     uint32_t object_instance,
@@ -17,15 +17,41 @@
 /* BACnet Stack API */
 #include "bacnet/bactext.h"
 #include "bacnet/bacapp.h"
+#include "bacnet/bacint.h"
+#include "bacnet/apdu.h"
+#include "bacnet/rpm.h"
+#include "bacnet/basic/binding/address.h"
 #include "bacnet/basic/sys/mstimer.h"
 #include "bacnet/basic/sys/debug.h"
 #include "bacnet/basic/sys/keylist.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/property.h"
 /* us */
 #include "bacnet/basic/client/bac-rw.h"
 #include "bacnet/basic/client/bac-discover.h"
 
+/* number of ReadPropertyMultiple requests in progress at once,
+   each to a different device */
+#ifndef BACNET_DISCOVER_REQUESTS_MAX
+#define BACNET_DISCOVER_REQUESTS_MAX 16
+#endif
+/* number of property references in one ReadPropertyMultiple */
+#ifndef BACNET_DISCOVER_RPM_MAX
+#define BACNET_DISCOVER_RPM_MAX 64
+#endif
+/* estimated octets of one object with ALL properties in an RPM-ACK,
+   used to size the first request before it adapts */
+#ifndef BACNET_DISCOVER_OBJECT_OCTETS
+#define BACNET_DISCOVER_OBJECT_OCTETS 256
+#endif
+/* number of timeouts before the device is skipped until rediscovery */
+#ifndef BACNET_DISCOVER_RETRY_MAX
+#define BACNET_DISCOVER_RETRY_MAX 3
+#endif
+/* snapshot file identifier "BACD" and format version */
+#define BACNET_DISCOVER_SNAPSHOT_MAGIC 0x42414344UL
+#define BACNET_DISCOVER_SNAPSHOT_VERSION 1
 /* send a Who-Is to discover new devices */
 static struct mstimer WhoIs_Timer;
 /* property R/W process interval timer */
@@ -47,12 +73,16 @@ typedef enum bacnet_discover_state_enum {
     BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_REQUEST,
     BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE,
     BACNET_DISCOVER_STATE_OBJECT_NEXT,
+    BACNET_DISCOVER_STATE_REVISION,
+    BACNET_DISCOVER_STATE_REVISION_REQUEST,
     BACNET_DISCOVER_STATE_DONE
 } BACNET_DISCOVER_STATE;
 
 typedef struct bacnet_property_data_t {
     uint8_t *application_data;
     int application_data_len;
+    /* application data is in the snapshot buffer - not allocated */
+    bool snapshot;
 } BACNET_PROPERTY_DATA;
 
 typedef struct bacnet_object_data_t {
@@ -71,8 +101,33 @@ typedef struct bacnet_device_data_t {
     struct mstimer Discovery_Timer;
     unsigned long Discovery_Elapsed_Milliseconds;
     BACNET_DISCOVER_STATE Discovery_State;
+    /* used for discovering with ReadPropertyMultiple */
+    bool RPM_Refused;
+    bool Request_Pending;
+    BACNET_DISCOVER_STATE Request_State;
+    uint16_t Request_Count;
+    uint8_t Request_Retries;
+    /* elements or objects per request - halved when refused */
+    uint16_t List_Batch;
+    uint16_t Object_Batch;
+    /* set when a device loaded from a snapshot has changed */
+    bool Revision_Changed;
 } BACNET_DEVICE_DATA;
 
+/* ReadPropertyMultiple requests in progress */
+typedef struct bacnet_discover_request_t {
+    uint32_t device_id;
+    /* zero when the slot is free */
+    uint8_t invoke_id;
+    bool ack;
+} BACNET_DISCOVER_REQUEST;
+static BACNET_DISCOVER_REQUEST Request_Table[BACNET_DISCOVER_REQUESTS_MAX];
+static unsigned Requests_Max = BACNET_DISCOVER_REQUESTS_MAX;
+/* ReadPropertyMultiple ACK callback node */
+static BACNET_READ_WRITE_RPM_ACK_NODE RPM_Ack_Node;
+/* the loaded snapshot file, referenced by the property data */
+static uint8_t *Snapshot_Buffer;
+
 /**
  * @brief Add a ReadProperty reply data value to the property-list
  * @param list - Keylist to add the property to
@@ -110,7 +165,9 @@ static void bacnet_property_data_cleanup(OS_Keylist list)
     do {
         data = Keylist_Data_Pop(list);
         if (data) {
-            free(data->application_data);
+            if (!data->snapshot) {
+                free(data->application_data);
+            }
             free(data);
         }
     } while (data);
@@ -237,9 +294,9 @@ static BACNET_DEVICE_DATA *bacnet_device_data(
 }
 
 /**
- * @brief Remove all the device data from the device-list
+ * @brief Remove all the devices from the device-list, but keep the list
  */
-void bacnet_discover_cleanup(void)
+static void bacnet_device_data_cleanup(void)
 {
     BACNET_DEVICE_DATA *data = NULL;
 
@@ -250,7 +307,18 @@ void bacnet_discover_cleanup(void)
             free(data);
         }
     } while (data);
+    free(Snapshot_Buffer);
+    Snapshot_Buffer = NULL;
+}
+
+/**
+ * @brief Remove all the device data from the device-list
+ */
+void bacnet_discover_cleanup(void)
+{
+    bacnet_device_data_cleanup();
     Keylist_Delete(Device_List);
+    Device_List = NULL;
 }
 
 /**
@@ -620,7 +688,10 @@ static void bacnet_device_object_property_add(uint32_t device_id,
         if (rp_data->application_data_len > 0) {
             if (property_data->application_data_len !=
                 rp_data->application_data_len) {
-                free(property_data->application_data);
+                if (!property_data->snapshot) {
+                    free(property_data->application_data);
+                }
+                property_data->snapshot = false;
                 property_data->application_data =
                     calloc(1, rp_data->application_data_len);
             }
@@ -636,7 +707,10 @@ static void bacnet_device_object_property_add(uint32_t device_id,
                     bactext_property_name(rp_data->object_property));
             }
         } else {
-            free(property_data->application_data);
+            if (!property_data->snapshot) {
+                free(property_data->application_data);
+            }
+            property_data->snapshot = false;
             property_data->application_data = NULL;
             property_data->application_data_len = 0;
         }
@@ -724,12 +798,477 @@ static void bacnet_read_property_reply(uint32_t device_id,
     }
 }
 
+/**
+ * @brief Compare a Database_Revision or Last_Restore_Time with the value
+ *  stored for the device
+ * @param device_id [in] Device instance number where data originated
+ * @param rp_data [in] The property data from the ACK
+ * @return true if the property is different from the one stored
+ */
+static bool bacnet_discover_revision_changed(
+    uint32_t device_id, BACNET_READ_PROPERTY_DATA *rp_data)
+{
+    BACNET_DEVICE_DATA *device;
+    BACNET_OBJECT_DATA *object = NULL;
+    BACNET_PROPERTY_DATA *property = NULL;
+
+    device = Keylist_Data(Device_List, device_id);
+    if (device) {
+        object = Keylist_Data(device->Object_List,
+            KEY_ENCODE(rp_data->object_type, rp_data->object_instance));
+    }
+    if (object) {
+        property = Keylist_Data(object->Property_List, rp_data->object_property);
+    }
+    if (rp_data->error_code != ERROR_CODE_SUCCESS) {
+        /* an optional property that was not stored is unchanged */
+        return (property != NULL);
+    }
+    if (!property) {
+        return true;
+    }
+    if (property->application_data_len != rp_data->application_data_len) {
+        return true;
+    }
+    if ((rp_data->application_data_len > 0) &&
+        (memcmp(property->application_data, rp_data->application_data,
+             rp_data->application_data_len) != 0)) {
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Store one property from a ReadPropertyMultiple-ACK
+ * @param device_id [in] Device instance number where data originated
+ * @param rp_data [in] The property data from the ACK
+ */
+static void bacnet_discover_rpm_property_process(
+    uint32_t device_id, BACNET_READ_PROPERTY_DATA *rp_data)
+{
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    BACNET_DEVICE_DATA *device_data;
+    int len;
+
+    device_data = bacnet_device_data(Device_List, device_id);
+    if (!device_data) {
+        return;
+    }
+    if (device_data->Request_State == BACNET_DISCOVER_STATE_REVISION) {
+        if (bacnet_discover_revision_changed(device_id, rp_data)) {
+            device_data->Revision_Changed = true;
+        }
+        return;
+    }
+    if (rp_data->error_code != ERROR_CODE_SUCCESS) {
+        debug_printf("%u %s-%lu %s - %s\n", device_id,
+            bactext_object_type_name(rp_data->object_type),
+            (unsigned long)rp_data->object_instance,
+            bactext_property_name(rp_data->object_property),
+            bactext_error_code_name((int)rp_data->error_code));
+        return;
+    }
+    if ((rp_data->object_type == OBJECT_DEVICE) &&
+        (rp_data->object_instance == device_id) &&
+        (rp_data->object_property == PROP_OBJECT_LIST) &&
+        (rp_data->array_index != BACNET_ARRAY_ALL)) {
+        /* the size or one element of the object-list */
+        len = bacapp_decode_application_data(rp_data->application_data,
+            rp_data->application_data_len, &value);
+        if (len <= 0) {
+            return;
+        }
+    }
+    bacnet_device_object_property_add(device_id, rp_data, &value, device_data);
+}
+
+/**
+ * @brief Save the data from the ReadPropertyMultiple ACK of one of our
+ *  discovery requests
+ * @param apdu [in] The contents of the service request.
+ * @param apdu_len [in] The length of the service_request.
+ * @param src [in] BACNET_ADDRESS of the source of the message
+ * @param service_data [in] The BACNET_CONFIRMED_SERVICE_DATA information
+ * decoded from the APDU header of this message.
+ * @return true if the ACK answered one of our requests
+ */
+static bool bacnet_discover_rpm_ack_handler(uint8_t *apdu,
+    uint16_t apdu_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_ACK_DATA *service_data)
+{
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    uint32_t device_id = 0;
+    unsigned i;
+
+    if (address_get_device_id(src, &device_id)) {
+        for (i = 0; i < BACNET_DISCOVER_REQUESTS_MAX; i++) {
+            if ((Request_Table[i].invoke_id == service_data->invoke_id) &&
+                (Request_Table[i].device_id == device_id)) {
+                Request_Table[i].ack = true;
+                rpm_ack_object_property_process(apdu, apdu_len, device_id,
+                    &rp_data, bacnet_discover_rpm_property_process);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Send a ReadPropertyMultiple for the next part of a device
+ * @param device_id - Device ID from discovered device
+ * @param device_data - Pointer to the device data structure
+ * @param max_apdu - maximum APDU accepted by the device
+ * @return invoke ID of the request, or zero if not sent
+ */
+static uint8_t bacnet_discover_rpm_send(uint32_t device_id,
+    BACNET_DEVICE_DATA *device_data,
+    unsigned max_apdu)
+{
+    BACNET_READ_ACCESS_DATA read_access_data[BACNET_DISCOVER_RPM_MAX];
+    BACNET_PROPERTY_REFERENCE property_list[BACNET_DISCOVER_RPM_MAX];
+    uint8_t pdu[MAX_PDU];
+    unsigned count = 0, limit = 0, i;
+    KEY key = 0;
+
+    switch (device_data->Discovery_State) {
+        case BACNET_DISCOVER_STATE_REVISION:
+            /* has the device changed since the snapshot? */
+            property_list[0].propertyIdentifier = PROP_DATABASE_REVISION;
+            property_list[0].propertyArrayIndex = BACNET_ARRAY_ALL;
+            property_list[0].next = &property_list[1];
+            property_list[1].propertyIdentifier = PROP_LAST_RESTORE_TIME;
+            property_list[1].propertyArrayIndex = BACNET_ARRAY_ALL;
+            property_list[1].next = NULL;
+            count = 2;
+            break;
+        case BACNET_DISCOVER_STATE_INIT:
+            /* object-list size */
+            limit = 1;
+            property_list[0].propertyIdentifier = PROP_OBJECT_LIST;
+            property_list[0].propertyArrayIndex = 0;
+            property_list[0].next = NULL;
+            count = 1;
+            break;
+        case BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE:
+            /* each object-list element returns in about 12 octets */
+            limit = (max_apdu > 28) ? ((max_apdu - 16) / 12) : 1;
+            if (limit > device_data->List_Batch) {
+                limit = device_data->List_Batch;
+            }
+            for (count = 0; count < limit; count++) {
+                if ((device_data->Object_List_Index + count) >=
+                    device_data->Object_List_Size) {
+                    break;
+                }
+                property_list[count].propertyIdentifier = PROP_OBJECT_LIST;
+                property_list[count].propertyArrayIndex =
+                    device_data->Object_List_Index + count + 1;
+                property_list[count].next = NULL;
+                if (count > 0) {
+                    property_list[count - 1].next = &property_list[count];
+                }
+            }
+            break;
+        case BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE:
+            limit = device_data->Object_Batch;
+            for (count = 0; count < limit; count++) {
+                if (!Keylist_Index_Key(device_data->Object_List,
+                        device_data->Object_List_Index + count, &key)) {
+                    break;
+                }
+                property_list[count].propertyIdentifier = PROP_ALL;
+                property_list[count].propertyArrayIndex = BACNET_ARRAY_ALL;
+                property_list[count].next = NULL;
+                read_access_data[count].object_type = KEY_DECODE_TYPE(key);
+                read_access_data[count].object_instance = KEY_DECODE_ID(key);
+                read_access_data[count].listOfProperties =
+                    &property_list[count];
+                read_access_data[count].next = NULL;
+                if (count > 0) {
+                    read_access_data[count - 1].next =
+                        &read_access_data[count];
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    if (device_data->Discovery_State !=
+        BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE) {
+        read_access_data[0].object_type = OBJECT_DEVICE;
+        read_access_data[0].object_instance = device_id;
+        read_access_data[0].listOfProperties = &property_list[0];
+        read_access_data[0].next = NULL;
+    }
+    for (i = 0; i < count; i++) {
+        property_list[i].value = NULL;
+    }
+    device_data->Request_Count = count;
+
+    return Send_Read_Property_Multiple_Request(
+        pdu, sizeof(pdu), device_id, &read_access_data[0]);
+}
+
+/**
+ * @brief Complete the ReadPropertyMultiple request of a device
+ * @param device_id - Device ID from discovered device
+ * @param device_data - Pointer to the device data structure
+ * @param ack - true if the request was acknowledged
+ * @param timeout - true if the request timed out
+ */
+static void bacnet_discover_rpm_complete(uint32_t device_id,
+    BACNET_DEVICE_DATA *device_data,
+    bool ack,
+    bool timeout)
+{
+    unsigned count = device_data->Request_Count;
+
+    device_data->Request_Pending = false;
+    if (ack) {
+        device_data->Request_Retries = 0;
+    } else if (timeout) {
+        device_data->Request_Retries++;
+        if (device_data->Request_Retries > BACNET_DISCOVER_RETRY_MAX) {
+            debug_printf("%u not responding.\n", device_id);
+            device_data->Request_Retries = 0;
+            device_data->Discovery_Elapsed_Milliseconds =
+                mstimer_elapsed(&device_data->Discovery_Timer);
+            mstimer_set(&device_data->Discovery_Timer, Discovery_Milliseconds);
+            device_data->Discovery_State = BACNET_DISCOVER_STATE_DONE;
+            return;
+        }
+    }
+    switch (device_data->Request_State) {
+        case BACNET_DISCOVER_STATE_REVISION:
+            if (ack && !device_data->Revision_Changed) {
+                debug_printf("%u unchanged since the snapshot.\n", device_id);
+                device_data->Discovery_Elapsed_Milliseconds =
+                    mstimer_elapsed(&device_data->Discovery_Timer);
+                mstimer_set(
+                    &device_data->Discovery_Timer, Discovery_Milliseconds);
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_DONE;
+            } else if (timeout) {
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_REVISION;
+            } else {
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_INIT;
+            }
+            device_data->Revision_Changed = false;
+            break;
+        case BACNET_DISCOVER_STATE_INIT:
+            if (ack) {
+                if (device_data->Discovery_State ==
+                    BACNET_DISCOVER_STATE_OBJECT_LIST_SIZE_REQUEST) {
+                    /* object-list size not returned */
+                    device_data->Object_List_Size = 0;
+                }
+                device_data->Object_List_Index = 0;
+                device_data->Discovery_State =
+                    BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE;
+            } else if (timeout) {
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_INIT;
+            } else {
+                /* ReadPropertyMultiple is not supported */
+                debug_printf("%u RPM refused.\n", device_id);
+                device_data->RPM_Refused = true;
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_INIT;
+            }
+            break;
+        case BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE:
+            if (ack) {
+                device_data->Object_List_Index += count;
+            } else if (!timeout) {
+                if (count > 1) {
+                    /* likely too big for the device - ask for less */
+                    device_data->List_Batch = count / 2;
+                } else {
+                    /* skip the element */
+                    device_data->Object_List_Index++;
+                }
+            }
+            device_data->Discovery_State =
+                BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE;
+            break;
+        case BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE:
+            if (ack) {
+                device_data->Object_List_Index += count;
+            } else if (!timeout) {
+                if (count > 1) {
+                    /* likely too big for the device - ask for less */
+                    device_data->Object_Batch = count / 2;
+                } else {
+                    /* skip the object */
+                    device_data->Object_List_Index++;
+                }
+            }
+            device_data->Discovery_State =
+                BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Non-blocking task for running the ReadPropertyMultiple
+ *  discovery of a device
+ * @param device_id - Device ID from discovered device
+ * @param device_data - Pointer to the device data structure
+ */
+static void bacnet_discover_device_rpm_fsm(
+    uint32_t device_id, BACNET_DEVICE_DATA *device_data)
+{
+    BACNET_ADDRESS dest = { 0 };
+    unsigned max_apdu = 0;
+    uint8_t invoke_id = 0;
+    unsigned i, slot;
+
+    if (device_data->Request_Pending) {
+        return;
+    }
+    switch (device_data->Discovery_State) {
+        case BACNET_DISCOVER_STATE_REVISION:
+        case BACNET_DISCOVER_STATE_INIT:
+        case BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE:
+        case BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE:
+            break;
+        case BACNET_DISCOVER_STATE_OBJECT_LIST_SIZE_RESPONSE:
+            device_data->Object_List_Index = 0;
+            device_data->Discovery_State =
+                BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE;
+            break;
+        case BACNET_DISCOVER_STATE_DONE:
+            if (mstimer_expired(&device_data->Discovery_Timer)) {
+                mstimer_set(&device_data->Discovery_Timer, 0);
+                device_data->Discovery_State = BACNET_DISCOVER_STATE_INIT;
+            }
+            return;
+        default:
+            /* a response that arrived after its request completed */
+            return;
+    }
+    if ((device_data->Discovery_State ==
+            BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE) &&
+        (device_data->Object_List_Index >= device_data->Object_List_Size)) {
+        device_data->Object_List_Index = 0;
+        device_data->Discovery_State =
+            BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE;
+    }
+    if ((device_data->Discovery_State ==
+            BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_RESPONSE) &&
+        (device_data->Object_List_Index >=
+            (uint32_t)Keylist_Count(device_data->Object_List))) {
+        /* track the duration */
+        device_data->Discovery_Elapsed_Milliseconds =
+            mstimer_elapsed(&device_data->Discovery_Timer);
+        debug_printf("%u discovered in %lums.\n", device_id,
+            device_data->Discovery_Elapsed_Milliseconds);
+        /* rediscover in the future */
+        mstimer_set(&device_data->Discovery_Timer, Discovery_Milliseconds);
+        device_data->Discovery_State = BACNET_DISCOVER_STATE_DONE;
+        return;
+    }
+    /* the in-flight budget */
+    slot = Requests_Max;
+    for (i = 0; i < Requests_Max; i++) {
+        if (Request_Table[i].invoke_id == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot >= Requests_Max) {
+        return;
+    }
+    if (!address_get_by_device(device_id, &max_apdu, &dest)) {
+        return;
+    }
+    if (device_data->Discovery_State == BACNET_DISCOVER_STATE_INIT) {
+        device_data->List_Batch = BACNET_DISCOVER_RPM_MAX;
+        device_data->Object_Batch = max_apdu / BACNET_DISCOVER_OBJECT_OCTETS;
+        if (device_data->Object_Batch == 0) {
+            device_data->Object_Batch = 1;
+        }
+        if (device_data->Object_Batch > BACNET_DISCOVER_RPM_MAX) {
+            device_data->Object_Batch = BACNET_DISCOVER_RPM_MAX;
+        }
+    }
+    invoke_id = bacnet_discover_rpm_send(device_id, device_data, max_apdu);
+    if (invoke_id) {
+        Request_Table[slot].device_id = device_id;
+        Request_Table[slot].invoke_id = invoke_id;
+        Request_Table[slot].ack = false;
+        device_data->Request_Pending = true;
+        device_data->Request_State = device_data->Discovery_State;
+        switch (device_data->Discovery_State) {
+            case BACNET_DISCOVER_STATE_REVISION:
+                device_data->Revision_Changed = false;
+                device_data->Discovery_State =
+                    BACNET_DISCOVER_STATE_REVISION_REQUEST;
+                break;
+            case BACNET_DISCOVER_STATE_INIT:
+                device_data->Discovery_State =
+                    BACNET_DISCOVER_STATE_OBJECT_LIST_SIZE_REQUEST;
+                break;
+            case BACNET_DISCOVER_STATE_OBJECT_LIST_RESPONSE:
+                device_data->Discovery_State =
+                    BACNET_DISCOVER_STATE_OBJECT_LIST_REQUEST;
+                break;
+            default:
+                device_data->Discovery_State =
+                    BACNET_DISCOVER_STATE_OBJECT_GET_PROPERTY_REQUEST;
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Complete the ReadPropertyMultiple requests that are finished
+ */
+static void bacnet_discover_requests_task(void)
+{
+    BACNET_DISCOVER_REQUEST *request;
+    BACNET_DEVICE_DATA *device_data;
+    bool ack = false, timeout = false;
+    unsigned i;
+
+    for (i = 0; i < BACNET_DISCOVER_REQUESTS_MAX; i++) {
+        request = &Request_Table[i];
+        if (request->invoke_id == 0) {
+            continue;
+        }
+        if (tsm_invoke_id_free(request->invoke_id)) {
+            ack = request->ack;
+            timeout = false;
+        } else if (tsm_invoke_id_failed(request->invoke_id)) {
+            tsm_free_invoke_id(request->invoke_id);
+            ack = false;
+            timeout = true;
+        } else {
+            continue;
+        }
+        request->invoke_id = 0;
+        device_data = bacnet_device_data(Device_List, request->device_id);
+        if (device_data) {
+            bacnet_discover_rpm_complete(
+                request->device_id, device_data, ack, timeout);
+        }
+    }
+}
+
 /**
  * @brief Non-blocking task for running BACnet discover state machine
+ *  one ReadProperty at a time, for devices that refuse
+ *  ReadPropertyMultiple
  * @param device_id - Device ID from discovered device
  * @param device_data - Pointer to the device data structure
  */
-void bacnet_discover_device_fsm(
+static void bacnet_discover_device_rp_fsm(
     uint32_t device_id, BACNET_DEVICE_DATA *device_data)
 {
     KEY key = 0;
@@ -826,6 +1365,11 @@ void bacnet_discover_device_fsm(
                 device_data->Discovery_State = BACNET_DISCOVER_STATE_DONE;
             }
             break;
+        case BACNET_DISCOVER_STATE_REVISION:
+        case BACNET_DISCOVER_STATE_REVISION_REQUEST:
+            /* snapshot is not checked without ReadPropertyMultiple */
+            device_data->Discovery_State = BACNET_DISCOVER_STATE_INIT;
+            break;
         case BACNET_DISCOVER_STATE_DONE:
             /* finished getting all the object properties */
             if (mstimer_expired(&device_data->Discovery_Timer)) {
@@ -840,6 +1384,24 @@ void bacnet_discover_device_fsm(
     }
 }
 
+/**
+ * @brief Non-blocking task for running BACnet discover state machine
+ * @param device_id - Device ID from discovered device
+ * @param device_data - Pointer to the device data structure
+ */
+void bacnet_discover_device_fsm(
+    uint32_t device_id, BACNET_DEVICE_DATA *device_data)
+{
+    if (!device_data) {
+        return;
+    }
+    if (!device_data->RPM_Refused) {
+        bacnet_discover_device_rpm_fsm(device_id, device_data);
+    } else if (bacnet_read_write_idle()) {
+        bacnet_discover_device_rp_fsm(device_id, device_data);
+    }
+}
+
 /**
  * @brief Adds a device to the device list
  * @param device_id - Device ID from discovered device
@@ -1032,9 +1594,8 @@ void bacnet_discover_task(void)
         mstimer_restart(&Read_Write_Timer);
         bacnet_read_write_task();
     }
-    if (bacnet_read_write_idle()) {
-        bacnet_discover_devices_task();
-    }
+    bacnet_discover_requests_task();
+    bacnet_discover_devices_task();
 }
 
 /**
@@ -1093,6 +1654,283 @@ unsigned int bacnet_discover_seconds(void)
     return Discovery_Milliseconds = 1000;
 }
 
+/**
+ * @brief Set the number of ReadPropertyMultiple requests in progress at
+ *  once, each to a different device
+ * @param count - number of requests, 1..BACNET_DISCOVER_REQUESTS_MAX
+ */
+void bacnet_discover_requests_max_set(unsigned int count)
+{
+    if (count == 0) {
+        count = 1;
+    }
+    if (count > BACNET_DISCOVER_REQUESTS_MAX) {
+        count = BACNET_DISCOVER_REQUESTS_MAX;
+    }
+    Requests_Max = count;
+}
+
+/**
+ * @brief Get the number of ReadPropertyMultiple requests in progress at
+ *  once, each to a different device
+ * @return number of requests
+ */
+unsigned int bacnet_discover_requests_max(void)
+{
+    return Requests_Max;
+}
+
+/**
+ * @brief Write a 32-bit value to the snapshot file, big-endian
+ * @param file - snapshot file
+ * @param value - value to write
+ * @return true if the value was written
+ */
+static bool bacnet_discover_snapshot_write(FILE *file, uint32_t value)
+{
+    uint8_t buffer[4];
+
+    encode_unsigned32(buffer, value);
+
+    return (fwrite(buffer, sizeof(buffer), 1, file) == 1);
+}
+
+/**
+ * @brief Save the discovered devices, objects, and properties to a file.
+ *
+ *  The file is a sequence of 4-byte aligned, big-endian records:
+ *  header: magic, version, device-count, reserved
+ *  device: device-instance, object-count, object-list-size
+ *  object: object-key, property-count
+ *  property: property-identifier, length, data padded to 4 bytes
+ *
+ *  The file is written to pathname.tmp and renamed when complete,
+ *  so a reader never sees a partial snapshot.
+ * @param pathname - name of the snapshot file
+ * @return true if the snapshot was saved
+ */
+bool bacnet_discover_snapshot_save(const char *pathname)
+{
+    static const uint8_t pad[4] = { 0 };
+    FILE *file;
+    char *temp_pathname;
+    BACNET_DEVICE_DATA *device;
+    BACNET_OBJECT_DATA *object;
+    BACNET_PROPERTY_DATA *property;
+    int device_count, object_count, property_count;
+    int device_index, object_index, property_index;
+    KEY device_key, object_key, property_key;
+    size_t pad_len;
+    bool status;
+
+    if (!pathname) {
+        return false;
+    }
+    temp_pathname = malloc(strlen(pathname) + 5);
+    if (!temp_pathname) {
+        return false;
+    }
+    strcpy(temp_pathname, pathname);
+    strcat(temp_pathname, ".tmp");
+    file = fopen(temp_pathname, "wb");
+    if (!file) {
+        free(temp_pathname);
+        return false;
+    }
+    device_count = Keylist_Count(Device_List);
+    status = bacnet_discover_snapshot_write(
+                 file, BACNET_DISCOVER_SNAPSHOT_MAGIC) &&
+        bacnet_discover_snapshot_write(
+            file, BACNET_DISCOVER_SNAPSHOT_VERSION) &&
+        bacnet_discover_snapshot_write(file, (uint32_t)device_count) &&
+        bacnet_discover_snapshot_write(file, 0);
+    for (device_index = 0; status && (device_index < device_count);
+         device_index++) {
+        device = Keylist_Data_Index(Device_List, device_index);
+        Keylist_Index_Key(Device_List, device_index, &device_key);
+        object_count = Keylist_Count(device->Object_List);
+        status = bacnet_discover_snapshot_write(file, device_key) &&
+            bacnet_discover_snapshot_write(file, (uint32_t)object_count) &&
+            bacnet_discover_snapshot_write(file, device->Object_List_Size);
+        for (object_index = 0; status && (object_index < object_count);
+             object_index++) {
+            object = Keylist_Data_Index(device->Object_List, object_index);
+            Keylist_Index_Key(device->Object_List, object_index, &object_key);
+            property_count = Keylist_Count(object->Property_List);
+            status = bacnet_discover_snapshot_write(file, object_key) &&
+                bacnet_discover_snapshot_write(file, (uint32_t)property_count);
+            for (property_index = 0;
+                 status && (property_index < property_count);
+                 property_index++) {
+                property =
+                    Keylist_Data_Index(object->Property_List, property_index);
+                Keylist_Index_Key(
+                    object->Property_List, property_index, &property_key);
+                status = bacnet_discover_snapshot_write(file, property_key) &&
+                    bacnet_discover_snapshot_write(
+                        file, (uint32_t)property->application_data_len);
+                if (status && (property->application_data_len > 0)) {
+                    status = (fwrite(property->application_data,
+                                  property->application_data_len, 1,
+                                  file) == 1);
+                    pad_len = (4 - (property->application_data_len & 3)) & 3;
+                    if (status && pad_len) {
+                        status = (fwrite(pad, pad_len, 1, file) == 1);
+                    }
+                }
+            }
+        }
+    }
+    if (fclose(file) != 0) {
+        status = false;
+    }
+    if (status) {
+        /* rename() does not replace an existing file on every platform */
+        (void)remove(pathname);
+        status = (rename(temp_pathname, pathname) == 0);
+    }
+    if (!status) {
+        (void)remove(temp_pathname);
+    }
+    free(temp_pathname);
+
+    return status;
+}
+
+/**
+ * @brief Read a 32-bit value from the snapshot buffer
+ * @param offset - offset into the snapshot buffer, advanced by 4
+ * @param size - size of the snapshot buffer
+ * @param value - value that was read
+ * @return true if the value was within the buffer
+ */
+static bool
+bacnet_discover_snapshot_read(size_t *offset, size_t size, uint32_t *value)
+{
+    if ((size - *offset) < 4) {
+        return false;
+    }
+    decode_unsigned32(&Snapshot_Buffer[*offset], value);
+    *offset += 4;
+
+    return true;
+}
+
+/**
+ * @brief Load the discovered devices, objects, and properties from a file
+ *  written by bacnet_discover_snapshot_save().
+ *
+ *  The property data is not copied: it refers to the loaded file.
+ *  The loaded devices only read their Database_Revision and
+ *  Last_Restore_Time, and are discovered again only when either changed.
+ * @param pathname - name of the snapshot file
+ * @return true if the snapshot was loaded
+ */
+bool bacnet_discover_snapshot_load(const char *pathname)
+{
+    FILE *file;
+    long file_size;
+    size_t size = 0, offset = 0;
+    uint32_t magic = 0, version = 0, reserved = 0;
+    uint32_t device_count = 0, object_count = 0, property_count = 0;
+    uint32_t device_id = 0, object_key = 0, property_key = 0;
+    uint32_t object_list_size = 0, data_len = 0;
+    uint32_t device_index, object_index, property_index;
+    BACNET_DEVICE_DATA *device;
+    BACNET_OBJECT_DATA *object;
+    BACNET_PROPERTY_DATA *property;
+    bool status = false;
+
+    if (!pathname || !Device_List || Snapshot_Buffer ||
+        (Keylist_Count(Device_List) > 0)) {
+        return false;
+    }
+    file = fopen(pathname, "rb");
+    if (!file) {
+        return false;
+    }
+    if (fseek(file, 0, SEEK_END) == 0) {
+        file_size = ftell(file);
+        if ((file_size > 0) && (fseek(file, 0, SEEK_SET) == 0)) {
+            size = (size_t)file_size;
+            Snapshot_Buffer = malloc(size);
+        }
+    }
+    if (Snapshot_Buffer) {
+        status = (fread(Snapshot_Buffer, size, 1, file) == 1);
+    }
+    fclose(file);
+    if (status) {
+        status = bacnet_discover_snapshot_read(&offset, size, &magic) &&
+            bacnet_discover_snapshot_read(&offset, size, &version) &&
+            bacnet_discover_snapshot_read(&offset, size, &device_count) &&
+            bacnet_discover_snapshot_read(&offset, size, &reserved) &&
+            (magic == BACNET_DISCOVER_SNAPSHOT_MAGIC) &&
+            (version == BACNET_DISCOVER_SNAPSHOT_VERSION);
+    }
+    for (device_index = 0; status && (device_index < device_count);
+         device_index++) {
+        status = bacnet_discover_snapshot_read(&offset, size, &device_id) &&
+            bacnet_discover_snapshot_read(&offset, size, &object_count) &&
+            bacnet_discover_snapshot_read(&offset, size, &object_list_size) &&
+            (device_id < BACNET_MAX_INSTANCE);
+        device = NULL;
+        if (status) {
+            device = bacnet_device_data_add(device_id);
+            status = (device != NULL);
+        }
+        if (status) {
+            device->Object_List_Size = object_list_size;
+            device->Discovery_State = BACNET_DISCOVER_STATE_REVISION;
+        }
+        for (object_index = 0; status && (object_index < object_count);
+             object_index++) {
+            status =
+                bacnet_discover_snapshot_read(&offset, size, &object_key) &&
+                bacnet_discover_snapshot_read(&offset, size, &property_count);
+            object = NULL;
+            if (status) {
+                object = bacnet_object_data_add(device->Object_List,
+                    KEY_DECODE_TYPE(object_key), KEY_DECODE_ID(object_key));
+                status = (object != NULL);
+            }
+            for (property_index = 0;
+                 status && (property_index < property_count);
+                 property_index++) {
+                status = bacnet_discover_snapshot_read(
+                             &offset, size, &property_key) &&
+                    bacnet_discover_snapshot_read(&offset, size, &data_len) &&
+                    (data_len <= MAX_APDU) &&
+                    (((data_len + 3UL) & ~3UL) <= (size - offset));
+                property = NULL;
+                if (status) {
+                    property = bacnet_property_data_add(
+                        object->Property_List, property_key);
+                    status = (property != NULL);
+                }
+                if (status) {
+                    if (data_len > 0) {
+                        property->application_data = &Snapshot_Buffer[offset];
+                        property->snapshot = true;
+                    }
+                    property->application_data_len = (int)data_len;
+                    offset += (data_len + 3UL) & ~3UL;
+                }
+            }
+        }
+    }
+    if (status && (offset != size)) {
+        /* more than the devices that were saved */
+        status = false;
+    }
+    if (!status) {
+        /* discard anything loaded from a damaged snapshot */
+        bacnet_device_data_cleanup();
+    }
+
+    return status;
+}
+
 /**
  * @brief Set the millisecond timer for the read propcess (default=10ms)
  * @param milliseconds - read process task time
@@ -1153,4 +1991,6 @@ void bacnet_discover_init(void)
     }
     bacnet_read_write_value_callback_set(bacnet_read_property_reply);
     bacnet_read_write_device_callback_set(bacnet_discover_device_add);
+    RPM_Ack_Node.callback = bacnet_discover_rpm_ack_handler;
+    bacnet_read_write_rpm_ack_callback_add(&RPM_Ack_Node);
 }
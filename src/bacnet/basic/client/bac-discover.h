@@ -115,6 +115,16 @@ void bacnet_discover_seconds_set(unsigned int seconds);
 BACNET_STACK_EXPORT
 unsigned int bacnet_discover_seconds(void);
 
+BACNET_STACK_EXPORT
+void bacnet_discover_requests_max_set(unsigned int count);
+BACNET_STACK_EXPORT
+unsigned int bacnet_discover_requests_max(void);
+
+BACNET_STACK_EXPORT
+bool bacnet_discover_snapshot_save(const char *pathname);
+BACNET_STACK_EXPORT
+bool bacnet_discover_snapshot_load(const char *pathname);
+
 BACNET_STACK_EXPORT
 void bacnet_discover_read_process_milliseconds_set(unsigned long milliseconds);
 BACNET_STACK_EXPORT
@@ -34,6 +34,8 @@ static struct mstimer Read_Write_Timer;
 static bacnet_read_write_value_callback_t bacnet_read_write_value_callback;
 /* where the data from the I-Am is called */
 static bacnet_read_write_device_callback_t bacnet_read_write_device_callback;
+/* the modules that receive the ACKs of their ReadPropertyMultiple requests */
+static BACNET_READ_WRITE_RPM_ACK_NODE RPM_Ack_Head;
 
 /* states for client task */
 typedef enum {
@@ -289,8 +291,34 @@ static void My_Read_Property_Ack_Handler(uint8_t *service_request,
     }
 }
 
+/**
+ * @brief Add a callback for the ReadPropertyMultiple ACKs of the
+ *  requests of another module, such as bac-data or bac-discover
+ * @param node [in] list node of the callback, which must stay in memory
+ */
+void bacnet_read_write_rpm_ack_callback_add(
+    BACNET_READ_WRITE_RPM_ACK_NODE *node)
+{
+    BACNET_READ_WRITE_RPM_ACK_NODE *head;
+
+    head = &RPM_Ack_Head;
+    do {
+        if (head->next == node) {
+            /* already here! */
+            break;
+        } else if (!head->next) {
+            /* first available free node */
+            head->next = node;
+            break;
+        }
+        head = head->next;
+    } while (head);
+}
+
 /** Handler for a ReadPropertyMultiple ACK.
- *  Saves the data from a matching read-property-multiple request
+ *  Passes the ACK to each module callback in turn until one of them
+ *  matches it to its own request, or else saves the data from a
+ *  matching read-property-multiple request.
  *
  * @param service_request [in] The contents of the service request.
  * @param service_len [in] The length of the service_request.
@@ -303,9 +331,19 @@ static void My_Read_Property_Multiple_Ack_Handler(uint8_t *apdu,
     BACNET_ADDRESS *src,
     BACNET_CONFIRMED_SERVICE_ACK_DATA *service_data)
 {
+    BACNET_READ_WRITE_RPM_ACK_NODE *node;
     BACNET_READ_PROPERTY_DATA rp_data = { 0 };
     uint32_t device_id = 0;
 
+    node = RPM_Ack_Head.next;
+    while (node) {
+        if (node->callback &&
+            node->callback(apdu, apdu_len, src, service_data)) {
+            return;
+        }
+        node = node->next;
+    }
+
     address_get_device_id(src, &device_id);
     if (address_match(&Target_Address, src) &&
         (service_data->invoke_id == Request_Invoke_ID)) {
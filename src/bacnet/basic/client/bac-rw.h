@@ -12,6 +12,7 @@
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
+#include "bacnet/apdu.h"
 #include "bacnet/bacapp.h"
 #include "bacnet/rp.h"
 
@@ -41,6 +42,27 @@ typedef void (*bacnet_read_write_device_callback_t)(uint32_t device_instance,
     int segmentation,
     uint16_t vendor_id);
 
+/**
+ * Save the data from a ReadPropertyMultiple ACK of a module's own request
+ *
+ * @param apdu [in] The contents of the service request.
+ * @param apdu_len [in] The length of the service_request.
+ * @param src [in] BACNET_ADDRESS of the source of the message
+ * @param service_data [in] The BACNET_CONFIRMED_SERVICE_DATA information
+ *  decoded from the APDU header of this message.
+ * @return true if the ACK answered one of the requests of the module
+ */
+typedef bool (*bacnet_read_write_rpm_ack_callback_t)(uint8_t *apdu,
+    uint16_t apdu_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_ACK_DATA *service_data);
+
+/* list node of a ReadPropertyMultiple ACK callback */
+typedef struct bacnet_read_write_rpm_ack_node {
+    struct bacnet_read_write_rpm_ack_node *next;
+    bacnet_read_write_rpm_ack_callback_t callback;
+} BACNET_READ_WRITE_RPM_ACK_NODE;
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -52,6 +74,9 @@ void bacnet_read_write_task(void);
 BACNET_STACK_EXPORT
 bool bacnet_read_write_idle(void);
 BACNET_STACK_EXPORT
+void bacnet_read_write_rpm_ack_callback_add(
+    BACNET_READ_WRITE_RPM_ACK_NODE *node);
+BACNET_STACK_EXPORT
 bool bacnet_read_write_busy(void);
 BACNET_STACK_EXPORT
 bool bacnet_read_property_queue(uint32_t device_id,
@@ -34,6 +34,7 @@
 #include "bacnet/apdu.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/debug.h"
+#include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/datalink/datalink.h"
 
 #if PRINT_ENABLED
@@ -191,6 +192,15 @@ static void network_control_handler(BACNET_ADDRESS *src,
                     that are sent with a local unicast address. */
             }
             break;
+        case NETWORK_MESSAGE_REJECT_MESSAGE_TO_NETWORK:
+            /*  A router could not forward a request because it was
+                too long for the next hop: learn the path limit */
+            if ((npdu_len >= 3) &&
+                (npdu[0] == NETWORK_REJECT_MESSAGE_TOO_LONG)) {
+                (void)decode_unsigned16(&npdu[1], &dnet);
+                tsm_network_too_long(dnet);
+            }
+            break;
         default:
             break;
     }
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
@@ -37,10 +38,24 @@
 #include "bacnet/wp.h"
 #include "bacnet/basic/object/access_credential.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/keylist.h"
 
 static bool Access_Credential_Initialized = false;
 
-static ACCESS_CREDENTIAL_DESCR ac_descr[MAX_ACCESS_CREDENTIALS];
+/* Key List for storing the object data sorted by instance number  */
+static OS_Keylist Object_List;
+
+/* Index of the authentication factors of every credential, in an
+   open addressed hash table that doubles when 3/4 full */
+struct factor_index_slot {
+    ACCESS_CREDENTIAL_DESCR *credential;
+    uint32_t object_instance;
+    uint32_t hash;
+    uint8_t factor_index;
+};
+static struct factor_index_slot *Factor_Index;
+static size_t Factor_Index_Size;
+static size_t Factor_Index_Count;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -70,69 +85,247 @@ void Access_Credential_Property_Lists(
     return;
 }
 
+/**
+ * @brief Compute the hash of an authentication factor value
+ * @param factor - authentication factor
+ * @return hash of the format and value of the factor
+ */
+static uint32_t Authentication_Factor_Hash(BACNET_AUTHENTICATION_FACTOR *factor)
+{
+    uint32_t hash = 2166136261UL;
+    uint8_t *value;
+    size_t length;
+    size_t i;
+
+    value = octetstring_value(&factor->value);
+    length = octetstring_length(&factor->value);
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ value[i]) * 16777619UL;
+    }
+    hash ^= ((uint32_t)factor->format_type << 24) ^ factor->format_class;
+    hash *= 0x9E3779B1UL;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/**
+ * @brief Compare two authentication factors
+ * @param factor1 - authentication factor
+ * @param factor2 - authentication factor
+ * @return true if both have the same format and value
+ */
+static bool Authentication_Factor_Same(BACNET_AUTHENTICATION_FACTOR *factor1,
+    BACNET_AUTHENTICATION_FACTOR *factor2)
+{
+    return (factor1->format_type == factor2->format_type) &&
+        (factor1->format_class == factor2->format_class) &&
+        octetstring_value_same(&factor1->value, &factor2->value);
+}
+
+/**
+ * @brief Find the slot of an authentication factor in the index
+ * @param factor - authentication factor
+ * @param hash - hash of the authentication factor
+ * @return the slot of the factor, or of the empty slot where it would be
+ *  stored, or NULL if the index is empty
+ */
+static struct factor_index_slot *Factor_Index_Slot(
+    BACNET_AUTHENTICATION_FACTOR *factor, uint32_t hash)
+{
+    struct factor_index_slot *slot;
+    size_t index;
+
+    if (Factor_Index_Size == 0) {
+        return NULL;
+    }
+    index = hash & (Factor_Index_Size - 1);
+    for (;;) {
+        slot = &Factor_Index[index];
+        if (!slot->credential) {
+            break;
+        }
+        if ((slot->hash == hash) &&
+            Authentication_Factor_Same(factor,
+                &slot->credential->auth_factors[slot->factor_index]
+                     .authentication_factor)) {
+            break;
+        }
+        index = (index + 1) & (Factor_Index_Size - 1);
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Double the size of the index, and store every factor again
+ * @return true if the index was resized
+ */
+static bool Factor_Index_Grow(void)
+{
+    struct factor_index_slot *old_index = Factor_Index;
+    size_t old_size = Factor_Index_Size;
+    struct factor_index_slot *slot;
+    size_t size;
+    size_t i, index;
+
+    size = old_size ? old_size * 2 : 16;
+    Factor_Index = calloc(size, sizeof(struct factor_index_slot));
+    if (!Factor_Index) {
+        Factor_Index = old_index;
+        return false;
+    }
+    Factor_Index_Size = size;
+    for (i = 0; i < old_size; i++) {
+        if (old_index[i].credential) {
+            index = old_index[i].hash & (size - 1);
+            while (Factor_Index[index].credential) {
+                index = (index + 1) & (size - 1);
+            }
+            slot = &Factor_Index[index];
+            *slot = old_index[i];
+        }
+    }
+    free(old_index);
+
+    return true;
+}
+
+/**
+ * @brief Add an authentication factor of a credential to the index
+ * @param object_instance - object-instance number of the credential
+ * @param credential - credential object data
+ * @param factor_index - index of the factor in the credential
+ * @return true if added, false if the factor belongs to a credential
+ */
+static bool Factor_Index_Add(uint32_t object_instance,
+    ACCESS_CREDENTIAL_DESCR *credential,
+    uint8_t factor_index)
+{
+    BACNET_AUTHENTICATION_FACTOR *factor;
+    struct factor_index_slot *slot;
+    uint32_t hash;
+
+    factor = &credential->auth_factors[factor_index].authentication_factor;
+    hash = Authentication_Factor_Hash(factor);
+    slot = Factor_Index_Slot(factor, hash);
+    if (slot && slot->credential) {
+        return false;
+    }
+    if (((Factor_Index_Count + 1) * 4) > (Factor_Index_Size * 3)) {
+        if (!Factor_Index_Grow()) {
+            return false;
+        }
+        slot = Factor_Index_Slot(factor, hash);
+    }
+    slot->credential = credential;
+    slot->object_instance = object_instance;
+    slot->hash = hash;
+    slot->factor_index = factor_index;
+    Factor_Index_Count++;
+
+    return true;
+}
+
+/**
+ * @brief Remove the authentication factors of a credential from the index
+ * @param credential - credential object data
+ */
+static void Factor_Index_Remove(ACCESS_CREDENTIAL_DESCR *credential)
+{
+    BACNET_AUTHENTICATION_FACTOR *factor;
+    struct factor_index_slot *slot;
+    size_t hole, index, home;
+    uint32_t i;
+
+    for (i = 0; i < credential->auth_factors_count; i++) {
+        factor = &credential->auth_factors[i].authentication_factor;
+        slot = Factor_Index_Slot(factor, Authentication_Factor_Hash(factor));
+        if (!slot || (slot->credential != credential)) {
+            continue;
+        }
+        /* shift back the following entries of the probe sequence */
+        hole = (size_t)(slot - Factor_Index);
+        index = hole;
+        for (;;) {
+            index = (index + 1) & (Factor_Index_Size - 1);
+            if (!Factor_Index[index].credential) {
+                break;
+            }
+            home = Factor_Index[index].hash & (Factor_Index_Size - 1);
+            if (((index - home) & (Factor_Index_Size - 1)) >=
+                ((index - hole) & (Factor_Index_Size - 1))) {
+                Factor_Index[hole] = Factor_Index[index];
+                hole = index;
+            }
+        }
+        memset(&Factor_Index[hole], 0, sizeof(Factor_Index[hole]));
+        Factor_Index_Count--;
+    }
+}
+
+/**
+ * @brief Initialize the default Access Credential objects
+ */
 void Access_Credential_Init(void)
 {
     unsigned i;
 
     if (!Access_Credential_Initialized) {
         Access_Credential_Initialized = true;
-
+        if (!Object_List) {
+            Object_List = Keylist_Create();
+        }
         for (i = 0; i < MAX_ACCESS_CREDENTIALS; i++) {
-            ac_descr[i].global_identifier =
-                0; /* set to some meaningful value */
-            ac_descr[i].reliability = RELIABILITY_NO_FAULT_DETECTED;
-            ac_descr[i].credential_status = false;
-            ac_descr[i].reasons_count = 0;
-            ac_descr[i].auth_factors_count = 0;
-            memset(&ac_descr[i].activation_time, 0, sizeof(BACNET_DATE_TIME));
-            memset(&ac_descr[i].expiration_time, 0, sizeof(BACNET_DATE_TIME));
-            ac_descr[i].credential_disable = ACCESS_CREDENTIAL_DISABLE_NONE;
-            ac_descr[i].assigned_access_rights_count = 0;
+            Access_Credential_Create(i);
         }
     }
 
     return;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need validate that the */
-/* given instance exists */
+/**
+ * @brief Determines if a given Access Credential instance is valid
+ * @param object_instance - object-instance number of the object
+ * @return true if the instance is valid, and false if not
+ */
 bool Access_Credential_Valid_Instance(uint32_t object_instance)
 {
-    if (object_instance < MAX_ACCESS_CREDENTIALS) {
-        return true;
-    }
-
-    return false;
+    return Keylist_Data(Object_List, object_instance) != NULL;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then count how many you have */
+/**
+ * @brief Determines the number of Access Credential objects
+ * @return Number of Access Credential objects
+ */
 unsigned Access_Credential_Count(void)
 {
-    return MAX_ACCESS_CREDENTIALS;
+    return Keylist_Count(Object_List);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the instance */
-/* that correlates to the correct index */
+/**
+ * @brief Determines the object instance-number for a given 0..N index
+ * @param index - 0..N where N is Access_Credential_Count()
+ * @return object instance-number for the given index
+ */
 uint32_t Access_Credential_Index_To_Instance(unsigned index)
 {
-    return index;
+    KEY key = UINT32_MAX;
+
+    Keylist_Index_Key(Object_List, index, &key);
+
+    return key;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the index */
-/* that correlates to the correct instance number */
+/**
+ * @brief For a given object instance-number, determines a 0..N index
+ * @param object_instance - object-instance number of the object
+ * @return index for the given instance-number, or Access_Credential_Count()
+ *  if not valid.
+ */
 unsigned Access_Credential_Instance_To_Index(uint32_t object_instance)
 {
-    unsigned index = MAX_ACCESS_CREDENTIALS;
-
-    if (object_instance < MAX_ACCESS_CREDENTIALS) {
-        index = object_instance;
-    }
-
-    return index;
+    return Keylist_Index(Object_List, object_instance);
 }
 
 /* note: the object name must be unique within this device */
@@ -142,7 +335,7 @@ bool Access_Credential_Object_Name(
     static char text[32] = ""; /* okay for single thread */
     bool status = false;
 
-    if (object_instance < MAX_ACCESS_CREDENTIALS) {
+    if (Access_Credential_Valid_Instance(object_instance)) {
         snprintf(text, sizeof(text), "ACCESS CREDENTIAL %lu",
             (unsigned long)object_instance);
         status = characterstring_init_ansi(object_name, text);
@@ -165,11 +358,13 @@ static int Access_Credential_Authentication_Factor_Array_Encode(
     uint32_t object_instance, BACNET_ARRAY_INDEX index, uint8_t *apdu)
 {
     int apdu_len = BACNET_STATUS_ERROR;
+    ACCESS_CREDENTIAL_DESCR *pObject;
 
-    if (object_instance < MAX_ACCESS_CREDENTIALS) {
-        if (index < ac_descr[object_instance].auth_factors_count) {
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (pObject) {
+        if (index < pObject->auth_factors_count) {
             apdu_len = bacapp_encode_credential_authentication_factor(
-                apdu, &ac_descr[object_instance].auth_factors[index]);
+                apdu, &pObject->auth_factors[index]);
         }
     }
 
@@ -190,11 +385,13 @@ static int Access_Credential_Assigned_Access_Rights_Array_Encode(
     uint32_t object_instance, BACNET_ARRAY_INDEX index, uint8_t *apdu)
 {
     int apdu_len = BACNET_STATUS_ERROR;
+    ACCESS_CREDENTIAL_DESCR *pObject;
 
-    if (object_instance < MAX_ACCESS_CREDENTIALS) {
-        if (index < ac_descr[object_instance].assigned_access_rights_count) {
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (pObject) {
+        if (index < pObject->assigned_access_rights_count) {
             apdu_len = bacapp_encode_assigned_access_rights(
-                apdu, &ac_descr[object_instance].assigned_access_rights[index]);
+                apdu, &pObject->assigned_access_rights[index]);
         }
     }
 
@@ -209,7 +406,7 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     int apdu_len = 0; /* return value */
     BACNET_BIT_STRING bit_string;
     BACNET_CHARACTER_STRING char_string;
-    unsigned object_index = 0;
+    ACCESS_CREDENTIAL_DESCR *pObject;
     unsigned i = 0;
     uint8_t *apdu = NULL;
 
@@ -217,9 +414,14 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         (rpdata->application_data_len == 0)) {
         return 0;
     }
+    pObject = Keylist_Data(Object_List, rpdata->object_instance);
+    if (!pObject) {
+        rpdata->error_class = ERROR_CLASS_OBJECT;
+        rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return BACNET_STATUS_ERROR;
+    }
     apdu = rpdata->application_data;
     apdu_size = rpdata->application_data_len;
-    object_index = Access_Credential_Instance_To_Index(rpdata->object_instance);
     switch (rpdata->object_property) {
         case PROP_OBJECT_IDENTIFIER:
             apdu_len = encode_application_object_id(
@@ -237,7 +439,7 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_GLOBAL_IDENTIFIER:
             apdu_len = encode_application_unsigned(
-                &apdu[0], ac_descr[object_index].global_identifier);
+                &apdu[0], pObject->global_identifier);
             break;
         case PROP_STATUS_FLAGS:
             bitstring_init(&bit_string);
@@ -249,16 +451,16 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_RELIABILITY:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ac_descr[object_index].reliability);
+                &apdu[0], pObject->reliability);
             break;
         case PROP_CREDENTIAL_STATUS:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ac_descr[object_index].credential_status);
+                &apdu[0], pObject->credential_status);
             break;
         case PROP_REASON_FOR_DISABLE:
-            for (i = 0; i < ac_descr[object_index].reasons_count; i++) {
+            for (i = 0; i < pObject->reasons_count; i++) {
                 len = encode_application_enumerated(
-                    &apdu[0], ac_descr[object_index].reason_for_disable[i]);
+                    &apdu[0], pObject->reason_for_disable[i]);
                 if (apdu_len + len < MAX_APDU) {
                     apdu_len += len;
                 } else {
@@ -273,7 +475,7 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             apdu_len = bacnet_array_encode(rpdata->object_instance,
                 rpdata->array_index, 
                 Access_Credential_Authentication_Factor_Array_Encode,
-                ac_descr[object_index].auth_factors_count, apdu, apdu_size);
+                pObject->auth_factors_count, apdu, apdu_size);
             if (apdu_len == BACNET_STATUS_ABORT) {
                 rpdata->error_code =
                     ERROR_CODE_ABORT_SEGMENTATION_NOT_SUPPORTED;
@@ -284,21 +486,21 @@ int Access_Credential_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_ACTIVATION_TIME:
             apdu_len = bacapp_encode_datetime(
-                &apdu[0], &ac_descr[object_index].activation_time);
+                &apdu[0], &pObject->activation_time);
             break;
         case PROP_EXPIRATION_TIME:
             apdu_len = bacapp_encode_datetime(
-                &apdu[0], &ac_descr[object_index].expiration_time);
+                &apdu[0], &pObject->expiration_time);
             break;
         case PROP_CREDENTIAL_DISABLE:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ac_descr[object_index].credential_disable);
+                &apdu[0], pObject->credential_disable);
             break;
         case PROP_ASSIGNED_ACCESS_RIGHTS:
             apdu_len = bacnet_array_encode(rpdata->object_instance,
                 rpdata->array_index, 
                 Access_Credential_Assigned_Access_Rights_Array_Encode,
-                ac_descr[object_index].assigned_access_rights_count, apdu, apdu_size);
+                pObject->assigned_access_rights_count, apdu, apdu_size);
             if (apdu_len == BACNET_STATUS_ABORT) {
                 rpdata->error_code =
                     ERROR_CODE_ABORT_SEGMENTATION_NOT_SUPPORTED;
@@ -332,7 +534,7 @@ bool Access_Credential_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     bool status = false; /* return value */
     int len = 0;
     BACNET_APPLICATION_DATA_VALUE value;
-    unsigned object_index = 0;
+    ACCESS_CREDENTIAL_DESCR *pObject;
 
     /* decode the some of the request */
     len = bacapp_decode_application_data(
@@ -352,14 +554,18 @@ bool Access_Credential_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
         wp_data->error_code = ERROR_CODE_PROPERTY_IS_NOT_AN_ARRAY;
         return false;
     }
-    object_index =
-        Access_Credential_Instance_To_Index(wp_data->object_instance);
+    pObject = Keylist_Data(Object_List, wp_data->object_instance);
+    if (!pObject) {
+        wp_data->error_class = ERROR_CLASS_OBJECT;
+        wp_data->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return false;
+    }
     switch (wp_data->object_property) {
         case PROP_GLOBAL_IDENTIFIER:
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_UNSIGNED_INT);
             if (status) {
-                ac_descr[object_index].global_identifier =
+                pObject->global_identifier =
                     value.type.Unsigned_Int;
             }
             break;
@@ -386,3 +592,244 @@ bool Access_Credential_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 
     return status;
 }
+
+/**
+ * @brief Add an authentication factor to a credential
+ * @param object_instance - object-instance number of the object
+ * @param value - authentication factor, which must not belong to
+ *  any credential
+ * @return true if the authentication factor was added
+ */
+bool Access_Credential_Authentication_Factor_Add(uint32_t object_instance,
+    BACNET_CREDENTIAL_AUTHENTICATION_FACTOR *value)
+{
+    ACCESS_CREDENTIAL_DESCR *pObject;
+    uint32_t index;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !value) {
+        return false;
+    }
+    index = pObject->auth_factors_count;
+    if (index >= MAX_AUTHENTICATION_FACTORS) {
+        return false;
+    }
+    pObject->auth_factors[index] = *value;
+    if (!Factor_Index_Add(object_instance, pObject, (uint8_t)index)) {
+        return false;
+    }
+    pObject->auth_factors_count++;
+
+    return true;
+}
+
+/**
+ * @brief Remove every authentication factor of a credential
+ * @param object_instance - object-instance number of the object
+ * @return true if the object exists
+ */
+bool Access_Credential_Authentication_Factor_Delete_All(
+    uint32_t object_instance)
+{
+    ACCESS_CREDENTIAL_DESCR *pObject;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        return false;
+    }
+    Factor_Index_Remove(pObject);
+    pObject->auth_factors_count = 0;
+
+    return true;
+}
+
+/**
+ * @brief Find the credential that holds an authentication factor
+ * @param factor - authentication factor presented at an access point
+ * @param object_instance [out] object-instance number of the credential
+ * @return true if a credential holds the authentication factor
+ */
+bool Access_Credential_Authentication_Factor_Find(
+    BACNET_AUTHENTICATION_FACTOR *factor, uint32_t *object_instance)
+{
+    struct factor_index_slot *slot;
+
+    if (!factor) {
+        return false;
+    }
+    slot = Factor_Index_Slot(factor, Authentication_Factor_Hash(factor));
+    if (!slot || !slot->credential) {
+        return false;
+    }
+    if (object_instance) {
+        *object_instance = slot->object_instance;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decide whether a presented authentication factor is accepted,
+ *  from the credential that holds it.  The access rights of the
+ *  credential are not evaluated here.
+ * @param factor - authentication factor presented at an access point
+ * @param now - current date and time
+ * @param object_instance [out] object-instance number of the credential
+ * @return ACCESS_EVENT_GRANTED, or the reason the factor was denied
+ */
+BACNET_ACCESS_EVENT Access_Credential_Authorize(
+    BACNET_AUTHENTICATION_FACTOR *factor,
+    BACNET_DATE_TIME *now,
+    uint32_t *object_instance)
+{
+    struct factor_index_slot *slot;
+    ACCESS_CREDENTIAL_DESCR *pObject;
+
+    if (!factor) {
+        return ACCESS_EVENT_DENIED_UNKNOWN_CREDENTIAL;
+    }
+    slot = Factor_Index_Slot(factor, Authentication_Factor_Hash(factor));
+    if (!slot || !slot->credential) {
+        return ACCESS_EVENT_DENIED_UNKNOWN_CREDENTIAL;
+    }
+    if (object_instance) {
+        *object_instance = slot->object_instance;
+    }
+    pObject = slot->credential;
+    switch (pObject->auth_factors[slot->factor_index].disable) {
+        case ACCESS_AUTHENTICATION_FACTOR_DISABLE_NONE:
+            break;
+        case ACCESS_AUTHENTICATION_FACTOR_DISABLE_DISABLED_LOST:
+            return ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_LOST;
+        case ACCESS_AUTHENTICATION_FACTOR_DISABLE_DISABLED_STOLEN:
+            return ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_STOLEN;
+        case ACCESS_AUTHENTICATION_FACTOR_DISABLE_DISABLED_DAMAGED:
+            return ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_DAMAGED;
+        case ACCESS_AUTHENTICATION_FACTOR_DISABLE_DISABLED_DESTROYED:
+            return ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_DESTROYED;
+        default:
+            return ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_DISABLED;
+    }
+    switch (pObject->credential_disable) {
+        case ACCESS_CREDENTIAL_DISABLE_NONE:
+            break;
+        case ACCESS_CREDENTIAL_DISABLE_MANUAL:
+            return ACCESS_EVENT_DENIED_CREDENTIAL_MANUAL_DISABLE;
+        case ACCESS_CREDENTIAL_DISABLE_LOCKOUT:
+            return ACCESS_EVENT_DENIED_CREDENTIAL_LOCKOUT;
+        default:
+            return ACCESS_EVENT_DENIED_CREDENTIAL_DISABLED;
+    }
+    if (!pObject->credential_status) {
+        return ACCESS_EVENT_DENIED_CREDENTIAL_DISABLED;
+    }
+    if (now) {
+        if (!datetime_wildcard_present(&pObject->activation_time) &&
+            (datetime_compare(now, &pObject->activation_time) < 0)) {
+            return ACCESS_EVENT_DENIED_CREDENTIAL_NOT_YET_ACTIVE;
+        }
+        if (!datetime_wildcard_present(&pObject->expiration_time) &&
+            (datetime_compare(now, &pObject->expiration_time) > 0)) {
+            return ACCESS_EVENT_DENIED_CREDENTIAL_EXPIRED;
+        }
+    }
+
+    return ACCESS_EVENT_GRANTED;
+}
+
+/**
+ * @brief Get the data of an Access Credential object
+ * @param object_instance - object-instance number of the object
+ * @return object data that may be configured by the application,
+ *  or NULL if not found.  Use Access_Credential_Authentication_Factor_Add()
+ *  to change the authentication factors.
+ */
+ACCESS_CREDENTIAL_DESCR *Access_Credential_Data(uint32_t object_instance)
+{
+    return Keylist_Data(Object_List, object_instance);
+}
+
+/**
+ * @brief Creates an Access Credential object
+ * @param object_instance - object-instance number of the object
+ * @return object_instance if the object is created, else BACNET_MAX_INSTANCE
+ */
+uint32_t Access_Credential_Create(uint32_t object_instance)
+{
+    ACCESS_CREDENTIAL_DESCR *pObject;
+    int index;
+
+    if (!Object_List) {
+        Object_List = Keylist_Create();
+    }
+    if (object_instance > BACNET_MAX_INSTANCE) {
+        return BACNET_MAX_INSTANCE;
+    } else if (object_instance == BACNET_MAX_INSTANCE) {
+        /* wildcard instance */
+        object_instance = Keylist_Next_Empty_Key(Object_List, 1);
+    }
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        pObject = calloc(1, sizeof(ACCESS_CREDENTIAL_DESCR));
+        if (!pObject) {
+            return BACNET_MAX_INSTANCE;
+        }
+        pObject->global_identifier = 0; /* set to some meaningful value */
+        pObject->reliability = RELIABILITY_NO_FAULT_DETECTED;
+        pObject->credential_status = false;
+        pObject->reasons_count = 0;
+        pObject->auth_factors_count = 0;
+        datetime_wildcard_set(&pObject->activation_time);
+        datetime_wildcard_set(&pObject->expiration_time);
+        pObject->credential_disable = ACCESS_CREDENTIAL_DISABLE_NONE;
+        pObject->assigned_access_rights_count = 0;
+        index = Keylist_Data_Add(Object_List, object_instance, pObject);
+        if (index < 0) {
+            free(pObject);
+            return BACNET_MAX_INSTANCE;
+        }
+    }
+
+    return object_instance;
+}
+
+/**
+ * @brief Deletes an Access Credential object
+ * @param object_instance - object-instance number of the object
+ * @return true if the object is deleted
+ */
+bool Access_Credential_Delete(uint32_t object_instance)
+{
+    ACCESS_CREDENTIAL_DESCR *pObject;
+
+    pObject = Keylist_Data_Delete(Object_List, object_instance);
+    if (pObject) {
+        Factor_Index_Remove(pObject);
+        free(pObject);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Deletes all the Access Credential objects and their index
+ */
+void Access_Credential_Cleanup(void)
+{
+    ACCESS_CREDENTIAL_DESCR *pObject;
+
+    if (Object_List) {
+        do {
+            pObject = Keylist_Data_Pop(Object_List);
+            free(pObject);
+        } while (pObject);
+        Keylist_Delete(Object_List);
+        Object_List = NULL;
+    }
+    free(Factor_Index);
+    Factor_Index = NULL;
+    Factor_Index_Size = 0;
+    Factor_Index_Count = 0;
+    Access_Credential_Initialized = false;
+}
@@ -40,6 +40,7 @@
 #include "bacnet/wp.h"
 
 
+/* number of objects created by Init - more may be created at runtime */
 #ifndef MAX_ACCESS_CREDENTIALS
 #define MAX_ACCESS_CREDENTIALS 4
 #endif
@@ -115,6 +116,26 @@ extern "C" {
     bool Access_Credential_Write_Property(
         BACNET_WRITE_PROPERTY_DATA * wp_data);
 
+    BACNET_STACK_EXPORT
+    bool Access_Credential_Authentication_Factor_Add(
+        uint32_t object_instance,
+        BACNET_CREDENTIAL_AUTHENTICATION_FACTOR * value);
+    BACNET_STACK_EXPORT
+    bool Access_Credential_Authentication_Factor_Delete_All(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    bool Access_Credential_Authentication_Factor_Find(
+        BACNET_AUTHENTICATION_FACTOR * factor,
+        uint32_t * object_instance);
+    BACNET_STACK_EXPORT
+    BACNET_ACCESS_EVENT Access_Credential_Authorize(
+        BACNET_AUTHENTICATION_FACTOR * factor,
+        BACNET_DATE_TIME * now,
+        uint32_t * object_instance);
+    BACNET_STACK_EXPORT
+    ACCESS_CREDENTIAL_DESCR *Access_Credential_Data(
+        uint32_t object_instance);
+
     BACNET_STACK_EXPORT
     uint32_t Access_Credential_Create(
         uint32_t object_instance);
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -35,11 +36,15 @@
 #include "bacnet/bacapp.h"
 #include "bacnet/wp.h"
 #include "access_point.h"
+#include "bacnet/basic/object/access_credential.h"
+#include "bacnet/basic/object/access_rights.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/keylist.h"
 
 static bool Access_Point_Initialized = false;
 
-static ACCESS_POINT_DESCR ap_descr[MAX_ACCESS_POINTS];
+/* Key List for storing the object data sorted by instance number  */
+static OS_Keylist Object_List;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -76,66 +81,59 @@ void Access_Point_Init(void)
 
     if (!Access_Point_Initialized) {
         Access_Point_Initialized = true;
-
+        if (!Object_List) {
+            Object_List = Keylist_Create();
+        }
         for (i = 0; i < MAX_ACCESS_POINTS; i++) {
-            ap_descr[i].event_state = EVENT_STATE_NORMAL;
-            ap_descr[i].reliability = RELIABILITY_NO_FAULT_DETECTED;
-            ap_descr[i].out_of_service = false;
-            ap_descr[i].authentication_status = AUTHENTICATION_STATUS_NOT_READY;
-            ap_descr[i].active_authentication_policy = 0;
-            ap_descr[i].number_of_authentication_policies = 0;
-            ap_descr[i].authorization_mode = AUTHORIZATION_MODE_AUTHORIZE;
-            ap_descr[i].access_event = ACCESS_EVENT_NONE;
-            /* timestamp uninitialized */
-            /* access_event_credential should be set to some meaningful value */
-            ap_descr[i].num_doors = 0;
-            /* fill in the access doors with proper ids */
-            ap_descr[i].priority_for_writing = 16; /* lowest possible for now */
+            Access_Point_Create(i);
         }
     }
 
     return;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need validate that the */
-/* given instance exists */
+/**
+ * @brief Determines if a given Access Point instance is valid
+ * @param object_instance - object-instance number of the object
+ * @return true if the instance is valid, and false if not
+ */
 bool Access_Point_Valid_Instance(uint32_t object_instance)
 {
-    if (object_instance < MAX_ACCESS_POINTS) {
-        return true;
-    }
-
-    return false;
+    return Keylist_Data(Object_List, object_instance) != NULL;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then count how many you have */
+/**
+ * @brief Determines the number of Access Point objects
+ * @return Number of Access Point objects
+ */
 unsigned Access_Point_Count(void)
 {
-    return MAX_ACCESS_POINTS;
+    return Keylist_Count(Object_List);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the instance */
-/* that correlates to the correct index */
+/**
+ * @brief Determines the object instance-number for a given 0..N index
+ * @param index - 0..N where N is Access_Point_Count()
+ * @return object instance-number for the given index
+ */
 uint32_t Access_Point_Index_To_Instance(unsigned index)
 {
-    return index;
+    KEY key = UINT32_MAX;
+
+    Keylist_Index_Key(Object_List, index, &key);
+
+    return key;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the index */
-/* that correlates to the correct instance number */
+/**
+ * @brief For a given object instance-number, determines a 0..N index
+ * @param object_instance - object-instance number of the object
+ * @return index for the given instance-number, or Access_Point_Count()
+ *  if not valid.
+ */
 unsigned Access_Point_Instance_To_Index(uint32_t object_instance)
 {
-    unsigned index = MAX_ACCESS_POINTS;
-
-    if (object_instance < MAX_ACCESS_POINTS) {
-        index = object_instance;
-    }
-
-    return index;
+    return Keylist_Index(Object_List, object_instance);
 }
 
 /* note: the object name must be unique within this device */
@@ -145,7 +143,7 @@ bool Access_Point_Object_Name(
     static char text[32] = ""; /* okay for single thread */
     bool status = false;
 
-    if (object_instance < MAX_ACCESS_POINTS) {
+    if (Access_Point_Valid_Instance(object_instance)) {
         snprintf(text, sizeof(text), "ACCESS POINT %lu", 
             (unsigned long)object_instance);
         status = characterstring_init_ansi(object_name, text);
@@ -156,12 +154,12 @@ bool Access_Point_Object_Name(
 
 bool Access_Point_Out_Of_Service(uint32_t instance)
 {
-    unsigned index = 0;
+    ACCESS_POINT_DESCR *pObject;
     bool oos_flag = false;
 
-    index = Access_Point_Instance_To_Index(instance);
-    if (index < MAX_ACCESS_POINTS) {
-        oos_flag = ap_descr[index].out_of_service;
+    pObject = Keylist_Data(Object_List, instance);
+    if (pObject) {
+        oos_flag = pObject->out_of_service;
     }
 
     return oos_flag;
@@ -169,11 +167,11 @@ bool Access_Point_Out_Of_Service(uint32_t instance)
 
 void Access_Point_Out_Of_Service_Set(uint32_t instance, bool oos_flag)
 {
-    unsigned index = 0;
+    ACCESS_POINT_DESCR *pObject;
 
-    index = Access_Point_Instance_To_Index(instance);
-    if (index < MAX_ACCESS_POINTS) {
-        ap_descr[index].out_of_service = oos_flag;
+    pObject = Keylist_Data(Object_List, instance);
+    if (pObject) {
+        pObject->out_of_service = oos_flag;
     }
 }
 
@@ -184,7 +182,7 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     int apdu_len = 0; /* return value */
     BACNET_BIT_STRING bit_string;
     BACNET_CHARACTER_STRING char_string;
-    unsigned object_index = 0;
+    ACCESS_POINT_DESCR *pObject;
     unsigned i = 0;
     bool state = false;
     uint8_t *apdu = NULL;
@@ -193,8 +191,13 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         (rpdata->application_data_len == 0)) {
         return 0;
     }
+    pObject = Keylist_Data(Object_List, rpdata->object_instance);
+    if (!pObject) {
+        rpdata->error_class = ERROR_CLASS_OBJECT;
+        rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return BACNET_STATUS_ERROR;
+    }
     apdu = rpdata->application_data;
-    object_index = Access_Point_Instance_To_Index(rpdata->object_instance);
     switch (rpdata->object_property) {
         case PROP_OBJECT_IDENTIFIER:
             apdu_len = encode_application_object_id(
@@ -220,11 +223,11 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_EVENT_STATE:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ap_descr[object_index].event_state);
+                &apdu[0], pObject->event_state);
             break;
         case PROP_RELIABILITY:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ap_descr[object_index].reliability);
+                &apdu[0], pObject->reliability);
             break;
         case PROP_OUT_OF_SERVICE:
             state = Access_Point_Out_Of_Service(rpdata->object_instance);
@@ -232,44 +235,44 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_AUTHENTICATION_STATUS:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ap_descr[object_index].authentication_status);
+                &apdu[0], pObject->authentication_status);
             break;
         case PROP_ACTIVE_AUTHENTICATION_POLICY:
             apdu_len = encode_application_unsigned(
-                &apdu[0], ap_descr[object_index].active_authentication_policy);
+                &apdu[0], pObject->active_authentication_policy);
             break;
         case PROP_NUMBER_OF_AUTHENTICATION_POLICIES:
             apdu_len = encode_application_unsigned(&apdu[0],
-                ap_descr[object_index].number_of_authentication_policies);
+                pObject->number_of_authentication_policies);
             break;
         case PROP_AUTHORIZATION_MODE:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ap_descr[object_index].authorization_mode);
+                &apdu[0], pObject->authorization_mode);
             break;
         case PROP_ACCESS_EVENT:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ap_descr[object_index].access_event);
+                &apdu[0], pObject->access_event);
             break;
         case PROP_ACCESS_EVENT_TAG:
             apdu_len = encode_application_unsigned(
-                &apdu[0], ap_descr[object_index].access_event_tag);
+                &apdu[0], pObject->access_event_tag);
             break;
         case PROP_ACCESS_EVENT_TIME:
             apdu_len = bacapp_encode_timestamp(
-                &apdu[0], &ap_descr[object_index].access_event_time);
+                &apdu[0], &pObject->access_event_time);
             break;
         case PROP_ACCESS_EVENT_CREDENTIAL:
             apdu_len = bacapp_encode_device_obj_ref(
-                &apdu[0], &ap_descr[object_index].access_event_credential);
+                &apdu[0], &pObject->access_event_credential);
             break;
         case PROP_ACCESS_DOORS:
             if (rpdata->array_index == 0) {
                 apdu_len = encode_application_unsigned(
-                    &apdu[0], ap_descr[object_index].num_doors);
+                    &apdu[0], pObject->num_doors);
             } else if (rpdata->array_index == BACNET_ARRAY_ALL) {
-                for (i = 0; i < ap_descr[object_index].num_doors; i++) {
+                for (i = 0; i < pObject->num_doors; i++) {
                     len = bacapp_encode_device_obj_ref(
-                        &apdu[0], &ap_descr[object_index].access_doors[i]);
+                        &apdu[0], &pObject->access_doors[i]);
                     if (apdu_len + len < MAX_APDU) {
                         apdu_len += len;
                     } else {
@@ -280,10 +283,9 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                     }
                 }
             } else {
-                if (rpdata->array_index <= ap_descr[object_index].num_doors) {
+                if (rpdata->array_index <= pObject->num_doors) {
                     apdu_len = bacapp_encode_device_obj_ref(&apdu[0],
-                        &ap_descr[object_index]
-                             .access_doors[rpdata->array_index - 1]);
+                        &pObject->access_doors[rpdata->array_index - 1]);
                 } else {
                     rpdata->error_class = ERROR_CLASS_PROPERTY;
                     rpdata->error_code = ERROR_CODE_INVALID_ARRAY_INDEX;
@@ -293,7 +295,7 @@ int Access_Point_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_PRIORITY_FOR_WRITING:
             apdu_len = encode_application_unsigned(
-                &apdu[0], ap_descr[object_index].priority_for_writing);
+                &apdu[0], pObject->priority_for_writing);
             break;
         default:
             rpdata->error_class = ERROR_CLASS_PROPERTY;
@@ -366,3 +368,198 @@ bool Access_Point_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 
     return status;
 }
+
+/**
+ * @brief Decide whether the access rights of a credential grant access
+ *  at an access point.  Any negative rule of the assigned access rights
+ *  denies access, otherwise a positive rule must permit it.
+ * @param credential - credential object data
+ * @param location - object identifier of the access point
+ * @return ACCESS_EVENT_GRANTED, or the reason access was denied
+ */
+static BACNET_ACCESS_EVENT Access_Point_Access_Rights_Event(
+    ACCESS_CREDENTIAL_DESCR *credential, BACNET_OBJECT_ID *location)
+{
+    BACNET_ASSIGNED_ACCESS_RIGHTS *rights;
+    bool permitted = false;
+    uint32_t i;
+
+    for (i = 0; i < credential->assigned_access_rights_count; i++) {
+        rights = &credential->assigned_access_rights[i];
+        if (!rights->enable ||
+            (rights->assigned_access_rights.objectIdentifier.type !=
+                OBJECT_ACCESS_RIGHTS)) {
+            continue;
+        }
+        if (Access_Rights_Location_Denied(
+                rights->assigned_access_rights.objectIdentifier.instance,
+                location)) {
+            return ACCESS_EVENT_DENIED_POINT_NO_ACCESS_RIGHTS;
+        }
+        if (Access_Rights_Location_Permitted(
+                rights->assigned_access_rights.objectIdentifier.instance,
+                location)) {
+            permitted = true;
+        }
+    }
+    if (!permitted) {
+        return ACCESS_EVENT_DENIED_NO_ACCESS_RIGHTS;
+    }
+
+    return ACCESS_EVENT_GRANTED;
+}
+
+/**
+ * @brief Authenticate and authorize an authentication factor presented
+ *  at an access point, and record the result in the Access_Event,
+ *  Access_Event_Tag, Access_Event_Time, and Access_Event_Credential
+ *  properties.  The credential is found from the authentication factor
+ *  in constant time.
+ * @param object_instance - object-instance number of the access point
+ * @param factor - authentication factor presented
+ * @param now - current date and time
+ * @return ACCESS_EVENT_GRANTED, or the reason access was denied
+ */
+BACNET_ACCESS_EVENT Access_Point_Authenticate(uint32_t object_instance,
+    BACNET_AUTHENTICATION_FACTOR *factor,
+    BACNET_DATE_TIME *now)
+{
+    ACCESS_POINT_DESCR *pObject;
+    ACCESS_CREDENTIAL_DESCR *credential;
+    BACNET_OBJECT_ID location;
+    BACNET_ACCESS_EVENT event;
+    uint32_t credential_instance = BACNET_MAX_INSTANCE;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        return ACCESS_EVENT_DENIED_OTHER;
+    }
+    if (pObject->out_of_service ||
+        (pObject->authentication_status == AUTHENTICATION_STATUS_DISABLED)) {
+        event = ACCESS_EVENT_DENIED_AUTHENTICATION_UNAVAILABLE;
+    } else if (pObject->authorization_mode == AUTHORIZATION_MODE_DENY_ALL) {
+        event = ACCESS_EVENT_DENIED_DENY_ALL;
+    } else {
+        event = Access_Credential_Authorize(factor, now, &credential_instance);
+        if ((event == ACCESS_EVENT_GRANTED) &&
+            (pObject->authorization_mode != AUTHORIZATION_MODE_GRANT_ACTIVE)) {
+            credential = Access_Credential_Data(credential_instance);
+            location.type = OBJECT_ACCESS_POINT;
+            location.instance = object_instance;
+            event = Access_Point_Access_Rights_Event(credential, &location);
+        }
+    }
+    pObject->access_event = event;
+    pObject->access_event_tag++;
+    if (now) {
+        bacapp_timestamp_datetime_set(&pObject->access_event_time, now);
+    }
+    pObject->access_event_credential.deviceIdentifier.type = OBJECT_NONE;
+    pObject->access_event_credential.deviceIdentifier.instance =
+        BACNET_MAX_INSTANCE;
+    if (credential_instance < BACNET_MAX_INSTANCE) {
+        pObject->access_event_credential.objectIdentifier.type =
+            OBJECT_ACCESS_CREDENTIAL;
+    } else {
+        pObject->access_event_credential.objectIdentifier.type = OBJECT_NONE;
+    }
+    pObject->access_event_credential.objectIdentifier.instance =
+        credential_instance;
+
+    return event;
+}
+
+/**
+ * @brief Get the data of an Access Point object
+ * @param object_instance - object-instance number of the object
+ * @return object data that may be configured by the application,
+ *  or NULL if not found
+ */
+ACCESS_POINT_DESCR *Access_Point_Data(uint32_t object_instance)
+{
+    return Keylist_Data(Object_List, object_instance);
+}
+
+/**
+ * @brief Creates an Access Point object
+ * @param object_instance - object-instance number of the object
+ * @return object_instance if the object is created, else BACNET_MAX_INSTANCE
+ */
+uint32_t Access_Point_Create(uint32_t object_instance)
+{
+    ACCESS_POINT_DESCR *pObject;
+    int index;
+
+    if (!Object_List) {
+        Object_List = Keylist_Create();
+    }
+    if (object_instance > BACNET_MAX_INSTANCE) {
+        return BACNET_MAX_INSTANCE;
+    } else if (object_instance == BACNET_MAX_INSTANCE) {
+        /* wildcard instance */
+        object_instance = Keylist_Next_Empty_Key(Object_List, 1);
+    }
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        pObject = calloc(1, sizeof(ACCESS_POINT_DESCR));
+        if (!pObject) {
+            return BACNET_MAX_INSTANCE;
+        }
+        pObject->event_state = EVENT_STATE_NORMAL;
+        pObject->reliability = RELIABILITY_NO_FAULT_DETECTED;
+        pObject->out_of_service = false;
+        pObject->authentication_status = AUTHENTICATION_STATUS_NOT_READY;
+        pObject->active_authentication_policy = 0;
+        pObject->number_of_authentication_policies = 0;
+        pObject->authorization_mode = AUTHORIZATION_MODE_AUTHORIZE;
+        pObject->access_event = ACCESS_EVENT_NONE;
+        /* timestamp uninitialized */
+        /* access_event_credential should be set to some meaningful value */
+        pObject->num_doors = 0;
+        /* fill in the access doors with proper ids */
+        pObject->priority_for_writing = 16; /* lowest possible for now */
+        index = Keylist_Data_Add(Object_List, object_instance, pObject);
+        if (index < 0) {
+            free(pObject);
+            return BACNET_MAX_INSTANCE;
+        }
+    }
+
+    return object_instance;
+}
+
+/**
+ * @brief Deletes an Access Point object
+ * @param object_instance - object-instance number of the object
+ * @return true if the object is deleted
+ */
+bool Access_Point_Delete(uint32_t object_instance)
+{
+    ACCESS_POINT_DESCR *pObject;
+
+    pObject = Keylist_Data_Delete(Object_List, object_instance);
+    if (pObject) {
+        free(pObject);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Deletes all the Access Point objects
+ */
+void Access_Point_Cleanup(void)
+{
+    ACCESS_POINT_DESCR *pObject;
+
+    if (Object_List) {
+        do {
+            pObject = Keylist_Data_Pop(Object_List);
+            free(pObject);
+        } while (pObject);
+        Keylist_Delete(Object_List);
+        Object_List = NULL;
+    }
+    Access_Point_Initialized = false;
+}
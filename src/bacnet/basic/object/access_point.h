@@ -33,10 +33,12 @@
 #include "bacnet/bacerror.h"
 #include "bacnet/timestamp.h"
 #include "bacnet/bacdevobjpropref.h"
+#include "bacnet/authentication_factor.h"
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 
 
+/* number of objects created by Init - more may be created at runtime */
 #ifndef MAX_ACCESS_POINTS
 #define MAX_ACCESS_POINTS 4
 #endif
@@ -112,6 +114,15 @@ extern "C" {
     bool Access_Point_Write_Property(
         BACNET_WRITE_PROPERTY_DATA * wp_data);
 
+    BACNET_STACK_EXPORT
+    BACNET_ACCESS_EVENT Access_Point_Authenticate(
+        uint32_t object_instance,
+        BACNET_AUTHENTICATION_FACTOR * factor,
+        BACNET_DATE_TIME * now);
+    BACNET_STACK_EXPORT
+    ACCESS_POINT_DESCR *Access_Point_Data(
+        uint32_t object_instance);
+
     BACNET_STACK_EXPORT
     uint32_t Access_Point_Create(
         uint32_t object_instance);
@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -35,12 +36,14 @@
 #include "bacnet/bacapp.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/keylist.h"
 /* me! */
 #include "access_rights.h"
 
 static bool Access_Rights_Initialized = false;
 
-static ACCESS_RIGHTS_DESCR ar_descr[MAX_ACCESS_RIGHTSS];
+/* Key List for storing the object data sorted by instance number  */
+static OS_Keylist Object_List;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -74,60 +77,59 @@ void Access_Rights_Init(void)
 
     if (!Access_Rights_Initialized) {
         Access_Rights_Initialized = true;
-
+        if (!Object_List) {
+            Object_List = Keylist_Create();
+        }
         for (i = 0; i < MAX_ACCESS_RIGHTSS; i++) {
-            ar_descr[i].global_identifier =
-                0; /* set to some meaningful value */
-            ar_descr[i].reliability = RELIABILITY_NO_FAULT_DETECTED;
-            ar_descr[i].enable = false;
-            ar_descr[i].negative_access_rules_count = 0;
-            ar_descr[i].positive_access_rules_count = 0;
-            /* fill in the positive and negative access rules with proper ids */
+            Access_Rights_Create(i);
         }
     }
 
     return;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need validate that the */
-/* given instance exists */
+/**
+ * @brief Determines if a given Access Rights instance is valid
+ * @param object_instance - object-instance number of the object
+ * @return true if the instance is valid, and false if not
+ */
 bool Access_Rights_Valid_Instance(uint32_t object_instance)
 {
-    if (object_instance < MAX_ACCESS_RIGHTSS) {
-        return true;
-    }
-
-    return false;
+    return Keylist_Data(Object_List, object_instance) != NULL;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then count how many you have */
+/**
+ * @brief Determines the number of Access Rights objects
+ * @return Number of Access Rights objects
+ */
 unsigned Access_Rights_Count(void)
 {
-    return MAX_ACCESS_RIGHTSS;
+    return Keylist_Count(Object_List);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the instance */
-/* that correlates to the correct index */
+/**
+ * @brief Determines the object instance-number for a given 0..N index
+ * @param index - 0..N where N is Access_Rights_Count()
+ * @return object instance-number for the given index
+ */
 uint32_t Access_Rights_Index_To_Instance(unsigned index)
 {
-    return index;
+    KEY key = UINT32_MAX;
+
+    Keylist_Index_Key(Object_List, index, &key);
+
+    return key;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the index */
-/* that correlates to the correct instance number */
+/**
+ * @brief For a given object instance-number, determines a 0..N index
+ * @param object_instance - object-instance number of the object
+ * @return index for the given instance-number, or Access_Rights_Count()
+ *  if not valid.
+ */
 unsigned Access_Rights_Instance_To_Index(uint32_t object_instance)
 {
-    unsigned index = MAX_ACCESS_RIGHTSS;
-
-    if (object_instance < MAX_ACCESS_RIGHTSS) {
-        index = object_instance;
-    }
-
-    return index;
+    return Keylist_Index(Object_List, object_instance);
 }
 
 /* note: the object name must be unique within this device */
@@ -137,7 +139,7 @@ bool Access_Rights_Object_Name(
     static char text[32] = ""; /* okay for single thread */
     bool status = false;
 
-    if (object_instance < MAX_ACCESS_RIGHTSS) {
+    if (Access_Rights_Valid_Instance(object_instance)) {
         snprintf(text, sizeof(text), "ACCESS RIGHTS %lu", 
             (unsigned long)object_instance);
         status = characterstring_init_ansi(object_name, text);
@@ -153,7 +155,7 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     int apdu_len = 0; /* return value */
     BACNET_BIT_STRING bit_string;
     BACNET_CHARACTER_STRING char_string;
-    unsigned object_index = 0;
+    ACCESS_RIGHTS_DESCR *pObject;
     unsigned i = 0;
     uint8_t *apdu = NULL;
 
@@ -161,8 +163,13 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         (rpdata->application_data_len == 0)) {
         return 0;
     }
+    pObject = Keylist_Data(Object_List, rpdata->object_instance);
+    if (!pObject) {
+        rpdata->error_class = ERROR_CLASS_OBJECT;
+        rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return BACNET_STATUS_ERROR;
+    }
     apdu = rpdata->application_data;
-    object_index = Access_Rights_Instance_To_Index(rpdata->object_instance);
     switch (rpdata->object_property) {
         case PROP_OBJECT_IDENTIFIER:
             apdu_len = encode_application_object_id(
@@ -179,7 +186,7 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_GLOBAL_IDENTIFIER:
             apdu_len = encode_application_unsigned(
-                &apdu[0], ar_descr[object_index].global_identifier);
+                &apdu[0], pObject->global_identifier);
             break;
         case PROP_STATUS_FLAGS:
             bitstring_init(&bit_string);
@@ -191,22 +198,22 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_RELIABILITY:
             apdu_len = encode_application_enumerated(
-                &apdu[0], ar_descr[object_index].reliability);
+                &apdu[0], pObject->reliability);
             break;
         case PROP_ENABLE:
             apdu_len = encode_application_boolean(
-                &apdu[0], ar_descr[object_index].enable);
+                &apdu[0], pObject->enable);
             break;
         case PROP_NEGATIVE_ACCESS_RULES:
             if (rpdata->array_index == 0) {
                 apdu_len = encode_application_unsigned(&apdu[0],
-                    ar_descr[object_index].negative_access_rules_count);
+                    pObject->negative_access_rules_count);
             } else if (rpdata->array_index == BACNET_ARRAY_ALL) {
                 for (i = 0;
-                     i < ar_descr[object_index].negative_access_rules_count;
+                     i < pObject->negative_access_rules_count;
                      i++) {
                     len = bacapp_encode_access_rule(&apdu[0],
-                        &ar_descr[object_index].negative_access_rules[i]);
+                        &pObject->negative_access_rules[i]);
                     if (apdu_len + len < MAX_APDU) {
                         apdu_len += len;
                     } else {
@@ -218,10 +225,10 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                 }
             } else {
                 if (rpdata->array_index <=
-                    ar_descr[object_index].negative_access_rules_count) {
+                    pObject->negative_access_rules_count) {
                     apdu_len = bacapp_encode_access_rule(&apdu[0],
-                        &ar_descr[object_index]
-                             .negative_access_rules[rpdata->array_index - 1]);
+                        &pObject->negative_access_rules
+                             [rpdata->array_index - 1]);
                 } else {
                     rpdata->error_class = ERROR_CLASS_PROPERTY;
                     rpdata->error_code = ERROR_CODE_INVALID_ARRAY_INDEX;
@@ -232,13 +239,13 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         case PROP_POSITIVE_ACCESS_RULES:
             if (rpdata->array_index == 0) {
                 apdu_len = encode_application_unsigned(&apdu[0],
-                    ar_descr[object_index].positive_access_rules_count);
+                    pObject->positive_access_rules_count);
             } else if (rpdata->array_index == BACNET_ARRAY_ALL) {
                 for (i = 0;
-                     i < ar_descr[object_index].positive_access_rules_count;
+                     i < pObject->positive_access_rules_count;
                      i++) {
                     len = bacapp_encode_access_rule(&apdu[0],
-                        &ar_descr[object_index].positive_access_rules[i]);
+                        &pObject->positive_access_rules[i]);
                     if (apdu_len + len < MAX_APDU) {
                         apdu_len += len;
                     } else {
@@ -250,10 +257,10 @@ int Access_Rights_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                 }
             } else {
                 if (rpdata->array_index <=
-                    ar_descr[object_index].positive_access_rules_count) {
+                    pObject->positive_access_rules_count) {
                     apdu_len = bacapp_encode_access_rule(&apdu[0],
-                        &ar_descr[object_index]
-                             .positive_access_rules[rpdata->array_index - 1]);
+                        &pObject->positive_access_rules
+                             [rpdata->array_index - 1]);
                 } else {
                     rpdata->error_class = ERROR_CLASS_PROPERTY;
                     rpdata->error_code = ERROR_CODE_INVALID_ARRAY_INDEX;
@@ -286,7 +293,7 @@ bool Access_Rights_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     bool status = false; /* return value */
     int len = 0;
     BACNET_APPLICATION_DATA_VALUE value;
-    unsigned object_index = 0;
+    ACCESS_RIGHTS_DESCR *pObject;
 
     /* decode the some of the request */
     len = bacapp_decode_application_data(
@@ -306,13 +313,18 @@ bool Access_Rights_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
         wp_data->error_code = ERROR_CODE_PROPERTY_IS_NOT_AN_ARRAY;
         return false;
     }
-    object_index = Access_Rights_Instance_To_Index(wp_data->object_instance);
+    pObject = Keylist_Data(Object_List, wp_data->object_instance);
+    if (!pObject) {
+        wp_data->error_class = ERROR_CLASS_OBJECT;
+        wp_data->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return false;
+    }
     switch (wp_data->object_property) {
         case PROP_GLOBAL_IDENTIFIER:
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_UNSIGNED_INT);
             if (status) {
-                ar_descr[object_index].global_identifier =
+                pObject->global_identifier =
                     value.type.Unsigned_Int;
             }
             break;
@@ -335,3 +347,169 @@ bool Access_Rights_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 
     return status;
 }
+
+/**
+ * @brief Determine if an access rule applies at a location
+ * @param rule - access rule
+ * @param location - object identifier of an access point or zone
+ * @return true if the rule is enabled and refers to the location
+ */
+static bool Access_Rule_Location_Match(
+    BACNET_ACCESS_RULE *rule, BACNET_OBJECT_ID *location)
+{
+    if (!rule->enable) {
+        return false;
+    }
+    if (rule->location_specifier == LOCATION_SPECIFIER_ALL) {
+        return true;
+    }
+
+    return (rule->location.objectIdentifier.type == location->type) &&
+        (rule->location.objectIdentifier.instance == location->instance);
+}
+
+/**
+ * @brief Determine if the negative access rules of an Access Rights
+ *  object deny access at a location.  A rule with a specified time
+ *  range is not evaluated here, and denies access at any time.
+ * @param object_instance - object-instance number of the object
+ * @param location - object identifier of an access point or zone
+ * @return true if an enabled negative rule applies at the location
+ */
+bool Access_Rights_Location_Denied(
+    uint32_t object_instance, BACNET_OBJECT_ID *location)
+{
+    ACCESS_RIGHTS_DESCR *pObject;
+    uint32_t i;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !location || !pObject->enable) {
+        return false;
+    }
+    for (i = 0; i < pObject->negative_access_rules_count; i++) {
+        if (Access_Rule_Location_Match(
+                &pObject->negative_access_rules[i], location)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Determine if the positive access rules of an Access Rights
+ *  object permit access at a location.  A rule with a specified time
+ *  range is not evaluated here, and does not permit access.
+ * @param object_instance - object-instance number of the object
+ * @param location - object identifier of an access point or zone
+ * @return true if an enabled positive rule applies at the location
+ */
+bool Access_Rights_Location_Permitted(
+    uint32_t object_instance, BACNET_OBJECT_ID *location)
+{
+    ACCESS_RIGHTS_DESCR *pObject;
+    BACNET_ACCESS_RULE *rule;
+    uint32_t i;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !location || !pObject->enable) {
+        return false;
+    }
+    for (i = 0; i < pObject->positive_access_rules_count; i++) {
+        rule = &pObject->positive_access_rules[i];
+        if ((rule->time_range_specifier == TIME_RANGE_SPECIFIER_ALWAYS) &&
+            Access_Rule_Location_Match(rule, location)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get the data of an Access Rights object
+ * @param object_instance - object-instance number of the object
+ * @return object data that may be configured by the application,
+ *  or NULL if not found
+ */
+ACCESS_RIGHTS_DESCR *Access_Rights_Data(uint32_t object_instance)
+{
+    return Keylist_Data(Object_List, object_instance);
+}
+
+/**
+ * @brief Creates an Access Rights object
+ * @param object_instance - object-instance number of the object
+ * @return object_instance if the object is created, else BACNET_MAX_INSTANCE
+ */
+uint32_t Access_Rights_Create(uint32_t object_instance)
+{
+    ACCESS_RIGHTS_DESCR *pObject;
+    int index;
+
+    if (!Object_List) {
+        Object_List = Keylist_Create();
+    }
+    if (object_instance > BACNET_MAX_INSTANCE) {
+        return BACNET_MAX_INSTANCE;
+    } else if (object_instance == BACNET_MAX_INSTANCE) {
+        /* wildcard instance */
+        object_instance = Keylist_Next_Empty_Key(Object_List, 1);
+    }
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        pObject = calloc(1, sizeof(ACCESS_RIGHTS_DESCR));
+        if (!pObject) {
+            return BACNET_MAX_INSTANCE;
+        }
+        pObject->global_identifier = 0; /* set to some meaningful value */
+        pObject->reliability = RELIABILITY_NO_FAULT_DETECTED;
+        pObject->enable = false;
+        pObject->negative_access_rules_count = 0;
+        pObject->positive_access_rules_count = 0;
+        /* fill in the positive and negative access rules with proper ids */
+        index = Keylist_Data_Add(Object_List, object_instance, pObject);
+        if (index < 0) {
+            free(pObject);
+            return BACNET_MAX_INSTANCE;
+        }
+    }
+
+    return object_instance;
+}
+
+/**
+ * @brief Deletes an Access Rights object
+ * @param object_instance - object-instance number of the object
+ * @return true if the object is deleted
+ */
+bool Access_Rights_Delete(uint32_t object_instance)
+{
+    ACCESS_RIGHTS_DESCR *pObject;
+
+    pObject = Keylist_Data_Delete(Object_List, object_instance);
+    if (pObject) {
+        free(pObject);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Deletes all the Access Rights objects
+ */
+void Access_Rights_Cleanup(void)
+{
+    ACCESS_RIGHTS_DESCR *pObject;
+
+    if (Object_List) {
+        do {
+            pObject = Keylist_Data_Pop(Object_List);
+            free(pObject);
+        } while (pObject);
+        Keylist_Delete(Object_List);
+        Object_List = NULL;
+    }
+    Access_Rights_Initialized = false;
+}
@@ -37,6 +37,7 @@
 #include "bacnet/wp.h"
 
 
+/* number of objects created by Init - more may be created at runtime */
 #ifndef MAX_ACCESS_RIGHTSS
 #define MAX_ACCESS_RIGHTSS 4
 #endif
@@ -100,6 +101,18 @@ extern "C" {
     bool Access_Rights_Write_Property(
         BACNET_WRITE_PROPERTY_DATA * wp_data);
 
+    BACNET_STACK_EXPORT
+    bool Access_Rights_Location_Denied(
+        uint32_t object_instance,
+        BACNET_OBJECT_ID * location);
+    BACNET_STACK_EXPORT
+    bool Access_Rights_Location_Permitted(
+        uint32_t object_instance,
+        BACNET_OBJECT_ID * location);
+    BACNET_STACK_EXPORT
+    ACCESS_RIGHTS_DESCR *Access_Rights_Data(
+        uint32_t object_instance);
+
     BACNET_STACK_EXPORT
     uint32_t Access_Rights_Create(
         uint32_t object_instance);
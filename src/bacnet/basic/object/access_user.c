@@ -28,6 +28,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -36,10 +37,12 @@
 #include "bacnet/wp.h"
 #include "access_user.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/keylist.h"
 
 static bool Access_User_Initialized = false;
 
-static ACCESS_USER_DESCR au_descr[MAX_ACCESS_USERS];
+/* Key List for storing the object data sorted by instance number  */
+static OS_Keylist Object_List;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -72,59 +75,59 @@ void Access_User_Init(void)
 
     if (!Access_User_Initialized) {
         Access_User_Initialized = true;
-
+        if (!Object_List) {
+            Object_List = Keylist_Create();
+        }
         for (i = 0; i < MAX_ACCESS_USERS; i++) {
-            au_descr[i].global_identifier =
-                0; /* set to some meaningful value */
-            au_descr[i].reliability = RELIABILITY_NO_FAULT_DETECTED;
-            au_descr[i].user_type = ACCESS_USER_TYPE_PERSON;
-            au_descr[i].credentials_count = 0;
-            /* fill in the credentials with proper ids */
+            Access_User_Create(i);
         }
     }
 
     return;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need validate that the */
-/* given instance exists */
+/**
+ * @brief Determines if a given Access User instance is valid
+ * @param object_instance - object-instance number of the object
+ * @return true if the instance is valid, and false if not
+ */
 bool Access_User_Valid_Instance(uint32_t object_instance)
 {
-    if (object_instance < MAX_ACCESS_USERS) {
-        return true;
-    }
-
-    return false;
+    return Keylist_Data(Object_List, object_instance) != NULL;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then count how many you have */
+/**
+ * @brief Determines the number of Access User objects
+ * @return Number of Access User objects
+ */
 unsigned Access_User_Count(void)
 {
-    return MAX_ACCESS_USERS;
+    return Keylist_Count(Object_List);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the instance */
-/* that correlates to the correct index */
+/**
+ * @brief Determines the object instance-number for a given 0..N index
+ * @param index - 0..N where N is Access_User_Count()
+ * @return object instance-number for the given index
+ */
 uint32_t Access_User_Index_To_Instance(unsigned index)
 {
-    return index;
+    KEY key = UINT32_MAX;
+
+    Keylist_Index_Key(Object_List, index, &key);
+
+    return key;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the index */
-/* that correlates to the correct instance number */
+/**
+ * @brief For a given object instance-number, determines a 0..N index
+ * @param object_instance - object-instance number of the object
+ * @return index for the given instance-number, or Access_User_Count()
+ *  if not valid.
+ */
 unsigned Access_User_Instance_To_Index(uint32_t object_instance)
 {
-    unsigned index = MAX_ACCESS_USERS;
-
-    if (object_instance < MAX_ACCESS_USERS) {
-        index = object_instance;
-    }
-
-    return index;
+    return Keylist_Index(Object_List, object_instance);
 }
 
 /* note: the object name must be unique within this device */
@@ -134,7 +137,7 @@ bool Access_User_Object_Name(
     static char text[32] = ""; /* okay for single thread */
     bool status = false;
 
-    if (object_instance < MAX_ACCESS_USERS) {
+    if (Access_User_Valid_Instance(object_instance)) {
         snprintf(text, sizeof(text), "ACCESS USER %lu", 
             (unsigned long)object_instance);
         status = characterstring_init_ansi(object_name, text);
@@ -150,7 +153,7 @@ int Access_User_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     int apdu_len = 0; /* return value */
     BACNET_BIT_STRING bit_string;
     BACNET_CHARACTER_STRING char_string;
-    unsigned object_index = 0;
+    ACCESS_USER_DESCR *pObject;
     unsigned i = 0;
     uint8_t *apdu = NULL;
 
@@ -158,8 +161,13 @@ int Access_User_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         (rpdata->application_data_len == 0)) {
         return 0;
     }
+    pObject = Keylist_Data(Object_List, rpdata->object_instance);
+    if (!pObject) {
+        rpdata->error_class = ERROR_CLASS_OBJECT;
+        rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return BACNET_STATUS_ERROR;
+    }
     apdu = rpdata->application_data;
-    object_index = Access_User_Instance_To_Index(rpdata->object_instance);
     switch (rpdata->object_property) {
         case PROP_OBJECT_IDENTIFIER:
             apdu_len = encode_application_object_id(
@@ -176,7 +184,7 @@ int Access_User_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_GLOBAL_IDENTIFIER:
             apdu_len = encode_application_unsigned(
-                &apdu[0], au_descr[object_index].global_identifier);
+                &apdu[0], pObject->global_identifier);
             break;
         case PROP_STATUS_FLAGS:
             bitstring_init(&bit_string);
@@ -188,16 +196,16 @@ int Access_User_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             break;
         case PROP_RELIABILITY:
             apdu_len = encode_application_enumerated(
-                &apdu[0], au_descr[object_index].reliability);
+                &apdu[0], pObject->reliability);
             break;
         case PROP_USER_TYPE:
             apdu_len = encode_application_enumerated(
-                &apdu[0], au_descr[object_index].user_type);
+                &apdu[0], pObject->user_type);
             break;
         case PROP_CREDENTIALS:
-            for (i = 0; i < au_descr[object_index].credentials_count; i++) {
+            for (i = 0; i < pObject->credentials_count; i++) {
                 len = bacapp_encode_device_obj_ref(
-                    &apdu[0], &au_descr[object_index].credentials[i]);
+                    &apdu[0], &pObject->credentials[i]);
                 if (apdu_len + len < MAX_APDU) {
                     apdu_len += len;
                 } else {
@@ -230,7 +238,7 @@ bool Access_User_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     bool status = false; /* return value */
     int len = 0;
     BACNET_APPLICATION_DATA_VALUE value;
-    unsigned object_index = 0;
+    ACCESS_USER_DESCR *pObject;
 
     /* decode the some of the request */
     len = bacapp_decode_application_data(
@@ -248,13 +256,18 @@ bool Access_User_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
         wp_data->error_code = ERROR_CODE_PROPERTY_IS_NOT_AN_ARRAY;
         return false;
     }
-    object_index = Access_User_Instance_To_Index(wp_data->object_instance);
+    pObject = Keylist_Data(Object_List, wp_data->object_instance);
+    if (!pObject) {
+        wp_data->error_class = ERROR_CLASS_OBJECT;
+        wp_data->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return false;
+    }
     switch (wp_data->object_property) {
         case PROP_GLOBAL_IDENTIFIER:
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_UNSIGNED_INT);
             if (status) {
-                au_descr[object_index].global_identifier =
+                pObject->global_identifier =
                     value.type.Unsigned_Int;
             }
             break;
@@ -277,3 +290,90 @@ bool Access_User_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 
     return status;
 }
+
+/**
+ * @brief Get the data of an Access User object
+ * @param object_instance - object-instance number of the object
+ * @return object data that may be configured by the application,
+ *  or NULL if not found
+ */
+ACCESS_USER_DESCR *Access_User_Data(uint32_t object_instance)
+{
+    return Keylist_Data(Object_List, object_instance);
+}
+
+/**
+ * @brief Creates an Access User object
+ * @param object_instance - object-instance number of the object
+ * @return object_instance if the object is created, else BACNET_MAX_INSTANCE
+ */
+uint32_t Access_User_Create(uint32_t object_instance)
+{
+    ACCESS_USER_DESCR *pObject;
+    int index;
+
+    if (!Object_List) {
+        Object_List = Keylist_Create();
+    }
+    if (object_instance > BACNET_MAX_INSTANCE) {
+        return BACNET_MAX_INSTANCE;
+    } else if (object_instance == BACNET_MAX_INSTANCE) {
+        /* wildcard instance */
+        object_instance = Keylist_Next_Empty_Key(Object_List, 1);
+    }
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        pObject = calloc(1, sizeof(ACCESS_USER_DESCR));
+        if (!pObject) {
+            return BACNET_MAX_INSTANCE;
+        }
+        pObject->global_identifier = 0; /* set to some meaningful value */
+        pObject->reliability = RELIABILITY_NO_FAULT_DETECTED;
+        pObject->user_type = ACCESS_USER_TYPE_PERSON;
+        pObject->credentials_count = 0;
+        /* fill in the credentials with proper ids */
+        index = Keylist_Data_Add(Object_List, object_instance, pObject);
+        if (index < 0) {
+            free(pObject);
+            return BACNET_MAX_INSTANCE;
+        }
+    }
+
+    return object_instance;
+}
+
+/**
+ * @brief Deletes an Access User object
+ * @param object_instance - object-instance number of the object
+ * @return true if the object is deleted
+ */
+bool Access_User_Delete(uint32_t object_instance)
+{
+    ACCESS_USER_DESCR *pObject;
+
+    pObject = Keylist_Data_Delete(Object_List, object_instance);
+    if (pObject) {
+        free(pObject);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Deletes all the Access User objects
+ */
+void Access_User_Cleanup(void)
+{
+    ACCESS_USER_DESCR *pObject;
+
+    if (Object_List) {
+        do {
+            pObject = Keylist_Data_Pop(Object_List);
+            free(pObject);
+        } while (pObject);
+        Keylist_Delete(Object_List);
+        Object_List = NULL;
+    }
+    Access_User_Initialized = false;
+}
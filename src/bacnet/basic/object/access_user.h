@@ -36,6 +36,7 @@
 #include "bacnet/wp.h"
 
 
+/* number of objects created by Init - more may be created at runtime */
 #ifndef MAX_ACCESS_USERS
 #define MAX_ACCESS_USERS 4
 #endif
@@ -93,6 +94,10 @@ extern "C" {
     bool Access_User_Write_Property(
         BACNET_WRITE_PROPERTY_DATA * wp_data);
 
+    BACNET_STACK_EXPORT
+    ACCESS_USER_DESCR *Access_User_Data(
+        uint32_t object_instance);
+
     BACNET_STACK_EXPORT
     uint32_t Access_User_Create(
         uint32_t object_instance);
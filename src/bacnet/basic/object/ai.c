@@ -26,6 +26,7 @@
 #include "bacnet/timestamp.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/keylist.h"
+#include "bacnet/basic/sys/propcache.h"
 #include "bacnet/basic/sys/debug.h"
 /* me! */
 #include "bacnet/basic/object/ai.h"
@@ -56,6 +57,7 @@ static const int Properties_Optional[] = {
 static const int Properties_Proprietary[] = { 
     -1 
 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 /* clang-format on */
 
 /**
@@ -222,6 +224,8 @@ void Analog_Input_Present_Value_Set(uint32_t object_instance, float value)
     if (pObject) {
         Analog_Input_COV_Detect(pObject, value);
         pObject->Present_Value = value;
+        propcache_invalidate_property(
+            Object_Type, object_instance, PROP_PRESENT_VALUE);
     }
 }
 
@@ -275,6 +279,8 @@ bool Analog_Input_Name_Set(uint32_t object_instance, char *new_name)
     if (pObject) {
         status = true;
         pObject->Object_Name = new_name;
+        propcache_invalidate_property(
+            Object_Type, object_instance, PROP_OBJECT_NAME);
     }
 
     return status;
@@ -375,6 +381,8 @@ bool Analog_Input_Reliability_Set(
     pObject = Analog_Input_Object(object_instance);
     if (pObject) {
         pObject->Reliability = value;
+        propcache_invalidate_property(
+            Object_Type, object_instance, PROP_STATUS_FLAGS);
         status = true;
     }
 
@@ -520,6 +528,7 @@ bool Analog_Input_Units_Set(uint32_t object_instance, uint16_t units)
     pObject = Analog_Input_Object(object_instance);
     if (pObject) {
         pObject->Units = units;
+        propcache_invalidate_property(Object_Type, object_instance, PROP_UNITS);
         status = true;
     }
 
@@ -560,6 +569,8 @@ void Analog_Input_Out_Of_Service_Set(uint32_t object_instance, bool value)
     if (pObject) {
         if (pObject->Out_Of_Service != value) {
             pObject->Changed = true;
+            propcache_invalidate_property(
+                Object_Type, object_instance, PROP_STATUS_FLAGS);
         }
         pObject->Out_Of_Service = value;
     }
@@ -864,7 +875,8 @@ bool Analog_Input_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_ENUMERATED);
             if (status) {
-                pObject->Units = value.type.Enumerated;
+                Analog_Input_Units_Set(
+                    wp_data->object_instance, value.type.Enumerated);
             }
             break;
         case PROP_COV_INCREMENT:
@@ -965,9 +977,10 @@ bool Analog_Input_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             break;
 #endif
         default:
-            if (property_lists_member(
-                    Properties_Required, Properties_Optional,
-                    Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Properties_Required,
+                    Properties_Optional, Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -1114,6 +1127,9 @@ void Analog_Input_Intrinsic_Reporting(uint32_t object_instance)
         } /* switch (FromState) */
         ToState = CurrentAI->Event_State;
         if (FromState != ToState) {
+            /* the in-alarm status flag follows the event state */
+            propcache_invalidate_property(
+                Object_Type, object_instance, PROP_STATUS_FLAGS);
             /* Event_State has changed.
                Need to fill only the basic parameters of this type of event.
                Other parameters will be filled in common function. */
@@ -1609,6 +1625,7 @@ bool Analog_Input_Delete(uint32_t object_instance)
     pObject = Keylist_Data_Delete(Object_List, object_instance);
     if (pObject) {
         free(pObject);
+        propcache_invalidate(Object_Type, object_instance);
         status = true;
     }
 
@@ -1632,6 +1649,7 @@ void Analog_Input_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    propcache_enable(Object_Type, false);
 }
 
 /**
@@ -1642,6 +1660,7 @@ void Analog_Input_Init(void)
     if (!Object_List) {
         Object_List = Keylist_Create();
     }
+    propcache_enable(Object_Type, true);
 #if defined(INTRINSIC_REPORTING)
     /* Set handler for GetEventInformation function */
     handler_get_event_information_set(
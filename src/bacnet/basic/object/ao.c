@@ -51,6 +51,7 @@
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/commandable.h"
 #include "bacnet/basic/sys/keylist.h"
 /* me! */
 #include "ao.h"
@@ -59,11 +60,15 @@ struct object_data {
     bool Out_Of_Service : 1;
     bool Overridden : 1;
     bool Changed : 1;
+    bool Write_Pending : 1;
+    float Write_Old_Value;
     float COV_Increment;
     float Prior_Value;
-    bool Relinquished[BACNET_MAX_PRIORITY];
+    struct commandable Command;
     float Priority_Array[BACNET_MAX_PRIORITY];
     float Relinquish_Default;
+    /* effective value, updated when the priority array changes */
+    float Present_Value;
     float Min_Pres_Value;
     float Max_Pres_Value;
     uint16_t Units;
@@ -78,6 +83,9 @@ static const BACNET_OBJECT_TYPE Object_Type = OBJECT_ANALOG_OUTPUT;
 /* callback for present value writes */
 static analog_output_write_present_value_callback
     Analog_Output_Write_Present_Value_Callback;
+/* present value write callbacks are held until the end of a batch */
+static bool Write_Present_Value_Deferred;
+static unsigned Write_Present_Value_Pending;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 
@@ -183,18 +191,11 @@ unsigned Analog_Output_Instance_To_Index(uint32_t object_instance)
 float Analog_Output_Present_Value(uint32_t object_instance)
 {
     float value = 0.0;
-    uint8_t priority = 0; /* loop counter */
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        value = Analog_Output_Relinquish_Default(object_instance);
-        for (priority = 0; priority < BACNET_MAX_PRIORITY; priority++) {
-            if (!pObject->Relinquished[priority]) {
-                value = pObject->Priority_Array[priority];
-                break;
-            }
-        }
+        value = pObject->Present_Value;
     }
 
     return value;
@@ -207,18 +208,12 @@ float Analog_Output_Present_Value(uint32_t object_instance)
  */
 unsigned Analog_Output_Present_Value_Priority(uint32_t object_instance)
 {
-    unsigned p = 0; /* loop counter */
     unsigned priority = 0; /* return value */
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-            if (!pObject->Relinquished[p]) {
-                priority = p + 1;
-                break;
-            }
-        }
+        priority = commandable_priority(&pObject->Command);
     }
 
     return priority;
@@ -243,7 +238,7 @@ static int Analog_Output_Priority_Array_Encode(
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject && (index < BACNET_MAX_PRIORITY)) {
-        if (pObject->Relinquished[index]) {
+        if (!commandable_active(&pObject->Command, index + 1)) {
             apdu_len = encode_application_null(apdu);
         } else {
             real_value = pObject->Priority_Array[index];
@@ -290,6 +285,9 @@ bool Analog_Output_Relinquish_Default_Set(uint32_t object_instance, float value)
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         pObject->Relinquish_Default = value;
+        if (commandable_priority(&pObject->Command) == 0) {
+            pObject->Present_Value = value;
+        }
         status = true;
     }
 
@@ -305,21 +303,10 @@ bool Analog_Output_Relinquish_Default_Set(uint32_t object_instance, float value)
 static void Analog_Output_Present_Value_COV_Detect(
     struct object_data *pObject, float value)
 {
-    float prior_value = 0.0;
-    float cov_increment = 0.0;
-    float cov_delta = 0.0;
-
     if (pObject) {
-        prior_value = pObject->Prior_Value;
-        cov_increment = pObject->COV_Increment;
-        if (prior_value > value) {
-            cov_delta = prior_value - value;
-        } else {
-            cov_delta = value - prior_value;
-        }
-        if (cov_delta >= cov_increment) {
+        if (commandable_cov_real(
+                &pObject->Prior_Value, value, pObject->COV_Increment)) {
             pObject->Changed = true;
-            pObject->Prior_Value = value;
         }
     }
 }
@@ -342,10 +329,12 @@ bool Analog_Output_Present_Value_Set(
     if (pObject) {
         if ((priority >= 1) && (priority <= BACNET_MAX_PRIORITY) &&
                 value >= pObject->Min_Pres_Value && value <= pObject->Max_Pres_Value) {
-            pObject->Relinquished[priority - 1] = false;
             pObject->Priority_Array[priority - 1] = value;
+            if (commandable_command(&pObject->Command, priority)) {
+                pObject->Present_Value = value;
+            }
             Analog_Output_Present_Value_COV_Detect(
-                pObject, Analog_Output_Present_Value(object_instance));
+                pObject, pObject->Present_Value);
             status = true;
         }
     }
@@ -368,10 +357,18 @@ bool Analog_Output_Present_Value_Relinquish(
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         if ((priority >= 1) && (priority <= BACNET_MAX_PRIORITY)) {
-            pObject->Relinquished[priority - 1] = true;
             pObject->Priority_Array[priority - 1] = 0.0;
+            if (commandable_relinquish(&pObject->Command, priority)) {
+                priority = commandable_priority(&pObject->Command);
+                if (priority) {
+                    pObject->Present_Value =
+                        pObject->Priority_Array[priority - 1];
+                } else {
+                    pObject->Present_Value = pObject->Relinquish_Default;
+                }
+            }
             Analog_Output_Present_Value_COV_Detect(
-                pObject, Analog_Output_Present_Value(object_instance));
+                pObject, pObject->Present_Value);
             status = true;
         }
     }
@@ -379,6 +376,30 @@ bool Analog_Output_Present_Value_Relinquish(
     return status;
 }
 
+/**
+ * @brief Calls the present value write callback, or holds the value from
+ *  before the first write of a batch until the callbacks are no longer
+ *  deferred
+ * @param  object_instance - object-instance number of the object
+ * @param  pObject - object data
+ * @param  old_value - present value before the write
+ */
+static void Analog_Output_Write_Present_Value_Notify(uint32_t object_instance,
+    struct object_data *pObject,
+    float old_value)
+{
+    if (Write_Present_Value_Deferred) {
+        if (!pObject->Write_Pending) {
+            pObject->Write_Pending = true;
+            pObject->Write_Old_Value = old_value;
+            Write_Present_Value_Pending++;
+        }
+    } else {
+        Analog_Output_Write_Present_Value_Callback(object_instance, old_value,
+            Analog_Output_Present_Value(object_instance));
+    }
+}
+
 /**
  * @brief For a given object instance-number, writes the present-value to the
  * remote node
@@ -398,7 +419,6 @@ static bool Analog_Output_Present_Value_Write(uint32_t object_instance,
     bool status = false;
     struct object_data *pObject;
     float old_value = 0.0;
-    float new_value = 0.0;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
@@ -415,9 +435,8 @@ static bool Analog_Output_Present_Value_Write(uint32_t object_instance,
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Analog_Output_Write_Present_Value_Callback) {
-                    new_value = Analog_Output_Present_Value(object_instance);
-                    Analog_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Analog_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -454,7 +473,6 @@ static bool Analog_Output_Present_Value_Relinquish_Write(
     bool status = false;
     struct object_data *pObject;
     float old_value = 0.0;
-    float new_value = 0.0;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
@@ -470,9 +488,8 @@ static bool Analog_Output_Present_Value_Relinquish_Write(
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Analog_Output_Write_Present_Value_Callback) {
-                    new_value = Analog_Output_Present_Value(object_instance);
-                    Analog_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Analog_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -1182,6 +1199,41 @@ void Analog_Output_Write_Present_Value_Callback_Set(
     Analog_Output_Write_Present_Value_Callback = cb;
 }
 
+/**
+ * @brief Defers the present value write callback, so that a batch of
+ *  writes calls it once for each object that was written, with the
+ *  present value from before the first write
+ * @param defer - true to defer, false to call the deferred callbacks
+ */
+void Analog_Output_Write_Present_Value_Defer(bool defer)
+{
+    struct object_data *pObject;
+    uint32_t object_instance = 0;
+    float old_value;
+    int count, index;
+
+    Write_Present_Value_Deferred = defer;
+    if (defer) {
+        return;
+    }
+    count = Keylist_Count(Object_List);
+    for (index = 0; (index < count) && Write_Present_Value_Pending; index++) {
+        pObject = Keylist_Data_Index(Object_List, index);
+        if (pObject && pObject->Write_Pending) {
+            pObject->Write_Pending = false;
+            Write_Present_Value_Pending--;
+            old_value = pObject->Write_Old_Value;
+            if (Analog_Output_Write_Present_Value_Callback &&
+                !pObject->Out_Of_Service &&
+                Keylist_Index_Key(Object_List, index, &object_instance)) {
+                Analog_Output_Write_Present_Value_Callback(object_instance,
+                    old_value, Analog_Output_Present_Value(object_instance));
+            }
+        }
+    }
+    Write_Present_Value_Pending = 0;
+}
+
 /**
  * @brief Creates a Analog Output object
  * @param object_instance - object-instance number of the object
@@ -1210,11 +1262,12 @@ uint32_t Analog_Output_Create(uint32_t object_instance)
             pObject->Object_Name = NULL;
             pObject->Reliability = RELIABILITY_NO_FAULT_DETECTED;
             pObject->Overridden = false;
+            commandable_init(&pObject->Command);
             for (priority = 0; priority < BACNET_MAX_PRIORITY; priority++) {
-                pObject->Relinquished[priority] = true;
                 pObject->Priority_Array[priority] = 0.0;
             }
             pObject->Relinquish_Default = 0.0;
+            pObject->Present_Value = 0.0;
             pObject->COV_Increment = 1.0;
             pObject->Prior_Value = 0.0;
             pObject->Units = UNITS_NO_UNITS;
@@ -93,6 +93,9 @@ extern "C" {
     BACNET_STACK_EXPORT
     void Analog_Output_Write_Present_Value_Callback_Set(
         analog_output_write_present_value_callback cb);
+    BACNET_STACK_EXPORT
+    void Analog_Output_Write_Present_Value_Defer(
+        bool defer);
 
     BACNET_STACK_EXPORT
     float Analog_Output_Relinquish_Default(
@@ -55,6 +55,7 @@ static const int Analog_Value_Properties_Optional[] = {
 static const int Analog_Value_Properties_Proprietary[] = { 
     -1 
 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 /* clang-format on */
 
 /**
@@ -994,8 +995,8 @@ bool Analog_Value_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             break;
 #endif
         default:
-            if (property_lists_member(
-                    Analog_Value_Properties_Required,
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Analog_Value_Properties_Required,
                     Analog_Value_Properties_Optional,
                     Analog_Value_Properties_Proprietary,
                     wp_data->object_property)) {
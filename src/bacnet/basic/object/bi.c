@@ -23,6 +23,7 @@
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/keylist.h"
+#include "bacnet/basic/sys/propcache.h"
 /* me! */
 #include "bacnet/basic/object/bi.h"
 
@@ -60,6 +61,7 @@ static const int Properties_Optional[] = { PROP_RELIABILITY, PROP_DESCRIPTION,
                                            -1 };
 
 static const int Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Initialize the pointers for the required, the optional and the properitary
@@ -284,6 +286,7 @@ void Binary_Input_Out_Of_Service_Set(uint32_t object_instance, bool value)
         if (pObject->Out_Of_Service != value) {
             pObject->Out_Of_Service = value;
             pObject->Change_Of_Value = true;
+            propcache_invalidate(Object_Type, object_instance);
         }
     }
 
@@ -349,6 +352,7 @@ bool Binary_Input_Reliability_Set(
             pObject->Reliability = value;
             if (fault != Binary_Input_Object_Fault(pObject)) {
                 pObject->Change_Of_Value = true;
+                propcache_invalidate(Object_Type, object_instance);
             }
             status = true;
         }
@@ -464,6 +468,8 @@ bool Binary_Input_Present_Value_Set(
             }
             Binary_Input_Present_Value_COV_Detect(pObject, value);
             pObject->Present_Value = Binary_Present_Value_Boolean(value);
+            propcache_invalidate_property(
+                Object_Type, object_instance, PROP_PRESENT_VALUE);
             status = true;
         }
     }
@@ -498,6 +504,8 @@ static bool Binary_Input_Present_Value_Write(
                 old_value = Binary_Present_Value(pObject->Present_Value);
                 Binary_Input_Present_Value_COV_Detect(pObject, value);
                 pObject->Present_Value = Binary_Present_Value_Boolean(value);
+                propcache_invalidate_property(
+                    Object_Type, object_instance, PROP_PRESENT_VALUE);
                 if (pObject->Out_Of_Service) {
                     /* The physical point that the object represents
                         is not in service. This means that changes to the
@@ -570,6 +578,8 @@ bool Binary_Input_Name_Set(uint32_t object_instance, char *new_name)
         if (new_name) {
             status = true;
             pObject->Object_Name = new_name;
+            propcache_invalidate_property(
+                Object_Type, object_instance, PROP_OBJECT_NAME);
         }
     }
 
@@ -609,6 +619,8 @@ bool Binary_Input_Polarity_Set(
     pObject = Binary_Input_Object(object_instance);
     if (pObject) {
         pObject->Polarity = Binary_Polarity_Boolean(polarity);
+        /* the present-value is reported with the polarity applied */
+        propcache_invalidate(Object_Type, object_instance);
     }
 
     return status;
@@ -906,9 +918,10 @@ bool Binary_Input_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                    Properties_Required, Properties_Optional,
-                    Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Properties_Required,
+                    Properties_Optional, Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -1042,6 +1055,7 @@ void Binary_Input_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    propcache_enable(Object_Type, false);
 }
 
 /**
@@ -1057,6 +1071,7 @@ bool Binary_Input_Delete(uint32_t object_instance)
     pObject = Keylist_Data_Delete(Object_List, object_instance);
     if (pObject) {
         free(pObject);
+        propcache_invalidate(Object_Type, object_instance);
         status = true;
     }
 
@@ -1071,4 +1086,5 @@ void Binary_Input_Init(void)
     if (!Object_List) {
         Object_List = Keylist_Create();
     }
+    propcache_enable(Object_Type, true);
 }
@@ -49,6 +49,7 @@ static const int Properties_Optional[] = { PROP_RELIABILITY,
     PROP_OUT_OF_SERVICE, PROP_DESCRIPTION, -1 };
 
 static const int Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Initialize the pointers for the required, the optional and the properitary
@@ -666,9 +667,10 @@ bool BitString_Value_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                Properties_Required, Properties_Optional, 
-                Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Properties_Required,
+                    Properties_Optional, Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
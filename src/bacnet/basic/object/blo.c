@@ -20,7 +20,9 @@
 #include "bacnet/wp.h"
 #include "bacnet/lighting.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/commandable.h"
 #include "bacnet/basic/sys/keylist.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/proplist.h"
 /* me! */
 #include "bacnet/basic/object/blo.h"
@@ -33,7 +35,7 @@ struct object_data {
     uint32_t Egress_Time;
     BACNET_BINARY_LIGHTING_PV Feedback_Value;
     BACNET_BINARY_LIGHTING_PV Priority_Array[BACNET_MAX_PRIORITY];
-    uint16_t Priority_Active_Bits;
+    struct commandable Command;
     BACNET_BINARY_LIGHTING_PV Relinquish_Default;
     float Power;
     uint32_t Elapsed_Active_Time;
@@ -58,6 +60,11 @@ static binary_lighting_output_write_value_callback
     Binary_Lighting_Output_Write_Value_Callback;
 static binary_lighting_output_blink_warn_callback
     Binary_Lighting_Output_Blink_Warn_Callback;
+/* runs the written target values and egress delays while there are any */
+static struct tmwheel_timer Output_Timer;
+#ifndef BINARY_LIGHTING_OUTPUT_TIMER_MILLISECONDS
+#define BINARY_LIGHTING_OUTPUT_TIMER_MILLISECONDS 100
+#endif
 
 /* These arrays are used by the ReadPropertyMultiple handler and
    property-list property (as of protocol-revision 14) */
@@ -77,6 +84,18 @@ static const int Binary_Lighting_Output_Properties_Optional[] = {
 
 static const int Binary_Lighting_Output_Properties_Proprietary[] = { -1 };
 
+/**
+ * @brief Arm the output timer for a new target value,
+ *  unless it is already armed
+ */
+static void Binary_Lighting_Output_Timer_Start(void)
+{
+    if (!tmwheel_timer_pending(&Output_Timer)) {
+        tmwheel_timer_set(
+            &Output_Timer, BINARY_LIGHTING_OUTPUT_TIMER_MILLISECONDS);
+    }
+}
+
 /**
  * Returns the list of required, optional, and proprietary properties.
  * Used by ReadPropertyMultiple service.
@@ -164,27 +183,6 @@ unsigned Binary_Lighting_Output_Instance_To_Index(uint32_t object_instance)
     return Keylist_Index(Object_List, object_instance);
 }
 
-/**
- * @brief Get the priority-array active status for the specific priority
- * @param object [in] BACnet object instance
- * @param priority [in] array index requested:
- *    0 to N for individual array members
- * @return the priority-array active status for the specific priority
- */
-static bool Priority_Array_Active(
-    struct object_data *pObject, BACNET_ARRAY_INDEX priority)
-{
-    bool active = false;
-
-    if (priority < BACNET_MAX_PRIORITY) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, priority)) {
-            active = true;
-        }
-    }
-
-    return active;
-}
-
 /**
  * @brief Get the value of the next highest non-NULL priority, including
  *  Relinquish_Default
@@ -196,15 +194,13 @@ static bool Priority_Array_Active(
 static BACNET_BINARY_LIGHTING_PV Priority_Array_Next_Value(
     struct object_data *pObject, BACNET_ARRAY_INDEX priority)
 {
-    BACNET_BINARY_LIGHTING_PV value = BINARY_LIGHTING_PV_OFF;
-    unsigned p = 0;
+    BACNET_BINARY_LIGHTING_PV value;
+    unsigned next_priority;
 
     value = pObject->Relinquish_Default;
-    for (p = priority; p < BACNET_MAX_PRIORITY; p++) {
-        if (Priority_Array_Active(pObject, p)) {
-            value = pObject->Priority_Array[p];
-            break;
-        }
+    next_priority = commandable_next_priority(&pObject->Command, priority);
+    if (next_priority) {
+        value = pObject->Priority_Array[next_priority - 1];
     }
 
     return value;
@@ -231,27 +227,6 @@ BACNET_BINARY_LIGHTING_PV Binary_Lighting_Output_Present_Value(
     return value;
 }
 
-/**
- * @brief Get the priority-array value for the specific priority
- * @param object [in] BACnet object instance
- * @param priority [in] array index requested:
- *    0 to N for individual array members
- * @return The priority-array value for the specific priority
- */
-static BACNET_BINARY_LIGHTING_PV Priority_Array_Value(
-    struct object_data *pObject, BACNET_ARRAY_INDEX priority)
-{
-    BACNET_BINARY_LIGHTING_PV value = BINARY_LIGHTING_PV_OFF;
-
-    if (priority < BACNET_MAX_PRIORITY) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, priority)) {
-            value = pObject->Priority_Array[priority];
-        }
-    }
-
-    return value;
-}
-
 /**
  * @brief Encode a BACnetARRAY property element
  * @param object_instance [in] BACnet network port object instance number
@@ -272,7 +247,7 @@ static int Binary_Lighting_Output_Priority_Array_Encode(
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         if (priority < BACNET_MAX_PRIORITY) {
-            if (Priority_Array_Active(pObject, priority)) {
+            if (commandable_active(&pObject->Command, priority + 1)) {
                 value = pObject->Priority_Array[priority];
                 apdu_len = encode_application_enumerated(apdu, value);
             } else {
@@ -284,28 +259,6 @@ static int Binary_Lighting_Output_Priority_Array_Encode(
     return apdu_len;
 }
 
-/**
- * For a given object instance-number, determines the active priority
- *
- * @param  object_instance - object-instance number of the object
- *
- * @return  active priority 1..16, or 0 if no priority is active
- */
-static unsigned Present_Value_Priority(struct object_data *pObject)
-{
-    unsigned p = 0; /* loop counter */
-    unsigned priority = 0; /* return value */
-
-    for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, p)) {
-            priority = p + 1;
-            break;
-        }
-    }
-
-    return priority;
-}
-
 /**
  * For a given object instance, relinquishes the present-value
  * at a given priority 1..16.
@@ -322,9 +275,8 @@ static bool Present_Value_Relinquish(
 
     if (priority && (priority <= BACNET_MAX_PRIORITY) &&
         (priority != 6 /* reserved */)) {
-        priority--;
-        BIT_CLEAR(pObject->Priority_Active_Bits, priority);
-        pObject->Priority_Array[priority] = BINARY_LIGHTING_PV_OFF;
+        (void)commandable_relinquish(&pObject->Command, priority);
+        pObject->Priority_Array[priority - 1] = BINARY_LIGHTING_PV_OFF;
         status = true;
     }
 
@@ -349,12 +301,11 @@ static bool Present_Value_Set(struct object_data *pObject,
 
     if (priority && (priority <= BACNET_MAX_PRIORITY) &&
         (priority != 6 /* reserved */)) {
-        priority--;
         if ((value == BINARY_LIGHTING_PV_OFF) ||
             (value == BINARY_LIGHTING_PV_ON)) {
             /* The logical state of the output shall be either ON or OFF */
-            BIT_SET(pObject->Priority_Active_Bits, priority);
-            pObject->Priority_Array[priority] = value;
+            pObject->Priority_Array[priority - 1] = value;
+            (void)commandable_command(&pObject->Command, priority);
             status = true;
         }
     }
@@ -376,7 +327,7 @@ unsigned Binary_Lighting_Output_Present_Value_Priority(uint32_t object_instance)
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        priority = Present_Value_Priority(pObject);
+        priority = commandable_priority(&pObject->Command);
     }
 
     return priority;
@@ -402,6 +353,7 @@ bool Binary_Lighting_Output_Present_Value_Set(uint32_t object_instance,
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         status = Present_Value_Set(pObject, value, priority);
+        Binary_Lighting_Output_Timer_Start();
     }
 
     return status;
@@ -421,7 +373,7 @@ static void Present_Value_On_Off_Handler(uint32_t object_instance)
     if (!pObject) {
         return;
     }
-    current_priority = Present_Value_Priority(pObject);
+    current_priority = commandable_priority(&pObject->Command);
     if (pObject->Target_Priority <= current_priority) {
         /* we have priority - do something */
         if (pObject->Feedback_Value != pObject->Target_Value) {
@@ -452,16 +404,12 @@ static void Present_Value_Relinquish_Handler(uint32_t object_instance)
     if (!pObject) {
         return;
     }
-    current_priority = Present_Value_Priority(pObject);
+    current_priority = commandable_priority(&pObject->Command);
     if (pObject->Target_Priority != current_priority) {
         /* target priority holds previous priority
            and *any* change after relinquish
            indicates something needs done */
-        if (current_priority > BACNET_MAX_PRIORITY) {
-            value = pObject->Relinquish_Default;
-        } else {
-            value = Priority_Array_Value(pObject, current_priority);
-        }
+        value = Priority_Array_Next_Value(pObject, 0);
         if (pObject->Feedback_Value != value) {
             pObject->Changed = true;
             if ((!pObject->Out_Of_Service) &&
@@ -519,7 +467,7 @@ static void Present_Value_Warn_Handler(uint32_t object_instance)
     if (!pObject) {
         return;
     }
-    current_priority = Present_Value_Priority(pObject);
+    current_priority = commandable_priority(&pObject->Command);
     if (pObject->Target_Value == BINARY_LIGHTING_PV_WARN_RELINQUISH) {
         /* relinquish this priority */
         Present_Value_Relinquish(pObject, pObject->Target_Priority);
@@ -538,7 +486,7 @@ static void Present_Value_Warn_Handler(uint32_t object_instance)
         return;
     }
     if (pObject->Target_Value == BINARY_LIGHTING_PV_WARN_RELINQUISH) {
-        if (!Priority_Array_Active(pObject, pObject->Target_Priority)) {
+        if (!commandable_active(&pObject->Command, pObject->Target_Priority)) {
             /* The value at the specified priority is NULL */
             return;
         }
@@ -549,7 +497,7 @@ static void Present_Value_Warn_Handler(uint32_t object_instance)
                 including Relinquish_Default, is ON. */
             return;
         }
-        pObject->Target_Priority = Present_Value_Priority(pObject);
+        pObject->Target_Priority = commandable_priority(&pObject->Command);
     }
     /* the egress time in seconds when a WARN_RELINQUISH or WARN_OFF value
         is written to the Present_Value property. */
@@ -619,6 +567,47 @@ void Binary_Lighting_Output_Timer(
     }
 }
 
+/**
+ * @brief Output timer callback - updates every binary lighting output,
+ *  and stays armed while an egress delay is running or a target value
+ *  was changed by the update
+ * @param timer - the output timer
+ * @param context - not used
+ */
+static void Binary_Lighting_Output_Timer_Handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    BACNET_BINARY_LIGHTING_PV target_value;
+    struct object_data *pObject;
+    KEY key = 0;
+    int count, index;
+    bool active = false;
+
+    (void)context;
+    count = Keylist_Count(Object_List);
+    for (index = 0; index < count; index++) {
+        if (!Keylist_Index_Key(Object_List, index, &key)) {
+            continue;
+        }
+        pObject = Keylist_Data(Object_List, key);
+        if (!pObject) {
+            continue;
+        }
+        target_value = pObject->Target_Value;
+        Binary_Lighting_Output_Timer(
+            key, (uint16_t)tmwheel_timer_interval(timer));
+        pObject = Keylist_Data(Object_List, key);
+        if (pObject &&
+            ((pObject->Egress_Timer > 0) ||
+                (pObject->Target_Value != target_value))) {
+            active = true;
+        }
+    }
+    if (active && !tmwheel_timer_pending(timer)) {
+        tmwheel_timer_reset(timer);
+    }
+}
+
 /**
  * For a given object instance-number, writes the present-value
  *
@@ -656,11 +645,13 @@ static bool Binary_Lighting_Output_Present_Value_Write(uint32_t object_instance,
                     /* ON or OFF only */
                     Present_Value_On_Off_Handler(object_instance);
                 }
+                Binary_Lighting_Output_Timer_Start();
                 status = true;
             } else if ((value >= BINARY_LIGHTING_PV_PROPRIETARY_MIN) &&
                 (value <= BINARY_LIGHTING_PV_PROPRIETARY_MAX)) {
                 pObject->Target_Priority = priority;
                 pObject->Target_Value = value;
+                Binary_Lighting_Output_Timer_Start();
                 status = true;
             } else {
                 *error_class = ERROR_CLASS_PROPERTY;
@@ -696,6 +687,7 @@ bool Binary_Lighting_Output_Present_Value_Relinquish(
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         status = Present_Value_Relinquish(pObject, priority);
+        Binary_Lighting_Output_Timer_Start();
     }
 
     return status;
@@ -731,10 +723,11 @@ static bool Binary_Lighting_Output_Present_Value_Relinquish_Write(
             *error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
         } else if ((priority > 0) && (priority <= BACNET_MAX_PRIORITY)) {
             /* target priority will hold the previous priority */
-            pObject->Target_Priority = Present_Value_Priority(pObject);
+            pObject->Target_Priority = commandable_priority(&pObject->Command);
             pObject->Target_Value = BINARY_LIGHTING_PV_STOP;
             Present_Value_Relinquish(pObject, priority);
             Present_Value_Relinquish_Handler(object_instance);
+            Binary_Lighting_Output_Timer_Start();
             status = true;
         } else {
             *error_class = ERROR_CLASS_PROPERTY;
@@ -1494,9 +1487,9 @@ uint32_t Binary_Lighting_Output_Create(uint32_t object_instance)
         pObject->Egress_Time = 0;
         pObject->Feedback_Value = BINARY_LIGHTING_PV_OFF;
         pObject->Target_Value = BINARY_LIGHTING_PV_OFF;
+        commandable_init(&pObject->Command);
         for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
             pObject->Priority_Array[p] = BINARY_LIGHTING_PV_OFF;
-            BIT_CLEAR(pObject->Priority_Active_Bits, p);
         }
         pObject->Relinquish_Default = BINARY_LIGHTING_PV_OFF;
         pObject->Power = 0.0;
@@ -1547,6 +1540,7 @@ void Binary_Lighting_Output_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    tmwheel_timer_cancel(&Output_Timer);
 }
 
 /**
@@ -1556,5 +1550,7 @@ void Binary_Lighting_Output_Init(void)
 {
     if (!Object_List) {
         Object_List = Keylist_Create();
+        tmwheel_timer_init(
+            &Output_Timer, Binary_Lighting_Output_Timer_Handler, NULL);
     }
 }
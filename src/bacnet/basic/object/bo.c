@@ -50,6 +50,7 @@
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/commandable.h"
 #include "bacnet/basic/sys/keylist.h"
 /* me! */
 #include "bo.h"
@@ -59,11 +60,14 @@ static const char *Default_Inactive_Text = "Inactive";
 struct object_data {
     bool Out_Of_Service : 1;
     bool Changed : 1;
+    /* effective value, updated when the priority array changes */
     bool Present_Value : 1;
     bool Relinquish_Default : 1;
     bool Polarity : 1;
+    bool Write_Pending : 1;
+    BACNET_BINARY_PV Write_Old_Value;
     uint16_t Priority_Array;
-    uint16_t Priority_Active_Bits;
+    struct commandable Command;
     uint8_t Reliability;
     const char *Object_Name;
     const char *Active_Text;
@@ -77,6 +81,9 @@ static const BACNET_OBJECT_TYPE Object_Type = OBJECT_BINARY_OUTPUT;
 /* callback for present value writes */
 static binary_output_write_present_value_callback
     Binary_Output_Write_Present_Value_Callback;
+/* present value write callbacks are held until the end of a batch */
+static bool Write_Present_Value_Deferred;
+static unsigned Write_Present_Value_Pending;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -92,6 +99,7 @@ static const int Properties_Optional[] = { PROP_RELIABILITY,
     PROP_DESCRIPTION, PROP_ACTIVE_TEXT, PROP_INACTIVE_TEXT, -1 };
 
 static const int Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Returns the list of required, optional, and proprietary properties.
@@ -190,29 +198,37 @@ unsigned Binary_Output_Instance_To_Index(uint32_t object_instance)
 BACNET_BINARY_PV Binary_Output_Present_Value(uint32_t object_instance)
 {
     BACNET_BINARY_PV value = BINARY_INACTIVE;
-    unsigned p = 0;
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        if (pObject->Relinquish_Default) {
+        if (pObject->Present_Value) {
             value = BINARY_ACTIVE;
         }
-        for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-            if (BIT_CHECK(pObject->Priority_Active_Bits, p)) {
-                if (BIT_CHECK(pObject->Priority_Array, p)) {
-                    value = BINARY_ACTIVE;
-                } else {
-                    value = BINARY_INACTIVE;
-                }
-                break;
-            }
-        }
     }
 
     return value;
 }
 
+/**
+ * For a given object, updates the effective present-value from the
+ * winning priority, or from the relinquish-default
+ *
+ * @param  pObject - specific object with valid data
+ */
+static void Binary_Output_Present_Value_Update(struct object_data *pObject)
+{
+    unsigned priority;
+
+    priority = commandable_priority(&pObject->Command);
+    if (priority) {
+        pObject->Present_Value =
+            BIT_CHECK(pObject->Priority_Array, priority - 1) ? true : false;
+    } else {
+        pObject->Present_Value = pObject->Relinquish_Default;
+    }
+}
+
 /**
  * @brief Encode a BACnetARRAY property element
  * @param object_instance [in] BACnet network port object instance number
@@ -232,7 +248,7 @@ static int Binary_Output_Priority_Array_Encode(
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject && (index < BACNET_MAX_PRIORITY)) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, index)) {
+        if (commandable_active(&pObject->Command, index + 1)) {
             if (BIT_CHECK(pObject->Priority_Array, index)) {
                 value = BINARY_ACTIVE;
             }
@@ -254,18 +270,12 @@ static int Binary_Output_Priority_Array_Encode(
  */
 unsigned Binary_Output_Present_Value_Priority(uint32_t object_instance)
 {
-    unsigned p = 0; /* loop counter */
     unsigned priority = 0; /* return value */
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-            if (BIT_CHECK(pObject->Priority_Active_Bits, p)) {
-                priority = p + 1;
-                break;
-            }
-        }
+        priority = commandable_priority(&pObject->Command);
     }
 
     return priority;
@@ -291,13 +301,14 @@ bool Binary_Output_Present_Value_Set(
     if (pObject) {
         if (priority && (priority <= BACNET_MAX_PRIORITY) &&
             (priority != 6 /* reserved */)) {
-            priority--;
             if (binary_value <= MAX_BINARY_PV) {
-                BIT_SET(pObject->Priority_Active_Bits, priority);
                 if (binary_value == BINARY_ACTIVE) {
-                    BIT_SET(pObject->Priority_Array, priority);
+                    BIT_SET(pObject->Priority_Array, priority - 1);
                 } else {
-                    BIT_CLEAR(pObject->Priority_Array, priority);
+                    BIT_CLEAR(pObject->Priority_Array, priority - 1);
+                }
+                if (commandable_command(&pObject->Command, priority)) {
+                    Binary_Output_Present_Value_Update(pObject);
                 }
                 status = true;
             }
@@ -326,9 +337,10 @@ bool Binary_Output_Present_Value_Relinquish(
     if (pObject) {
         if (priority && (priority <= BACNET_MAX_PRIORITY) &&
             (priority != 6 /* reserved */)) {
-            priority--;
-            BIT_CLEAR(pObject->Priority_Active_Bits, priority);
-            BIT_CLEAR(pObject->Priority_Array, priority);
+            BIT_CLEAR(pObject->Priority_Array, priority - 1);
+            if (commandable_relinquish(&pObject->Command, priority)) {
+                Binary_Output_Present_Value_Update(pObject);
+            }
             status = true;
         }
     }
@@ -336,6 +348,30 @@ bool Binary_Output_Present_Value_Relinquish(
     return status;
 }
 
+/**
+ * @brief Calls the present value write callback, or holds the value from
+ *  before the first write of a batch until the callbacks are no longer
+ *  deferred
+ * @param  object_instance - object-instance number of the object
+ * @param  pObject - object data
+ * @param  old_value - present value before the write
+ */
+static void Binary_Output_Write_Present_Value_Notify(uint32_t object_instance,
+    struct object_data *pObject,
+    BACNET_BINARY_PV old_value)
+{
+    if (Write_Present_Value_Deferred) {
+        if (!pObject->Write_Pending) {
+            pObject->Write_Pending = true;
+            pObject->Write_Old_Value = old_value;
+            Write_Present_Value_Pending++;
+        }
+    } else {
+        Binary_Output_Write_Present_Value_Callback(object_instance, old_value,
+            Binary_Output_Present_Value(object_instance));
+    }
+}
+
 /**
  * @brief For a given object instance-number, writes the present-value to the
  * remote node
@@ -355,7 +391,6 @@ static bool Binary_Output_Present_Value_Write(uint32_t object_instance,
     bool status = false;
     struct object_data *pObject;
     BACNET_BINARY_PV old_value = BINARY_INACTIVE;
-    BACNET_BINARY_PV new_value = BINARY_INACTIVE;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
@@ -372,9 +407,8 @@ static bool Binary_Output_Present_Value_Write(uint32_t object_instance,
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Binary_Output_Write_Present_Value_Callback) {
-                    new_value = Binary_Output_Present_Value(object_instance);
-                    Binary_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Binary_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -411,7 +445,6 @@ static bool Binary_Output_Present_Value_Relinquish_Write(
     bool status = false;
     struct object_data *pObject;
     BACNET_BINARY_PV old_value = BINARY_INACTIVE;
-    BACNET_BINARY_PV new_value = BINARY_INACTIVE;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
@@ -427,9 +460,8 @@ static bool Binary_Output_Present_Value_Relinquish_Write(
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Binary_Output_Write_Present_Value_Callback) {
-                    new_value = Binary_Output_Present_Value(object_instance);
-                    Binary_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Binary_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -645,6 +677,9 @@ bool Binary_Output_Relinquish_Default_Set(
             pObject->Relinquish_Default = false;
             status = true;
         }
+        if (status) {
+            Binary_Output_Present_Value_Update(pObject);
+        }
     }
 
     return status;
@@ -1119,8 +1154,10 @@ bool Binary_Output_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(Properties_Required, Properties_Optional,
-                    Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Properties_Required,
+                    Properties_Optional, Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -1145,6 +1182,41 @@ void Binary_Output_Write_Present_Value_Callback_Set(
     Binary_Output_Write_Present_Value_Callback = cb;
 }
 
+/**
+ * @brief Defers the present value write callback, so that a batch of
+ *  writes calls it once for each object that was written, with the
+ *  present value from before the first write
+ * @param defer - true to defer, false to call the deferred callbacks
+ */
+void Binary_Output_Write_Present_Value_Defer(bool defer)
+{
+    struct object_data *pObject;
+    uint32_t object_instance = 0;
+    BACNET_BINARY_PV old_value;
+    int count, index;
+
+    Write_Present_Value_Deferred = defer;
+    if (defer) {
+        return;
+    }
+    count = Keylist_Count(Object_List);
+    for (index = 0; (index < count) && Write_Present_Value_Pending; index++) {
+        pObject = Keylist_Data_Index(Object_List, index);
+        if (pObject && pObject->Write_Pending) {
+            pObject->Write_Pending = false;
+            Write_Present_Value_Pending--;
+            old_value = pObject->Write_Old_Value;
+            if (Binary_Output_Write_Present_Value_Callback &&
+                !pObject->Out_Of_Service &&
+                Keylist_Index_Key(Object_List, index, &object_instance)) {
+                Binary_Output_Write_Present_Value_Callback(object_instance,
+                    old_value, Binary_Output_Present_Value(object_instance));
+            }
+        }
+    }
+    Write_Present_Value_Pending = 0;
+}
+
 /**
  * @brief Creates a Binary Output object
  * @param object_instance - object-instance number of the object
@@ -1171,6 +1243,7 @@ uint32_t Binary_Output_Create(uint32_t object_instance)
         if (pObject) {
             pObject->Object_Name = NULL;
             pObject->Reliability = RELIABILITY_NO_FAULT_DETECTED;
+            commandable_init(&pObject->Command);
             pObject->Present_Value = false;
             pObject->Out_Of_Service = false;
             pObject->Active_Text = Default_Active_Text;
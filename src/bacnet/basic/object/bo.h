@@ -126,6 +126,9 @@ extern "C" {
     BACNET_STACK_EXPORT
     void Binary_Output_Write_Present_Value_Callback_Set(
         binary_output_write_present_value_callback cb);
+    BACNET_STACK_EXPORT
+    void Binary_Output_Write_Present_Value_Defer(
+        bool defer);
 
     BACNET_STACK_EXPORT
     bool Binary_Output_Out_Of_Service(
@@ -59,6 +59,7 @@ static const int Binary_Value_Properties_Optional[] = {
 };
 
 static const int Binary_Value_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Initialize the pointers for the required, the optional and the properitary
@@ -920,8 +921,8 @@ bool Binary_Value_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                    Binary_Value_Properties_Required,
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Binary_Value_Properties_Required,
                     Binary_Value_Properties_Optional,
                     Binary_Value_Properties_Proprietary,
                     wp_data->object_property)) {
@@ -36,15 +36,23 @@
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/days.h"
 #include "bacnet/basic/sys/keylist.h"
 /* me! */
 #include "calendar.h"
 
+#define CALENDAR_SECONDS_PER_DAY 86400UL
+
 struct object_data {
     bool Changed : 1;
     bool Write_Enabled : 1;
+    bool Day_Bitmap_Valid : 1;
+    bool Date_List_Shared : 1;
     bool Present_Value;
     OS_Keylist Date_List;
+    /* Date_List compiled into one bit per day-of-year 1..366 */
+    uint8_t Day_Bitmap[(366 + 7) / 8];
+    uint16_t Day_Bitmap_Year;
     const char *Object_Name;
     const char *Description;
 };
@@ -53,6 +61,10 @@ static OS_Keylist Object_List;
 /* callback for present value writes */
 static calendar_write_present_value_callback
     Calendar_Write_Present_Value_Callback;
+/* callback for Date_List changes */
+static calendar_date_list_changed_callback Calendar_Date_List_Changed_Callback;
+/* the date last evaluated by Calendar_Task() */
+static BACNET_DATE Calendar_Task_Date;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Calendar_Properties_Required[] = {
@@ -63,6 +75,7 @@ static const int Calendar_Properties_Required[] = {
 static const int Calendar_Properties_Optional[] = { PROP_DESCRIPTION, -1 };
 
 static const int Calendar_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /* standard properties that are arrays for this object,
    but not necessary supported in this object */
@@ -217,6 +230,9 @@ static void Calendar_Date_List_Clean(OS_Keylist list)
 
 /**
  * For a given object instance-number, returns the Calendar entity by index.
+ * The caller may change the entity, so the Date_List is evaluated without
+ * its compiled bitmap until the Date_List is changed, or the entity is
+ * stored with Calendar_Date_List_Set().
  *
  * @param  object_instance - object-instance number of the object
  * @param  index - index of entity
@@ -232,11 +248,30 @@ Calendar_Date_List_Get(uint32_t object_instance, uint8_t index)
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
         entry = Keylist_Data_Index(pObject->Date_List, index);
+        if (entry) {
+            pObject->Date_List_Shared = true;
+        }
     }
 
     return entry;
 }
 
+/**
+ * @brief Drop the compiled Date_List of an object and tell the
+ *  objects that use it that the Date_List changed
+ * @param pObject - object data
+ * @param object_instance - object-instance number of the object
+ */
+static void Calendar_Date_List_Changed(
+    struct object_data *pObject, uint32_t object_instance)
+{
+    pObject->Day_Bitmap_Valid = false;
+    pObject->Date_List_Shared = false;
+    if (Calendar_Date_List_Changed_Callback) {
+        Calendar_Date_List_Changed_Callback(object_instance);
+    }
+}
+
 /**
  * For a given object instance-number, adds a Calendar entity to entities list.
  *
@@ -248,7 +283,6 @@ Calendar_Date_List_Get(uint32_t object_instance, uint8_t index)
 bool Calendar_Date_List_Add(
     uint32_t object_instance, BACNET_CALENDAR_ENTRY *value)
 {
-    bool st = false;
     BACNET_CALENDAR_ENTRY *entry;
     struct object_data *pObject;
 
@@ -263,10 +297,48 @@ bool Calendar_Date_List_Add(
     }
 
     *entry = *value;
-    st = Keylist_Data_Add(
-        pObject->Date_List, Keylist_Count(pObject->Date_List), entry);
+    if (Keylist_Data_Add(
+            pObject->Date_List, Keylist_Count(pObject->Date_List), entry) <
+        0) {
+        free(entry);
+        return false;
+    }
+    Calendar_Date_List_Changed(pObject, object_instance);
 
-    return st;
+    return true;
+}
+
+/**
+ * For a given object instance-number, replaces a Calendar entity of the
+ * entities list.
+ *
+ * @param  object_instance - object-instance number of the object
+ * @param  index - index of entity
+ * @param  value - Calendar entity, which may be the entity returned by
+ *  Calendar_Date_List_Get()
+ *
+ * @return  true if the entity is replaced successfully.
+ */
+bool Calendar_Date_List_Set(
+    uint32_t object_instance, uint8_t index, BACNET_CALENDAR_ENTRY *value)
+{
+    BACNET_CALENDAR_ENTRY *entry;
+    struct object_data *pObject;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !value) {
+        return false;
+    }
+    entry = Keylist_Data_Index(pObject->Date_List, index);
+    if (!entry) {
+        return false;
+    }
+    if (entry != value) {
+        *entry = *value;
+    }
+    Calendar_Date_List_Changed(pObject, object_instance);
+
+    return true;
 }
 
 /**
@@ -285,6 +357,7 @@ bool Calendar_Date_List_Delete_All(uint32_t object_instance)
     }
 
     Calendar_Date_List_Clean(pObject->Date_List);
+    Calendar_Date_List_Changed(pObject, object_instance);
 
     return true;
 }
@@ -320,13 +393,18 @@ int Calendar_Date_List_Encode(
     uint32_t object_instance, uint8_t *apdu, int max_apdu)
 {
     BACNET_CALENDAR_ENTRY *entry = NULL;
+    struct object_data *pObject;
     int apdu_len = 0;
     unsigned index = 0;
     unsigned size = 0;
 
-    size = Calendar_Date_List_Count(object_instance);
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        return 0;
+    }
+    size = Keylist_Count(pObject->Date_List);
     for (index = 0; index < size; index++) {
-        entry = Calendar_Date_List_Get(object_instance, index);
+        entry = Keylist_Data_Index(pObject->Date_List, index);
         apdu_len += bacnet_calendar_entry_encode(NULL, entry);
     }
     if (apdu_len > max_apdu) {
@@ -334,13 +412,97 @@ int Calendar_Date_List_Encode(
     }
     apdu_len = 0;
     for (index = 0; index < size; index++) {
-        entry = Calendar_Date_List_Get(object_instance, index);
+        entry = Keylist_Data_Index(pObject->Date_List, index);
         apdu_len += bacnet_calendar_entry_encode(&apdu[apdu_len], entry);
     }
 
     return apdu_len;
 }
 
+/**
+ * @brief Determine if a date is included by any entry of a Date_List
+ * @param list - Date_List of BACnetCalendarEntry
+ * @param date - date to find
+ * @return true if an entry of the Date_List includes the date
+ */
+static bool Calendar_Date_List_Match(OS_Keylist list, BACNET_DATE *date)
+{
+    BACNET_CALENDAR_ENTRY *entry = NULL;
+    int count;
+    int index;
+
+    count = Keylist_Count(list);
+    for (index = 0; index < count; index++) {
+        entry = Keylist_Data_Index(list, index);
+        if (bacapp_date_in_calendar_entry(date, entry)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Compile the Date_List into a bitmap of the days of a year,
+ *  so that a date lookup is a single bit test.
+ * @param pObject - object data
+ * @param year - year of the bitmap
+ */
+static void Calendar_Day_Bitmap_Build(
+    struct object_data *pObject, uint16_t year)
+{
+    BACNET_DATE date;
+    uint32_t days;
+    uint32_t day;
+
+    memset(pObject->Day_Bitmap, 0, sizeof(pObject->Day_Bitmap));
+    if (Keylist_Count(pObject->Date_List) > 0) {
+        days = days_per_year(year);
+        for (day = 1; day <= days; day++) {
+            datetime_day_of_year_into_date(day, year, &date);
+            if (Calendar_Date_List_Match(pObject->Date_List, &date)) {
+                pObject->Day_Bitmap[(day - 1) / 8] |=
+                    (uint8_t)(1 << ((day - 1) % 8));
+            }
+        }
+    }
+    pObject->Day_Bitmap_Year = year;
+    pObject->Day_Bitmap_Valid = true;
+}
+
+/**
+ * For a given object instance-number, determines if a date is in
+ * the Date_List
+ *
+ * @param  object_instance - object-instance number of the object
+ * @param  date - date to find
+ *
+ * @return  true if an entry of the Date_List includes the date
+ */
+bool Calendar_Date_Active(uint32_t object_instance, BACNET_DATE *date)
+{
+    struct object_data *pObject;
+    uint32_t day;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !date) {
+        return false;
+    }
+    if (pObject->Date_List_Shared || datetime_wildcard_year(date) ||
+        !datetime_ymd_is_valid(date->year, date->month, date->day)) {
+        /* not a single day of a year, or entries that may have
+           changed since the bitmap was built */
+        return Calendar_Date_List_Match(pObject->Date_List, date);
+    }
+    if (!pObject->Day_Bitmap_Valid ||
+        (pObject->Day_Bitmap_Year != date->year)) {
+        Calendar_Day_Bitmap_Build(pObject, date->year);
+    }
+    day = datetime_day_of_year(date) - 1;
+
+    return (pObject->Day_Bitmap[day / 8] & (1 << (day % 8))) != 0;
+}
+
 /**
  * For a given object instance-number, determines the present-value
  *
@@ -352,21 +514,113 @@ bool Calendar_Present_Value(uint32_t object_instance)
 {
     BACNET_DATE date;
     BACNET_TIME time;
-    BACNET_CALENDAR_ENTRY *entry = NULL;
-    unsigned size = 0;
-    int index;
 
     datetime_local(&date, &time, NULL, NULL);
 
-    size = Calendar_Date_List_Count(object_instance);
-    for (index = 0; index < size; index++) {
-        entry = Calendar_Date_List_Get(object_instance, index);
-        if (bacapp_date_in_calendar_entry(&date, entry)) {
-            return true;
+    return Calendar_Date_Active(object_instance, &date);
+}
+
+/**
+ * @brief For a given object instance-number, determines if the
+ *  present-value changed at a day boundary in Calendar_Task()
+ * @param  object_instance - object-instance number of the object
+ * @return true if the present-value changed since the last clear
+ */
+bool Calendar_Change_Of_Value(uint32_t object_instance)
+{
+    bool changed = false;
+    struct object_data *pObject;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (pObject) {
+        changed = pObject->Changed;
+    }
+
+    return changed;
+}
+
+/**
+ * @brief For a given object instance-number, clears the COV flag
+ * @param  object_instance - object-instance number of the object
+ */
+void Calendar_Change_Of_Value_Clear(uint32_t object_instance)
+{
+    struct object_data *pObject;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (pObject) {
+        pObject->Changed = false;
+    }
+}
+
+/**
+ * @brief For a given object instance-number, loads the value_list with
+ *  the COV data
+ * @param  object_instance - object-instance number of the object
+ * @param  value_list - list of COV data
+ * @return  true if the value list is encoded
+ */
+bool Calendar_Encode_Value_List(
+    uint32_t object_instance, BACNET_PROPERTY_VALUE *value_list)
+{
+    struct object_data *pObject;
+
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject || !value_list) {
+        return false;
+    }
+    /* the Calendar has no Status_Flags */
+    value_list->propertyIdentifier = PROP_PRESENT_VALUE;
+    value_list->propertyArrayIndex = BACNET_ARRAY_ALL;
+    value_list->value.context_specific = false;
+    value_list->value.tag = BACNET_APPLICATION_TAG_BOOLEAN;
+    value_list->value.type.Boolean = pObject->Present_Value;
+    value_list->value.next = NULL;
+    value_list->priority = BACNET_NO_PRIORITY;
+    value_list->next = NULL;
+
+    return true;
+}
+
+/**
+ * @brief Evaluate every Calendar when the date changes, and flag the
+ *  objects whose present-value changed at the day boundary.
+ * @param bdatetime - current local date and time
+ * @return milliseconds until the next day boundary
+ */
+uint32_t Calendar_Task(BACNET_DATE_TIME *bdatetime)
+{
+    struct object_data *pObject;
+    uint32_t seconds;
+    int count;
+    int index;
+    KEY key;
+    bool value;
+
+    if (!bdatetime) {
+        return 0;
+    }
+    if (datetime_compare_date(&Calendar_Task_Date, &bdatetime->date) != 0) {
+        datetime_copy_date(&Calendar_Task_Date, &bdatetime->date);
+        count = Keylist_Count(Object_List);
+        for (index = 0; index < count; index++) {
+            pObject = Keylist_Data_Index(Object_List, index);
+            if (!pObject || !Keylist_Index_Key(Object_List, index, &key)) {
+                continue;
+            }
+            value = Calendar_Date_Active(key, &bdatetime->date);
+            if (value != pObject->Present_Value) {
+                pObject->Present_Value = value;
+                pObject->Changed = true;
+            }
         }
     }
+    seconds = datetime_seconds_since_midnight(&bdatetime->time);
+    if (seconds >= CALENDAR_SECONDS_PER_DAY) {
+        seconds = CALENDAR_SECONDS_PER_DAY - 1;
+    }
 
-    return false;
+    return (CALENDAR_SECONDS_PER_DAY - seconds) * 1000UL;
 }
 
 /**
@@ -609,10 +863,10 @@ bool Calendar_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
                 &wp_data->error_class, &wp_data->error_code);
             break;
         default:
-            if (property_lists_member(
-                    Calendar_Properties_Required, Calendar_Properties_Optional,
-                    Calendar_Properties_Proprietary,
-                    wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Calendar_Properties_Required,
+                    Calendar_Properties_Optional,
+                    Calendar_Properties_Proprietary, wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -635,6 +889,17 @@ void Calendar_Write_Present_Value_Callback_Set(
     Calendar_Write_Present_Value_Callback = cb;
 }
 
+/**
+ * @brief Sets a callback used when the Date_List changes, such as to
+ *  compile the schedules that reference the Calendar again
+ * @param cb - callback used to provide indications
+ */
+void Calendar_Date_List_Changed_Callback_Set(
+    calendar_date_list_changed_callback cb)
+{
+    Calendar_Date_List_Changed_Callback = cb;
+}
+
 /**
  * @brief Determines a object write-enabled flag state
  * @param object_instance - object-instance number of the object
@@ -711,6 +976,8 @@ uint32_t Calendar_Create(uint32_t object_instance)
         pObject->Description = NULL;
         pObject->Present_Value = false;
         pObject->Date_List = Keylist_Create();
+        pObject->Day_Bitmap_Valid = false;
+        pObject->Date_List_Shared = false;
         pObject->Changed = false;
         pObject->Write_Enabled = false;
         /* add to list */
@@ -774,4 +1041,5 @@ void Calendar_Init(void)
     if (!Object_List) {
         Object_List = Keylist_Create();
     }
+    memset(&Calendar_Task_Date, 0, sizeof(Calendar_Task_Date));
 }
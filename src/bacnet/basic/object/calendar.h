@@ -16,6 +16,8 @@
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
 #include "bacnet/calendar_entry.h"
+#include "bacnet/cov.h"
+#include "bacnet/datetime.h"
 #include "bacnet/bacerror.h"
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
@@ -29,6 +31,12 @@
 typedef void (*calendar_write_present_value_callback)(
     uint32_t object_instance, bool old_value, bool value);
 
+/**
+ * @brief Callback for a change of the Date_List
+ * @param  object_instance - object-instance number of the object
+ */
+typedef void (*calendar_date_list_changed_callback)(uint32_t object_instance);
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -60,8 +68,22 @@ bool Calendar_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data);
 BACNET_STACK_EXPORT
 bool Calendar_Present_Value(uint32_t object_instance);
 BACNET_STACK_EXPORT
+bool Calendar_Date_Active(uint32_t object_instance, BACNET_DATE *date);
+BACNET_STACK_EXPORT
+bool Calendar_Change_Of_Value(uint32_t object_instance);
+BACNET_STACK_EXPORT
+void Calendar_Change_Of_Value_Clear(uint32_t object_instance);
+BACNET_STACK_EXPORT
+bool Calendar_Encode_Value_List(
+    uint32_t object_instance, BACNET_PROPERTY_VALUE *value_list);
+BACNET_STACK_EXPORT
+uint32_t Calendar_Task(BACNET_DATE_TIME *bdatetime);
+BACNET_STACK_EXPORT
 void Calendar_Write_Present_Value_Callback_Set(
     calendar_write_present_value_callback cb);
+BACNET_STACK_EXPORT
+void Calendar_Date_List_Changed_Callback_Set(
+    calendar_date_list_changed_callback cb);
 
 BACNET_STACK_EXPORT
 BACNET_CALENDAR_ENTRY *Calendar_Date_List_Get(
@@ -70,6 +92,9 @@ BACNET_STACK_EXPORT
 bool Calendar_Date_List_Add(
     uint32_t object_instance, BACNET_CALENDAR_ENTRY *value);
 BACNET_STACK_EXPORT
+bool Calendar_Date_List_Set(
+    uint32_t object_instance, uint8_t index, BACNET_CALENDAR_ENTRY *value);
+BACNET_STACK_EXPORT
 bool Calendar_Date_List_Delete_All(uint32_t object_instance);
 BACNET_STACK_EXPORT
 int Calendar_Date_List_Count(uint32_t object_instance);
@@ -42,7 +42,11 @@
 #include "bacnet/bacdcode.h"
 #include "bacnet/bacapp.h"
 #include "bacnet/wp.h"
+#include "bacnet/wpm.h"
+#include "bacnet/basic/binding/address.h"
+#include "bacnet/basic/object/device.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/proplist.h"
 #include "bacnet/basic/sys/keylist.h"
 #if defined(CHANNEL_LIGHTING_COMMAND) || defined(CHANNEL_COLOR_COMMAND)
@@ -69,12 +73,26 @@ struct object_data {
     uint32_t Control_Groups[CONTROL_GROUPS_MAX];
     const char *Object_Name;
     const char *Description;
+    /* WritePropertyMultiple requests to remote member devices */
+    uint8_t Remote_Invoke_ID[CHANNEL_MEMBERS_MAX];
+    BACNET_ADDRESS Remote_Dest[CHANNEL_MEMBERS_MAX];
+    bool Remote_Failed;
 };
 
 /* Key List for storing the object data sorted by instance number  */
 static OS_Keylist Object_List;
 
+/* space for building a WritePropertyMultiple to one device,
+   allocated only while the members of a remote device are written */
+struct remote_request {
+    BACNET_WRITE_ACCESS_DATA Write_Access[CHANNEL_MEMBERS_MAX];
+    BACNET_PROPERTY_VALUE Property_Value[CHANNEL_MEMBERS_MAX];
+    uint8_t PDU[MAX_PDU];
+};
+
 static write_property_function Write_Property_Internal_Callback;
+/* told by the TSM when a request to a remote member device ends */
+static BACNET_TSM_COMPLETE_NOTIFICATION Channel_TSM_Complete;
 
 /* These arrays are used by the ReadPropertyMultiple handler
    property-list property (as of protocol-revision 14) */
@@ -1205,10 +1223,207 @@ bool Channel_Write_Member_Value(
     return status;
 }
 
+/**
+ * @brief Send one WritePropertyMultiple for the members in the request
+ *  space, and track its invoke-id for the Write_Status
+ * @param pObject - object instance data
+ * @param request - request space holding the members
+ * @param device_id - member device instance
+ * @param dest - address of the member device
+ * @param count - number of members in the request space
+ */
+static void Channel_Write_Remote_Send(struct object_data *pObject,
+    struct remote_request *request,
+    uint32_t device_id,
+    BACNET_ADDRESS *dest,
+    unsigned count)
+{
+    uint8_t invoke_id = 0;
+    unsigned r;
+
+    if (count == 0) {
+        return;
+    }
+    invoke_id = Send_Write_Property_Multiple_Request(
+        request->PDU, sizeof(request->PDU), device_id,
+        &request->Write_Access[0]);
+    for (r = 0; r < CHANNEL_MEMBERS_MAX; r++) {
+        if (invoke_id && (pObject->Remote_Invoke_ID[r] == 0)) {
+            pObject->Remote_Invoke_ID[r] = invoke_id;
+            bacnet_address_copy(&pObject->Remote_Dest[r], dest);
+            return;
+        }
+    }
+    pObject->Remote_Failed = true;
+}
+
+/**
+ * @brief Write the members of one remote device with as few
+ *  WritePropertyMultiple requests as fit the device max-APDU
+ * @param pObject - object instance data
+ * @param first - index of the first member of the device
+ * @param value - application value
+ * @param priority - BACnet priority 0=none,1..16
+ * @param member_done - members handled so far, updated
+ */
+static void Channel_Write_Remote_Members(struct object_data *pObject,
+    unsigned first,
+    BACNET_APPLICATION_DATA_VALUE *value,
+    uint8_t priority,
+    bool *member_done)
+{
+    BACNET_WRITE_PROPERTY_DATA wp_data = { 0 };
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE *pMember = NULL;
+    struct remote_request *request = NULL;
+    BACNET_ADDRESS dest = { 0 };
+    unsigned max_apdu = 0;
+    uint32_t device_id;
+    unsigned m, count = 0;
+    int apdu_size, apdu_len = 0, len;
+
+    device_id = pObject->Members[first].deviceIdentifier.instance;
+    if (!address_get_by_device(device_id, &max_apdu, &dest)) {
+        /* bind for the next write */
+        Send_WhoIs(device_id, device_id);
+        for (m = first; m < CHANNEL_MEMBERS_MAX; m++) {
+            if (pObject->Members[m].deviceIdentifier.instance == device_id) {
+                member_done[m] = true;
+            }
+        }
+        pObject->Remote_Failed = true;
+        return;
+    }
+    request = calloc(1, sizeof(struct remote_request));
+    if (!request) {
+        for (m = first; m < CHANNEL_MEMBERS_MAX; m++) {
+            if (pObject->Members[m].deviceIdentifier.instance == device_id) {
+                member_done[m] = true;
+            }
+        }
+        pObject->Remote_Failed = true;
+        return;
+    }
+    if (max_apdu > MAX_APDU) {
+        max_apdu = MAX_APDU;
+    }
+    /* the sender counts the NPDU and the request header against
+       the max-APDU of the device */
+    apdu_size = (int)max_apdu - MAX_NPDU - wpm_encode_apdu_init(NULL, 0);
+    for (m = first; m < CHANNEL_MEMBERS_MAX; m++) {
+        pMember = &pObject->Members[m];
+        if (member_done[m] || !Channel_Reference_List_Member_Valid(pMember) ||
+            (pMember->deviceIdentifier.instance != device_id)) {
+            continue;
+        }
+        member_done[m] = true;
+        wp_data.object_type = pMember->objectIdentifier.type;
+        wp_data.object_instance = pMember->objectIdentifier.instance;
+        wp_data.object_property = pMember->propertyIdentifier;
+        wp_data.array_index = pMember->arrayIndex;
+        wp_data.priority = priority;
+        wp_data.application_data_len = sizeof(wp_data.application_data);
+        if (!Channel_Write_Member_Value(&wp_data, value)) {
+            pObject->Remote_Failed = true;
+            continue;
+        }
+        len = wpm_encode_apdu_object_begin(
+            NULL, wp_data.object_type, wp_data.object_instance);
+        len += wpm_encode_apdu_object_property(NULL, &wp_data);
+        len += wpm_encode_apdu_object_end(NULL);
+        if ((count > 0) && ((apdu_len + len) > apdu_size)) {
+            Channel_Write_Remote_Send(
+                pObject, request, device_id, &dest, count);
+            count = 0;
+            apdu_len = 0;
+        }
+        if (bacapp_decode_known_property(wp_data.application_data,
+                wp_data.application_data_len,
+                &request->Property_Value[count].value, wp_data.object_type,
+                wp_data.object_property) <= 0) {
+            pObject->Remote_Failed = true;
+            continue;
+        }
+        request->Property_Value[count].value.next = NULL;
+        request->Property_Value[count].propertyIdentifier =
+            wp_data.object_property;
+        request->Property_Value[count].propertyArrayIndex =
+            wp_data.array_index;
+        request->Property_Value[count].priority = wp_data.priority;
+        request->Property_Value[count].next = NULL;
+        request->Write_Access[count].object_type = wp_data.object_type;
+        request->Write_Access[count].object_instance =
+            wp_data.object_instance;
+        request->Write_Access[count].listOfProperties =
+            &request->Property_Value[count];
+        request->Write_Access[count].next = NULL;
+        if (count > 0) {
+            request->Write_Access[count - 1].next =
+                &request->Write_Access[count];
+        }
+        count++;
+        apdu_len += len;
+    }
+    Channel_Write_Remote_Send(pObject, request, device_id, &dest, count);
+    free(request);
+}
+
+/**
+ * @brief Determine if a member device is this device, or one of the
+ *  devices routed by this stack that share its objects
+ * @param device_id - member device instance
+ * @return true if the member is written directly
+ */
+static bool Channel_Member_Device_Local(uint32_t device_id)
+{
+    bool status = false;
+#ifdef BAC_ROUTING
+    uint32_t current_id;
+#endif
+
+    if (device_id == Device_Object_Instance_Number()) {
+        status = true;
+    }
+#ifdef BAC_ROUTING
+    if (!status) {
+        /* the lookup selects the device it finds - select the
+           current device again */
+        current_id = Device_Object_Instance_Number();
+        status = Routed_Device_Valid_Object_Instance_Number(device_id);
+        (void)Routed_Device_Valid_Object_Instance_Number(current_id);
+    }
+#endif
+
+    return status;
+}
+
+/**
+ * @brief Determine if any WritePropertyMultiple to a remote member
+ *  device is still in progress
+ * @param pObject - object instance data
+ * @return true if a request is in progress
+ */
+static bool Channel_Write_Remote_Pending(struct object_data *pObject)
+{
+    unsigned r;
+
+    for (r = 0; r < CHANNEL_MEMBERS_MAX; r++) {
+        if (pObject->Remote_Invoke_ID[r] != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /**
  * For a given object instance-number, sets the present-value at a given
  * priority 1..16.
  *
+ * Members in this device, or in a device routed by this stack, are
+ * written directly. Members in other devices are grouped by device, and written with WritePropertyMultiple
+ * requests sent to every device at once. The Write_Status stays
+ * IN_PROGRESS until the TSM reports that all the requests ended.
+ *
  * @param pObject - object instance data
  * @param value - application value
  * @param priority - BACnet priority 0=none,1..16
@@ -1221,38 +1436,50 @@ static bool Channel_Write_Members(struct object_data *pObject,
 {
     BACNET_WRITE_PROPERTY_DATA wp_data = { 0 };
     bool status = false;
+    bool member_done[CHANNEL_MEMBERS_MAX] = { false };
     unsigned m = 0;
     BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE *pMember = NULL;
 
     if (pObject && value) {
         pObject->Write_Status = BACNET_WRITE_STATUS_IN_PROGRESS;
+        /* forget any requests from a previous write */
+        for (m = 0; m < CHANNEL_MEMBERS_MAX; m++) {
+            pObject->Remote_Invoke_ID[m] = 0;
+        }
+        pObject->Remote_Failed = false;
         for (m = 0; m < CHANNEL_MEMBERS_MAX; m++) {
             pMember = &pObject->Members[m];
-            /* NOTE: our implementation is for internal objects only */
-            /* NOTE: we could check to match our Device ID, but then
-               we would need to update all channels when our device ID
-               changed.  Instead, we'll just screen when members are
-               set. */
-            if ((pMember->deviceIdentifier.type == OBJECT_DEVICE) &&
-                (pMember->deviceIdentifier.instance != BACNET_MAX_INSTANCE) &&
-                (pMember->objectIdentifier.instance != BACNET_MAX_INSTANCE)) {
-                wp_data.object_type = pMember->objectIdentifier.type;
-                wp_data.object_instance = pMember->objectIdentifier.instance;
-                wp_data.object_property = pMember->propertyIdentifier;
-                wp_data.array_index = pMember->arrayIndex;
-                wp_data.priority = priority;
-                wp_data.application_data_len = sizeof(wp_data.application_data);
-                status = Channel_Write_Member_Value(&wp_data, value);
-                if (status) {
-                    if (Write_Property_Internal_Callback) {
-                        status = Write_Property_Internal_Callback(&wp_data);
-                    }
-                } else {
-                    pObject->Write_Status = BACNET_WRITE_STATUS_FAILED;
+            if (!Channel_Reference_List_Member_Valid(pMember) ||
+                (pMember->deviceIdentifier.type != OBJECT_DEVICE) ||
+                member_done[m]) {
+                continue;
+            }
+            if (!Channel_Member_Device_Local(
+                    pMember->deviceIdentifier.instance)) {
+                Channel_Write_Remote_Members(
+                    pObject, m, value, priority, member_done);
+                continue;
+            }
+            wp_data.object_type = pMember->objectIdentifier.type;
+            wp_data.object_instance = pMember->objectIdentifier.instance;
+            wp_data.object_property = pMember->propertyIdentifier;
+            wp_data.array_index = pMember->arrayIndex;
+            wp_data.priority = priority;
+            wp_data.application_data_len = sizeof(wp_data.application_data);
+            status = Channel_Write_Member_Value(&wp_data, value);
+            if (status) {
+                if (Write_Property_Internal_Callback) {
+                    status = Write_Property_Internal_Callback(&wp_data);
                 }
+            } else {
+                pObject->Write_Status = BACNET_WRITE_STATUS_FAILED;
             }
         }
-        if (pObject->Write_Status == BACNET_WRITE_STATUS_IN_PROGRESS) {
+        if (pObject->Remote_Failed) {
+            pObject->Write_Status = BACNET_WRITE_STATUS_FAILED;
+        }
+        if ((pObject->Write_Status == BACNET_WRITE_STATUS_IN_PROGRESS) &&
+            !Channel_Write_Remote_Pending(pObject)) {
             pObject->Write_Status = BACNET_WRITE_STATUS_SUCCESSFUL;
         }
     }
@@ -1663,6 +1890,55 @@ void Channel_Write_Property_Internal_Callback_Set(write_property_function cb)
     Write_Property_Internal_Callback = cb;
 }
 
+/**
+ * @brief Handle the end of a WritePropertyMultiple that was sent to a
+ *  remote member device, and update the Write_Status when all of them
+ *  ended.  The request is found by both the invoke ID and the address
+ *  of the device, before the TSM frees the invoke ID.
+ * @param dest - address the request was sent to
+ * @param invoke_id - invoke ID of the request
+ * @param status - SimpleACK, Error, Reject, Abort, or timeout
+ */
+static void Channel_Write_Remote_Complete(BACNET_ADDRESS *dest,
+    uint8_t invoke_id,
+    BACNET_TSM_TRANSACTION_STATUS status)
+{
+    struct object_data *pObject;
+    int count, index;
+    unsigned r;
+
+    count = Keylist_Count(Object_List);
+    for (index = 0; index < count; index++) {
+        pObject = Keylist_Data_Index(Object_List, index);
+        if (!pObject) {
+            continue;
+        }
+        for (r = 0; r < CHANNEL_MEMBERS_MAX; r++) {
+            if ((pObject->Remote_Invoke_ID[r] != invoke_id) ||
+                !bacnet_address_same(&pObject->Remote_Dest[r], dest)) {
+                continue;
+            }
+            pObject->Remote_Invoke_ID[r] = 0;
+            if (status == TSM_TRANSACTION_TIMEOUT) {
+                /* a failed request keeps its invoke ID until freed */
+                tsm_free_invoke_id(invoke_id);
+            }
+            if (status != TSM_TRANSACTION_ACK) {
+                pObject->Remote_Failed = true;
+            }
+            if (!Channel_Write_Remote_Pending(pObject) &&
+                (pObject->Write_Status == BACNET_WRITE_STATUS_IN_PROGRESS)) {
+                if (pObject->Remote_Failed) {
+                    pObject->Write_Status = BACNET_WRITE_STATUS_FAILED;
+                } else {
+                    pObject->Write_Status = BACNET_WRITE_STATUS_SUCCESSFUL;
+                }
+            }
+            return;
+        }
+    }
+}
+
 /**
  * @brief Creates a new object
  * @param object_instance - object-instance number of the object
@@ -1769,4 +2045,6 @@ void Channel_Init(void)
     if (!Object_List) {
         Object_List = Keylist_Create();
     }
+    Channel_TSM_Complete.callback = Channel_Write_Remote_Complete;
+    tsm_complete_notification_add(&Channel_TSM_Complete);
 }
@@ -40,6 +40,7 @@
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/keylist.h"
 #include "bacnet/basic/sys/linear.h"
+#include "bacnet/basic/sys/tmwheel.h"
 /* me! */
 #include "bacnet/basic/object/color_object.h"
 
@@ -70,6 +71,11 @@ struct object_data {
 static OS_Keylist Object_List;
 /* callback for present value writes */
 static color_write_present_value_callback Color_Write_Present_Value_Callback;
+/* advances the color fades while there are any */
+static struct tmwheel_timer Transition_Timer;
+#ifndef COLOR_TRANSITION_MILLISECONDS
+#define COLOR_TRANSITION_MILLISECONDS 100
+#endif
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Color_Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -82,6 +88,17 @@ static const int Color_Properties_Optional[] = { PROP_DESCRIPTION,
 
 static const int Color_Properties_Proprietary[] = { -1 };
 
+/**
+ * @brief Arm the transition timer for a new color command,
+ *  unless it is already armed
+ */
+static void Color_Transition_Start(void)
+{
+    if (!tmwheel_timer_pending(&Transition_Timer)) {
+        tmwheel_timer_set(&Transition_Timer, COLOR_TRANSITION_MILLISECONDS);
+    }
+}
+
 /**
  * Returns the list of required, optional, and proprietary properties.
  * Used by ReadPropertyMultiple service.
@@ -245,6 +262,7 @@ static bool Color_Present_Value_Write(uint32_t object_instance,
         }
         pObject->Color_Command.operation = BACNET_COLOR_OPERATION_FADE_TO_COLOR;
         xy_color_copy(&pObject->Color_Command.target.color, value);
+        Color_Transition_Start();
         status = true;
     } else {
         *error_class = ERROR_CLASS_OBJECT;
@@ -333,6 +351,7 @@ bool Color_Command_Set(uint32_t object_instance, BACNET_COLOR_COMMAND *value)
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject && value) {
         color_command_copy(&pObject->Color_Command, value);
+        Color_Transition_Start();
         status = true;
     }
 
@@ -364,6 +383,7 @@ static bool Color_Command_Write(uint32_t object_instance,
         (void)priority;
         if (pObject->Write_Enabled) {
             color_command_copy(&pObject->Color_Command, value);
+            Color_Transition_Start();
             status = true;
         } else {
             *error_class = ERROR_CLASS_PROPERTY;
@@ -871,6 +891,39 @@ void Color_Timer(uint32_t object_instance, uint16_t milliseconds)
     }
 }
 
+/**
+ * @brief Transition timer callback - updates every color object,
+ *  and stays armed while any fade is in progress
+ * @param timer - the transition timer
+ * @param context - not used
+ */
+static void Color_Transition_Timer_Handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    struct object_data *pObject;
+    KEY key = 0;
+    int count, index;
+    bool active = false;
+
+    (void)context;
+    count = Keylist_Count(Object_List);
+    for (index = 0; index < count; index++) {
+        if (!Keylist_Index_Key(Object_List, index, &key)) {
+            continue;
+        }
+        Color_Timer(key, (uint16_t)tmwheel_timer_interval(timer));
+        pObject = Keylist_Data(Object_List, key);
+        if (pObject &&
+            (pObject->Color_Command.operation ==
+                BACNET_COLOR_OPERATION_FADE_TO_COLOR)) {
+            active = true;
+        }
+    }
+    if (active && !tmwheel_timer_pending(timer)) {
+        tmwheel_timer_reset(timer);
+    }
+}
+
 /**
  * ReadProperty handler for this object.  For the given ReadProperty
  * data, the application_data is loaded or the error flags are set.
@@ -1158,6 +1211,7 @@ uint32_t Color_Create(uint32_t object_instance)
                 BACNET_COLOR_OPERATION_FADE_TO_COLOR;
             pObject->Color_Command.transit.fade_time =
                 pObject->Default_Fade_Time;
+            Color_Transition_Start();
             /* initialize all the status */
             pObject->In_Progress = BACNET_COLOR_OPERATION_IN_PROGRESS_IDLE;
             pObject->Transition = BACNET_COLOR_TRANSITION_FADE;
@@ -1213,6 +1267,7 @@ void Color_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    tmwheel_timer_cancel(&Transition_Timer);
 }
 
 /**
@@ -1222,5 +1277,7 @@ void Color_Init(void)
 {
     if (!Object_List) {
         Object_List = Keylist_Create();
+        tmwheel_timer_init(
+            &Transition_Timer, Color_Transition_Timer_Handler, NULL);
     }
 }
@@ -39,6 +39,7 @@
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/keylist.h"
 #include "bacnet/basic/sys/linear.h"
+#include "bacnet/basic/sys/tmwheel.h"
 /* me! */
 #include "color_temperature.h"
 
@@ -64,6 +65,11 @@ static OS_Keylist Object_List;
 /* callback for present value writes */
 static color_temperature_write_present_value_callback
     Color_Temperature_Write_Present_Value_Callback;
+/* advances the fades, ramps, and steps while there are any */
+static struct tmwheel_timer Transition_Timer;
+#ifndef COLOR_TEMPERATURE_TRANSITION_MILLISECONDS
+#define COLOR_TEMPERATURE_TRANSITION_MILLISECONDS 100
+#endif
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Color_Temperature_Properties_Required[] = {
@@ -78,6 +84,18 @@ static const int Color_Temperature_Properties_Optional[] = { PROP_DESCRIPTION,
 
 static const int Color_Temperature_Properties_Proprietary[] = { -1 };
 
+/**
+ * @brief Arm the transition timer for a new color command,
+ *  unless it is already armed
+ */
+static void Color_Temperature_Transition_Start(void)
+{
+    if (!tmwheel_timer_pending(&Transition_Timer)) {
+        tmwheel_timer_set(
+            &Transition_Timer, COLOR_TEMPERATURE_TRANSITION_MILLISECONDS);
+    }
+}
+
 /**
  * Returns the list of required, optional, and proprietary properties.
  * Used by ReadPropertyMultiple service.
@@ -250,6 +268,7 @@ static bool Color_Temperature_Present_Value_Write(uint32_t object_instance,
                     BACNET_COLOR_OPERATION_FADE_TO_CCT;
             }
             pObject->Color_Command.target.color_temperature = value;
+            Color_Temperature_Transition_Start();
             status = true;
         } else {
             *error_class = ERROR_CLASS_PROPERTY;
@@ -428,6 +447,7 @@ bool Color_Temperature_Command_Set(
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject && value) {
         color_command_copy(&pObject->Color_Command, value);
+        Color_Temperature_Transition_Start();
         status = true;
     }
 
@@ -1189,6 +1209,7 @@ static void Color_Temperature_Step_Up_CCT_Handler(uint32_t object_instance)
     pObject->Present_Value = target_value;
     pObject->Tracking_Value = target_value;
     pObject->In_Progress = BACNET_COLOR_OPERATION_IN_PROGRESS_IDLE;
+    pObject->Color_Command.operation = BACNET_COLOR_OPERATION_STOP;
     if (Color_Temperature_Write_Present_Value_Callback) {
         Color_Temperature_Write_Present_Value_Callback(
             object_instance, old_value, pObject->Tracking_Value);
@@ -1232,6 +1253,7 @@ static void Color_Temperature_Step_Down_CCT_Handler(uint32_t object_instance)
     pObject->Present_Value = target_value;
     pObject->Tracking_Value = target_value;
     pObject->In_Progress = BACNET_COLOR_OPERATION_IN_PROGRESS_IDLE;
+    pObject->Color_Command.operation = BACNET_COLOR_OPERATION_STOP;
     if (Color_Temperature_Write_Present_Value_Callback) {
         Color_Temperature_Write_Present_Value_Callback(
             object_instance, old_value, pObject->Tracking_Value);
@@ -1274,6 +1296,41 @@ void Color_Temperature_Timer(uint32_t object_instance, uint16_t milliseconds)
     }
 }
 
+/**
+ * @brief Transition timer callback - updates every color temperature
+ *  object, and stays armed while any fade or ramp is in progress
+ * @param timer - the transition timer
+ * @param context - not used
+ */
+static void Color_Temperature_Transition_Timer_Handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    struct object_data *pObject;
+    KEY key = 0;
+    int count, index;
+    bool active = false;
+
+    (void)context;
+    count = Keylist_Count(Object_List);
+    for (index = 0; index < count; index++) {
+        if (!Keylist_Index_Key(Object_List, index, &key)) {
+            continue;
+        }
+        Color_Temperature_Timer(key, (uint16_t)tmwheel_timer_interval(timer));
+        pObject = Keylist_Data(Object_List, key);
+        if (pObject &&
+            ((pObject->Color_Command.operation ==
+                 BACNET_COLOR_OPERATION_FADE_TO_CCT) ||
+                (pObject->Color_Command.operation ==
+                    BACNET_COLOR_OPERATION_RAMP_TO_CCT))) {
+            active = true;
+        }
+    }
+    if (active && !tmwheel_timer_pending(timer)) {
+        tmwheel_timer_reset(timer);
+    }
+}
+
 /**
  * ReadProperty handler for this object.  For the given ReadProperty
  * data, the application_data is loaded or the error flags are set.
@@ -1598,6 +1655,7 @@ uint32_t Color_Temperature_Create(uint32_t object_instance)
                 pObject->Default_Fade_Time;
             pObject->Color_Command.target.color_temperature =
                 pObject->Default_Color_Temperature;
+            Color_Temperature_Transition_Start();
             pObject->Changed = false;
             pObject->Write_Enabled = false;
             /* add to list */
@@ -1650,6 +1708,7 @@ void Color_Temperature_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    tmwheel_timer_cancel(&Transition_Timer);
 }
 
 /**
@@ -1659,5 +1718,7 @@ void Color_Temperature_Init(void)
 {
     if (!Object_List) {
         Object_List = Keylist_Create();
+        tmwheel_timer_init(&Transition_Timer,
+            Color_Temperature_Transition_Timer_Handler, NULL);
     }
 }
@@ -352,6 +352,7 @@ static const int Command_Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
 static const int Command_Properties_Optional[] = { PROP_DESCRIPTION, -1 };
 
 static const int Command_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Returns the list of required, optional, and proprietary properties.
@@ -801,9 +802,10 @@ bool Command_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                Command_Properties_Required, Command_Properties_Optional, 
-                Command_Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Command_Properties_Required,
+                    Command_Properties_Optional,
+                    Command_Properties_Proprietary, wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
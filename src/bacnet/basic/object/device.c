@@ -26,6 +26,7 @@
 #include "bacnet/basic/services.h"
 #include "bacnet/datalink/datalink.h"
 #include "bacnet/basic/binding/address.h"
+#include "bacnet/basic/sys/propcache.h"
 /* include the device object */
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/object/acc.h"
@@ -94,7 +95,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Intrinsic Reporting */, NULL /* Add_List_Element */,
         NULL /* Remove_List_Element */, NULL /* Create */, NULL /* Delete */,
         NULL /* Timer */ },
-#if (BACNET_PROTOCOL_REVISION >= 17)
+#if (BACNET_PROTOCOL_REVISION >= 17) && \
+    defined(BACNET_BASIC_OBJECT_NETWORK_PORT)
     { OBJECT_NETWORK_PORT, Network_Port_Init, Network_Port_Count,
         Network_Port_Index_To_Instance, Network_Port_Valid_Instance,
         Network_Port_Object_Name, Network_Port_Read_Property,
@@ -104,6 +106,7 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
 #endif
+#if defined(BACNET_BASIC_OBJECT_ANALOG_INPUT)
     { OBJECT_ANALOG_INPUT, Analog_Input_Init, Analog_Input_Count,
         Analog_Input_Index_To_Instance, Analog_Input_Valid_Instance,
         Analog_Input_Object_Name, Analog_Input_Read_Property,
@@ -113,6 +116,8 @@ static object_functions_t My_Object_Table[] = {
         Analog_Input_Change_Of_Value_Clear, Analog_Input_Intrinsic_Reporting,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Analog_Input_Create, Analog_Input_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_ANALOG_OUTPUT)
     { OBJECT_ANALOG_OUTPUT, Analog_Output_Init, Analog_Output_Count,
         Analog_Output_Index_To_Instance, Analog_Output_Valid_Instance,
         Analog_Output_Object_Name, Analog_Output_Read_Property,
@@ -122,6 +127,8 @@ static object_functions_t My_Object_Table[] = {
         Analog_Output_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Analog_Output_Create, Analog_Output_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_ANALOG_VALUE)
     { OBJECT_ANALOG_VALUE, Analog_Value_Init, Analog_Value_Count,
         Analog_Value_Index_To_Instance, Analog_Value_Valid_Instance,
         Analog_Value_Object_Name, Analog_Value_Read_Property,
@@ -131,6 +138,8 @@ static object_functions_t My_Object_Table[] = {
         Analog_Value_Change_Of_Value_Clear, Analog_Value_Intrinsic_Reporting,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Analog_Value_Create, Analog_Value_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_BINARY_INPUT)
     { OBJECT_BINARY_INPUT, Binary_Input_Init, Binary_Input_Count,
         Binary_Input_Index_To_Instance, Binary_Input_Valid_Instance,
         Binary_Input_Object_Name, Binary_Input_Read_Property,
@@ -140,6 +149,8 @@ static object_functions_t My_Object_Table[] = {
         Binary_Input_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Binary_Input_Create, Binary_Input_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_BINARY_OUTPUT)
     { OBJECT_BINARY_OUTPUT, Binary_Output_Init, Binary_Output_Count,
         Binary_Output_Index_To_Instance, Binary_Output_Valid_Instance,
         Binary_Output_Object_Name, Binary_Output_Read_Property,
@@ -149,6 +160,8 @@ static object_functions_t My_Object_Table[] = {
         Binary_Output_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Binary_Output_Create, Binary_Output_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_BINARY_VALUE)
     { OBJECT_BINARY_VALUE, Binary_Value_Init, Binary_Value_Count,
         Binary_Value_Index_To_Instance, Binary_Value_Valid_Instance,
         Binary_Value_Object_Name, Binary_Value_Read_Property,
@@ -158,15 +171,20 @@ static object_functions_t My_Object_Table[] = {
         Binary_Value_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Binary_Value_Create, Binary_Value_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_CALENDAR)
     { OBJECT_CALENDAR, Calendar_Init, Calendar_Count,
         Calendar_Index_To_Instance, Calendar_Valid_Instance,
         Calendar_Object_Name, Calendar_Read_Property,
         Calendar_Write_Property, Calendar_Property_Lists,
-        NULL /* ReadRangeInfo */, NULL /* Iterator */, NULL /* Value_Lists */,
-        NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
+        NULL /* ReadRangeInfo */, NULL /* Iterator */,
+        Calendar_Encode_Value_List, Calendar_Change_Of_Value,
+        Calendar_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
 #if (BACNET_PROTOCOL_REVISION >= 10)
+#if defined(BACNET_BASIC_OBJECT_BITSTRING_VALUE)
     { OBJECT_BITSTRING_VALUE, BitString_Value_Init,
         BitString_Value_Count, BitString_Value_Index_To_Instance,
         BitString_Value_Valid_Instance, BitString_Value_Object_Name,
@@ -177,6 +195,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Intrinsic Reporting */,  NULL /* Add_List_Element */,
         NULL /* Remove_List_Element */, NULL /* Create */, NULL /* Delete */,
         NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_CHARACTERSTRING_VALUE)
     { OBJECT_CHARACTERSTRING_VALUE, CharacterString_Value_Init,
         CharacterString_Value_Count, CharacterString_Value_Index_To_Instance,
         CharacterString_Value_Valid_Instance, CharacterString_Value_Object_Name,
@@ -189,6 +209,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Intrinsic Reporting */, NULL /* Add_List_Element */,
         NULL /* Remove_List_Element */, NULL /* Create */, NULL /* Delete */,
         NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_OCTET_STRING_VALUE)
     { OBJECT_OCTETSTRING_VALUE, OctetString_Value_Init, OctetString_Value_Count,
         OctetString_Value_Index_To_Instance, OctetString_Value_Valid_Instance,
         OctetString_Value_Object_Name, OctetString_Value_Read_Property,
@@ -197,6 +219,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_POSITIVE_INTEGER_VALUE)
     { OBJECT_POSITIVE_INTEGER_VALUE, PositiveInteger_Value_Init,
         PositiveInteger_Value_Count, PositiveInteger_Value_Index_To_Instance,
         PositiveInteger_Value_Valid_Instance, PositiveInteger_Value_Object_Name,
@@ -207,6 +231,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_TIME_VALUE)
     { OBJECT_TIME_VALUE, Time_Value_Init, Time_Value_Count,
         Time_Value_Index_To_Instance, Time_Value_Valid_Instance,
         Time_Value_Object_Name, Time_Value_Read_Property,
@@ -216,6 +242,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
 #endif
+#endif
+#if defined(BACNET_BASIC_OBJECT_COMMAND)
     { OBJECT_COMMAND, Command_Init, Command_Count, Command_Index_To_Instance,
         Command_Valid_Instance, Command_Object_Name, Command_Read_Property,
         Command_Write_Property, Command_Property_Lists,
@@ -223,6 +251,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_INTEGER_VALUE)
     { OBJECT_INTEGER_VALUE, Integer_Value_Init, Integer_Value_Count,
         Integer_Value_Index_To_Instance, Integer_Value_Valid_Instance,
         Integer_Value_Object_Name, Integer_Value_Read_Property,
@@ -231,7 +261,9 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
-#if defined(INTRINSIC_REPORTING)
+#endif
+#if defined(INTRINSIC_REPORTING) && \
+    defined(BACNET_BASIC_OBJECT_NOTIFICATION_CLASS)
     { OBJECT_NOTIFICATION_CLASS, Notification_Class_Init,
         Notification_Class_Count, Notification_Class_Index_To_Instance,
         Notification_Class_Valid_Instance, Notification_Class_Object_Name,
@@ -243,6 +275,7 @@ static object_functions_t My_Object_Table[] = {
         Notification_Class_Remove_List_Element, NULL /* Create */,
         NULL /* Delete */, NULL /* Timer */ },
 #endif
+#if defined(BACNET_BASIC_OBJECT_LIFE_SAFETY_POINT)
     { OBJECT_LIFE_SAFETY_POINT, Life_Safety_Point_Init, Life_Safety_Point_Count,
         Life_Safety_Point_Index_To_Instance, Life_Safety_Point_Valid_Instance,
         Life_Safety_Point_Object_Name, Life_Safety_Point_Read_Property,
@@ -251,6 +284,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Life_Safety_Point_Create, Life_Safety_Point_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_LIFE_SAFETY_ZONE)
     { OBJECT_LIFE_SAFETY_ZONE, Life_Safety_Zone_Init, Life_Safety_Zone_Count,
         Life_Safety_Zone_Index_To_Instance, Life_Safety_Zone_Valid_Instance,
         Life_Safety_Zone_Object_Name, Life_Safety_Zone_Read_Property,
@@ -259,6 +294,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Life_Safety_Zone_Create, Life_Safety_Zone_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_LOAD_CONTROL)
     { OBJECT_LOAD_CONTROL, Load_Control_Init, Load_Control_Count,
         Load_Control_Index_To_Instance, Load_Control_Valid_Instance,
         Load_Control_Object_Name, Load_Control_Read_Property,
@@ -266,7 +303,9 @@ static object_functions_t My_Object_Table[] = {
         NULL /* ReadRangeInfo */, NULL /* Iterator */, NULL /* Value_Lists */,
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
-        NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+        Load_Control_Create, Load_Control_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_MULTISTATE_INPUT)
     { OBJECT_MULTI_STATE_INPUT, Multistate_Input_Init, Multistate_Input_Count,
         Multistate_Input_Index_To_Instance, Multistate_Input_Valid_Instance,
         Multistate_Input_Object_Name, Multistate_Input_Read_Property,
@@ -276,6 +315,8 @@ static object_functions_t My_Object_Table[] = {
         Multistate_Input_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Multistate_Input_Create, Multistate_Input_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT)
     { OBJECT_MULTI_STATE_OUTPUT, Multistate_Output_Init,
         Multistate_Output_Count, Multistate_Output_Index_To_Instance,
         Multistate_Output_Valid_Instance, Multistate_Output_Object_Name,
@@ -286,6 +327,8 @@ static object_functions_t My_Object_Table[] = {
         Multistate_Output_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Multistate_Output_Create, Multistate_Output_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_MULTISTATE_VALUE)
     { OBJECT_MULTI_STATE_VALUE, Multistate_Value_Init, Multistate_Value_Count,
         Multistate_Value_Index_To_Instance, Multistate_Value_Valid_Instance,
         Multistate_Value_Object_Name, Multistate_Value_Read_Property,
@@ -295,6 +338,8 @@ static object_functions_t My_Object_Table[] = {
         Multistate_Value_Change_Of_Value_Clear, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Multistate_Value_Create, Multistate_Value_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_TRENDLOG)
     { OBJECT_TRENDLOG, Trend_Log_Init, Trend_Log_Count,
         Trend_Log_Index_To_Instance, Trend_Log_Valid_Instance,
         Trend_Log_Object_Name, Trend_Log_Read_Property,
@@ -303,7 +348,9 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
 #if (BACNET_PROTOCOL_REVISION >= 14)
+#if defined(BACNET_BASIC_OBJECT_LIGHTING_OUTPUT)
     { OBJECT_LIGHTING_OUTPUT, Lighting_Output_Init, Lighting_Output_Count,
         Lighting_Output_Index_To_Instance, Lighting_Output_Valid_Instance,
         Lighting_Output_Object_Name, Lighting_Output_Read_Property,
@@ -311,7 +358,10 @@ static object_functions_t My_Object_Table[] = {
         NULL /* ReadRangeInfo */, NULL /* Iterator */, NULL /* Value_Lists */,
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
-        Lighting_Output_Create, Lighting_Output_Delete, Lighting_Output_Timer },
+        Lighting_Output_Create, Lighting_Output_Delete,
+        NULL /* Timer - uses the timer wheel */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_CHANNEL)
     { OBJECT_CHANNEL, Channel_Init, Channel_Count, Channel_Index_To_Instance,
         Channel_Valid_Instance, Channel_Object_Name, Channel_Read_Property,
         Channel_Write_Property, Channel_Property_Lists,
@@ -320,7 +370,9 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Channel_Create, Channel_Delete, NULL /* Timer */ },
 #endif
-#if (BACNET_PROTOCOL_REVISION >= 16)
+#endif
+#if (BACNET_PROTOCOL_REVISION >= 16) && \
+    defined(BACNET_BASIC_OBJECT_BINARY_LIGHTING_OUTPUT)
     { OBJECT_BINARY_LIGHTING_OUTPUT, Binary_Lighting_Output_Init,
         Binary_Lighting_Output_Count, Binary_Lighting_Output_Index_To_Instance,
         Binary_Lighting_Output_Valid_Instance,
@@ -332,16 +384,20 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Binary_Lighting_Output_Create, Binary_Lighting_Output_Delete,
-        Binary_Lighting_Output_Timer },
+        NULL /* Timer - uses the timer wheel */ },
 #endif
 #if (BACNET_PROTOCOL_REVISION >= 24)
+#if defined(BACNET_BASIC_OBJECT_COLOR)
     { OBJECT_COLOR, Color_Init, Color_Count, Color_Index_To_Instance,
         Color_Valid_Instance, Color_Object_Name, Color_Read_Property,
         Color_Write_Property, Color_Property_Lists, NULL /* ReadRangeInfo */,
         NULL /* Iterator */, NULL /* Value_Lists */, NULL /* COV */,
         NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
-        Color_Create, Color_Delete, Color_Timer },
+        Color_Create, Color_Delete,
+        NULL /* Timer - uses the timer wheel */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_COLOR_TEMPERATURE)
     { OBJECT_COLOR_TEMPERATURE, Color_Temperature_Init, Color_Temperature_Count,
         Color_Temperature_Index_To_Instance, Color_Temperature_Valid_Instance,
         Color_Temperature_Object_Name, Color_Temperature_Read_Property,
@@ -350,9 +406,10 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Color_Temperature_Create, Color_Temperature_Delete,
-        Color_Temperature_Timer },
+        NULL /* Timer - uses the timer wheel */ },
 #endif
-#if defined(BACFILE)
+#endif
+#if defined(BACFILE) && defined(BACNET_BASIC_OBJECT_FILE)
     { OBJECT_FILE, bacfile_init, bacfile_count, bacfile_index_to_instance,
         bacfile_valid_instance, bacfile_object_name, bacfile_read_property,
         bacfile_write_property, BACfile_Property_Lists,
@@ -361,6 +418,7 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         bacfile_create, bacfile_delete, NULL /* Timer */ },
 #endif
+#if defined(BACNET_BASIC_OBJECT_SCHEDULE)
     { OBJECT_SCHEDULE, Schedule_Init, Schedule_Count,
         Schedule_Index_To_Instance, Schedule_Valid_Instance,
         Schedule_Object_Name, Schedule_Read_Property, Schedule_Write_Property,
@@ -369,6 +427,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* Intrinsic Reporting */, NULL /* Add_List_Element */,
         NULL /* Remove_List_Element */, NULL /* Create */, NULL /* Delete */,
         NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_STRUCTURED_VIEW)
     { OBJECT_STRUCTURED_VIEW, Structured_View_Init, Structured_View_Count,
         Structured_View_Index_To_Instance, Structured_View_Valid_Instance,
         Structured_View_Object_Name, Structured_View_Read_Property,
@@ -377,6 +437,8 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */,  NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         Structured_View_Create, Structured_View_Delete, NULL /* Timer */ },
+#endif
+#if defined(BACNET_BASIC_OBJECT_ACCUMULATOR)
     { OBJECT_ACCUMULATOR, Accumulator_Init, Accumulator_Count,
         Accumulator_Index_To_Instance, Accumulator_Valid_Instance,
         Accumulator_Object_Name, Accumulator_Read_Property,
@@ -385,6 +447,7 @@ static object_functions_t My_Object_Table[] = {
         NULL /* COV */, NULL /* COV Clear */, NULL /* Intrinsic Reporting */,
         NULL /* Add_List_Element */, NULL /* Remove_List_Element */,
         NULL /* Create */, NULL /* Delete */, NULL /* Timer */ },
+#endif
     { MAX_BACNET_OBJECT_TYPE, NULL /* Init */, NULL /* Count */,
         NULL /* Index_To_Instance */, NULL /* Valid_Instance */,
         NULL /* Object_Name */, NULL /* Read_Property */,
@@ -396,6 +459,14 @@ static object_functions_t My_Object_Table[] = {
 };
 /* clang-format on */
 
+/* precomputed special property lists, one for each slot in Object_Table */
+#ifndef DEVICE_OBJECT_PROPERTY_LISTS_MAX
+#define DEVICE_OBJECT_PROPERTY_LISTS_MAX \
+    (sizeof(My_Object_Table) / sizeof(My_Object_Table[0]))
+#endif
+static struct special_property_list_bitmap_t
+    Object_Property_Lists[DEVICE_OBJECT_PROPERTY_LISTS_MAX];
+
 /** Glue function to let the Device object, when called by a handler,
  * lookup which Object type needs to be invoked.
  * @ingroup ObjHelpers
@@ -440,6 +511,38 @@ rr_info_function Device_Objects_RR_Info(BACNET_OBJECT_TYPE object_type)
     return (pObject != NULL ? pObject->Object_RR_Info : NULL);
 }
 
+/** For a given object, returns its precomputed special property lists.
+ * The lists are computed once per slot in the object table, and computed
+ * again only when the object returns different lists.
+ * @param pObject [in] The object functions for the object type
+ * @param pBitmap [in] Storage for the lists when the slot has no cache
+ * @return Pointer to the precomputed lists
+ */
+static const struct special_property_list_bitmap_t *
+Device_Objects_Property_List_Bitmap(struct object_functions *pObject,
+    struct special_property_list_bitmap_t *pBitmap)
+{
+    const int *pRequired = NULL;
+    const int *pOptional = NULL;
+    const int *pProprietary = NULL;
+    size_t slot = 0;
+
+    if (pObject->Object_RPM_List) {
+        pObject->Object_RPM_List(&pRequired, &pOptional, &pProprietary);
+    }
+    slot = (size_t)(pObject - Object_Table);
+    if (slot < DEVICE_OBJECT_PROPERTY_LISTS_MAX) {
+        pBitmap = &Object_Property_Lists[slot];
+        if (property_list_bitmap_same(
+                pBitmap, pRequired, pOptional, pProprietary)) {
+            return pBitmap;
+        }
+    }
+    property_list_bitmap_init(pBitmap, pRequired, pOptional, pProprietary);
+
+    return pBitmap;
+}
+
 /** For a given object type, returns the special property list.
  * This function is used for ReadPropertyMultiple calls which want
  * just Required, just Optional, or All properties.
@@ -456,36 +559,26 @@ void Device_Objects_Property_List(BACNET_OBJECT_TYPE object_type,
     struct special_property_list_t *pPropertyList)
 {
     struct object_functions *pObject = NULL;
+    struct special_property_list_bitmap_t bitmap;
+    const struct special_property_list_bitmap_t *pBitmap = NULL;
 
     (void)object_instance;
     pPropertyList->Required.pList = NULL;
+    pPropertyList->Required.count = 0;
     pPropertyList->Optional.pList = NULL;
+    pPropertyList->Optional.count = 0;
     pPropertyList->Proprietary.pList = NULL;
+    pPropertyList->Proprietary.count = 0;
 
     /* If we can find an entry for the required object type
-     * and there is an Object_List_RPM fn ptr then call it
-     * to populate the pointers to the individual list counters.
+     * then use its precomputed lists and counts.
      */
-
     pObject = Device_Objects_Find_Functions(object_type);
-    if ((pObject != NULL) && (pObject->Object_RPM_List != NULL)) {
-        pObject->Object_RPM_List(&pPropertyList->Required.pList,
-            &pPropertyList->Optional.pList, &pPropertyList->Proprietary.pList);
+    if (pObject != NULL) {
+        pBitmap = Device_Objects_Property_List_Bitmap(pObject, &bitmap);
+        *pPropertyList = pBitmap->List;
     }
 
-    /* Fetch the counts if available otherwise zero them */
-    pPropertyList->Required.count = pPropertyList->Required.pList == NULL
-        ? 0
-        : property_list_count(pPropertyList->Required.pList);
-
-    pPropertyList->Optional.count = pPropertyList->Optional.pList == NULL
-        ? 0
-        : property_list_count(pPropertyList->Optional.pList);
-
-    pPropertyList->Proprietary.count = pPropertyList->Proprietary.pList == NULL
-        ? 0
-        : property_list_count(pPropertyList->Proprietary.pList);
-
     return;
 }
 
@@ -580,6 +673,9 @@ static uint32_t Interval_Offset_Minutes;
 /* Max_Info_Frames - rely on MS/TP subsystem, if there is one */
 /* Device_Address_Binding - required, but relies on binding cache */
 static uint32_t Database_Revision = 0;
+/* nesting of write batches, during which side effects are held */
+static unsigned Write_Batch_Depth;
+static bool Database_Revision_Pending;
 /* Configuration_Files */
 /* Last_Restore_Time */
 /* Backup_Failure_Timeout */
@@ -964,11 +1060,16 @@ void Device_Set_Database_Revision(uint32_t revision)
 /*
  * Shortcut for incrementing database revision as this is potentially
  * the most common operation if changing object names and ids is
- * implemented.
+ * implemented.  During a write batch, the database revision is
+ * incremented once when the batch ends.
  */
 void Device_Inc_Database_Revision(void)
 {
-    Database_Revision++;
+    if (Write_Batch_Depth) {
+        Database_Revision_Pending = true;
+    } else {
+        Database_Revision++;
+    }
 }
 
 /** Get the total count of objects supported by this Device Object.
@@ -1534,6 +1635,60 @@ static int Read_Property_Common(
     return apdu_len;
 }
 
+/**
+ * @brief Determine if a property is one of the small values that
+ *  clients read over and over
+ * @param object_property - property identifier
+ * @return true if the encoded value of the property may be cached
+ */
+static bool Read_Property_Cacheable(BACNET_PROPERTY_ID object_property)
+{
+    switch (object_property) {
+        case PROP_OBJECT_NAME:
+        case PROP_PRESENT_VALUE:
+        case PROP_STATUS_FLAGS:
+        case PROP_UNITS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Copy the cached encoding of a property value into the APDU
+ * @param rpdata [in,out] Structure with the desired Object and Property
+ * @return length of the encoded value, or 0 if it is not cached
+ */
+static int Read_Property_Cached(BACNET_READ_PROPERTY_DATA *rpdata)
+{
+    if (!Read_Property_Cacheable(rpdata->object_property) ||
+        !rpdata->application_data || (rpdata->application_data_len <= 0)) {
+        return 0;
+    }
+
+    return propcache_read(
+        rpdata->object_type, rpdata->object_instance,
+        rpdata->object_property, rpdata->array_index,
+        rpdata->application_data, (size_t)rpdata->application_data_len);
+}
+
+/**
+ * @brief Keep the encoding of a property value for the next read
+ *  if its object type uses the cache
+ * @param rpdata [in] Structure with the Object, Property and encoded value
+ * @param apdu_len - length of the encoded value, or a negative error
+ */
+static void
+Read_Property_Cache_Store(BACNET_READ_PROPERTY_DATA *rpdata, int apdu_len)
+{
+    if ((apdu_len > 0) && Read_Property_Cacheable(rpdata->object_property)) {
+        (void)propcache_store(
+            rpdata->object_type, rpdata->object_instance,
+            rpdata->object_property, rpdata->array_index,
+            rpdata->application_data, apdu_len);
+    }
+}
+
 /** Looks up the requested Object and Property, and encodes its Value in an
  * APDU.
  * @ingroup ObjIntf
@@ -1555,7 +1710,11 @@ int Device_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     if (pObject != NULL) {
         if (pObject->Object_Valid_Instance &&
             pObject->Object_Valid_Instance(rpdata->object_instance)) {
-            apdu_len = Read_Property_Common(pObject, rpdata);
+            apdu_len = Read_Property_Cached(rpdata);
+            if (apdu_len == 0) {
+                apdu_len = Read_Property_Common(pObject, rpdata);
+                Read_Property_Cache_Store(rpdata, apdu_len);
+            }
         } else {
             rpdata->error_class = ERROR_CLASS_OBJECT;
             rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
@@ -1952,6 +2111,85 @@ bool Device_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     return (status);
 }
 
+/**
+ * @brief Begin a batch of writes.  Until the batch ends, the database
+ *  revision is incremented at most once, and the present value write
+ *  callbacks of the output objects are held, so that each written
+ *  object is reported once.  Batches may be nested.
+ */
+void Device_Write_Property_Batch_Begin(void)
+{
+    if (Write_Batch_Depth == 0) {
+        Database_Revision_Pending = false;
+#if defined(BACNET_BASIC_OBJECT_ANALOG_OUTPUT)
+        Analog_Output_Write_Present_Value_Defer(true);
+#endif
+#if defined(BACNET_BASIC_OBJECT_BINARY_OUTPUT)
+        Binary_Output_Write_Present_Value_Defer(true);
+#endif
+#if defined(BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT)
+        Multistate_Output_Write_Present_Value_Defer(true);
+#endif
+    }
+    Write_Batch_Depth++;
+}
+
+/**
+ * @brief End a batch of writes, and apply the side effects that were held
+ *  when the outermost batch ends.
+ */
+void Device_Write_Property_Batch_End(void)
+{
+    if (Write_Batch_Depth == 0) {
+        return;
+    }
+    Write_Batch_Depth--;
+    if (Write_Batch_Depth == 0) {
+#if defined(BACNET_BASIC_OBJECT_ANALOG_OUTPUT)
+        Analog_Output_Write_Present_Value_Defer(false);
+#endif
+#if defined(BACNET_BASIC_OBJECT_BINARY_OUTPUT)
+        Binary_Output_Write_Present_Value_Defer(false);
+#endif
+#if defined(BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT)
+        Multistate_Output_Write_Present_Value_Defer(false);
+#endif
+        if (Database_Revision_Pending) {
+            Database_Revision_Pending = false;
+            Database_Revision++;
+        }
+    }
+}
+
+/**
+ * @brief Write a list of property values as one batch, stopping at the
+ *  first write that fails.  Like WritePropertyMultiple, the writes before
+ *  a failure remain written.
+ * @param wp_data [in,out] array of property values to write, where the
+ *  failed write is given its error class and error code
+ * @param count - number of elements in the array
+ * @return number of successful writes, which is the index of the
+ *  failed write if less than count
+ */
+unsigned Device_Write_Property_Batch(
+    BACNET_WRITE_PROPERTY_DATA *wp_data, unsigned count)
+{
+    unsigned index = 0;
+
+    if (!wp_data) {
+        return 0;
+    }
+    Device_Write_Property_Batch_Begin();
+    for (index = 0; index < count; index++) {
+        if (!Device_Write_Property(&wp_data[index])) {
+            break;
+        }
+    }
+    Device_Write_Property_Batch_End();
+
+    return index;
+}
+
 /**
  * @brief AddListElement from an object list property
  * @param list_element [in] Pointer to the BACnet_List_Element_Data structure,
@@ -2262,6 +2500,7 @@ void Device_Init(object_functions_t *object_table)
     } else {
         Object_Table = &My_Object_Table[0];
     }
+    memset(Object_Property_Lists, 0, sizeof(Object_Property_Lists));
     pObject = Object_Table;
     while (pObject->Object_Type < MAX_BACNET_OBJECT_TYPE) {
         if (pObject->Object_Init) {
@@ -2269,9 +2508,16 @@ void Device_Init(object_functions_t *object_table)
         }
         pObject++;
     }
-#if (BACNET_PROTOCOL_REVISION >= 14)
+#if (BACNET_PROTOCOL_REVISION >= 14) && defined(BACNET_BASIC_OBJECT_CHANNEL)
     Channel_Write_Property_Internal_Callback_Set(Device_Write_Property);
 #endif
+#if defined(BACNET_BASIC_OBJECT_SCHEDULE)
+#if defined(BACNET_BASIC_OBJECT_CALENDAR)
+    Schedule_Calendar_Date_Callback_Set(Calendar_Date_Active);
+    Calendar_Date_List_Changed_Callback_Set(Schedule_Calendar_Changed);
+#endif
+    Schedule_Write_Property_Internal_Callback_Set(Device_Write_Property);
+#endif
 }
 
 bool DeviceGetRRInfo(BACNET_READ_RANGE_DATA *pRequest, /* Info on the request */
@@ -2325,13 +2571,12 @@ void Device_Timer(uint16_t milliseconds)
 
     pObject = Object_Table;
     while (pObject->Object_Type < MAX_BACNET_OBJECT_TYPE) {
-        if (pObject->Object_Count) {
+        /* only the object types that have a timer are counted */
+        if ((pObject->Object_Timer) && (pObject->Object_Count) &&
+            (pObject->Object_Index_To_Instance)) {
             count = pObject->Object_Count();
-        }
-        while (count) {
-            count--;
-            if ((pObject->Object_Timer) &&
-                (pObject->Object_Index_To_Instance)) {
+            while (count) {
+                count--;
                 instance = pObject->Object_Index_To_Instance(count);
                 pObject->Object_Timer(instance, milliseconds);
             }
@@ -460,6 +460,16 @@ extern "C" {
     BACNET_STACK_EXPORT
     bool Device_Write_Property(
         BACNET_WRITE_PROPERTY_DATA * wp_data);
+    BACNET_STACK_EXPORT
+    void Device_Write_Property_Batch_Begin(
+        void);
+    BACNET_STACK_EXPORT
+    void Device_Write_Property_Batch_End(
+        void);
+    BACNET_STACK_EXPORT
+    unsigned Device_Write_Property_Batch(
+        BACNET_WRITE_PROPERTY_DATA * wp_data,
+        unsigned count);
 
     BACNET_STACK_EXPORT
     int Device_Add_List_Element(
@@ -26,9 +26,11 @@
 /* Load Control Objects - customize for your use */
 /* from 135-2004-Addendum e */
 
+#include <stdbool.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
@@ -40,17 +42,15 @@
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/debug.h"
+#include "bacnet/basic/sys/keylist.h"
 
 #define PRINTF debug_printf
 
-/* number of demo objects */
+/* number of demo objects created by Load_Control_Init() */
 #ifndef MAX_LOAD_CONTROLS
 #define MAX_LOAD_CONTROLS 4
 #endif
 
-/*  indicates the current load shedding state of the object */
-static BACNET_SHED_STATE Present_Value[MAX_LOAD_CONTROLS];
-
 /* load control objects are required to support LEVEL */
 typedef enum BACnetShedLevelType {
     BACNET_SHED_TYPE_PERCENT, /* Unsigned */
@@ -72,57 +72,71 @@ typedef struct {
         float amount;
     } value;
 } BACNET_SHED_LEVEL;
-/* indicates the desired load shedding */
-static BACNET_SHED_LEVEL Requested_Shed_Level[MAX_LOAD_CONTROLS];
-/* Indicates the amount of power that the object expects
-   to be able to shed in response to a load shed request. */
-static BACNET_SHED_LEVEL Expected_Shed_Level[MAX_LOAD_CONTROLS];
-/* Indicates the actual amount of power being shed in response
-   to a load shed request. */
-static BACNET_SHED_LEVEL Actual_Shed_Level[MAX_LOAD_CONTROLS];
-
-/* indicates the start of the duty window in which the load controlled
-   by the Load Control object must be compliant with the requested shed. */
-static BACNET_DATE_TIME Start_Time[MAX_LOAD_CONTROLS];
-static BACNET_DATE_TIME End_Time[MAX_LOAD_CONTROLS];
-static BACNET_DATE_TIME Current_Time;
-
-/* indicates the duration of the load shed action,
-   starting at Start_Time in minutes */
-static uint32_t Shed_Duration[MAX_LOAD_CONTROLS];
-
-/* indicates the time window used for load shed accounting in minutes */
-static uint32_t Duty_Window[MAX_LOAD_CONTROLS];
-
-/* indicates and controls whether the Load Control object is
-   currently enabled to respond to load shed requests.  */
-static bool Load_Control_Enable[MAX_LOAD_CONTROLS];
-
-/* indicates when the object receives a write to any of the properties
-   Requested_Shed_Level, Shed_Duration, Duty_Window */
-static bool Load_Control_Request_Written[MAX_LOAD_CONTROLS];
-/* indicates when the object receives a write to Start_Time */
-static bool Start_Time_Property_Written[MAX_LOAD_CONTROLS];
-
-/* optional: indicates the baseline power consumption value
-   for the sheddable load controlled by this object,
-   if a fixed baseline is used.
-   The units of Full_Duty_Baseline are kilowatts.*/
-static float Full_Duty_Baseline[MAX_LOAD_CONTROLS];
 
 #define MAX_SHED_LEVELS 3
-/* Represents the shed levels for the LEVEL choice of
-   BACnetShedLevel that have meaning for this particular
-   Load Control object. */
-/* The elements of the array are required to be writable,
-   allowing local configuration of how this Load Control
-   object will participate in load shedding for the
-   facility. This array is not required to be resizable
-   through BACnet write services. The size of this array
-   shall be equal to the size of the Shed_Level_Descriptions
-   array. The behavior of this object when the Shed_Levels
-   array contains duplicate entries is a local matter. */
-static unsigned Shed_Levels[MAX_LOAD_CONTROLS][MAX_SHED_LEVELS];
+
+struct object_data {
+    /* indicates the current load shedding state of the object,
+       which is also the state of the shed state machine */
+    BACNET_SHED_STATE Present_Value;
+    /* indicates the desired load shedding */
+    BACNET_SHED_LEVEL Requested_Shed_Level;
+    /* Indicates the amount of power that the object expects
+       to be able to shed in response to a load shed request. */
+    BACNET_SHED_LEVEL Expected_Shed_Level;
+    /* Indicates the actual amount of power being shed in response
+       to a load shed request. */
+    BACNET_SHED_LEVEL Actual_Shed_Level;
+    /* indicates the start of the duty window in which the load controlled
+       by the Load Control object must be compliant with the requested
+       shed. */
+    BACNET_DATE_TIME Start_Time;
+    /* Start_Time and Start_Time + Shed_Duration in seconds since epoch,
+       which are the deadlines of the shed request */
+    bacnet_time_t Start_Seconds;
+    bacnet_time_t End_Seconds;
+    /* indicates the duration of the load shed action,
+       starting at Start_Time in minutes */
+    uint32_t Shed_Duration;
+    /* indicates the time window used for load shed accounting in minutes */
+    uint32_t Duty_Window;
+    /* optional: indicates the baseline power consumption value
+       for the sheddable load controlled by this object,
+       if a fixed baseline is used.
+       The units of Full_Duty_Baseline are kilowatts.*/
+    float Full_Duty_Baseline;
+    /* Represents the shed levels for the LEVEL choice of
+       BACnetShedLevel that have meaning for this particular
+       Load Control object. */
+    /* The elements of the array are required to be writable,
+       allowing local configuration of how this Load Control
+       object will participate in load shedding for the
+       facility. This array is not required to be resizable
+       through BACnet write services. The size of this array
+       shall be equal to the size of the Shed_Level_Descriptions
+       array. The behavior of this object when the Shed_Levels
+       array contains duplicate entries is a local matter. */
+    unsigned Shed_Levels[MAX_SHED_LEVELS];
+    /* indicates and controls whether the Load Control object is
+       currently enabled to respond to load shed requests.  */
+    bool Enable : 1;
+    /* indicates when the object receives a write to any of the properties
+       Requested_Shed_Level, Shed_Duration, Duty_Window */
+    bool Request_Written : 1;
+    /* indicates when the object receives a write to Start_Time */
+    bool Start_Time_Written : 1;
+};
+
+/* Key List for storing the object data sorted by instance number  */
+static OS_Keylist Object_List;
+/* objects with a shed request or a pending write - the only objects
+   that the state machine handler needs to visit */
+static OS_Keylist Active_List;
+/* time of the last evaluation, and the time at which an object
+   in the active list next needs to be evaluated */
+static BACNET_DATE_TIME Current_Time;
+static bacnet_time_t Current_Seconds;
+static bacnet_time_t Next_Deadline;
 
 /* represents a description of the shed levels that the
    Load Control object can take on.  It is the same for
@@ -161,88 +175,79 @@ void Load_Control_Property_Lists(
     return;
 }
 
-void Load_Control_Init(void)
+/**
+ * @brief Gets an object from the list using an instance number
+ * @param object_instance - object-instance number of the object
+ * @return object found in the list, or NULL if not found
+ */
+static struct object_data *Load_Control_Object(uint32_t object_instance)
 {
-    unsigned i, j;
-
-    for (i = 0; i < MAX_LOAD_CONTROLS; i++) {
-        /* FIXME: load saved data? */
-        Present_Value[i] = BACNET_SHED_INACTIVE;
-        Requested_Shed_Level[i].type = BACNET_SHED_TYPE_LEVEL;
-        Requested_Shed_Level[i].value.level = 0;
-        datetime_wildcard_set(&Start_Time[i]);
-        datetime_wildcard_set(&End_Time[i]);
-        datetime_wildcard_set(&Current_Time);
-        Shed_Duration[i] = 0;
-        Duty_Window[i] = 0;
-        Load_Control_Enable[i] = true;
-        Full_Duty_Baseline[i] = 1.500; /* kilowatts */
-        Expected_Shed_Level[i].type = BACNET_SHED_TYPE_LEVEL;
-        Expected_Shed_Level[i].value.level = 0;
-        Actual_Shed_Level[i].type = BACNET_SHED_TYPE_LEVEL;
-        Actual_Shed_Level[i].value.level = 0;
-        Load_Control_Request_Written[i] = false;
-        Start_Time_Property_Written[i] = false;
-        for (j = 0; j < MAX_SHED_LEVELS; j++) {
-            Shed_Levels[i][j] = j + 1;
-        }
-    }
-
-    return;
+    return Keylist_Data(Object_List, object_instance);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need validate that the */
-/* given instance exists */
+/**
+ * @brief Determines if a given Load Control instance is valid
+ * @param object_instance - object-instance number of the object
+ * @return true if the instance is valid, and false if not
+ */
 bool Load_Control_Valid_Instance(uint32_t object_instance)
 {
-    if (object_instance < MAX_LOAD_CONTROLS) {
+    if (Load_Control_Object(object_instance)) {
         return true;
     }
 
     return false;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then count how many you have */
+/**
+ * @brief Determines the number of Load Control objects
+ * @return Number of Load Control objects
+ */
 unsigned Load_Control_Count(void)
 {
-    return MAX_LOAD_CONTROLS;
+    return Keylist_Count(Object_List);
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the instance */
-/* that correlates to the correct index */
+/**
+ * @brief Determines the object instance-number for a given 0..N index
+ * of Load Control objects where N is Load_Control_Count().
+ * @param index - 0..N where N is Load_Control_Count()
+ * @return object instance-number for the given index
+ */
 uint32_t Load_Control_Index_To_Instance(unsigned index)
 {
-    if (index < MAX_LOAD_CONTROLS) {
-        return index;
-    }
-    return MAX_LOAD_CONTROLS;
+    KEY key = UINT32_MAX;
+
+    Keylist_Index_Key(Object_List, index, &key);
+
+    return key;
 }
 
-/* we simply have 0-n object instances.  Yours might be */
-/* more complex, and then you need to return the index */
-/* that correlates to the correct instance number */
+/**
+ * @brief For a given object instance-number, determines a 0..N index
+ * of Load Control objects where N is Load_Control_Count().
+ * @param object_instance - object-instance number of the object
+ * @return index for the given instance-number, or Load_Control_Count()
+ * if not valid.
+ */
 unsigned Load_Control_Instance_To_Index(uint32_t object_instance)
 {
-    unsigned index = MAX_LOAD_CONTROLS;
-
-    if (object_instance < MAX_LOAD_CONTROLS) {
-        index = object_instance;
-    }
-
-    return index;
+    return Keylist_Index(Object_List, object_instance);
 }
 
-static BACNET_SHED_STATE Load_Control_Present_Value(uint32_t object_instance)
+/**
+ * @brief For a given object instance-number, returns the shed state
+ * @param object_instance - object-instance number of the object
+ * @return present-value of the object
+ */
+BACNET_SHED_STATE Load_Control_Present_Value(uint32_t object_instance)
 {
     BACNET_SHED_STATE value = BACNET_SHED_INACTIVE;
-    unsigned index = 0;
+    struct object_data *pObject;
 
-    index = Load_Control_Instance_To_Index(object_instance);
-    if (index < MAX_LOAD_CONTROLS) {
-        value = Present_Value[index];
+    pObject = Load_Control_Object(object_instance);
+    if (pObject) {
+        value = pObject->Present_Value;
     }
 
     return value;
@@ -255,7 +260,7 @@ bool Load_Control_Object_Name(
     static char text[32] = ""; /* okay for single thread */
     bool status = false;
 
-    if (object_instance < MAX_LOAD_CONTROLS) {
+    if (Load_Control_Valid_Instance(object_instance)) {
         snprintf(text, sizeof(text), "LOAD CONTROL %lu", (unsigned long)object_instance);
         status = characterstring_init_ansi(object_name, text);
     }
@@ -263,37 +268,77 @@ bool Load_Control_Object_Name(
     return status;
 }
 
-static void Update_Current_Time(BACNET_DATE_TIME *bdatetime)
+/**
+ * @brief Add an object to the list of objects that the state machine
+ *  handler visits, and have it visited on the next pass
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
+ */
+static void Load_Control_Activate(
+    uint32_t object_instance, struct object_data *pObject)
+{
+    if (!Keylist_Data(Active_List, object_instance)) {
+        Keylist_Data_Add(Active_List, object_instance, pObject);
+    }
+    Next_Deadline = 0;
+}
+
+/**
+ * @brief Compute the deadlines of the shed request from Start_Time
+ *  and Shed_Duration, so that the state machine compares integers
+ * @param pObject - object data
+ */
+static void Load_Control_Deadline_Update(struct object_data *pObject)
 {
-    if (bdatetime) {
-        datetime_local(&bdatetime->date, &bdatetime->time, NULL, NULL);
+    if (datetime_wildcard_present(&pObject->Start_Time)) {
+        pObject->Start_Seconds = datetime_seconds_since_epoch_max();
+        pObject->End_Seconds = datetime_seconds_since_epoch_max();
+    } else {
+        pObject->Start_Seconds =
+            datetime_seconds_since_epoch(&pObject->Start_Time);
+        pObject->End_Seconds =
+            pObject->Start_Seconds + (bacnet_time_t)pObject->Shed_Duration * 60;
     }
 }
 
+/**
+ * @brief Get the first whole second after a deadline
+ * @param seconds - deadline in seconds since epoch
+ * @return seconds since epoch, saturated for a deadline that never comes
+ */
+static bacnet_time_t Load_Control_Deadline_After(bacnet_time_t seconds)
+{
+    if (seconds < datetime_seconds_since_epoch_max()) {
+        seconds++;
+    }
+
+    return seconds;
+}
+
 /* convert the shed level request into an Analog Output Present_Value */
-static float Requested_Shed_Level_Value(int object_index)
+static float Requested_Shed_Level_Value(struct object_data *pObject)
 {
     unsigned shed_level_index = 0;
     unsigned i = 0;
     float requested_level = 0.0;
 
-    switch (Requested_Shed_Level[object_index].type) {
+    switch (pObject->Requested_Shed_Level.type) {
         case BACNET_SHED_TYPE_PERCENT:
             requested_level =
-                (float)Requested_Shed_Level[object_index].value.percent;
+                (float)pObject->Requested_Shed_Level.value.percent;
             break;
         case BACNET_SHED_TYPE_AMOUNT:
             /* Assumptions: wattage is linear with analog output level */
-            requested_level = Full_Duty_Baseline[object_index] -
-                Requested_Shed_Level[object_index].value.amount;
-            requested_level /= Full_Duty_Baseline[object_index];
+            requested_level = pObject->Full_Duty_Baseline -
+                pObject->Requested_Shed_Level.value.amount;
+            requested_level /= pObject->Full_Duty_Baseline;
             requested_level *= 100.0;
             break;
         case BACNET_SHED_TYPE_LEVEL:
         default:
             for (i = 0; i < MAX_SHED_LEVELS; i++) {
-                if (Shed_Levels[object_index][i] <=
-                    Requested_Shed_Level[object_index].value.level) {
+                if (pObject->Shed_Levels[i] <=
+                    pObject->Requested_Shed_Level.value.level) {
                     shed_level_index = i;
                 }
             }
@@ -343,21 +388,21 @@ static void Shed_Level_Default_Set(
     }
 }
 
-static bool Able_To_Meet_Shed_Request(int object_index)
+static bool Able_To_Meet_Shed_Request(
+    uint32_t object_instance, struct object_data *pObject)
 {
     float level = 0.0;
     float requested_level = 0.0;
     unsigned priority = 0;
     bool status = false;
-    int object_instance = 0;
 
-    /* This demo is going to use the Analog Outputs as their Load */
-    object_instance = object_index;
+    /* This demo is going to use the Analog Output with the same
+       instance number as their Load */
     priority = Analog_Output_Present_Value_Priority(object_instance);
     /* we are controlling at Priority 4 - can we control the output? */
     if (priority >= 4) {
         /* is the level able to be lowered? */
-        requested_level = Requested_Shed_Level_Value(object_index);
+        requested_level = Requested_Shed_Level_Value(pObject);
         level = Analog_Output_Present_Value(object_instance);
         if (level >= requested_level) {
             status = true;
@@ -367,233 +412,212 @@ static bool Able_To_Meet_Shed_Request(int object_index)
     return status;
 }
 
-typedef enum load_control_state {
-    SHED_INACTIVE,
-    SHED_REQUEST_PENDING,
-    SHED_NON_COMPLIANT,
-    SHED_COMPLIANT,
-    MAX_LOAD_CONTROL_STATE
-} LOAD_CONTROL_STATE;
-static LOAD_CONTROL_STATE Load_Control_State[MAX_LOAD_CONTROLS];
-static LOAD_CONTROL_STATE Load_Control_State_Previously[MAX_LOAD_CONTROLS];
-
 #if PRINT_ENABLED_DEBUG
-static void Print_Load_Control_State(int object_index)
+static void Print_Load_Control_State(
+    uint32_t object_instance, struct object_data *pObject)
 {
-    char *Load_Control_State_Text[MAX_LOAD_CONTROLS] = { "SHED_INACTIVE",
-        "SHED_REQUEST_PENDING", "SHED_NON_COMPLIANT", "SHED_COMPLIANT" };
+    char *Load_Control_State_Text[] = { "SHED_INACTIVE",
+        "SHED_REQUEST_PENDING", "SHED_COMPLIANT", "SHED_NON_COMPLIANT" };
 
-    if (object_index < MAX_LOAD_CONTROLS) {
-        if (Load_Control_State[object_index] < MAX_LOAD_CONTROL_STATE) {
-            printf("Load Control[%d]=%s\n", object_index,
-                Load_Control_State_Text[Load_Control_State[object_index]]);
-        }
+    if (pObject->Present_Value <= BACNET_SHED_NON_COMPLIANT) {
+        printf("Load Control[%lu]=%s\n", (unsigned long)object_instance,
+            Load_Control_State_Text[pObject->Present_Value]);
     }
 }
 #endif
 
-void Load_Control_State_Machine(int object_index)
+/**
+ * @brief Run the shed state machine of one object at Current_Time
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
+ */
+static void Load_Control_Object_State_Machine(
+    uint32_t object_instance, struct object_data *pObject)
 {
-    unsigned i = 0; /* loop counter */
-    int diff = 0; /* used for datetime comparison */
-
     /* is the state machine enabled? */
-    if (!Load_Control_Enable[object_index]) {
-        Load_Control_State[object_index] = SHED_INACTIVE;
+    if (!pObject->Enable) {
+        pObject->Present_Value = BACNET_SHED_INACTIVE;
         return;
     }
 
-    switch (Load_Control_State[object_index]) {
-        case SHED_REQUEST_PENDING:
-            if (Load_Control_Request_Written[object_index]) {
-                Load_Control_Request_Written[object_index] = false;
+    switch (pObject->Present_Value) {
+        case BACNET_SHED_REQUEST_PENDING:
+            if (pObject->Request_Written) {
+                pObject->Request_Written = false;
                 /* request to cancel using default values? */
-                switch (Requested_Shed_Level[object_index].type) {
+                switch (pObject->Requested_Shed_Level.type) {
                     case BACNET_SHED_TYPE_PERCENT:
-                        if (Requested_Shed_Level[object_index].value.percent ==
+                        if (pObject->Requested_Shed_Level.value.percent ==
                             DEFAULT_VALUE_PERCENT) {
-                            Load_Control_State[object_index] = SHED_INACTIVE;
+                            pObject->Present_Value = BACNET_SHED_INACTIVE;
                         }
                         break;
                     case BACNET_SHED_TYPE_AMOUNT:
-                        if (Requested_Shed_Level[object_index].value.amount <=
+                        if (pObject->Requested_Shed_Level.value.amount <=
                             DEFAULT_VALUE_AMOUNT) {
-                            Load_Control_State[object_index] = SHED_INACTIVE;
+                            pObject->Present_Value = BACNET_SHED_INACTIVE;
                         }
                         break;
                     case BACNET_SHED_TYPE_LEVEL:
                     default:
-                        if (Requested_Shed_Level[object_index].value.level ==
-                                DEFAULT_VALUE_LEVEL) {
-                            Load_Control_State[object_index] = SHED_INACTIVE;
+                        if (pObject->Requested_Shed_Level.value.level ==
+                            DEFAULT_VALUE_LEVEL) {
+                            pObject->Present_Value = BACNET_SHED_INACTIVE;
                         }
                         break;
                 }
-                if (Load_Control_State[object_index] == SHED_INACTIVE) {
+                if (pObject->Present_Value == BACNET_SHED_INACTIVE) {
 #if PRINT_ENABLED_DEBUG
-                    printf("Load Control[%d]:Requested Shed Level=Default\n",
-                        object_index);
+                    printf("Load Control[%lu]:Requested Shed Level=Default\n",
+                        (unsigned long)object_instance);
 #endif
                     break;
                 }
             }
             /* clear the flag for Start time if it is written */
-            if (Start_Time_Property_Written[object_index]) {
-                Start_Time_Property_Written[object_index] = false;
+            if (pObject->Start_Time_Written) {
+                pObject->Start_Time_Written = false;
                 /* request to cancel using wildcards in start time? */
-                if (datetime_wildcard(&Start_Time[object_index])) {
-                    Load_Control_State[object_index] = SHED_INACTIVE;
+                if (datetime_wildcard(&pObject->Start_Time)) {
+                    pObject->Present_Value = BACNET_SHED_INACTIVE;
 #if PRINT_ENABLED_DEBUG
-                    printf(
-                        "Load Control[%d]:Start Time=Wildcard\n", object_index);
+                    printf("Load Control[%lu]:Start Time=Wildcard\n",
+                        (unsigned long)object_instance);
 #endif
                     break;
                 }
             }
             /* cancel because current time is after start time + duration? */
-            datetime_copy(&End_Time[object_index], &Start_Time[object_index]);
-            datetime_add_minutes(
-                &End_Time[object_index], Shed_Duration[object_index]);
-            diff = datetime_compare(&End_Time[object_index], &Current_Time);
-            if (diff < 0) {
+            if (pObject->End_Seconds < Current_Seconds) {
                 /* CancelShed */
                 /* FIXME: stop shedding! i.e. relinquish */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Current Time"
+                printf("Load Control[%lu]:Current Time"
                        " is after Start Time + Duration\n",
-                    object_index);
+                    (unsigned long)object_instance);
 #endif
-                Load_Control_State[object_index] = SHED_INACTIVE;
+                pObject->Present_Value = BACNET_SHED_INACTIVE;
                 break;
             }
-            diff = datetime_compare(&Current_Time, &Start_Time[object_index]);
-            if (diff < 0) {
+            if (Current_Seconds < pObject->Start_Seconds) {
                 /* current time prior to start time */
                 /* ReconfigurePending */
-                Shed_Level_Copy(&Expected_Shed_Level[object_index],
-                    &Requested_Shed_Level[object_index]);
-                Shed_Level_Default_Set(&Actual_Shed_Level[object_index],
-                    Requested_Shed_Level[object_index].type);
-            } else if (diff > 0) {
+                Shed_Level_Copy(&pObject->Expected_Shed_Level,
+                    &pObject->Requested_Shed_Level);
+                Shed_Level_Default_Set(&pObject->Actual_Shed_Level,
+                    pObject->Requested_Shed_Level.type);
+            } else if (Current_Seconds > pObject->Start_Seconds) {
                 /* current time after to start time */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Current Time"
+                printf("Load Control[%lu]:Current Time"
                        " is after Start Time\n",
-                    object_index);
+                    (unsigned long)object_instance);
 #endif
                 /* AbleToMeetShed */
-                if (Able_To_Meet_Shed_Request(object_index)) {
-                    Shed_Level_Copy(&Expected_Shed_Level[object_index],
-                        &Requested_Shed_Level[object_index]);
-                    Analog_Output_Present_Value_Set(object_index,
-                        Requested_Shed_Level_Value(object_index), 4);
-                    Shed_Level_Copy(&Actual_Shed_Level[object_index],
-                        &Requested_Shed_Level[object_index]);
-                    Load_Control_State[object_index] = SHED_COMPLIANT;
+                if (Able_To_Meet_Shed_Request(object_instance, pObject)) {
+                    Shed_Level_Copy(&pObject->Expected_Shed_Level,
+                        &pObject->Requested_Shed_Level);
+                    Analog_Output_Present_Value_Set(object_instance,
+                        Requested_Shed_Level_Value(pObject), 4);
+                    Shed_Level_Copy(&pObject->Actual_Shed_Level,
+                        &pObject->Requested_Shed_Level);
+                    pObject->Present_Value = BACNET_SHED_COMPLIANT;
                 } else {
                     /* CannotMeetShed */
-                    Shed_Level_Default_Set(&Expected_Shed_Level[object_index],
-                        Requested_Shed_Level[object_index].type);
-                    Shed_Level_Default_Set(&Actual_Shed_Level[object_index],
-                        Requested_Shed_Level[object_index].type);
-                    Load_Control_State[object_index] = SHED_NON_COMPLIANT;
+                    Shed_Level_Default_Set(&pObject->Expected_Shed_Level,
+                        pObject->Requested_Shed_Level.type);
+                    Shed_Level_Default_Set(&pObject->Actual_Shed_Level,
+                        pObject->Requested_Shed_Level.type);
+                    pObject->Present_Value = BACNET_SHED_NON_COMPLIANT;
                 }
             }
             break;
-        case SHED_NON_COMPLIANT:
-            datetime_copy(&End_Time[object_index], &Start_Time[object_index]);
-            datetime_add_minutes(
-                &End_Time[object_index], Shed_Duration[object_index]);
-            diff = datetime_compare(&End_Time[object_index], &Current_Time);
-            if (diff < 0) {
+        case BACNET_SHED_NON_COMPLIANT:
+            if (pObject->End_Seconds < Current_Seconds) {
                 /* FinishedUnsuccessfulShed */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Current Time is after Start Time + "
+                printf("Load Control[%lu]:Current Time is after Start Time + "
                        "Duration\n",
-                    object_index);
+                    (unsigned long)object_instance);
 #endif
-                Load_Control_State[object_index] = SHED_INACTIVE;
+                pObject->Present_Value = BACNET_SHED_INACTIVE;
                 break;
             }
-            if (Load_Control_Request_Written[object_index] ||
-                Start_Time_Property_Written[object_index]) {
+            if (pObject->Request_Written || pObject->Start_Time_Written) {
                 /* UnsuccessfulShedReconfigured */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Control Property written\n",
-                    object_index);
+                printf("Load Control[%lu]:Control Property written\n",
+                    (unsigned long)object_instance);
 #endif
                 /* The Written flags will cleared in the next state */
-                Load_Control_State[object_index] = SHED_REQUEST_PENDING;
+                pObject->Present_Value = BACNET_SHED_REQUEST_PENDING;
                 break;
             }
-            if (Able_To_Meet_Shed_Request(object_index)) {
+            if (Able_To_Meet_Shed_Request(object_instance, pObject)) {
                 /* CanNowComplyWithShed */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Able to meet Shed Request\n",
-                    object_index);
+                printf("Load Control[%lu]:Able to meet Shed Request\n",
+                    (unsigned long)object_instance);
 #endif
-                Shed_Level_Copy(&Expected_Shed_Level[object_index],
-                    &Requested_Shed_Level[object_index]);
-                Analog_Output_Present_Value_Set(
-                    object_index, Requested_Shed_Level_Value(object_index), 4);
-                Shed_Level_Copy(&Actual_Shed_Level[object_index],
-                    &Requested_Shed_Level[object_index]);
-                Load_Control_State[object_index] = SHED_COMPLIANT;
+                Shed_Level_Copy(&pObject->Expected_Shed_Level,
+                    &pObject->Requested_Shed_Level);
+                Analog_Output_Present_Value_Set(object_instance,
+                    Requested_Shed_Level_Value(pObject), 4);
+                Shed_Level_Copy(&pObject->Actual_Shed_Level,
+                    &pObject->Requested_Shed_Level);
+                pObject->Present_Value = BACNET_SHED_COMPLIANT;
             }
             break;
-        case SHED_COMPLIANT:
-            datetime_copy(&End_Time[object_index], &Start_Time[object_index]);
-            datetime_add_minutes(
-                &End_Time[object_index], Shed_Duration[object_index]);
-            diff = datetime_compare(&End_Time[object_index], &Current_Time);
-            if (diff < 0) {
+        case BACNET_SHED_COMPLIANT:
+            if (pObject->End_Seconds < Current_Seconds) {
                 /* FinishedSuccessfulShed */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Current Time is after Start Time + "
+                printf("Load Control[%lu]:Current Time is after Start Time + "
                        "Duration\n",
-                    object_index);
+                    (unsigned long)object_instance);
 #endif
-                datetime_wildcard_set(&Start_Time[i]);
-                Analog_Output_Present_Value_Relinquish(object_index, 4);
-                Load_Control_State[object_index] = SHED_INACTIVE;
+                datetime_wildcard_set(&pObject->Start_Time);
+                Load_Control_Deadline_Update(pObject);
+                Analog_Output_Present_Value_Relinquish(object_instance, 4);
+                pObject->Present_Value = BACNET_SHED_INACTIVE;
                 break;
             }
-            if (Load_Control_Request_Written[object_index] ||
-                Start_Time_Property_Written[object_index]) {
+            if (pObject->Request_Written || pObject->Start_Time_Written) {
                 /* UnsuccessfulShedReconfigured */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Control Property written\n",
-                    object_index);
+                printf("Load Control[%lu]:Control Property written\n",
+                    (unsigned long)object_instance);
 #endif
                 /* The Written flags will cleared in the next state */
-                Load_Control_State[object_index] = SHED_REQUEST_PENDING;
+                pObject->Present_Value = BACNET_SHED_REQUEST_PENDING;
                 break;
             }
-            if (!Able_To_Meet_Shed_Request(object_index)) {
+            if (!Able_To_Meet_Shed_Request(object_instance, pObject)) {
                 /* CanNoLongerComplyWithShed */
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Not able to meet Shed Request\n",
-                    object_index);
+                printf("Load Control[%lu]:Not able to meet Shed Request\n",
+                    (unsigned long)object_instance);
 #endif
-                Shed_Level_Default_Set(&Expected_Shed_Level[object_index],
-                    Requested_Shed_Level[object_index].type);
-                Shed_Level_Default_Set(&Actual_Shed_Level[object_index],
-                    Requested_Shed_Level[object_index].type);
-                Load_Control_State[object_index] = SHED_NON_COMPLIANT;
+                Shed_Level_Default_Set(&pObject->Expected_Shed_Level,
+                    pObject->Requested_Shed_Level.type);
+                Shed_Level_Default_Set(&pObject->Actual_Shed_Level,
+                    pObject->Requested_Shed_Level.type);
+                pObject->Present_Value = BACNET_SHED_NON_COMPLIANT;
             }
             break;
-        case SHED_INACTIVE:
+        case BACNET_SHED_INACTIVE:
         default:
-            if (Start_Time_Property_Written[object_index]) {
+            if (pObject->Start_Time_Written) {
 #if PRINT_ENABLED_DEBUG
-                printf("Load Control[%d]:Start Time written\n", object_index);
+                printf("Load Control[%lu]:Start Time written\n",
+                    (unsigned long)object_instance);
 #endif
                 /* The Written flag will cleared in the next state */
-                Shed_Level_Copy(&Expected_Shed_Level[object_index],
-                    &Requested_Shed_Level[object_index]);
-                Shed_Level_Default_Set(&Actual_Shed_Level[object_index],
-                    Requested_Shed_Level[object_index].type);
-                Load_Control_State[object_index] = SHED_REQUEST_PENDING;
+                Shed_Level_Copy(&pObject->Expected_Shed_Level,
+                    &pObject->Requested_Shed_Level);
+                Shed_Level_Default_Set(&pObject->Actual_Shed_Level,
+                    pObject->Requested_Shed_Level.type);
+                pObject->Present_Value = BACNET_SHED_REQUEST_PENDING;
             }
             break;
     }
@@ -601,28 +625,248 @@ void Load_Control_State_Machine(int object_index)
     return;
 }
 
+/**
+ * @brief Run the state machine of one object in the active list, and
+ *  determine when the object next needs to be evaluated
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
+ * @return the time in seconds since epoch when the object next needs
+ *  to be evaluated, or 0 if it no longer needs to be evaluated
+ */
+static bacnet_time_t Load_Control_Object_Evaluate(
+    uint32_t object_instance, struct object_data *pObject)
+{
+    BACNET_SHED_STATE previous_state = pObject->Present_Value;
+    bool written;
+
+    written = pObject->Request_Written || pObject->Start_Time_Written;
+    if ((pObject->Present_Value == BACNET_SHED_REQUEST_PENDING) &&
+        !written && (Current_Seconds <= pObject->Start_Seconds)) {
+        /* nothing changes until the start time has passed */
+        return Load_Control_Deadline_After(pObject->Start_Seconds);
+    }
+    Load_Control_Object_State_Machine(object_instance, pObject);
+    if (pObject->Present_Value != previous_state) {
+#if PRINT_ENABLED_DEBUG
+        Print_Load_Control_State(object_instance, pObject);
+#endif
+    }
+    written = pObject->Request_Written || pObject->Start_Time_Written;
+    if (!pObject->Enable ||
+        ((pObject->Present_Value == BACNET_SHED_INACTIVE) && !written)) {
+        return 0;
+    }
+    if (written || (pObject->Present_Value != previous_state)) {
+        /* the next state acts on the written properties */
+        return Current_Seconds;
+    }
+    if (pObject->Present_Value == BACNET_SHED_REQUEST_PENDING) {
+        return Load_Control_Deadline_After(pObject->Start_Seconds);
+    }
+
+    /* while shedding, the ability of the load to comply is polled */
+    return Current_Seconds + 1;
+}
+
+/**
+ * @brief Evaluate the shed requests of the Load Control objects.
+ *  Only objects with a shed request or a pending write are visited,
+ *  and nothing is visited before the earliest of their deadlines.
+ * @param bdatetime - current date and time
+ * @return milliseconds until the next deadline of a shed request
+ */
+uint32_t Load_Control_Task(BACNET_DATE_TIME *bdatetime)
+{
+    struct object_data *pObject;
+    bacnet_time_t next_deadline = datetime_seconds_since_epoch_max();
+    bacnet_time_t deadline;
+    KEY key = 0;
+    int index;
+
+    if (!bdatetime) {
+        return 0;
+    }
+    datetime_copy(&Current_Time, bdatetime);
+    Current_Seconds = datetime_seconds_since_epoch(bdatetime);
+    if (Current_Seconds >= Next_Deadline) {
+        /* backwards, since objects leave the list */
+        index = Keylist_Count(Active_List);
+        while (index > 0) {
+            index--;
+            pObject = Keylist_Data_Index(Active_List, index);
+            Keylist_Index_Key(Active_List, index, &key);
+            deadline = Load_Control_Object_Evaluate(key, pObject);
+            if (deadline == 0) {
+                Keylist_Data_Delete_By_Index(Active_List, index);
+            } else if (deadline < next_deadline) {
+                next_deadline = deadline;
+            }
+        }
+        Next_Deadline = next_deadline;
+    }
+    if (Next_Deadline <= Current_Seconds) {
+        return 0;
+    }
+    if ((Next_Deadline - Current_Seconds) >= (UINT32_MAX / 1000)) {
+        return UINT32_MAX;
+    }
+
+    return (uint32_t)(Next_Deadline - Current_Seconds) * 1000UL;
+}
+
+/**
+ * @brief Run the state machine of one Load Control object at the time
+ *  of the last evaluation
+ * @param object_index - 0..N where N is Load_Control_Count()
+ */
+void Load_Control_State_Machine(int object_index)
+{
+    struct object_data *pObject;
+    KEY key = 0;
+
+    if (object_index < 0) {
+        return;
+    }
+    pObject = Keylist_Data_Index(Object_List, object_index);
+    if (pObject && Keylist_Index_Key(Object_List, object_index, &key)) {
+        if (Load_Control_Object_Evaluate(key, pObject) == 0) {
+            Keylist_Data_Delete(Active_List, key);
+        } else {
+            Load_Control_Activate(key, pObject);
+        }
+    }
+}
+
 /* call every second or so */
 void Load_Control_State_Machine_Handler(void)
 {
-    unsigned i = 0;
-    static bool initialized = false;
+    BACNET_DATE_TIME bdatetime;
 
-    if (!initialized) {
-        initialized = true;
-        for (i = 0; i < MAX_LOAD_CONTROLS; i++) {
-            Load_Control_State[i] = SHED_INACTIVE;
-            Load_Control_State_Previously[i] = SHED_INACTIVE;
+    datetime_local(&bdatetime.date, &bdatetime.time, NULL, NULL);
+    (void)Load_Control_Task(&bdatetime);
+}
+
+/**
+ * @brief Creates a Load Control object
+ * @param object_instance - object-instance number of the object
+ * @return the object-instance that was created, or BACNET_MAX_INSTANCE
+ */
+uint32_t Load_Control_Create(uint32_t object_instance)
+{
+    struct object_data *pObject = NULL;
+    int index = 0;
+    unsigned j;
+
+    if (object_instance > BACNET_MAX_INSTANCE) {
+        return BACNET_MAX_INSTANCE;
+    } else if (object_instance == BACNET_MAX_INSTANCE) {
+        /* wildcard instance */
+        /* the Object_Identifier property of the newly created object
+            shall be initialized to a value that is unique within the
+            responding BACnet-user device. The method used to generate
+            the object identifier is a local matter.*/
+        object_instance = Keylist_Next_Empty_Key(Object_List, 1);
+    }
+    pObject = Keylist_Data(Object_List, object_instance);
+    if (!pObject) {
+        pObject = calloc(1, sizeof(struct object_data));
+        if (!pObject) {
+            return BACNET_MAX_INSTANCE;
         }
+        pObject->Present_Value = BACNET_SHED_INACTIVE;
+        pObject->Requested_Shed_Level.type = BACNET_SHED_TYPE_LEVEL;
+        pObject->Requested_Shed_Level.value.level = 0;
+        datetime_wildcard_set(&pObject->Start_Time);
+        pObject->Shed_Duration = 0;
+        pObject->Duty_Window = 0;
+        Load_Control_Deadline_Update(pObject);
+        pObject->Enable = true;
+        pObject->Full_Duty_Baseline = 1.500; /* kilowatts */
+        pObject->Expected_Shed_Level.type = BACNET_SHED_TYPE_LEVEL;
+        pObject->Expected_Shed_Level.value.level = 0;
+        pObject->Actual_Shed_Level.type = BACNET_SHED_TYPE_LEVEL;
+        pObject->Actual_Shed_Level.value.level = 0;
+        pObject->Request_Written = false;
+        pObject->Start_Time_Written = false;
+        for (j = 0; j < MAX_SHED_LEVELS; j++) {
+            pObject->Shed_Levels[j] = j + 1;
+        }
+        /* add to list */
+        index = Keylist_Data_Add(Object_List, object_instance, pObject);
+        if (index < 0) {
+            free(pObject);
+            return BACNET_MAX_INSTANCE;
+        }
+    }
+
+    return object_instance;
+}
+
+/**
+ * @brief Deletes a Load Control object
+ * @param object_instance - object-instance number of the object
+ * @return true if the object is deleted
+ */
+bool Load_Control_Delete(uint32_t object_instance)
+{
+    bool status = false;
+    struct object_data *pObject = NULL;
+
+    pObject = Keylist_Data_Delete(Object_List, object_instance);
+    if (pObject) {
+        Keylist_Data_Delete(Active_List, object_instance);
+        free(pObject);
+        status = true;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Deletes all the Load Control objects and their data
+ */
+void Load_Control_Cleanup(void)
+{
+    struct object_data *pObject;
+
+    if (Object_List) {
+        do {
+            pObject = Keylist_Data_Pop(Object_List);
+            if (pObject) {
+                free(pObject);
+            }
+        } while (pObject);
+        Keylist_Delete(Object_List);
+        Object_List = NULL;
+    }
+    if (Active_List) {
+        /* the data is owned by the object list */
+        do {
+            pObject = Keylist_Data_Pop(Active_List);
+        } while (pObject);
+        Keylist_Delete(Active_List);
+        Active_List = NULL;
     }
-    Update_Current_Time(&Current_Time);
+}
+
+/**
+ * @brief Initializes the Load Control object data
+ */
+void Load_Control_Init(void)
+{
+    uint32_t i;
+
+    if (!Object_List) {
+        Object_List = Keylist_Create();
+    }
+    if (!Active_List) {
+        Active_List = Keylist_Create();
+    }
+    datetime_wildcard_set(&Current_Time);
+    Current_Seconds = 0;
+    Next_Deadline = 0;
     for (i = 0; i < MAX_LOAD_CONTROLS; i++) {
-        Load_Control_State_Machine(i);
-        if (Load_Control_State[i] != Load_Control_State_Previously[i]) {
-#if PRINT_ENABLED_DEBUG
-            Print_Load_Control_State(i);
-#endif
-            Load_Control_State_Previously[i] = Load_Control_State[i];
-        }
+        (void)Load_Control_Create(i);
     }
 }
 
@@ -634,7 +878,7 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     BACNET_BIT_STRING bit_string;
     BACNET_CHARACTER_STRING char_string;
     int enumeration = 0;
-    unsigned object_index = 0;
+    struct object_data *pObject;
     unsigned i = 0;
     bool state = false;
     uint8_t *apdu = NULL;
@@ -643,8 +887,13 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
         (rpdata->application_data_len == 0)) {
         return 0;
     }
+    pObject = Load_Control_Object(rpdata->object_instance);
+    if (!pObject) {
+        rpdata->error_class = ERROR_CLASS_OBJECT;
+        rpdata->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return BACNET_STATUS_ERROR;
+    }
     apdu = rpdata->application_data;
-    object_index = Load_Control_Instance_To_Index(rpdata->object_instance);
     switch (rpdata->object_property) {
         case PROP_OBJECT_IDENTIFIER:
             apdu_len = encode_application_object_id(
@@ -686,77 +935,77 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                 encode_application_enumerated(&apdu[0], EVENT_STATE_NORMAL);
             break;
         case PROP_REQUESTED_SHED_LEVEL:
-            switch (Requested_Shed_Level[object_index].type) {
+            switch (pObject->Requested_Shed_Level.type) {
                 case BACNET_SHED_TYPE_PERCENT:
                     apdu_len = encode_context_unsigned(&apdu[0], 0,
-                        Requested_Shed_Level[object_index].value.percent);
+                        pObject->Requested_Shed_Level.value.percent);
                     break;
                 case BACNET_SHED_TYPE_AMOUNT:
                     apdu_len = encode_context_real(&apdu[0], 2,
-                        Requested_Shed_Level[object_index].value.amount);
+                        pObject->Requested_Shed_Level.value.amount);
                     break;
                 case BACNET_SHED_TYPE_LEVEL:
                 default:
                     apdu_len = encode_context_unsigned(&apdu[0], 1,
-                        Requested_Shed_Level[object_index].value.level);
+                        pObject->Requested_Shed_Level.value.level);
                     break;
             }
             break;
         case PROP_START_TIME:
             len = encode_application_date(
-                &apdu[0], &Start_Time[object_index].date);
+                &apdu[0], &pObject->Start_Time.date);
             apdu_len = len;
             len = encode_application_time(
-                &apdu[apdu_len], &Start_Time[object_index].time);
+                &apdu[apdu_len], &pObject->Start_Time.time);
             apdu_len += len;
             break;
         case PROP_SHED_DURATION:
             apdu_len = encode_application_unsigned(
-                &apdu[0], Shed_Duration[object_index]);
+                &apdu[0], pObject->Shed_Duration);
             break;
         case PROP_DUTY_WINDOW:
             apdu_len = encode_application_unsigned(
-                &apdu[0], Duty_Window[object_index]);
+                &apdu[0], pObject->Duty_Window);
             break;
         case PROP_ENABLE:
-            state = Load_Control_Enable[object_index];
+            state = pObject->Enable;
             apdu_len = encode_application_boolean(&apdu[0], state);
             break;
         case PROP_FULL_DUTY_BASELINE: /* optional */
             apdu_len = encode_application_real(
-                &apdu[0], Full_Duty_Baseline[object_index]);
+                &apdu[0], pObject->Full_Duty_Baseline);
             break;
         case PROP_EXPECTED_SHED_LEVEL:
-            switch (Expected_Shed_Level[object_index].type) {
+            switch (pObject->Expected_Shed_Level.type) {
                 case BACNET_SHED_TYPE_PERCENT:
                     apdu_len = encode_context_unsigned(&apdu[0], 0,
-                        Expected_Shed_Level[object_index].value.percent);
+                        pObject->Expected_Shed_Level.value.percent);
                     break;
                 case BACNET_SHED_TYPE_AMOUNT:
                     apdu_len = encode_context_real(&apdu[0], 2,
-                        Expected_Shed_Level[object_index].value.amount);
+                        pObject->Expected_Shed_Level.value.amount);
                     break;
                 case BACNET_SHED_TYPE_LEVEL:
                 default:
                     apdu_len = encode_context_unsigned(&apdu[0], 1,
-                        Expected_Shed_Level[object_index].value.level);
+                        pObject->Expected_Shed_Level.value.level);
                     break;
             }
             break;
         case PROP_ACTUAL_SHED_LEVEL:
-            switch (Actual_Shed_Level[object_index].type) {
+            switch (pObject->Actual_Shed_Level.type) {
                 case BACNET_SHED_TYPE_PERCENT:
                     apdu_len = encode_context_unsigned(&apdu[0], 0,
-                        Actual_Shed_Level[object_index].value.percent);
+                        pObject->Actual_Shed_Level.value.percent);
                     break;
                 case BACNET_SHED_TYPE_AMOUNT:
                     apdu_len = encode_context_real(&apdu[0], 2,
-                        Actual_Shed_Level[object_index].value.amount);
+                        pObject->Actual_Shed_Level.value.amount);
                     break;
                 case BACNET_SHED_TYPE_LEVEL:
                 default:
                     apdu_len = encode_context_unsigned(&apdu[0], 1,
-                        Actual_Shed_Level[object_index].value.level);
+                        pObject->Actual_Shed_Level.value.level);
                     break;
             }
             break;
@@ -773,7 +1022,7 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                 for (i = 0; i < MAX_SHED_LEVELS; i++) {
                     /* FIXME: check if we have room before adding it to APDU */
                     len = encode_application_unsigned(
-                        &apdu[apdu_len], Shed_Levels[object_index][i]);
+                        &apdu[apdu_len], pObject->Shed_Levels[i]);
                     /* add it if we have room */
                     if ((apdu_len + len) < MAX_APDU) {
                         apdu_len += len;
@@ -787,7 +1036,7 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
             } else {
                 if (rpdata->array_index <= MAX_SHED_LEVELS) {
                     apdu_len = encode_application_unsigned(&apdu[0],
-                        Shed_Levels[object_index][rpdata->array_index - 1]);
+                        pObject->Shed_Levels[rpdata->array_index - 1]);
                 } else {
                     rpdata->error_class = ERROR_CLASS_PROPERTY;
                     rpdata->error_code = ERROR_CODE_INVALID_ARRAY_INDEX;
@@ -857,7 +1106,7 @@ int Load_Control_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
 bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 {
     bool status = false; /* return value */
-    unsigned int object_index = 0;
+    struct object_data *pObject;
     int len = 0;
     BACNET_APPLICATION_DATA_VALUE value;
     /* build here in case of error in time half of datetime */
@@ -880,7 +1129,9 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
     len = bacapp_decode_application_data(
         wp_data->application_data, wp_data->application_data_len, &value);
     /* FIXME: len < application_data_len: more data? */
-    if (len < 0) {
+    /* Requested_Shed_Level is a context tagged choice, decoded below */
+    if ((len < 0) &&
+        (wp_data->object_property != PROP_REQUESTED_SHED_LEVEL)) {
         PRINTF("Load_Control_Write_Property() failure detected point B\n");
         /* error while decoding - a value larger than we can handle */
         wp_data->error_class = ERROR_CLASS_PROPERTY;
@@ -895,7 +1146,12 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
         wp_data->error_code = ERROR_CODE_PROPERTY_IS_NOT_AN_ARRAY;
         return false;
     }
-    object_index = Load_Control_Instance_To_Index(wp_data->object_instance);
+    pObject = Load_Control_Object(wp_data->object_instance);
+    if (!pObject) {
+        wp_data->error_class = ERROR_CLASS_OBJECT;
+        wp_data->error_code = ERROR_CODE_UNKNOWN_OBJECT;
+        return false;
+    }
     switch (wp_data->object_property) {
         case PROP_REQUESTED_SHED_LEVEL:
             len = bacapp_decode_context_data(wp_data->application_data,
@@ -909,23 +1165,23 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
                 wp_data->error_code = ERROR_CODE_INVALID_DATA_TYPE;
             } else if (value.context_tag == 0) {
                 /* percent - Unsigned */
-                Requested_Shed_Level[object_index].type =
+                pObject->Requested_Shed_Level.type =
                     BACNET_SHED_TYPE_PERCENT;
-                Requested_Shed_Level[object_index].value.percent =
+                pObject->Requested_Shed_Level.value.percent =
                     value.type.Unsigned_Int;
                 status = true;
             } else if (value.context_tag == 1) {
                 /* level - Unsigned */
-                Requested_Shed_Level[object_index].type =
+                pObject->Requested_Shed_Level.type =
                     BACNET_SHED_TYPE_LEVEL;
-                Requested_Shed_Level[object_index].value.level =
+                pObject->Requested_Shed_Level.value.level =
                     value.type.Unsigned_Int;
                 status = true;
             } else if (value.context_tag == 2) {
                 /* amount - REAL */
-                Requested_Shed_Level[object_index].type =
+                pObject->Requested_Shed_Level.type =
                     BACNET_SHED_TYPE_AMOUNT;
-                Requested_Shed_Level[object_index].value.amount =
+                pObject->Requested_Shed_Level.value.amount =
                     value.type.Real;
                 status = true;
             } else {
@@ -936,7 +1192,7 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
                 wp_data->error_code = ERROR_CODE_INVALID_DATA_TYPE;
             }
             if (status) {
-                Load_Control_Request_Written[object_index] = true;
+                pObject->Request_Written = true;
             }
             break;
 
@@ -959,9 +1215,10 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
                     wp_data, &value, BACNET_APPLICATION_TAG_TIME);
                 if (status) {
                     /* Write time and date and set written flag */
-                    Start_Time[object_index].date = start_date;
-                    Start_Time[object_index].time = value.type.Time;
-                    Start_Time_Property_Written[object_index] = true;
+                    pObject->Start_Time.date = start_date;
+                    pObject->Start_Time.time = value.type.Time;
+                    pObject->Start_Time_Written = true;
+                    Load_Control_Deadline_Update(pObject);
                 }
             } else {
                 PRINTF(
@@ -976,8 +1233,9 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_UNSIGNED_INT);
             if (status) {
-                Shed_Duration[object_index] = value.type.Unsigned_Int;
-                Load_Control_Request_Written[object_index] = true;
+                pObject->Shed_Duration = value.type.Unsigned_Int;
+                pObject->Request_Written = true;
+                Load_Control_Deadline_Update(pObject);
             } else {
                 PRINTF(
                     "Load_Control_Write_Property() failure detected point H\n");
@@ -988,8 +1246,8 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_UNSIGNED_INT);
             if (status) {
-                Duty_Window[object_index] = value.type.Unsigned_Int;
-                Load_Control_Request_Written[object_index] = true;
+                pObject->Duty_Window = value.type.Unsigned_Int;
+                pObject->Request_Written = true;
             }
             break;
 
@@ -1005,7 +1263,7 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
                 } else if (wp_data->array_index == BACNET_ARRAY_ALL) {
                     /* FIXME: write entire array */
                 } else if (wp_data->array_index <= MAX_SHED_LEVELS) {
-                    Shed_Levels[object_index][wp_data->array_index - 1] =
+                    pObject->Shed_Levels[wp_data->array_index - 1] =
                         value.type.Unsigned_Int;
                 } else {
                     /* FIXME: Something's missing from here so I'll just put in
@@ -1021,7 +1279,7 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             status = write_property_type_valid(
                 wp_data, &value, BACNET_APPLICATION_TAG_BOOLEAN);
             if (status) {
-                Load_Control_Enable[object_index] = value.type.Boolean;
+                pObject->Enable = value.type.Boolean;
             }
             break;
         default:
@@ -1031,6 +1289,10 @@ bool Load_Control_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             break;
     }
 
+    if (status) {
+        /* evaluate the request on the next pass of the state machine */
+        Load_Control_Activate(wp_data->object_instance, pObject);
+    }
     PRINTF("Load_Control_Write_Property() returning status=%d\n", status);
     return status;
 }
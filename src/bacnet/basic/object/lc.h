@@ -31,6 +31,7 @@
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
 #include "bacnet/bacerror.h"
+#include "bacnet/datetime.h"
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 
@@ -46,6 +47,9 @@ extern "C" {
     BACNET_STACK_EXPORT
     void Load_Control_State_Machine_Handler(
         void);
+    BACNET_STACK_EXPORT
+    uint32_t Load_Control_Task(
+        BACNET_DATE_TIME * bdatetime);
 
     BACNET_STACK_EXPORT
     bool Load_Control_Valid_Instance(
@@ -64,6 +68,19 @@ extern "C" {
     bool Load_Control_Object_Name(
         uint32_t object_instance,
         BACNET_CHARACTER_STRING * object_name);
+    BACNET_STACK_EXPORT
+    BACNET_SHED_STATE Load_Control_Present_Value(
+        uint32_t object_instance);
+
+    BACNET_STACK_EXPORT
+    uint32_t Load_Control_Create(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    bool Load_Control_Delete(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    void Load_Control_Cleanup(
+        void);
 
     BACNET_STACK_EXPORT
     void Load_Control_Init(
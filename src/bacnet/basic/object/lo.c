@@ -42,8 +42,10 @@
 #include "bacnet/wp.h"
 #include "bacnet/lighting.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/commandable.h"
 #include "bacnet/basic/sys/keylist.h"
 #include "bacnet/basic/sys/linear.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/proplist.h"
 /* me! */
 #include "bacnet/basic/object/lo.h"
@@ -61,7 +63,7 @@ struct object_data {
     BACNET_LIGHTING_TRANSITION Transition;
     float Feedback_Value;
     float Priority_Array[BACNET_MAX_PRIORITY];
-    uint16_t Priority_Active_Bits;
+    struct commandable Command;
     float Relinquish_Default;
     float Power;
     float Instantaneous_Power;
@@ -77,9 +79,21 @@ struct object_data {
     bool Blink_Warn_Enable : 1;
     bool Egress_Active : 1;
     bool Color_Override : 1;
+    bool Transition_Active : 1;
 };
 /* Key List for storing the object data sorted by instance number  */
 static OS_Keylist Object_List;
+/* outputs with a fade, ramp, or step in progress, in the order they
+   were started, so that outputs started together stay together */
+static struct object_data **Active_Object;
+static uint32_t *Active_Instance;
+static unsigned Active_Count;
+static unsigned Active_Size;
+/* advances the active outputs while there are any */
+static struct tmwheel_timer Transition_Timer;
+#ifndef LIGHTING_OUTPUT_TRANSITION_MILLISECONDS
+#define LIGHTING_OUTPUT_TRANSITION_MILLISECONDS 10
+#endif
 /* callback for present value writes */
 static lighting_output_write_present_value_callback
     Lighting_Output_Write_Present_Value_Callback;
@@ -220,17 +234,16 @@ unsigned Lighting_Output_Instance_To_Index(uint32_t object_instance)
 float Lighting_Output_Present_Value(uint32_t object_instance)
 {
     float value = 0.0;
-    unsigned p = 0;
+    unsigned priority = 0;
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        value = pObject->Relinquish_Default;
-        for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-            if (BIT_CHECK(pObject->Priority_Active_Bits, p)) {
-                value = pObject->Priority_Array[p];
-                break;
-            }
+        priority = commandable_priority(&pObject->Command);
+        if (priority) {
+            value = pObject->Priority_Array[priority - 1];
+        } else {
+            value = pObject->Relinquish_Default;
         }
     }
 
@@ -247,15 +260,99 @@ float Lighting_Output_Present_Value(uint32_t object_instance)
 static bool
 Priority_Array_Active(struct object_data *pObject, BACNET_ARRAY_INDEX priority)
 {
-    bool active = false;
+    return commandable_active(&pObject->Command, priority + 1);
+}
+
+/**
+ * @brief Determine if a lighting operation needs the transition timer
+ * @param operation - lighting operation
+ * @return true if the operation fades, ramps, or steps the output
+ */
+static bool Lighting_Output_Operation_Active(
+    BACNET_LIGHTING_OPERATION operation)
+{
+    switch (operation) {
+        case BACNET_LIGHTS_FADE_TO:
+        case BACNET_LIGHTS_RAMP_TO:
+        case BACNET_LIGHTS_STEP_UP:
+        case BACNET_LIGHTS_STEP_DOWN:
+        case BACNET_LIGHTS_STEP_ON:
+        case BACNET_LIGHTS_STEP_OFF:
+            return true;
+        default:
+            break;
+    }
+
+    return false;
+}
 
-    if (priority < BACNET_MAX_PRIORITY) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, priority)) {
-            active = true;
+/**
+ * @brief Add an output to the active transitions, if it is not already
+ *  there, and start the transition timer
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
+ */
+static void Lighting_Output_Transition_Start(
+    uint32_t object_instance, struct object_data *pObject)
+{
+    unsigned new_size;
+    struct object_data **new_object;
+    uint32_t *new_instance;
+
+    if (!Lighting_Output_Operation_Active(
+            pObject->Lighting_Command.operation)) {
+        return;
+    }
+    if (!pObject->Transition_Active) {
+        if (Active_Count >= Active_Size) {
+            new_size = Active_Size ? (Active_Size * 2) : 8;
+            new_object =
+                realloc(Active_Object, new_size * sizeof(*Active_Object));
+            if (!new_object) {
+                return;
+            }
+            Active_Object = new_object;
+            new_instance =
+                realloc(Active_Instance, new_size * sizeof(*Active_Instance));
+            if (!new_instance) {
+                return;
+            }
+            Active_Instance = new_instance;
+            Active_Size = new_size;
         }
+        Active_Object[Active_Count] = pObject;
+        Active_Instance[Active_Count] = object_instance;
+        Active_Count++;
+        pObject->Transition_Active = true;
+    }
+    if (!tmwheel_timer_pending(&Transition_Timer)) {
+        tmwheel_timer_set(
+            &Transition_Timer, LIGHTING_OUTPUT_TRANSITION_MILLISECONDS);
     }
+}
+
+/**
+ * @brief Remove an output from the active transitions
+ * @param pObject - object data
+ */
+static void Lighting_Output_Transition_Remove(struct object_data *pObject)
+{
+    unsigned i;
 
-    return active;
+    if (!pObject->Transition_Active) {
+        return;
+    }
+    for (i = 0; i < Active_Count; i++) {
+        if (Active_Object[i] == pObject) {
+            Active_Count--;
+            for (; i < Active_Count; i++) {
+                Active_Object[i] = Active_Object[i + 1];
+                Active_Instance[i] = Active_Instance[i + 1];
+            }
+            break;
+        }
+    }
+    pObject->Transition_Active = false;
 }
 
 /**
@@ -272,12 +369,11 @@ static float Priority_Array_Next_Value(
     float real_value = 0.0;
     unsigned p = 0;
 
-    real_value = pObject->Relinquish_Default;
-    for (p = priority; p < BACNET_MAX_PRIORITY; p++) {
-        if (Priority_Array_Active(pObject, p)) {
-            real_value = pObject->Priority_Array[p];
-            break;
-        }
+    p = commandable_next_priority(&pObject->Command, priority);
+    if (p) {
+        real_value = pObject->Priority_Array[p - 1];
+    } else {
+        real_value = pObject->Relinquish_Default;
     }
 
     return real_value;
@@ -295,10 +391,8 @@ Priority_Array_Value(struct object_data *pObject, BACNET_ARRAY_INDEX priority)
 {
     float real_value = 0.0;
 
-    if (priority < BACNET_MAX_PRIORITY) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, priority)) {
-            real_value = pObject->Priority_Array[priority];
-        }
+    if (Priority_Array_Active(pObject, priority)) {
+        real_value = pObject->Priority_Array[priority];
     }
 
     return real_value;
@@ -345,17 +439,7 @@ static int Lighting_Output_Priority_Array_Encode(
  */
 static unsigned Present_Value_Priority(struct object_data *pObject)
 {
-    unsigned p = 0; /* loop counter */
-    unsigned priority = 0; /* return value */
-
-    for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-        if (BIT_CHECK(pObject->Priority_Active_Bits, p)) {
-            priority = p + 1;
-            break;
-        }
-    }
-
-    return priority;
+    return commandable_priority(&pObject->Command);
 }
 
 /**
@@ -374,9 +458,8 @@ Present_Value_Relinquish(struct object_data *pObject, unsigned priority)
 
     if (priority && (priority <= BACNET_MAX_PRIORITY) &&
         (priority != 6 /* reserved */)) {
-        priority--;
-        BIT_CLEAR(pObject->Priority_Active_Bits, priority);
-        pObject->Priority_Array[priority] = 0.0;
+        commandable_relinquish(&pObject->Command, priority);
+        pObject->Priority_Array[priority - 1] = 0.0;
         status = true;
     }
 
@@ -400,9 +483,8 @@ Present_Value_Set(struct object_data *pObject, float value, unsigned priority)
 
     if (priority && (priority <= BACNET_MAX_PRIORITY) &&
         (priority != 6 /* reserved */)) {
-        priority--;
-        BIT_SET(pObject->Priority_Active_Bits, priority);
-        pObject->Priority_Array[priority] = value;
+        pObject->Priority_Array[priority - 1] = value;
+        commandable_command(&pObject->Command, priority);
         status = true;
     }
 
@@ -449,9 +531,8 @@ bool Lighting_Output_Present_Value_Set(
     if (pObject) {
         if (priority && (priority <= BACNET_MAX_PRIORITY) &&
             (priority != 6 /* reserved */)) {
-            priority--;
-            BIT_SET(pObject->Priority_Active_Bits, priority);
-            pObject->Priority_Array[priority] = value;
+            pObject->Priority_Array[priority - 1] = value;
+            commandable_command(&pObject->Command, priority);
             status = true;
         }
     }
@@ -590,6 +671,7 @@ static bool Lighting_Output_Present_Value_Write(
                             BACNET_LIGHTS_FADE_TO;
                     }
                     pObject->Lighting_Command.target_level = value;
+                    Lighting_Output_Transition_Start(object_instance, pObject);
                 }
                 status = true;
             } else {
@@ -690,6 +772,7 @@ static bool Lighting_Output_Present_Value_Relinquish_Write(
                     pObject->Lighting_Command.operation = BACNET_LIGHTS_FADE_TO;
                 }
                 pObject->Lighting_Command.target_level = value;
+                Lighting_Output_Transition_Start(object_instance, pObject);
             }
             status = true;
         } else {
@@ -823,7 +906,10 @@ bool Lighting_Output_Lighting_Command_Set(
     if (pObject) {
         /* FIXME: check lighting command member values */
         status = lighting_command_copy(&pObject->Lighting_Command, value);
-        /* FIXME: set all the other values, and get the light levels moving */
+        /* FIXME: set all the other values */
+        if (status) {
+            Lighting_Output_Transition_Start(object_instance, pObject);
+        }
     }
 
     return status;
@@ -2019,22 +2105,20 @@ bool Lighting_Output_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
 /**
  * Handles the timing for a single Lighting Output object Fade
  *
- * @param pLight - Lighting Output object
- * @param pCommand - BACNET_LIGHTING_COMMAND of the Lighting Output object
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
  * @param milliseconds - number of milliseconds elapsed since previously
  * called.  Works best when called about every 10 milliseconds.
+ * @param fraction - milliseconds divided by the remaining fade time,
+ *  which is shared by outputs that were started together
  */
-static void
-Lighting_Output_Fade_Handler(uint32_t object_instance, uint16_t milliseconds)
+static void Lighting_Output_Fade_Handler(uint32_t object_instance,
+    struct object_data *pObject,
+    uint16_t milliseconds,
+    float fraction)
 {
-    struct object_data *pObject;
     float old_value;
-    float x1, x2, x3, y1, y3;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = pObject->Tracking_Value;
     if (milliseconds >= pObject->Lighting_Command.fade_time) {
         /* stop fading */
@@ -2053,12 +2137,9 @@ Lighting_Output_Fade_Handler(uint32_t object_instance, uint16_t milliseconds)
             pObject->Lighting_Command.fade_time = 0;
         } else {
             /* fading */
-            x1 = 0.0f;
-            x2 = (float)milliseconds;
-            x3 = (float)pObject->Lighting_Command.fade_time;
-            y1 = old_value;
-            y3 = pObject->Lighting_Command.target_level;
-            pObject->Tracking_Value = linear_interpolate(x1, x2, x3, y1, y3);
+            pObject->Tracking_Value = old_value +
+                (fraction *
+                 (pObject->Lighting_Command.target_level - old_value));
             pObject->Lighting_Command.fade_time -= milliseconds;
             pObject->In_Progress = BACNET_LIGHTING_FADE_ACTIVE;
         }
@@ -2084,16 +2165,13 @@ Lighting_Output_Fade_Handler(uint32_t object_instance, uint16_t milliseconds)
  * @param  object_instance - object-instance number of the object
  * @param milliseconds - number of milliseconds elapsed
  */
-static void
-Lighting_Output_Ramp_Handler(uint32_t object_instance, uint16_t milliseconds)
+static void Lighting_Output_Ramp_Handler(
+    uint32_t object_instance,
+    struct object_data *pObject,
+    uint16_t milliseconds)
 {
     float old_value, target_value, min_value, max_value, step_value, steps;
-    struct object_data *pObject;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = pObject->Tracking_Value;
     min_value = pObject->Min_Actual_Value;
     max_value = pObject->Max_Actual_Value;
@@ -2157,15 +2235,11 @@ Lighting_Output_Ramp_Handler(uint32_t object_instance, uint16_t milliseconds)
  *
  * @param  object_instance - object-instance number of the object
  */
-static void Lighting_Output_Step_Up_Handler(uint32_t object_instance)
+static void Lighting_Output_Step_Up_Handler(
+    uint32_t object_instance, struct object_data *pObject)
 {
     float old_value, target_value, min_value, max_value, step_value;
-    struct object_data *pObject;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = pObject->Tracking_Value;
     min_value = pObject->Min_Actual_Value;
     max_value = pObject->Max_Actual_Value;
@@ -2200,15 +2274,11 @@ static void Lighting_Output_Step_Up_Handler(uint32_t object_instance)
  *
  * @param  object_instance - object-instance number of the object
  */
-static void Lighting_Output_Step_Down_Handler(uint32_t object_instance)
+static void Lighting_Output_Step_Down_Handler(
+    uint32_t object_instance, struct object_data *pObject)
 {
     float old_value, target_value, min_value, max_value, step_value;
-    struct object_data *pObject;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = target_value = pObject->Tracking_Value;
     min_value = pObject->Min_Actual_Value;
     max_value = pObject->Max_Actual_Value;
@@ -2244,15 +2314,11 @@ static void Lighting_Output_Step_Down_Handler(uint32_t object_instance)
  *
  * @param  object_instance - object-instance number of the object
  */
-static void Lighting_Output_Step_On_Handler(uint32_t object_instance)
+static void Lighting_Output_Step_On_Handler(
+    uint32_t object_instance, struct object_data *pObject)
 {
     float old_value, target_value, min_value, max_value, step_value;
-    struct object_data *pObject;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = target_value = pObject->Tracking_Value;
     min_value = pObject->Min_Actual_Value;
     max_value = pObject->Max_Actual_Value;
@@ -2284,15 +2350,11 @@ static void Lighting_Output_Step_On_Handler(uint32_t object_instance)
  *
  * @param  object_instance - object-instance number of the object
  */
-static void Lighting_Output_Step_Off_Handler(uint32_t object_instance)
+static void Lighting_Output_Step_Off_Handler(
+    uint32_t object_instance, struct object_data *pObject)
 {
     float old_value, target_value, min_value, max_value, step_value;
-    struct object_data *pObject;
 
-    pObject = Keylist_Data(Object_List, object_instance);
-    if (!pObject) {
-        return;
-    }
     old_value = target_value = pObject->Tracking_Value;
     min_value = pObject->Min_Actual_Value;
     max_value = pObject->Max_Actual_Value;
@@ -2320,11 +2382,67 @@ static void Lighting_Output_Step_Off_Handler(uint32_t object_instance)
     }
 }
 
+/**
+ * @brief Advances one output by its fade, ramp, or step operation
+ * @param object_instance - object-instance number of the object
+ * @param pObject - object data
+ * @param milliseconds - number of milliseconds elapsed since previously
+ * called.
+ */
+static void Lighting_Output_Transition_Step(
+    uint32_t object_instance,
+    struct object_data *pObject,
+    uint16_t milliseconds)
+{
+    switch (pObject->Lighting_Command.operation) {
+        case BACNET_LIGHTS_NONE:
+            pObject->In_Progress = BACNET_LIGHTING_IDLE;
+            break;
+        case BACNET_LIGHTS_FADE_TO:
+            Lighting_Output_Fade_Handler(
+                object_instance, pObject, milliseconds,
+                (pObject->Lighting_Command.fade_time > 0)
+                    ? ((float)milliseconds /
+                       (float)pObject->Lighting_Command.fade_time)
+                    : 1.0f);
+            break;
+        case BACNET_LIGHTS_RAMP_TO:
+            Lighting_Output_Ramp_Handler(
+                object_instance, pObject, milliseconds);
+            break;
+        case BACNET_LIGHTS_STEP_UP:
+            Lighting_Output_Step_Up_Handler(object_instance, pObject);
+            break;
+        case BACNET_LIGHTS_STEP_DOWN:
+            Lighting_Output_Step_Down_Handler(object_instance, pObject);
+            break;
+        case BACNET_LIGHTS_STEP_ON:
+            Lighting_Output_Step_On_Handler(object_instance, pObject);
+            break;
+        case BACNET_LIGHTS_STEP_OFF:
+            Lighting_Output_Step_Off_Handler(object_instance, pObject);
+            break;
+        case BACNET_LIGHTS_WARN:
+            break;
+        case BACNET_LIGHTS_WARN_OFF:
+            break;
+        case BACNET_LIGHTS_WARN_RELINQUISH:
+            break;
+        case BACNET_LIGHTS_STOP:
+            pObject->In_Progress = BACNET_LIGHTING_IDLE;
+            break;
+        default:
+            break;
+    }
+}
+
 /**
  * @brief Updates the lighting object tracking value per ramp or fade or step
  * @param  object_instance - object-instance number of the object
  * @param milliseconds - number of milliseconds elapsed since previously
  * called.  Suggest that this is called every 10 milliseconds.
+ * @note Outputs that are commanded through this module are advanced by
+ *  Lighting_Output_Active_Timer() and do not need this function.
  */
 void Lighting_Output_Timer(uint32_t object_instance, uint16_t milliseconds)
 {
@@ -2332,41 +2450,89 @@ void Lighting_Output_Timer(uint32_t object_instance, uint16_t milliseconds)
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        switch (pObject->Lighting_Command.operation) {
-            case BACNET_LIGHTS_NONE:
-                pObject->In_Progress = BACNET_LIGHTING_IDLE;
-                break;
-            case BACNET_LIGHTS_FADE_TO:
-                Lighting_Output_Fade_Handler(object_instance, milliseconds);
-                break;
-            case BACNET_LIGHTS_RAMP_TO:
-                Lighting_Output_Ramp_Handler(object_instance, milliseconds);
-                break;
-            case BACNET_LIGHTS_STEP_UP:
-                Lighting_Output_Step_Up_Handler(object_instance);
-                break;
-            case BACNET_LIGHTS_STEP_DOWN:
-                Lighting_Output_Step_Down_Handler(object_instance);
-                break;
-            case BACNET_LIGHTS_STEP_ON:
-                Lighting_Output_Step_On_Handler(object_instance);
-                break;
-            case BACNET_LIGHTS_STEP_OFF:
-                Lighting_Output_Step_Off_Handler(object_instance);
-                break;
-            case BACNET_LIGHTS_WARN:
-                break;
-            case BACNET_LIGHTS_WARN_OFF:
-                break;
-            case BACNET_LIGHTS_WARN_RELINQUISH:
-                break;
-            case BACNET_LIGHTS_STOP:
-                pObject->In_Progress = BACNET_LIGHTING_IDLE;
-                break;
-            default:
-                break;
+        Lighting_Output_Transition_Step(object_instance, pObject, milliseconds);
+    }
+}
+
+/**
+ * @brief Advances only the outputs with a fade, ramp, or step in
+ *  progress, so the cost follows the number of active transitions
+ *  rather than the number of objects.  Outputs that were started together
+ *  with the same fade time, such as by one Channel write, share the
+ *  fade computation.
+ * @param milliseconds - number of milliseconds elapsed since previously
+ *  called
+ */
+void Lighting_Output_Active_Timer(uint16_t milliseconds)
+{
+    struct object_data *pObject;
+    uint32_t object_instance;
+    uint32_t fade_time = 0;
+    float fraction = 1.0f;
+    bool fade_valid = false;
+    unsigned count = 0, started, i;
+
+    started = Active_Count;
+    for (i = 0; i < started; i++) {
+        pObject = Active_Object[i];
+        object_instance = Active_Instance[i];
+        if (pObject->Lighting_Command.operation == BACNET_LIGHTS_FADE_TO) {
+            if (!fade_valid ||
+                (fade_time != pObject->Lighting_Command.fade_time)) {
+                fade_time = pObject->Lighting_Command.fade_time;
+                if (fade_time > 0) {
+                    fraction = (float)milliseconds / (float)fade_time;
+                } else {
+                    fraction = 1.0f;
+                }
+                fade_valid = true;
+            }
+            Lighting_Output_Fade_Handler(
+                object_instance, pObject, milliseconds, fraction);
+        } else {
+            Lighting_Output_Transition_Step(
+                object_instance, pObject, milliseconds);
+        }
+        if (Lighting_Output_Operation_Active(
+                pObject->Lighting_Command.operation)) {
+            Active_Object[count] = pObject;
+            Active_Instance[count] = object_instance;
+            count++;
+        } else {
+            pObject->Transition_Active = false;
         }
     }
+    /* keep any outputs started by a callback during the pass */
+    for (i = started; i < Active_Count; i++) {
+        Active_Object[count] = Active_Object[i];
+        Active_Instance[count] = Active_Instance[i];
+        count++;
+    }
+    Active_Count = count;
+}
+
+/**
+ * @brief Gets the number of outputs with a fade, ramp, or step in progress
+ * @return number of active outputs
+ */
+unsigned Lighting_Output_Active_Count(void)
+{
+    return Active_Count;
+}
+
+/**
+ * @brief Transition timer callback
+ * @param timer - the transition timer
+ * @param context - not used
+ */
+static void Lighting_Output_Transition_Timer_Handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    (void)context;
+    Lighting_Output_Active_Timer((uint16_t)tmwheel_timer_interval(timer));
+    if (Active_Count > 0) {
+        tmwheel_timer_reset(timer);
+    }
 }
 
 /**
@@ -2427,9 +2593,9 @@ uint32_t Lighting_Output_Create(uint32_t object_instance)
         pObject->Default_Step_Increment = 1.0;
         pObject->Transition = BACNET_LIGHTING_TRANSITION_FADE;
         pObject->Feedback_Value = 0.0;
+        commandable_init(&pObject->Command);
         for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
             pObject->Priority_Array[p] = 0.0;
-            BIT_CLEAR(pObject->Priority_Active_Bits, p);
         }
         pObject->Relinquish_Default = 0.0;
         pObject->Power = 0.0;
@@ -2465,6 +2631,7 @@ bool Lighting_Output_Delete(uint32_t object_instance)
 
     pObject = Keylist_Data_Delete(Object_List, object_instance);
     if (pObject) {
+        Lighting_Output_Transition_Remove(pObject);
         free(pObject);
         status = true;
     }
@@ -2489,6 +2656,13 @@ void Lighting_Output_Cleanup(void)
         Keylist_Delete(Object_List);
         Object_List = NULL;
     }
+    tmwheel_timer_cancel(&Transition_Timer);
+    free(Active_Object);
+    Active_Object = NULL;
+    free(Active_Instance);
+    Active_Instance = NULL;
+    Active_Count = 0;
+    Active_Size = 0;
 }
 
 /**
@@ -2498,5 +2672,7 @@ void Lighting_Output_Init(void)
 {
     if (!Object_List) {
         Object_List = Keylist_Create();
+        tmwheel_timer_init(
+            &Transition_Timer, Lighting_Output_Transition_Timer_Handler, NULL);
     }
 }
@@ -64,6 +64,7 @@ static const int Life_Safety_Zone_Properties_Required[] = {
 static const int Life_Safety_Zone_Properties_Optional[] = { -1 };
 
 static const int Life_Safety_Zone_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * Returns the list of required, optional, and proprietary properties.
@@ -806,11 +807,12 @@ bool Life_Safety_Zone_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             status = Life_Safety_Zone_Members_Write(wp_data);
             break;
         default:
-            if (property_lists_member(
-                Life_Safety_Zone_Properties_Required,
-                Life_Safety_Zone_Properties_Optional,
-                Life_Safety_Zone_Properties_Proprietary,
-                wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap,
+                    Life_Safety_Zone_Properties_Required,
+                    Life_Safety_Zone_Properties_Optional,
+                    Life_Safety_Zone_Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
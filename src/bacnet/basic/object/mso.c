@@ -50,6 +50,7 @@
 #include "bacnet/rp.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/commandable.h"
 #include "bacnet/basic/sys/keylist.h"
 /* me! */
 #include "mso.h"
@@ -57,7 +58,9 @@
 struct object_data {
     bool Out_Of_Service : 1;
     bool Changed : 1;
-    bool Relinquished[BACNET_MAX_PRIORITY];
+    bool Write_Pending : 1;
+    uint32_t Write_Old_Value;
+    struct commandable Command;
     uint8_t Priority_Array[BACNET_MAX_PRIORITY];
     uint8_t Relinquish_Default;
     uint8_t Reliability;
@@ -73,6 +76,9 @@ static const BACNET_OBJECT_TYPE Object_Type = OBJECT_MULTI_STATE_OUTPUT;
 /* callback for present value writes */
 static multistate_output_write_present_value_callback
     Multistate_Output_Write_Present_Value_Callback;
+/* present value write callbacks are held until the end of a batch */
+static bool Write_Present_Value_Deferred;
+static unsigned Write_Present_Value_Pending;
 /* default state text when none is specified */
 static const char *Default_State_Text = "State 1\0" "State 2\0" "State 3\0" ;
 /* These three arrays are used by the ReadPropertyMultiple handler */
@@ -89,6 +95,7 @@ static const int Properties_Optional[] = { PROP_STATE_TEXT, PROP_DESCRIPTION,
     -1 };
 
 static const int Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /**
  * @brief Returns the list of required, optional, and proprietary properties.
@@ -245,15 +252,14 @@ uint32_t Multistate_Output_Max_States(uint32_t object_instance)
 static uint32_t Object_Present_Value(struct object_data *pObject)
 {
     uint32_t value = 1;
-    uint8_t priority = 0; /* loop counter */
+    unsigned priority = 0;
 
     if (pObject) {
-        value = pObject->Relinquish_Default;
-        for (priority = 0; priority < BACNET_MAX_PRIORITY; priority++) {
-            if (!pObject->Relinquished[priority]) {
-                value = pObject->Priority_Array[priority];
-                break;
-            }
+        priority = commandable_priority(&pObject->Command);
+        if (priority) {
+            value = pObject->Priority_Array[priority - 1];
+        } else {
+            value = pObject->Relinquish_Default;
         }
     }
 
@@ -295,7 +301,7 @@ static int Multistate_Output_Priority_Array_Encode(
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject && (priority < BACNET_MAX_PRIORITY)) {
-        if (pObject->Relinquished[priority]) {
+        if (!commandable_active(&pObject->Command, priority + 1)) {
             apdu_len = encode_application_null(apdu);
         } else {
             value = pObject->Priority_Array[priority];
@@ -313,18 +319,12 @@ static int Multistate_Output_Priority_Array_Encode(
  */
 unsigned Multistate_Output_Present_Value_Priority(uint32_t object_instance)
 {
-    unsigned p = 0; /* loop counter */
     unsigned priority = 0; /* return value */
     struct object_data *pObject;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
-        for (p = 0; p < BACNET_MAX_PRIORITY; p++) {
-            if (!pObject->Relinquished[p]) {
-                priority = p + 1;
-                break;
-            }
-        }
+        priority = commandable_priority(&pObject->Command);
     }
 
     return priority;
@@ -392,8 +392,8 @@ bool Multistate_Output_Present_Value_Set(
         if ((value >= 1) && (value <= max_states) &&
             (priority >= 1) && (priority <= BACNET_MAX_PRIORITY)) {
             old_value = Object_Present_Value(pObject);
-            pObject->Relinquished[priority - 1] = false;
             pObject->Priority_Array[priority - 1] = value;
+            commandable_command(&pObject->Command, priority);
             new_value = Object_Present_Value(pObject);
             if (old_value != new_value) {
                 pObject->Changed = true;
@@ -423,8 +423,8 @@ bool Multistate_Output_Present_Value_Relinquish(
     if (pObject) {
         if ((priority >= 1) && (priority <= BACNET_MAX_PRIORITY)) {
             old_value = Object_Present_Value(pObject);
-            pObject->Relinquished[priority - 1] = true;
             pObject->Priority_Array[priority - 1] = 0;
+            commandable_relinquish(&pObject->Command, priority);
             new_value = Object_Present_Value(pObject);
             if (old_value != new_value) {
                 pObject->Changed = true;
@@ -436,6 +436,29 @@ bool Multistate_Output_Present_Value_Relinquish(
     return status;
 }
 
+/**
+ * @brief Calls the present value write callback, or holds the value from
+ *  before the first write of a batch until the callbacks are no longer
+ *  deferred
+ * @param  object_instance - object-instance number of the object
+ * @param  pObject - object data
+ * @param  old_value - present value before the write
+ */
+static void Multistate_Output_Write_Present_Value_Notify(
+    uint32_t object_instance, struct object_data *pObject, uint32_t old_value)
+{
+    if (Write_Present_Value_Deferred) {
+        if (!pObject->Write_Pending) {
+            pObject->Write_Pending = true;
+            pObject->Write_Old_Value = old_value;
+            Write_Present_Value_Pending++;
+        }
+    } else {
+        Multistate_Output_Write_Present_Value_Callback(
+            object_instance, old_value, Object_Present_Value(pObject));
+    }
+}
+
 /**
  * @brief For a given object instance-number, writes the present-value to the
  *  remote node
@@ -454,7 +477,6 @@ static bool Multistate_Output_Present_Value_Write(
     bool status = false;
     struct object_data *pObject;
     uint32_t old_value = 0;
-    uint32_t new_value = 0;
     unsigned max_states = 0;
 
     pObject = Keylist_Data(Object_List, object_instance);
@@ -473,9 +495,8 @@ static bool Multistate_Output_Present_Value_Write(
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Multistate_Output_Write_Present_Value_Callback) {
-                    new_value = Object_Present_Value(pObject);
-                    Multistate_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Multistate_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -511,7 +532,6 @@ static bool Multistate_Output_Present_Value_Relinquish_Write(
     bool status = false;
     struct object_data *pObject;
     uint32_t old_value = 0;
-    uint32_t new_value = 0;
 
     pObject = Keylist_Data(Object_List, object_instance);
     if (pObject) {
@@ -527,9 +547,8 @@ static bool Multistate_Output_Present_Value_Relinquish_Write(
                         physical output when the value of Out_Of_Service
                         is true. */
                 } else if (Multistate_Output_Write_Present_Value_Callback) {
-                    new_value = Object_Present_Value(pObject);
-                    Multistate_Output_Write_Present_Value_Callback(
-                        object_instance, old_value, new_value);
+                    Multistate_Output_Write_Present_Value_Notify(
+                        object_instance, pObject, old_value);
                 }
                 status = true;
             } else {
@@ -1101,11 +1120,10 @@ bool Multistate_Output_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                Properties_Required, 
-                Properties_Optional, 
-                Properties_Proprietary, 
-                wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Properties_Required,
+                    Properties_Optional, Properties_Proprietary,
+                    wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -1128,6 +1146,41 @@ void Multistate_Output_Write_Present_Value_Callback_Set(
     Multistate_Output_Write_Present_Value_Callback = cb;
 }
 
+/**
+ * @brief Defers the present value write callback, so that a batch of
+ *  writes calls it once for each object that was written, with the
+ *  present value from before the first write
+ * @param defer - true to defer, false to call the deferred callbacks
+ */
+void Multistate_Output_Write_Present_Value_Defer(bool defer)
+{
+    struct object_data *pObject;
+    uint32_t object_instance = 0;
+    uint32_t old_value;
+    int count, index;
+
+    Write_Present_Value_Deferred = defer;
+    if (defer) {
+        return;
+    }
+    count = Keylist_Count(Object_List);
+    for (index = 0; (index < count) && Write_Present_Value_Pending; index++) {
+        pObject = Keylist_Data_Index(Object_List, index);
+        if (pObject && pObject->Write_Pending) {
+            pObject->Write_Pending = false;
+            Write_Present_Value_Pending--;
+            old_value = pObject->Write_Old_Value;
+            if (Multistate_Output_Write_Present_Value_Callback &&
+                !pObject->Out_Of_Service &&
+                Keylist_Index_Key(Object_List, index, &object_instance)) {
+                Multistate_Output_Write_Present_Value_Callback(
+                    object_instance, old_value, Object_Present_Value(pObject));
+            }
+        }
+    }
+    Write_Present_Value_Pending = 0;
+}
+
 /**
  * @brief Creates a new object and adds it to the object list
  * @param  object_instance - object-instance number of the object
@@ -1158,8 +1211,8 @@ uint32_t Multistate_Output_Create(uint32_t object_instance)
             pObject->Out_Of_Service = false;
             pObject->Reliability = RELIABILITY_NO_FAULT_DETECTED;
             pObject->Changed = false;
+            commandable_init(&pObject->Command);
             for (priority = 0; priority < BACNET_MAX_PRIORITY; priority++) {
-                pObject->Relinquished[priority] = true;
                 pObject->Priority_Array[priority] = 0;
             }
             pObject->Relinquish_Default = 1;
@@ -110,6 +110,9 @@ extern "C" {
     BACNET_STACK_EXPORT
     void Multistate_Output_Write_Present_Value_Callback_Set(
         multistate_output_write_present_value_callback cb);
+    BACNET_STACK_EXPORT
+    void Multistate_Output_Write_Present_Value_Defer(
+        bool defer);
 
     BACNET_STACK_EXPORT
     bool Multistate_Output_Change_Of_Value(
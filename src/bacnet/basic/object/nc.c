@@ -39,13 +39,16 @@
 #include "bacnet/bacapp.h"
 #include "bacnet/bacdest.h"
 #include "bacnet/datetime.h"
+#include "bacnet/dcc.h"
 #include "bacnet/event.h"
+#include "bacnet/npdu.h"
 #include "bacnet/wp.h"
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/object/nc.h"
 #include "bacnet/basic/binding/address.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/sys/debug.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/datalink/datalink.h"
 
@@ -58,7 +61,36 @@
 #if defined(INTRINSIC_REPORTING)
 static NOTIFICATION_CLASS_INFO NC_Info[MAX_NOTIFICATION_CLASSES];
 /* buffer for sending event messages */
-static uint8_t Event_Buffer[MAX_APDU];
+static uint8_t Event_Buffer[MAX_PDU];
+
+/* a recipient of a queued event */
+typedef struct NC_Event_Recipient {
+    BACNET_RECIPIENT Recipient;
+    uint32_t Process_Identifier;
+    BACNET_ADDRESS Dest; /* where the confirmed notification was sent */
+    uint8_t Invoke_ID; /* confirmed notification awaiting acknowledgment */
+    uint8_t Retries;
+    bool Confirmed : 1;
+    bool Pending : 1; /* true until the recipient was sent the event */
+} NC_EVENT_RECIPIENT;
+
+/* an event encoded once, with the recipients it is sent to */
+typedef struct NC_Event {
+    uint8_t Service[MAX_APDU];
+    uint16_t Service_Len;
+    uint16_t Service_Offset; /* the service after the Process Identifier */
+    uint8_t Recipient_Count;
+    NC_EVENT_RECIPIENT Recipient[NC_MAX_RECIPIENTS];
+} NC_EVENT;
+
+/* queue of events waiting to be sent to their recipients */
+static NC_EVENT NC_Event[NC_EVENT_OUTBOX_SIZE];
+static unsigned NC_Event_Head;
+static unsigned NC_Event_Count;
+/* told by the TSM when a confirmed notification ends */
+static BACNET_TSM_COMPLETE_NOTIFICATION NC_TSM_Complete;
+/* armed only while queued notifications can be sent */
+static struct tmwheel_timer NC_Event_Timer;
 
 /* These three arrays are used by the ReadPropertyMultiple handler */
 static const int Notification_Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
@@ -81,6 +113,63 @@ void Notification_Class_Property_Lists(
     return;
 }
 
+/**
+ * @brief Handle the end of a confirmed notification.  The recipient is
+ *  found by both the invoke ID and the address of the request, before
+ *  the TSM frees the invoke ID, so that it is not confused with another
+ *  request that is given the invoke ID later.
+ * @param dest - address the request was sent to
+ * @param invoke_id - invoke ID of the request
+ * @param status - how the request ended
+ */
+static void nc_event_transaction_complete(BACNET_ADDRESS *dest,
+    uint8_t invoke_id,
+    BACNET_TSM_TRANSACTION_STATUS status)
+{
+    NC_EVENT_RECIPIENT *recipient;
+    NC_EVENT *event;
+    unsigned i, j;
+
+    for (i = 0; i < NC_Event_Count; i++) {
+        event = &NC_Event[(NC_Event_Head + i) % NC_EVENT_OUTBOX_SIZE];
+        for (j = 0; j < event->Recipient_Count; j++) {
+            recipient = &event->Recipient[j];
+            if ((recipient->Invoke_ID != invoke_id) ||
+                !bacnet_address_same(&recipient->Dest, dest)) {
+                continue;
+            }
+            recipient->Invoke_ID = 0;
+            if (status == TSM_TRANSACTION_TIMEOUT) {
+                /* a failed request keeps its invoke ID until freed */
+                tsm_free_invoke_id(invoke_id);
+                if (recipient->Retries >= NC_EVENT_RETRIES) {
+                    recipient->Pending = false;
+                } else {
+                    recipient->Retries++;
+                }
+            } else {
+                /* acknowledged, or answered with an error */
+                recipient->Pending = false;
+            }
+            /* send again, or free the event, outside of the TSM */
+            tmwheel_timer_set(&NC_Event_Timer, 0);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Send the queued event notifications when the outbox timer fires
+ * @param timer - timer that expired
+ * @param context - not used
+ */
+static void nc_event_timer_handler(struct tmwheel_timer *timer, void *context)
+{
+    (void)timer;
+    (void)context;
+    Notification_Class_Event_Outbox_Task();
+}
+
 void Notification_Class_Init(void)
 {
     uint8_t NotifyIdx = 0;
@@ -102,6 +191,12 @@ void Notification_Class_Init(void)
             bacnet_destination_default_init(destination);
         }
     }
+    NC_Event_Head = 0;
+    NC_Event_Count = 0;
+    NC_TSM_Complete.callback = nc_event_transaction_complete;
+    tsm_complete_notification_add(&NC_TSM_Complete);
+    tmwheel_timer_cancel(&NC_Event_Timer);
+    tmwheel_timer_init(&NC_Event_Timer, nc_event_timer_handler, NULL);
 
     return;
 }
@@ -615,15 +710,416 @@ static bool IsRecipientActive(
     return true;
 }
 
+/**
+ * @brief Find the address of a notification recipient
+ * @param recipient - device or address of the recipient
+ * @param dest [out] address of the recipient
+ * @param max_apdu [out] largest APDU the recipient accepts
+ * @return true if the address is known
+ */
+static bool nc_event_recipient_address(
+    BACNET_RECIPIENT *recipient, BACNET_ADDRESS *dest, unsigned *max_apdu)
+{
+    if (recipient->tag == BACNET_RECIPIENT_TAG_DEVICE) {
+        return address_get_by_device(
+            recipient->type.device.instance, max_apdu, dest);
+    } else if (recipient->tag == BACNET_RECIPIENT_TAG_ADDRESS) {
+        bacnet_address_copy(dest, &recipient->type.address);
+        *max_apdu = MAX_APDU;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Determine if an address is a broadcast
+ * @param dest - address
+ * @return true if the address is a local, remote, or global broadcast
+ */
+static bool nc_event_address_broadcast(BACNET_ADDRESS *dest)
+{
+    if (dest->net == BACNET_BROADCAST_NETWORK) {
+        return true;
+    }
+    if (dest->net) {
+        return dest->len == 0;
+    }
+
+    return dest->mac_len == 0;
+}
+
+/**
+ * @brief Determine if a broadcast reaches an address
+ * @param broadcast - broadcast address
+ * @param dest - address
+ * @return true if the broadcast reaches the address
+ */
+static bool nc_event_address_reached(
+    BACNET_ADDRESS *broadcast, BACNET_ADDRESS *dest)
+{
+    if (bacnet_address_same(broadcast, dest)) {
+        return true;
+    }
+    if (!nc_event_address_broadcast(broadcast)) {
+        return false;
+    }
+    if (broadcast->net == BACNET_BROADCAST_NETWORK) {
+        return true;
+    }
+
+    return broadcast->net == dest->net;
+}
+
+/**
+ * @brief Encode the event notification to one recipient. The service
+ *  request was encoded once, and only the Process Identifier differs.
+ * @param pdu - buffer for the PDU, or NULL for the length
+ * @param dest - address of the recipient
+ * @param npdu_data [out] network layer information
+ * @param event - queued event
+ * @param recipient - recipient of the notification
+ * @param invoke_id - invoke ID of a confirmed notification
+ * @return number of bytes encoded
+ */
+static int nc_event_pdu_encode(uint8_t *pdu,
+    BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    NC_EVENT *event,
+    NC_EVENT_RECIPIENT *recipient,
+    uint8_t invoke_id)
+{
+    BACNET_ADDRESS my_address;
+    int pdu_len = 0;
+    int len;
+
+    datalink_get_my_address(&my_address);
+    npdu_encode_npdu_data(
+        npdu_data, recipient->Confirmed, MESSAGE_PRIORITY_NORMAL);
+    pdu_len = npdu_encode_pdu(pdu, dest, &my_address, npdu_data);
+    if (recipient->Confirmed) {
+        if (pdu) {
+            pdu[pdu_len] = PDU_TYPE_CONFIRMED_SERVICE_REQUEST;
+            pdu[pdu_len + 1] = encode_max_segs_max_apdu(0, MAX_APDU);
+            pdu[pdu_len + 2] = invoke_id;
+            pdu[pdu_len + 3] = SERVICE_CONFIRMED_EVENT_NOTIFICATION;
+        }
+        pdu_len += 4;
+    } else {
+        if (pdu) {
+            pdu[pdu_len] = PDU_TYPE_UNCONFIRMED_SERVICE_REQUEST;
+            pdu[pdu_len + 1] = SERVICE_UNCONFIRMED_EVENT_NOTIFICATION;
+        }
+        pdu_len += 2;
+    }
+    len = encode_context_unsigned(
+        pdu ? &pdu[pdu_len] : NULL, 0, recipient->Process_Identifier);
+    pdu_len += len;
+    len = event->Service_Len - event->Service_Offset;
+    if (pdu) {
+        memcpy(&pdu[pdu_len], &event->Service[event->Service_Offset], len);
+    }
+    pdu_len += len;
+
+    return pdu_len;
+}
+
+/**
+ * @brief Mark the unconfirmed recipients that a notification reached
+ * @param event - queued event
+ * @param recipient - recipient that was sent the notification
+ * @param dest - address the notification was sent to
+ */
+static void nc_event_unconfirmed_reached(
+    NC_EVENT *event, NC_EVENT_RECIPIENT *recipient, BACNET_ADDRESS *dest)
+{
+    NC_EVENT_RECIPIENT *other;
+    BACNET_ADDRESS other_dest;
+    unsigned max_apdu;
+    unsigned i;
+
+    for (i = 0; i < event->Recipient_Count; i++) {
+        other = &event->Recipient[i];
+        if (!other->Pending || other->Confirmed ||
+            (other->Process_Identifier != recipient->Process_Identifier)) {
+            continue;
+        }
+        if (nc_event_recipient_address(
+                &other->Recipient, &other_dest, &max_apdu) &&
+            nc_event_address_reached(dest, &other_dest)) {
+            other->Pending = false;
+        }
+    }
+}
+
+/**
+ * @brief Find where to send the notification to an unconfirmed recipient.
+ *  The recipients with the same Process Identifier that a broadcast in
+ *  the recipient list reaches are sent that broadcast instead, and many
+ *  recipients on one network can be sent one broadcast.
+ * @param event - queued event
+ * @param recipient - unconfirmed recipient
+ * @param dest [in,out] address of the recipient, or the broadcast
+ */
+static void nc_event_unconfirmed_address(
+    NC_EVENT *event, NC_EVENT_RECIPIENT *recipient, BACNET_ADDRESS *dest)
+{
+    NC_EVENT_RECIPIENT *other;
+    BACNET_ADDRESS other_dest;
+    unsigned max_apdu;
+    unsigned i, count = 0;
+
+    for (i = 0; i < event->Recipient_Count; i++) {
+        other = &event->Recipient[i];
+        if (!other->Pending || other->Confirmed ||
+            (other->Process_Identifier != recipient->Process_Identifier) ||
+            !nc_event_recipient_address(
+                &other->Recipient, &other_dest, &max_apdu)) {
+            continue;
+        }
+        if (nc_event_address_broadcast(&other_dest) &&
+            nc_event_address_reached(&other_dest, dest)) {
+            bacnet_address_copy(dest, &other_dest);
+            return;
+        }
+        if (other_dest.net == dest->net) {
+            count++;
+        }
+    }
+#if (NC_EVENT_BROADCAST_MIN > 0)
+    if ((count >= NC_EVENT_BROADCAST_MIN) &&
+        (dest->net != BACNET_BROADCAST_NETWORK)) {
+        if (dest->net) {
+            dest->mac_len = 0;
+            dest->len = 0;
+        } else {
+            datalink_get_broadcast_address(dest);
+        }
+    }
+#else
+    (void)count;
+#endif
+}
+
+/**
+ * @brief Send the notification to a recipient, unless the confirmed
+ *  notification that was sent is awaiting its reply
+ * @param event - queued event
+ * @param recipient - recipient of the notification
+ * @return true if a notification was sent
+ */
+static bool nc_event_recipient_send(
+    NC_EVENT *event, NC_EVENT_RECIPIENT *recipient)
+{
+    BACNET_NPDU_DATA npdu_data;
+    BACNET_ADDRESS dest;
+    unsigned max_apdu = 0;
+    uint8_t *pdu = NULL;
+    uint8_t invoke_id = 0;
+    int pdu_len;
+
+    if (recipient->Invoke_ID) {
+        /* awaiting nc_event_transaction_complete() */
+        return false;
+    }
+    if (!nc_event_recipient_address(&recipient->Recipient, &dest, &max_apdu)) {
+        /* unbound devices are found by Notification_Class_find_recipient */
+        recipient->Pending = false;
+        return false;
+    }
+    if (recipient->Confirmed) {
+        invoke_id = tsm_next_free_invokeID();
+        if (!invoke_id) {
+            /* send when a transaction is available */
+            return false;
+        }
+        pdu_len =
+            nc_event_pdu_encode(NULL, &dest, &npdu_data, event, recipient, 0);
+        pdu = tsm_transaction_pdu_buffer(invoke_id, (uint16_t)pdu_len);
+    } else {
+        nc_event_unconfirmed_address(event, recipient, &dest);
+    }
+    if (!pdu) {
+        pdu = Event_Buffer;
+    }
+    pdu_len = nc_event_pdu_encode(
+        pdu, &dest, &npdu_data, event, recipient, invoke_id);
+    if ((pdu_len - npdu_encode_pdu(NULL, &dest, NULL, &npdu_data)) >
+        (int)max_apdu) {
+        if (invoke_id) {
+            tsm_free_invoke_id(invoke_id);
+        }
+        recipient->Pending = false;
+        return false;
+    }
+    if (invoke_id) {
+        if (!tsm_set_confirmed_unsegmented_transaction(
+                invoke_id, &dest, &npdu_data, pdu, (uint16_t)pdu_len)) {
+            /* send when a buffer is available */
+            return false;
+        }
+        bacnet_address_copy(&recipient->Dest, &dest);
+        recipient->Invoke_ID = invoke_id;
+    } else {
+        recipient->Pending = false;
+        nc_event_unconfirmed_reached(event, recipient, &dest);
+    }
+    datalink_send_pdu(&dest, &npdu_data, pdu, pdu_len);
+
+    return true;
+}
+
+/**
+ * @brief Send the queued event notifications to their recipients. The
+ *  confirmed notifications wait in the queue while no transaction is
+ *  available, and are sent again when a transaction fails.  The outbox
+ *  arms its own timer while notifications are waiting to be sent, and
+ *  the end of each confirmed notification fires it again.
+ */
+void Notification_Class_Event_Outbox_Task(void)
+{
+    NC_EVENT *event;
+    unsigned sent = 0;
+    unsigned i, j;
+    bool pending;
+    bool waiting = false;
+
+    tmwheel_timer_cancel(&NC_Event_Timer);
+    if (!dcc_communication_enabled()) {
+        if (NC_Event_Count > 0) {
+            tmwheel_timer_set(&NC_Event_Timer, NC_EVENT_TIMER_MS);
+        }
+        return;
+    }
+    for (i = 0; i < NC_Event_Count; i++) {
+        event = &NC_Event[(NC_Event_Head + i) % NC_EVENT_OUTBOX_SIZE];
+        for (j = 0; j < event->Recipient_Count; j++) {
+            if (sent >= NC_EVENT_SEND_MAX) {
+                break;
+            }
+            if (event->Recipient[j].Pending &&
+                nc_event_recipient_send(event, &event->Recipient[j])) {
+                sent++;
+            }
+        }
+    }
+    /* free the events that every recipient has received */
+    while (NC_Event_Count > 0) {
+        event = &NC_Event[NC_Event_Head];
+        pending = false;
+        for (j = 0; j < event->Recipient_Count; j++) {
+            if (event->Recipient[j].Pending) {
+                pending = true;
+                break;
+            }
+        }
+        if (pending) {
+            break;
+        }
+        NC_Event_Head = (NC_Event_Head + 1) % NC_EVENT_OUTBOX_SIZE;
+        NC_Event_Count--;
+    }
+    /* the notifications awaiting a reply are sent again, or freed,
+       by nc_event_transaction_complete() */
+    for (i = 0; (i < NC_Event_Count) && !waiting; i++) {
+        event = &NC_Event[(NC_Event_Head + i) % NC_EVENT_OUTBOX_SIZE];
+        for (j = 0; j < event->Recipient_Count; j++) {
+            if (event->Recipient[j].Pending &&
+                !event->Recipient[j].Invoke_ID) {
+                waiting = true;
+                break;
+            }
+        }
+    }
+    if (waiting) {
+        tmwheel_timer_set(&NC_Event_Timer, NC_EVENT_TIMER_MS);
+    }
+}
+
+/**
+ * @brief Get the number of events queued for their recipients
+ * @return number of queued events
+ */
+unsigned Notification_Class_Event_Outbox_Count(void)
+{
+    return NC_Event_Count;
+}
+
+/**
+ * @brief Queue an event for the active recipients of its class
+ * @param notification - notification class of the event
+ * @param event_data - event, with the priority and ack-required set
+ */
+static void nc_event_outbox_add(
+    NOTIFICATION_CLASS_INFO *notification,
+    BACNET_EVENT_NOTIFICATION_DATA *event_data)
+{
+    BACNET_DESTINATION *destination;
+    NC_EVENT_RECIPIENT *recipient;
+    NC_EVENT *event;
+    unsigned index;
+    int len;
+
+    if (NC_Event_Count >= NC_EVENT_OUTBOX_SIZE) {
+        Notification_Class_Event_Outbox_Task();
+    }
+    if (NC_Event_Count >= NC_EVENT_OUTBOX_SIZE) {
+        PRINTF("Notification Class: event outbox full!\n");
+        /* drop the oldest event to keep the newest, and free the
+           transactions of its confirmed notifications */
+        event = &NC_Event[NC_Event_Head];
+        for (index = 0; index < event->Recipient_Count; index++) {
+            recipient = &event->Recipient[index];
+            if (recipient->Invoke_ID) {
+                tsm_free_invoke_id(recipient->Invoke_ID);
+                recipient->Invoke_ID = 0;
+            }
+        }
+        NC_Event_Head = (NC_Event_Head + 1) % NC_EVENT_OUTBOX_SIZE;
+        NC_Event_Count--;
+    }
+    event =
+        &NC_Event[(NC_Event_Head + NC_Event_Count) % NC_EVENT_OUTBOX_SIZE];
+    event->Recipient_Count = 0;
+    destination = &notification->Recipient_List[0];
+    for (index = 0; index < NC_MAX_RECIPIENTS; index++, destination++) {
+        if (bacnet_recipient_device_wildcard(&destination->Recipient)) {
+            continue;
+        }
+        if (IsRecipientActive(destination, event_data->toState)) {
+            recipient = &event->Recipient[event->Recipient_Count];
+            recipient->Recipient = destination->Recipient;
+            recipient->Process_Identifier = destination->ProcessIdentifier;
+            recipient->Confirmed = destination->ConfirmedNotify;
+            recipient->Pending = true;
+            recipient->Invoke_ID = 0;
+            recipient->Retries = 0;
+            event->Recipient_Count++;
+        }
+    }
+    if (event->Recipient_Count == 0) {
+        return;
+    }
+    /* encode once, and skip the Process Identifier when sending */
+    event_data->processIdentifier = 0;
+    len = event_notify_encode_service_request(NULL, event_data);
+    if ((len <= 0) || (len > (int)sizeof(event->Service))) {
+        PRINTF("Notification Class: event too large!\n");
+        return;
+    }
+    len = event_notify_encode_service_request(event->Service, event_data);
+    event->Service_Len = (uint16_t)len;
+    event->Service_Offset = (uint16_t)encode_context_unsigned(NULL, 0, 0);
+    NC_Event_Count++;
+}
+
 void Notification_Class_common_reporting_function(
     BACNET_EVENT_NOTIFICATION_DATA *event_data)
 {
     /* Fill the parameters common for all types of events. */
 
     NOTIFICATION_CLASS_INFO *CurrentNotify;
-    BACNET_DESTINATION *pBacDest;
     uint32_t notify_index;
-    uint8_t index;
 
     notify_index =
         Notification_Class_Instance_To_Index(event_data->notificationClass);
@@ -672,48 +1168,11 @@ void Notification_Class_common_reporting_function(
             break;
     }
 
-    /* send notifications for active recipients */
-    PRINTF("Notification Class[%u]: send notifications\n",
+    /* queue notifications for active recipients */
+    PRINTF("Notification Class[%u]: queue notifications\n",
         event_data->notificationClass);
-    /* pointer to first recipient */
-    pBacDest = &CurrentNotify->Recipient_List[0];
-    for (index = 0; index < NC_MAX_RECIPIENTS; index++, pBacDest++) {
-        if (bacnet_recipient_device_wildcard(&pBacDest->Recipient)) {
-            continue;
-        }
-        if (IsRecipientActive(pBacDest, event_data->toState)) {
-            BACNET_ADDRESS dest;
-            uint32_t device_id;
-            unsigned max_apdu;
-
-            /* Process Identifier */
-            event_data->processIdentifier = pBacDest->ProcessIdentifier;
-
-            /* send notification */
-            if (pBacDest->Recipient.tag == BACNET_RECIPIENT_TAG_DEVICE) {
-                /* send notification to the specified device */
-                device_id = pBacDest->Recipient.type.device.instance;
-                PRINTF("Notification Class[%u]: send notification to %u\n",
-                    event_data->notificationClass, (unsigned)device_id);
-                if (pBacDest->ConfirmedNotify == true)
-                    Send_CEvent_Notify(device_id, event_data);
-                else if (address_get_by_device(device_id, &max_apdu, &dest))
-                    Send_UEvent_Notify(Event_Buffer, event_data, &dest);
-            } else if (pBacDest->Recipient.tag ==
-                BACNET_RECIPIENT_TAG_ADDRESS) {
-                PRINTF("Notification Class[%u]: send notification to ADDR\n",
-                    event_data->notificationClass);
-                /* send notification to the address indicated */
-                if (pBacDest->ConfirmedNotify == true) {
-                    if (address_get_device_id(&dest, &device_id))
-                        Send_CEvent_Notify(device_id, event_data);
-                } else {
-                    dest = pBacDest->Recipient.type.address;
-                    Send_UEvent_Notify(Event_Buffer, event_data, &dest);
-                }
-            }
-        }
-    }
+    nc_event_outbox_add(CurrentNotify, event_data);
+    Notification_Class_Event_Outbox_Task();
 }
 
 /* This function tries to find the addresses of the defined devices. */
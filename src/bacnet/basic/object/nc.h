@@ -42,6 +42,31 @@ extern "C" {
 /* max "length" of recipient_list */
 #define NC_MAX_RECIPIENTS 10
 
+/* number of events waiting to be sent to their recipients, enough for
+   a burst of events from many objects while confirmed notifications
+   wait for transactions; each holds a MAX_APDU encoded event */
+#ifndef NC_EVENT_OUTBOX_SIZE
+#define NC_EVENT_OUTBOX_SIZE 32
+#endif
+/* max notifications sent by each call of the outbox task */
+#ifndef NC_EVENT_SEND_MAX
+#define NC_EVENT_SEND_MAX 8
+#endif
+/* milliseconds until the outbox task runs again while notifications
+   are waiting to be sent */
+#ifndef NC_EVENT_TIMER_MS
+#define NC_EVENT_TIMER_MS 50
+#endif
+/* number of times a failed confirmed notification is sent again */
+#ifndef NC_EVENT_RETRIES
+#define NC_EVENT_RETRIES 3
+#endif
+/* number of unconfirmed recipients on one network that are sent
+   a broadcast instead, or 0 to send to each recipient */
+#ifndef NC_EVENT_BROADCAST_MIN
+#define NC_EVENT_BROADCAST_MIN 0
+#endif
+
 #if defined(INTRINSIC_REPORTING)
 
 /* Structure containing configuration for a Notification Class */
@@ -124,6 +149,11 @@ BACNET_STACK_EXPORT
 void Notification_Class_common_reporting_function(
     BACNET_EVENT_NOTIFICATION_DATA *event_data);
 
+BACNET_STACK_EXPORT
+void Notification_Class_Event_Outbox_Task(void);
+BACNET_STACK_EXPORT
+unsigned Notification_Class_Event_Outbox_Count(void);
+
 BACNET_STACK_EXPORT
 void Notification_Class_find_recipient(void);
 #endif /* defined(INTRINSIC_REPORTING) */
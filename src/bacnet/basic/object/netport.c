@@ -233,22 +233,17 @@ void Network_Port_Property_Lists(
 static bool Property_List_Member(
     uint32_t object_instance, int object_property)
 {
-    bool found = false;
+    /* rebuilt when the lists change with the network type */
+    static struct special_property_list_bitmap_t Property_List_Bitmap;
     const int *pRequired = NULL;
     const int *pOptional = NULL;
     const int *pProprietary = NULL;
 
     Network_Port_Property_List(object_instance,
         &pRequired, &pOptional, &pProprietary);
-    found = property_list_member(pRequired, object_property);
-    if (!found) {
-        found = property_list_member(pOptional, object_property);
-    }
-    if (!found) {
-        found = property_list_member(pProprietary, object_property);
-    }
 
-    return found;
+    return property_lists_bitmap_member(&Property_List_Bitmap, pRequired,
+        pOptional, pProprietary, object_property);
 }
 
 /**
@@ -23,6 +23,7 @@
  *
  *********************************************************************/
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 /* BACnet Stack defines - first */
@@ -35,12 +36,26 @@
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/object/schedule.h"
+#include "bacnet/basic/sys/tmwheel.h"
 
 #ifndef MAX_SCHEDULES
 #define MAX_SCHEDULES 4
 #endif
 
+#define SCHEDULE_SECONDS_PER_DAY 86400UL
+
 static SCHEDULE_DESCR Schedule_Descr[MAX_SCHEDULES];
+/* callback to find if a date is in the Date_List of a Calendar */
+static schedule_calendar_date_function Calendar_Date_Callback;
+/* callback to write the Present_Value to the referenced properties */
+static write_property_function Write_Property_Internal_Callback;
+/* seconds since epoch of the next transition of any schedule,
+   or zero when the schedules must be evaluated */
+static bacnet_time_t Schedule_Wake;
+/* seconds since epoch of the last evaluation, to detect a clock change */
+static bacnet_time_t Schedule_Last;
+/* timer of the next transition, for applications that run the wheel */
+static struct tmwheel_timer Schedule_Timer;
 
 static const int Schedule_Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
     PROP_OBJECT_NAME, PROP_OBJECT_TYPE, PROP_PRESENT_VALUE,
@@ -48,9 +63,11 @@ static const int Schedule_Properties_Required[] = { PROP_OBJECT_IDENTIFIER,
     PROP_LIST_OF_OBJECT_PROPERTY_REFERENCES, PROP_PRIORITY_FOR_WRITING,
     PROP_STATUS_FLAGS, PROP_RELIABILITY, PROP_OUT_OF_SERVICE, -1 };
 
-static const int Schedule_Properties_Optional[] = { PROP_WEEKLY_SCHEDULE, -1 };
+static const int Schedule_Properties_Optional[] = { PROP_WEEKLY_SCHEDULE,
+    PROP_EXCEPTION_SCHEDULE, -1 };
 
 static const int Schedule_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 void Schedule_Property_Lists(
     const int **pRequired, const int **pOptional, const int **pProprietary)
@@ -66,6 +83,38 @@ void Schedule_Property_Lists(
     }
 }
 
+/**
+ * @brief Arm the schedule timer for the next transition
+ * @param milliseconds - time until the next transition
+ * @return milliseconds until the next transition
+ */
+static uint32_t Schedule_Timer_Set(uint32_t milliseconds)
+{
+    if (milliseconds > SCHEDULE_TIMER_MAX_MS) {
+        tmwheel_timer_set(&Schedule_Timer, SCHEDULE_TIMER_MAX_MS);
+    } else {
+        tmwheel_timer_set(&Schedule_Timer, milliseconds);
+    }
+
+    return milliseconds;
+}
+
+/**
+ * @brief Evaluate the schedules at the local date and time when the
+ *  schedule timer fires
+ * @param timer - timer that expired
+ * @param context - not used
+ */
+static void Schedule_Timer_Handler(struct tmwheel_timer *timer, void *context)
+{
+    BACNET_DATE_TIME bdatetime;
+
+    (void)timer;
+    (void)context;
+    datetime_local(&bdatetime.date, &bdatetime.time, NULL, NULL);
+    (void)Schedule_Task(&bdatetime);
+}
+
 void Schedule_Init(void)
 {
     unsigned i, j;
@@ -74,17 +123,20 @@ void Schedule_Init(void)
 
     for (i = 0; i < MAX_SCHEDULES; i++, psched++) {
         /* whole year, change as necessary */
-        psched->Start_Date.year = 0xFF;
-        psched->Start_Date.month = 1;
-        psched->Start_Date.day = 1;
-        psched->Start_Date.wday = 0xFF;
-        psched->End_Date.year = 0xFF;
-        psched->End_Date.month = 12;
-        psched->End_Date.day = 31;
-        psched->End_Date.wday = 0xFF;
+        datetime_set_date(&psched->Start_Date, 0, 1, 1);
+        datetime_wildcard_year_set(&psched->Start_Date);
+        datetime_wildcard_weekday_set(&psched->Start_Date);
+        datetime_set_date(&psched->End_Date, 0, 12, 31);
+        datetime_wildcard_year_set(&psched->End_Date);
+        datetime_wildcard_weekday_set(&psched->End_Date);
         for (j = 0; j < 7; j++) {
             psched->Weekly_Schedule[j].TV_Count = 0;
         }
+        psched->Exception_Count = 0;
+        psched->Transition_Count = 0;
+        psched->Transition_Next = 0;
+        psched->Transition_Valid = false;
+        psched->Next_Transition = 0;
         memcpy(&psched->Present_Value, &psched->Schedule_Default,
             sizeof(psched->Present_Value));
         psched->Schedule_Default.context_specific = false;
@@ -94,6 +146,11 @@ void Schedule_Init(void)
         psched->Priority_For_Writing = 16; /* lowest priority */
         psched->Out_Of_Service = false;
     }
+    Schedule_Wake = 0;
+    Schedule_Last = 0;
+    tmwheel_timer_cancel(&Schedule_Timer);
+    tmwheel_timer_init(&Schedule_Timer, Schedule_Timer_Handler, NULL);
+    tmwheel_timer_set(&Schedule_Timer, 0);
 }
 
 bool Schedule_Valid_Instance(uint32_t object_instance)
@@ -143,6 +200,20 @@ bool Schedule_Object_Name(
     return status;
 }
 
+/**
+ * @brief Mark the schedule as changed, so that its day is compiled and
+ *  evaluated by the next call of Schedule_Task()
+ * @param desc - schedule object data
+ */
+static void Schedule_Changed(SCHEDULE_DESCR *desc)
+{
+    desc->Transition_Valid = false;
+    Schedule_Wake = 0;
+    if (tmwheel_timer_pending(&Schedule_Timer)) {
+        tmwheel_timer_set(&Schedule_Timer, 0);
+    }
+}
+
 /* 	BACnet Testing Observed Incident oi00106
         Out of service was not supported by Schedule object
         Revealed by BACnet Test Client v1.8.16 (
@@ -157,9 +228,51 @@ void Schedule_Out_Of_Service_Set(uint32_t object_instance, bool value)
     index = Schedule_Instance_To_Index(object_instance);
     if (index < MAX_SCHEDULES) {
         Schedule_Descr[index].Out_Of_Service = value;
+        Schedule_Changed(&Schedule_Descr[index]);
     }
 }
 
+/**
+ * @brief Encode a special event of the Exception_Schedule
+ * @param apdu - buffer for the encoding, or NULL for the length
+ * @param special_event - special event
+ * @return number of bytes encoded
+ */
+static int Schedule_Special_Event_Encode(
+    uint8_t *apdu, BACNET_OBJ_SPECIAL_EVENT *special_event)
+{
+    int apdu_len = 0;
+    int len;
+    unsigned i;
+
+    if (special_event->periodTag ==
+        BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_ENTRY) {
+        len = bacnet_calendar_entry_context_encode(apdu,
+            BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_ENTRY,
+            &special_event->period.calendarEntry);
+    } else {
+        len = encode_context_object_id(apdu,
+            BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_REFERENCE,
+            special_event->period.calendarReference.type,
+            special_event->period.calendarReference.instance);
+    }
+    apdu_len += len;
+    len = encode_opening_tag(apdu ? &apdu[apdu_len] : NULL, 2);
+    apdu_len += len;
+    for (i = 0; i < special_event->timeValues.TV_Count; i++) {
+        len = bacnet_time_value_encode(apdu ? &apdu[apdu_len] : NULL,
+            &special_event->timeValues.Time_Values[i]);
+        apdu_len += len;
+    }
+    len = encode_closing_tag(apdu ? &apdu[apdu_len] : NULL, 2);
+    apdu_len += len;
+    len = encode_context_unsigned(
+        apdu ? &apdu[apdu_len] : NULL, 3, special_event->priority);
+    apdu_len += len;
+
+    return apdu_len;
+}
+
 int Schedule_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
 {
     int apdu_len = 0;
@@ -243,6 +356,24 @@ int Schedule_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
                 apdu_len = BACNET_STATUS_ERROR;
             }
             break;
+        case PROP_EXCEPTION_SCHEDULE:
+            if (rpdata->array_index == 0) {
+                apdu_len = encode_application_unsigned(
+                    &apdu[0], CurrentSC->Exception_Count);
+            } else if (rpdata->array_index == BACNET_ARRAY_ALL) {
+                for (i = 0; i < CurrentSC->Exception_Count; i++) {
+                    apdu_len += Schedule_Special_Event_Encode(
+                        &apdu[apdu_len], &CurrentSC->Exception_Schedule[i]);
+                }
+            } else if (rpdata->array_index <= CurrentSC->Exception_Count) {
+                apdu_len = Schedule_Special_Event_Encode(&apdu[0],
+                    &CurrentSC->Exception_Schedule[rpdata->array_index - 1]);
+            } else {
+                rpdata->error_class = ERROR_CLASS_PROPERTY;
+                rpdata->error_code = ERROR_CODE_INVALID_ARRAY_INDEX;
+                apdu_len = BACNET_STATUS_ERROR;
+            }
+            break;
         case PROP_SCHEDULE_DEFAULT:
             apdu_len =
                 bacapp_encode_data(&apdu[0], &CurrentSC->Schedule_Default);
@@ -291,6 +422,7 @@ int Schedule_Read_Property(BACNET_READ_PROPERTY_DATA *rpdata)
     }
 
     if ((apdu_len >= 0) && (rpdata->object_property != PROP_WEEKLY_SCHEDULE) &&
+        (rpdata->object_property != PROP_EXCEPTION_SCHEDULE) &&
         (rpdata->array_index != BACNET_ARRAY_ALL)) {
         rpdata->error_class = ERROR_CLASS_PROPERTY;
         rpdata->error_code = ERROR_CODE_PROPERTY_IS_NOT_AN_ARRAY;
@@ -355,9 +487,10 @@ bool Schedule_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(
-                Schedule_Properties_Required, Schedule_Properties_Optional, 
-                Schedule_Properties_Proprietary, wp_data->object_property)) {
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Schedule_Properties_Required,
+                    Schedule_Properties_Optional,
+                    Schedule_Properties_Proprietary, wp_data->object_property)) {
                 wp_data->error_class = ERROR_CLASS_PROPERTY;
                 wp_data->error_code = ERROR_CODE_WRITE_ACCESS_DENIED;
             } else {
@@ -390,15 +523,7 @@ void Schedule_Recalculate_PV(
     int i;
     desc->Present_Value.tag = BACNET_APPLICATION_TAG_NULL;
 
-    /* for future development, here should be the loop for Exception Schedule */
-
-    /* Just a note to developers: We have a paying customer who has asked us to
-       fully implement the Schedule Object. In good spirit, they have agreed to
-       allow us to release the code we develop back to the Open Source community
-       after a 6-12 month waiting period. However, if you are about to work on
-       this yourself, please ping us at info@connect-ex.com, we may be able to
-       broker an early release on a case-by-case basis. */
-
+    /* the Exception_Schedule needs the date: see Schedule_Evaluate() */
     for (i = 0; i < desc->Weekly_Schedule[wday - 1].TV_Count &&
          desc->Present_Value.tag == BACNET_APPLICATION_TAG_NULL;
          i++) {
@@ -417,3 +542,557 @@ void Schedule_Recalculate_PV(
             sizeof(desc->Present_Value));
     }
 }
+
+/**
+ * @brief Compare two values of a schedule
+ * @param value1 - value
+ * @param value2 - value
+ * @return true if the values are the same
+ */
+static bool Schedule_Value_Same(
+    BACNET_PRIMITIVE_DATA_VALUE *value1, BACNET_PRIMITIVE_DATA_VALUE *value2)
+{
+    if (value1->tag != value2->tag) {
+        return false;
+    }
+    switch (value1->tag) {
+        case BACNET_APPLICATION_TAG_NULL:
+            return true;
+#if defined(BACAPP_BOOLEAN)
+        case BACNET_APPLICATION_TAG_BOOLEAN:
+            return value1->type.Boolean == value2->type.Boolean;
+#endif
+#if defined(BACAPP_UNSIGNED)
+        case BACNET_APPLICATION_TAG_UNSIGNED_INT:
+            return value1->type.Unsigned_Int == value2->type.Unsigned_Int;
+#endif
+#if defined(BACAPP_SIGNED)
+        case BACNET_APPLICATION_TAG_SIGNED_INT:
+            return value1->type.Signed_Int == value2->type.Signed_Int;
+#endif
+#if defined(BACAPP_REAL)
+        case BACNET_APPLICATION_TAG_REAL:
+            return !islessgreater(value1->type.Real, value2->type.Real);
+#endif
+#if defined(BACAPP_DOUBLE)
+        case BACNET_APPLICATION_TAG_DOUBLE:
+            return !islessgreater(value1->type.Double, value2->type.Double);
+#endif
+#if defined(BACAPP_ENUMERATED)
+        case BACNET_APPLICATION_TAG_ENUMERATED:
+            return value1->type.Enumerated == value2->type.Enumerated;
+#endif
+        default:
+            break;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Find the value of a day schedule at a time of the day
+ * @param day - time values of the day
+ * @param time - time of the day
+ * @return the value of the latest time value at or before the time,
+ *  or NULL if the first time value is later
+ */
+static BACNET_PRIMITIVE_DATA_VALUE *Schedule_Day_Value(
+    BACNET_OBJ_DAILY_SCHEDULE *day, BACNET_TIME *time)
+{
+    BACNET_TIME_VALUE *latest = NULL;
+    BACNET_TIME_VALUE *time_value;
+    unsigned i;
+
+    for (i = 0; i < day->TV_Count; i++) {
+        time_value = &day->Time_Values[i];
+        if ((datetime_compare_time(&time_value->Time, time) <= 0) &&
+            (!latest ||
+                (datetime_compare_time(&latest->Time, &time_value->Time) <=
+                    0))) {
+            latest = time_value;
+        }
+    }
+
+    return latest ? &latest->Value : NULL;
+}
+
+/**
+ * @brief Determine if a special event of the Exception_Schedule is
+ *  active on a date
+ * @param special_event - special event
+ * @param date - date
+ * @return true if the date is in the period of the special event
+ */
+static bool Schedule_Special_Event_Active(
+    BACNET_OBJ_SPECIAL_EVENT *special_event, BACNET_DATE *date)
+{
+    BACNET_OBJECT_ID *calendar;
+
+    if (special_event->periodTag ==
+        BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_ENTRY) {
+        return bacapp_date_in_calendar_entry(
+            date, &special_event->period.calendarEntry);
+    }
+    calendar = &special_event->period.calendarReference;
+    if ((calendar->type == OBJECT_CALENDAR) && Calendar_Date_Callback) {
+        return Calendar_Date_Callback(calendar->instance, date);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Add a time of the day to the sorted transitions of the schedule
+ * @param desc - schedule object data
+ * @param time - time of the day
+ */
+static void Schedule_Transition_Add(SCHEDULE_DESCR *desc, BACNET_TIME *time)
+{
+    unsigned i, j;
+    int diff = 1;
+
+    if (!datetime_time_is_valid(time)) {
+        return;
+    }
+    for (i = 0; i < desc->Transition_Count; i++) {
+        diff = datetime_compare_time(&desc->Transitions[i].Time, time);
+        if (diff >= 0) {
+            break;
+        }
+    }
+    if ((diff == 0) ||
+        (desc->Transition_Count >= BACNET_SCHEDULE_TRANSITIONS_SIZE)) {
+        return;
+    }
+    for (j = desc->Transition_Count; j > i; j--) {
+        desc->Transitions[j] = desc->Transitions[j - 1];
+    }
+    datetime_copy_time(&desc->Transitions[i].Time, time);
+    desc->Transition_Count++;
+}
+
+/**
+ * @brief Compile the Weekly_Schedule and the active special events of the
+ *  Exception_Schedule into the changes of Present_Value in one day
+ * @param desc - schedule object data
+ * @param date - the day to compile
+ */
+void Schedule_Compile(SCHEDULE_DESCR *desc, BACNET_DATE *date)
+{
+    BACNET_OBJ_SPECIAL_EVENT *active[BACNET_EXCEPTION_SCHEDULE_SIZE];
+    BACNET_OBJ_DAILY_SCHEDULE *weekly = NULL;
+    BACNET_PRIMITIVE_DATA_VALUE *value;
+    BACNET_TIME midnight;
+    unsigned active_count = 0;
+    unsigned i, j, count;
+
+    if (!desc || !date) {
+        return;
+    }
+    desc->Transition_Count = 0;
+    desc->Transition_Next = 0;
+    desc->Transition_Valid = true;
+    datetime_copy_date(&desc->Transition_Date, date);
+    datetime_set_time(&midnight, 0, 0, 0, 0);
+    Schedule_Transition_Add(desc, &midnight);
+    if (Schedule_In_Effective_Period(desc, date)) {
+        /* the active special events, highest priority first */
+        for (i = 0; i < desc->Exception_Count; i++) {
+            if (!Schedule_Special_Event_Active(
+                    &desc->Exception_Schedule[i], date)) {
+                continue;
+            }
+            for (j = active_count; j > 0; j--) {
+                if (active[j - 1]->priority <=
+                    desc->Exception_Schedule[i].priority) {
+                    break;
+                }
+                active[j] = active[j - 1];
+            }
+            active[j] = &desc->Exception_Schedule[i];
+            active_count++;
+        }
+        for (i = 0; i < active_count; i++) {
+            for (j = 0; j < active[i]->timeValues.TV_Count; j++) {
+                Schedule_Transition_Add(
+                    desc, &active[i]->timeValues.Time_Values[j].Time);
+            }
+        }
+        if ((date->wday >= 1) && (date->wday <= 7)) {
+            weekly = &desc->Weekly_Schedule[date->wday - 1];
+            for (j = 0; j < weekly->TV_Count; j++) {
+                Schedule_Transition_Add(desc, &weekly->Time_Values[j].Time);
+            }
+        }
+    }
+    /* a special event is in effect from its first time value until a
+       NULL value, and the Weekly_Schedule when none is in effect */
+    count = 0;
+    for (i = 0; i < desc->Transition_Count; i++) {
+        value = NULL;
+        for (j = 0; j < active_count; j++) {
+            value = Schedule_Day_Value(
+                &active[j]->timeValues, &desc->Transitions[i].Time);
+            if (value && (value->tag != BACNET_APPLICATION_TAG_NULL)) {
+                break;
+            }
+            value = NULL;
+        }
+        if (!value && weekly) {
+            value = Schedule_Day_Value(weekly, &desc->Transitions[i].Time);
+        }
+        if (value) {
+            desc->Transitions[i].Value = *value;
+        } else {
+            desc->Transitions[i].Value.tag = BACNET_APPLICATION_TAG_NULL;
+        }
+        /* only keep the changes of value */
+        if ((count == 0) ||
+            !Schedule_Value_Same(&desc->Transitions[count - 1].Value,
+                &desc->Transitions[i].Value)) {
+            desc->Transitions[count] = desc->Transitions[i];
+            count++;
+        }
+    }
+    desc->Transition_Count = count;
+}
+
+/**
+ * @brief Set the Present_Value of the schedule at a date and time, from
+ *  the transitions of the day, and find the next transition
+ * @param desc - schedule object data
+ * @param date - local date
+ * @param time - local time
+ */
+void Schedule_Evaluate(
+    SCHEDULE_DESCR *desc, BACNET_DATE *date, BACNET_TIME *time)
+{
+    BACNET_DATE_TIME midnight;
+    BACNET_TIME_VALUE *transition;
+    unsigned next;
+
+    if (!desc || !date || !time) {
+        return;
+    }
+    if (!desc->Transition_Valid ||
+        (datetime_compare_date(&desc->Transition_Date, date) != 0)) {
+        Schedule_Compile(desc, date);
+    }
+    for (next = 0; next < desc->Transition_Count; next++) {
+        if (datetime_compare_time(&desc->Transitions[next].Time, time) > 0) {
+            break;
+        }
+    }
+    desc->Transition_Next = next;
+    transition = &desc->Transitions[next - 1];
+    if (transition->Value.tag == BACNET_APPLICATION_TAG_NULL) {
+        desc->Present_Value = desc->Schedule_Default;
+    } else {
+        bacnet_primitive_to_application_data_value(
+            &desc->Present_Value, &transition->Value);
+    }
+    datetime_copy_date(&midnight.date, date);
+    datetime_set_time(&midnight.time, 0, 0, 0, 0);
+    desc->Next_Transition = datetime_seconds_since_epoch(&midnight);
+    if (next < desc->Transition_Count) {
+        desc->Next_Transition +=
+            datetime_seconds_since_midnight(&desc->Transitions[next].Time);
+    } else {
+        desc->Next_Transition += SCHEDULE_SECONDS_PER_DAY;
+    }
+}
+
+/**
+ * @brief Set the time values of one day of the Weekly_Schedule
+ * @param object_instance - object-instance number of the object
+ * @param wday - day of the week, 1=Monday..7=Sunday
+ * @param day_schedule - time values of the day
+ * @return true if the day was set
+ */
+bool Schedule_Weekly_Schedule_Set(uint32_t object_instance,
+    BACNET_WEEKDAY wday,
+    BACNET_OBJ_DAILY_SCHEDULE *day_schedule)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+
+    if ((index >= MAX_SCHEDULES) || !day_schedule || (wday < 1) ||
+        (wday > 7) || (day_schedule->TV_Count > BACNET_WEEKLY_SCHEDULE_SIZE)) {
+        return false;
+    }
+    Schedule_Descr[index].Weekly_Schedule[wday - 1] = *day_schedule;
+    Schedule_Changed(&Schedule_Descr[index]);
+
+    return true;
+}
+
+/**
+ * @brief Add a special event to the Exception_Schedule
+ * @param object_instance - object-instance number of the object
+ * @param special_event - special event
+ * @return true if the special event was added
+ */
+bool Schedule_Exception_Schedule_Add(
+    uint32_t object_instance, BACNET_OBJ_SPECIAL_EVENT *special_event)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+    SCHEDULE_DESCR *desc;
+
+    if ((index >= MAX_SCHEDULES) || !special_event ||
+        (special_event->timeValues.TV_Count > BACNET_WEEKLY_SCHEDULE_SIZE)) {
+        return false;
+    }
+    desc = &Schedule_Descr[index];
+    if (desc->Exception_Count >= BACNET_EXCEPTION_SCHEDULE_SIZE) {
+        return false;
+    }
+    desc->Exception_Schedule[desc->Exception_Count] = *special_event;
+    desc->Exception_Count++;
+    Schedule_Changed(desc);
+
+    return true;
+}
+
+/**
+ * @brief Remove every special event from the Exception_Schedule
+ * @param object_instance - object-instance number of the object
+ */
+void Schedule_Exception_Schedule_Delete_All(uint32_t object_instance)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+
+    if (index < MAX_SCHEDULES) {
+        Schedule_Descr[index].Exception_Count = 0;
+        Schedule_Changed(&Schedule_Descr[index]);
+    }
+}
+
+/**
+ * @brief Get the number of special events in the Exception_Schedule
+ * @param object_instance - object-instance number of the object
+ * @return number of special events
+ */
+unsigned Schedule_Exception_Schedule_Count(uint32_t object_instance)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+
+    if (index < MAX_SCHEDULES) {
+        return Schedule_Descr[index].Exception_Count;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Add a property to the List_Of_Object_Property_References
+ * @param object_instance - object-instance number of the object
+ * @param reference - property written with the Present_Value
+ * @return true if the reference was added
+ */
+bool Schedule_Object_Property_Reference_Add(uint32_t object_instance,
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE *reference)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+    SCHEDULE_DESCR *desc;
+
+    if ((index >= MAX_SCHEDULES) || !reference) {
+        return false;
+    }
+    desc = &Schedule_Descr[index];
+    if (desc->obj_prop_ref_cnt >= BACNET_SCHEDULE_OBJ_PROP_REF_SIZE) {
+        return false;
+    }
+    desc->Object_Property_References[desc->obj_prop_ref_cnt] = *reference;
+    desc->obj_prop_ref_cnt++;
+    Schedule_Changed(desc);
+
+    return true;
+}
+
+/**
+ * @brief Get the Present_Value of the schedule
+ * @param object_instance - object-instance number of the object
+ * @param value [out] present-value
+ * @return true if the object exists
+ */
+bool Schedule_Present_Value(
+    uint32_t object_instance, BACNET_APPLICATION_DATA_VALUE *value)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+
+    if ((index >= MAX_SCHEDULES) || !value) {
+        return false;
+    }
+    *value = Schedule_Descr[index].Present_Value;
+
+    return true;
+}
+
+/**
+ * @brief Get the date and time of the next change of Present_Value
+ * @param object_instance - object-instance number of the object
+ * @param bdatetime [out] date and time of the next transition
+ * @return true if the schedule was evaluated and is in service
+ */
+bool Schedule_Next_Transition(
+    uint32_t object_instance, BACNET_DATE_TIME *bdatetime)
+{
+    unsigned index = Schedule_Instance_To_Index(object_instance);
+    SCHEDULE_DESCR *desc;
+
+    if ((index >= MAX_SCHEDULES) || !bdatetime) {
+        return false;
+    }
+    desc = &Schedule_Descr[index];
+    if (!desc->Transition_Valid || desc->Out_Of_Service) {
+        return false;
+    }
+    datetime_since_epoch_seconds(bdatetime, desc->Next_Transition);
+
+    return true;
+}
+
+/**
+ * @brief Sets the callback used to find if a date is in a Calendar
+ *  referenced by the Exception_Schedule
+ * @param cb - callback, or NULL if calendar references are never active
+ */
+void Schedule_Calendar_Date_Callback_Set(schedule_calendar_date_function cb)
+{
+    Calendar_Date_Callback = cb;
+}
+
+/**
+ * @brief Mark the schedules that reference a Calendar in their
+ *  Exception_Schedule as changed, when the Date_List of the Calendar
+ *  changed, so that the day is compiled again
+ * @param object_instance - instance number of the Calendar
+ */
+void Schedule_Calendar_Changed(uint32_t object_instance)
+{
+    BACNET_OBJ_SPECIAL_EVENT *special_event;
+    unsigned i, j;
+
+    for (i = 0; i < MAX_SCHEDULES; i++) {
+        for (j = 0; j < Schedule_Descr[i].Exception_Count; j++) {
+            special_event = &Schedule_Descr[i].Exception_Schedule[j];
+            if ((special_event->periodTag ==
+                    BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_REFERENCE) &&
+                (special_event->period.calendarReference.type ==
+                    OBJECT_CALENDAR) &&
+                (special_event->period.calendarReference.instance ==
+                    object_instance)) {
+                Schedule_Changed(&Schedule_Descr[i]);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Sets the callback used to write the Present_Value to the
+ *  List_Of_Object_Property_References in this device
+ * @param cb - callback used to write the properties
+ */
+void Schedule_Write_Property_Internal_Callback_Set(write_property_function cb)
+{
+    Write_Property_Internal_Callback = cb;
+}
+
+/**
+ * @brief Write the Present_Value to the object properties in this device
+ *  that are referenced by the schedule
+ * @param desc - schedule object data
+ */
+static void Schedule_Write_References(SCHEDULE_DESCR *desc)
+{
+    BACNET_WRITE_PROPERTY_DATA wp_data = { 0 };
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE *reference;
+    int len;
+    unsigned i;
+
+    if (!Write_Property_Internal_Callback) {
+        return;
+    }
+    len = bacapp_encode_application_data(
+        wp_data.application_data, &desc->Present_Value);
+    if (len <= 0) {
+        return;
+    }
+    for (i = 0; i < desc->obj_prop_ref_cnt; i++) {
+        reference = &desc->Object_Property_References[i];
+        if ((reference->deviceIdentifier.type == OBJECT_DEVICE) &&
+            (reference->deviceIdentifier.instance !=
+                Device_Object_Instance_Number())) {
+            /* writing to other devices is not supported */
+            continue;
+        }
+        wp_data.object_type = reference->objectIdentifier.type;
+        wp_data.object_instance = reference->objectIdentifier.instance;
+        wp_data.object_property = reference->propertyIdentifier;
+        wp_data.array_index = reference->arrayIndex;
+        wp_data.priority = desc->Priority_For_Writing;
+        wp_data.application_data_len = len;
+        (void)Write_Property_Internal_Callback(&wp_data);
+    }
+}
+
+/**
+ * @brief Update the Present_Value of the schedules that reached their
+ *  next transition, and write it to their object property references.
+ *  Between transitions the call returns without looking at any schedule.
+ *  The schedule timer is armed for the next transition, so applications
+ *  that run the timer wheel do not need to call this function.
+ * @param bdatetime - the local date and time
+ * @return milliseconds until the next transition of any schedule
+ */
+uint32_t Schedule_Task(BACNET_DATE_TIME *bdatetime)
+{
+    SCHEDULE_DESCR *desc;
+    BACNET_PRIMITIVE_DATA_VALUE value = { 0 };
+    bacnet_time_t now, wake = 0;
+    bool clock_changed;
+    bool changed;
+    unsigned i;
+
+    if (!bdatetime) {
+        return 0;
+    }
+    now = datetime_seconds_since_epoch(bdatetime);
+    clock_changed = (now < Schedule_Last);
+    Schedule_Last = now;
+    if (Schedule_Wake && !clock_changed && (now < Schedule_Wake)) {
+        return Schedule_Timer_Set(
+            (uint32_t)((Schedule_Wake - now) * 1000UL));
+    }
+    for (i = 0; i < MAX_SCHEDULES; i++) {
+        desc = &Schedule_Descr[i];
+        if (desc->Out_Of_Service) {
+            continue;
+        }
+        if (!desc->Transition_Valid || clock_changed ||
+            (now >= desc->Next_Transition)) {
+            changed = !desc->Transition_Valid;
+            if (!changed && (desc->Transition_Next > 0)) {
+                value = desc->Transitions[desc->Transition_Next - 1].Value;
+            }
+            Schedule_Evaluate(desc, &bdatetime->date, &bdatetime->time);
+            if (!changed && (desc->Transition_Next > 0)) {
+                changed = !Schedule_Value_Same(&value,
+                    &desc->Transitions[desc->Transition_Next - 1].Value);
+            }
+            if (changed) {
+                Schedule_Write_References(desc);
+            }
+        }
+        if (!wake || (desc->Next_Transition < wake)) {
+            wake = desc->Next_Transition;
+        }
+    }
+    if (!wake) {
+        /* every schedule is out of service */
+        wake = now + SCHEDULE_SECONDS_PER_DAY;
+    }
+    Schedule_Wake = wake;
+
+    return Schedule_Timer_Set((uint32_t)((wake - now) * 1000UL));
+}
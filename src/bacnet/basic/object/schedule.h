@@ -38,6 +38,7 @@
 #include "bacnet/rp.h"
 #include "bacnet/bacdevobjpropref.h"
 #include "bacnet/bactimevalue.h"
+#include "bacnet/special_event.h"
 
 #ifndef BACNET_WEEKLY_SCHEDULE_SIZE
 #define BACNET_WEEKLY_SCHEDULE_SIZE 8   /* maximum number of data points for each day */
@@ -47,6 +48,22 @@
 #define BACNET_SCHEDULE_OBJ_PROP_REF_SIZE 4     /* maximum number of obj prop references */
 #endif
 
+#ifndef BACNET_EXCEPTION_SCHEDULE_SIZE
+#define BACNET_EXCEPTION_SCHEDULE_SIZE 4        /* maximum number of special events */
+#endif
+
+/* maximum number of transitions in one day, from every schedule */
+#ifndef BACNET_SCHEDULE_TRANSITIONS_SIZE
+#define BACNET_SCHEDULE_TRANSITIONS_SIZE \
+    (1 + BACNET_WEEKLY_SCHEDULE_SIZE * (1 + BACNET_EXCEPTION_SCHEDULE_SIZE))
+#endif
+
+/* longest wait of the schedule timer, so that a change of the
+   local clock is found without waiting for the next transition */
+#ifndef SCHEDULE_TIMER_MAX_MS
+#define SCHEDULE_TIMER_MAX_MS 60000UL
+#endif
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -62,12 +79,34 @@ extern "C" {
         uint16_t TV_Count;      /* the number of time values actually used */
     } BACNET_OBJ_DAILY_SCHEDULE;
 
+    /*
+     * Note:
+     * This is a different struct from BACNET_SPECIAL_EVENT used in prop value encoding!
+     * The number of time values is different.
+     */
+    typedef struct bacnet_obj_special_event {
+        BACNET_SPECIAL_EVENT_PERIOD_TAG periodTag;
+        union {
+            BACNET_CALENDAR_ENTRY calendarEntry;
+            BACNET_OBJECT_ID calendarReference;
+        } period;
+        BACNET_OBJ_DAILY_SCHEDULE timeValues;
+        uint8_t priority;       /* (1..16) */
+    } BACNET_OBJ_SPECIAL_EVENT;
+
+    /* callback to find if a date is in the Date_List of a Calendar */
+    typedef bool (*schedule_calendar_date_function)(
+        uint32_t object_instance, BACNET_DATE *date);
+
     typedef struct schedule {
         /* Effective Period: Start and End Date */
         BACNET_DATE Start_Date;
         BACNET_DATE End_Date;
         /* Properties concerning Present Value */
         BACNET_OBJ_DAILY_SCHEDULE Weekly_Schedule[7];
+        BACNET_OBJ_SPECIAL_EVENT
+            Exception_Schedule[BACNET_EXCEPTION_SCHEDULE_SIZE];
+        uint8_t Exception_Count;        /* actual number of special events */
         BACNET_APPLICATION_DATA_VALUE Schedule_Default;
         /*
          * Caution: This is a converted to BACNET_PRIMITIVE_APPLICATION_DATA_VALUE.
@@ -80,6 +119,14 @@ extern "C" {
         uint8_t obj_prop_ref_cnt;       /* actual number of obj_prop references */
         uint8_t Priority_For_Writing;   /* (1..16) */
         bool Out_Of_Service;
+        /* the changes of Present_Value in one day, sorted by time,
+           where a NULL value is the Schedule_Default */
+        BACNET_TIME_VALUE Transitions[BACNET_SCHEDULE_TRANSITIONS_SIZE];
+        uint8_t Transition_Count;
+        uint8_t Transition_Next;        /* index of the next transition */
+        BACNET_DATE Transition_Date;    /* the day that was compiled */
+        bool Transition_Valid;  /* false when the day must be compiled */
+        bacnet_time_t Next_Transition;  /* seconds since epoch */
     } SCHEDULE_DESCR;
 
     BACNET_STACK_EXPORT
@@ -107,6 +154,47 @@ extern "C" {
         uint32_t object_instance);
 
 
+    BACNET_STACK_EXPORT
+    bool Schedule_Weekly_Schedule_Set(
+        uint32_t object_instance,
+        BACNET_WEEKDAY wday,
+        BACNET_OBJ_DAILY_SCHEDULE * day_schedule);
+    BACNET_STACK_EXPORT
+    bool Schedule_Exception_Schedule_Add(
+        uint32_t object_instance,
+        BACNET_OBJ_SPECIAL_EVENT * special_event);
+    BACNET_STACK_EXPORT
+    void Schedule_Exception_Schedule_Delete_All(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    unsigned Schedule_Exception_Schedule_Count(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    bool Schedule_Object_Property_Reference_Add(
+        uint32_t object_instance,
+        BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE * reference);
+    BACNET_STACK_EXPORT
+    bool Schedule_Present_Value(
+        uint32_t object_instance,
+        BACNET_APPLICATION_DATA_VALUE * value);
+    BACNET_STACK_EXPORT
+    bool Schedule_Next_Transition(
+        uint32_t object_instance,
+        BACNET_DATE_TIME * bdatetime);
+
+    BACNET_STACK_EXPORT
+    void Schedule_Calendar_Date_Callback_Set(
+        schedule_calendar_date_function cb);
+    BACNET_STACK_EXPORT
+    void Schedule_Calendar_Changed(
+        uint32_t object_instance);
+    BACNET_STACK_EXPORT
+    void Schedule_Write_Property_Internal_Callback_Set(
+        write_property_function cb);
+    BACNET_STACK_EXPORT
+    uint32_t Schedule_Task(
+        BACNET_DATE_TIME * bdatetime);
+
     BACNET_STACK_EXPORT
     bool Schedule_Object_Name(uint32_t object_instance,
         BACNET_CHARACTER_STRING * object_name);
@@ -116,8 +204,7 @@ extern "C" {
     BACNET_STACK_EXPORT
     bool Schedule_Write_Property(BACNET_WRITE_PROPERTY_DATA * wp_data);
 
-    /* utility functions for calculating current Present Value
-     * if Exception Schedule is to be added, these functions must take that into account */
+    /* utility functions for calculating current Present Value */
     BACNET_STACK_EXPORT
     bool Schedule_In_Effective_Period(SCHEDULE_DESCR * desc,
         BACNET_DATE * date);
@@ -125,6 +212,13 @@ extern "C" {
     void Schedule_Recalculate_PV(SCHEDULE_DESCR * desc,
         BACNET_WEEKDAY wday,
         BACNET_TIME * time);
+    BACNET_STACK_EXPORT
+    void Schedule_Compile(SCHEDULE_DESCR * desc,
+        BACNET_DATE * date);
+    BACNET_STACK_EXPORT
+    void Schedule_Evaluate(SCHEDULE_DESCR * desc,
+        BACNET_DATE * date,
+        BACNET_TIME * time);
 
 #ifdef __cplusplus
 }
@@ -60,6 +60,7 @@ static const int Time_Value_Properties_Optional[] = { PROP_DESCRIPTION,
     PROP_EVENT_STATE, PROP_OUT_OF_SERVICE, -1 };
 
 static const int Time_Value_Properties_Proprietary[] = { -1 };
+static struct special_property_list_bitmap_t Property_List_Bitmap;
 
 /* standard properties that are arrays for this object,
    but not necessary supported in this object */
@@ -633,7 +634,8 @@ bool Time_Value_Write_Property(BACNET_WRITE_PROPERTY_DATA *wp_data)
             }
             break;
         default:
-            if (property_lists_member(Time_Value_Properties_Required,
+            if (property_lists_bitmap_member(
+                    &Property_List_Bitmap, Time_Value_Properties_Required,
                     Time_Value_Properties_Optional,
                     Time_Value_Properties_Proprietary,
                     wp_data->object_property)) {
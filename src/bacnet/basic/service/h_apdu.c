@@ -642,6 +642,7 @@ void apdu_handler(
                     Confirmed_ACK_Function[service_choice].simple(
                         src, invoke_id);
                 }
+                tsm_transaction_reply(src, invoke_id, TSM_TRANSACTION_ACK);
                 tsm_free_invoke_id(invoke_id);
             }
             break;
@@ -674,6 +675,7 @@ void apdu_handler(
                             &service_ack_data);
                     }
                 }
+                tsm_transaction_reply(src, invoke_id, TSM_TRANSACTION_ACK);
                 tsm_free_invoke_id(invoke_id);
             }
             break;
@@ -707,6 +709,7 @@ void apdu_handler(
                         (BACNET_ERROR_CODE)error_code);
                 }
             }
+            tsm_transaction_reply(src, invoke_id, TSM_TRANSACTION_ERROR);
             tsm_free_invoke_id(invoke_id);
             break;
         case PDU_TYPE_REJECT:
@@ -718,6 +721,10 @@ void apdu_handler(
             if (Reject_Function) {
                 Reject_Function(src, invoke_id, reason);
             }
+            tsm_transaction_reply(src, invoke_id,
+                (reason == REJECT_REASON_BUFFER_OVERFLOW)
+                    ? TSM_TRANSACTION_TOO_LONG
+                    : TSM_TRANSACTION_ERROR);
             tsm_free_invoke_id(invoke_id);
             break;
         case PDU_TYPE_ABORT:
@@ -730,6 +737,13 @@ void apdu_handler(
             if (Abort_Function) {
                 Abort_Function(src, invoke_id, reason, server);
             }
+            /* a server that could not take the whole request */
+            tsm_transaction_reply(src, invoke_id,
+                (server &&
+                    ((reason == ABORT_REASON_BUFFER_OVERFLOW) ||
+                        (reason == ABORT_REASON_APDU_TOO_LONG)))
+                    ? TSM_TRANSACTION_TOO_LONG
+                    : TSM_TRANSACTION_ERROR);
             tsm_free_invoke_id(invoke_id);
             break;
 #endif
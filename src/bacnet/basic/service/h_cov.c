@@ -46,11 +46,15 @@
 #include "bacnet/basic/tsm/tsm.h"
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/tmwheel.h"
 #include "bacnet/datalink/datalink.h"
 
 #ifndef MAX_COV_PROPERTIES
 #define MAX_COV_PROPERTIES 2
 #endif
+/* longest time the lifetime timer of a subscription is armed for,
+   so that the interval in milliseconds fits */
+#define COV_LIFETIME_TIMER_SECONDS 86400UL
 
 /** @file h_cov.c  Handles Change of Value (COV) services. */
 
@@ -74,6 +78,8 @@ typedef struct BACnet_COV_Subscription {
     uint32_t subscriberProcessIdentifier;
     uint32_t lifetime; /* optional */
     BACNET_OBJECT_ID monitoredObjectIdentifier;
+    /* counts down the lifetime from when it was last set */
+    struct tmwheel_timer timer;
 } BACNET_COV_SUBSCRIPTION;
 
 #ifndef MAX_COV_SUBCRIPTIONS
@@ -178,6 +184,105 @@ static int cov_address_add(BACNET_ADDRESS *dest)
     return index;
 }
 
+/**
+ * Gets the seconds that remain of the lifetime of a subscription
+ *
+ * @param cov_subscription  Subscription with a lifetime
+ *
+ * @return seconds remaining, or 0 for an indefinite lifetime
+ */
+static uint32_t cov_lifetime_remaining(BACNET_COV_SUBSCRIPTION *cov_subscription)
+{
+    unsigned long elapsed;
+
+    if (!tmwheel_timer_pending(&cov_subscription->timer)) {
+        return cov_subscription->lifetime;
+    }
+    elapsed = (tmwheel_timer_interval(&cov_subscription->timer) -
+                  tmwheel_timer_remaining(&cov_subscription->timer)) /
+        1000UL;
+    if (elapsed >= cov_subscription->lifetime) {
+        return 1;
+    }
+
+    return cov_subscription->lifetime - (uint32_t)elapsed;
+}
+
+/**
+ * Arms the timer for the lifetime of a subscription, or cancels it
+ * for an indefinite lifetime
+ *
+ * @param cov_subscription  Subscription with its lifetime set
+ */
+static void cov_lifetime_timer_set(BACNET_COV_SUBSCRIPTION *cov_subscription)
+{
+    unsigned long seconds = cov_subscription->lifetime;
+
+    if (seconds == 0) {
+        tmwheel_timer_cancel(&cov_subscription->timer);
+        return;
+    }
+    if (seconds > COV_LIFETIME_TIMER_SECONDS) {
+        seconds = COV_LIFETIME_TIMER_SECONDS;
+    }
+    tmwheel_timer_set(&cov_subscription->timer, seconds * 1000UL);
+}
+
+/**
+ * Removes a subscription whose lifetime has ended
+ *
+ * @param cov_subscription  Subscription to remove
+ */
+static void cov_lifetime_expire(BACNET_COV_SUBSCRIPTION *cov_subscription)
+{
+#if PRINT_ENABLED
+    fprintf(stderr, "COVtimer: PID=%u ",
+        cov_subscription->subscriberProcessIdentifier);
+    fprintf(stderr, "%s %u ",
+        bactext_object_type_name(
+            cov_subscription->monitoredObjectIdentifier.type),
+        cov_subscription->monitoredObjectIdentifier.instance);
+    fprintf(stderr, "time remaining=%u seconds ", cov_subscription->lifetime);
+    fprintf(stderr, "\n");
+#endif
+    tmwheel_timer_cancel(&cov_subscription->timer);
+    cov_subscription->lifetime = 0;
+    /* initialize with invalid COV address */
+    cov_subscription->flag.valid = false;
+    cov_subscription->dest_index = MAX_COV_ADDRESSES;
+    cov_address_remove_unused();
+    if (cov_subscription->flag.issueConfirmedNotifications) {
+        if (cov_subscription->invokeID) {
+            tsm_free_invoke_id(cov_subscription->invokeID);
+            cov_subscription->invokeID = 0;
+        }
+    }
+}
+
+/**
+ * Counts down the lifetime of a subscription when its timer expires
+ *
+ * @param timer  Timer that expired
+ * @param context  Subscription of the timer
+ */
+static void cov_lifetime_timer_handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    BACNET_COV_SUBSCRIPTION *cov_subscription = context;
+    uint32_t elapsed_seconds;
+
+    if (!cov_subscription->flag.valid) {
+        return;
+    }
+    elapsed_seconds = (uint32_t)(tmwheel_timer_interval(timer) / 1000UL);
+    if (cov_subscription->lifetime > elapsed_seconds) {
+        cov_subscription->lifetime -= elapsed_seconds;
+        cov_lifetime_timer_set(cov_subscription);
+    } else {
+        cov_lifetime_expire(cov_subscription);
+    }
+}
+
 /*
 BACnetCOVSubscription ::= SEQUENCE {
 Recipient [0] BACnetRecipientProcess,
@@ -276,8 +381,8 @@ static int cov_encode_subscription(
         &apdu[apdu_len], 2, cov_subscription->flag.issueConfirmedNotifications);
     apdu_len += len;
     /* TimeRemaining [3] Unsigned, */
-    len =
-        encode_context_unsigned(&apdu[apdu_len], 3, cov_subscription->lifetime);
+    len = encode_context_unsigned(
+        &apdu[apdu_len], 3, cov_lifetime_remaining(cov_subscription));
     apdu_len += len;
 
     return apdu_len;
@@ -325,6 +430,9 @@ void handler_cov_init(void)
     unsigned index = 0;
 
     for (index = 0; index < MAX_COV_SUBCRIPTIONS; index++) {
+        tmwheel_timer_cancel(&COV_Subscriptions[index].timer);
+        tmwheel_timer_init(&COV_Subscriptions[index].timer,
+            cov_lifetime_timer_handler, &COV_Subscriptions[index]);
         /* initialize with invalid COV address */
         COV_Subscriptions[index].flag.valid = false;
         COV_Subscriptions[index].dest_index = MAX_COV_ADDRESSES;
@@ -376,6 +484,7 @@ static bool cov_list_subscribe(BACNET_ADDRESS *src,
                 address_match) {
                 existing_entry = true;
                 if (cov_data->cancellationRequest) {
+                    tmwheel_timer_cancel(&COV_Subscriptions[index].timer);
                     /* initialize with invalid COV address */
                     COV_Subscriptions[index].flag.valid = false;
                     COV_Subscriptions[index].dest_index = MAX_COV_ADDRESSES;
@@ -385,6 +494,7 @@ static bool cov_list_subscribe(BACNET_ADDRESS *src,
                     COV_Subscriptions[index].flag.issueConfirmedNotifications =
                         cov_data->issueConfirmedNotifications;
                     COV_Subscriptions[index].lifetime = cov_data->lifetime;
+                    cov_lifetime_timer_set(&COV_Subscriptions[index]);
                     COV_Subscriptions[index].flag.send_requested = true;
                 }
                 if (COV_Subscriptions[index].invokeID) {
@@ -415,6 +525,7 @@ static bool cov_list_subscribe(BACNET_ADDRESS *src,
             cov_data->issueConfirmedNotifications;
         COV_Subscriptions[index].invokeID = 0;
         COV_Subscriptions[index].lifetime = cov_data->lifetime;
+        cov_lifetime_timer_set(&COV_Subscriptions[index]);
         COV_Subscriptions[index].flag.send_requested = true;
     } else if (!existing_entry) {
         if (first_invalid_index < 0) {
@@ -476,7 +587,7 @@ static bool cov_send_request(BACNET_COV_SUBSCRIPTION *cov_subscription,
         cov_subscription->monitoredObjectIdentifier.type;
     cov_data.monitoredObjectIdentifier.instance =
         cov_subscription->monitoredObjectIdentifier.instance;
-    cov_data.timeRemaining = cov_subscription->lifetime;
+    cov_data.timeRemaining = cov_lifetime_remaining(cov_subscription);
     cov_data.listOfValues = value_list;
     if (cov_subscription->flag.issueConfirmedNotifications) {
         npdu_data.data_expecting_reply = true;
@@ -495,8 +606,12 @@ static bool cov_send_request(BACNET_COV_SUBSCRIPTION *cov_subscription,
     }
     pdu_len += len;
     if (cov_subscription->flag.issueConfirmedNotifications) {
-        tsm_set_confirmed_unsegmented_transaction(invoke_id, dest, &npdu_data,
-            &Handler_Transmit_Buffer[0], (uint16_t)pdu_len);
+        if (!tsm_set_confirmed_unsegmented_transaction(invoke_id, dest,
+                &npdu_data, &Handler_Transmit_Buffer[0], (uint16_t)pdu_len)) {
+            /* the invoke ID was freed - send it on a later pass */
+            cov_subscription->invokeID = 0;
+            goto COV_FAILED;
+        }
     }
     bytes_sent = datalink_send_pdu(
         dest, &npdu_data, &Handler_Transmit_Buffer[0], pdu_len);
@@ -517,38 +632,17 @@ static void cov_lifetime_expiration_handler(
 {
     if (index < MAX_COV_SUBCRIPTIONS) {
         /* handle lifetime expiration */
-        if (lifetime_seconds >= elapsed_seconds) {
+        if (lifetime_seconds > elapsed_seconds) {
             COV_Subscriptions[index].lifetime -= elapsed_seconds;
 #if 0
             fprintf(stderr, "COVtimer: subscription[%d].lifetime=%lu\n", index,
                 (unsigned long) COV_Subscriptions[index].lifetime);
 #endif
+            /* the timer counts down from the new lifetime */
+            cov_lifetime_timer_set(&COV_Subscriptions[index]);
         } else {
-            COV_Subscriptions[index].lifetime = 0;
-        }
-        if (COV_Subscriptions[index].lifetime == 0) {
             /* expire the subscription */
-#if PRINT_ENABLED
-            fprintf(stderr, "COVtimer: PID=%u ",
-                COV_Subscriptions[index].subscriberProcessIdentifier);
-            fprintf(stderr, "%s %u ",
-                bactext_object_type_name(
-                    COV_Subscriptions[index].monitoredObjectIdentifier.type),
-                COV_Subscriptions[index].monitoredObjectIdentifier.instance);
-            fprintf(stderr, "time remaining=%u seconds ",
-                COV_Subscriptions[index].lifetime);
-            fprintf(stderr, "\n");
-#endif
-            /* initialize with invalid COV address */
-            COV_Subscriptions[index].flag.valid = false;
-            COV_Subscriptions[index].dest_index = MAX_COV_ADDRESSES;
-            cov_address_remove_unused();
-            if (COV_Subscriptions[index].flag.issueConfirmedNotifications) {
-                if (COV_Subscriptions[index].invokeID) {
-                    tsm_free_invoke_id(COV_Subscriptions[index].invokeID);
-                    COV_Subscriptions[index].invokeID = 0;
-                }
-            }
+            cov_lifetime_expire(&COV_Subscriptions[index]);
         }
     }
 }
@@ -572,6 +666,11 @@ static void cov_lifetime_expiration_handler(
  * @note worst case tasking: MS/TP with the ability to send only
  *        one notification per task cycle.
  *
+ * @note Each subscription also has a lifetime timer on the timer wheel,
+ *  so applications that call tmwheel_run() do not need to call this
+ *  handler.  When both are used, this handler restarts the timer from
+ *  the lifetime that remains, so the time is not counted twice.
+ *
  * @param elapsed_seconds [in] How many seconds have elapsed since last called.
  */
 void handler_cov_timer_seconds(uint32_t elapsed_seconds)
@@ -46,6 +46,163 @@
 
 /** @file h_rpm_a.c  Handles Read Property Multiple Acknowledgments. */
 
+/* number of array elements decoded at a time by the bulk decoders */
+#ifndef RPM_ACK_ARRAY_CHUNK
+#define RPM_ACK_ARRAY_CHUNK 16
+#endif
+
+/**
+ * @brief Decode a run of array elements of a single datatype, such as
+ *  a Priority_Array or an Object_List, with the bulk array decoders.
+ *  The first element is decoded into the value, and the other elements
+ *  into values that are allocated and linked after it.
+ * @param apdu [in] The buffer holding the array elements.
+ * @param apdu_size [in] The number of bytes in the buffer.
+ * @param property [in] The property identifier of the array.
+ * @param value [in,out] The value for the first element, and on return,
+ *  the value holding the last decoded element.
+ * @return The number of bytes decoded, or 0 if the elements are left
+ *  to the per-element decoder.
+ */
+static int rpm_ack_array_decode(uint8_t *apdu,
+    uint32_t apdu_size,
+    BACNET_PROPERTY_ID property,
+    BACNET_APPLICATION_DATA_VALUE **value)
+{
+    union {
+#if defined(BACAPP_UNSIGNED)
+        BACNET_UNSIGNED_INTEGER Unsigned_Int[RPM_ACK_ARRAY_CHUNK];
+#endif
+#if defined(BACAPP_ENUMERATED)
+        uint32_t Enumerated[RPM_ACK_ARRAY_CHUNK];
+#endif
+#if defined(BACAPP_REAL)
+        float Real[RPM_ACK_ARRAY_CHUNK];
+#endif
+#if defined(BACAPP_OBJECT_ID)
+        BACNET_OBJECT_ID Object_Id[RPM_ACK_ARRAY_CHUNK];
+#endif
+        uint8_t unused;
+    } element;
+    bool null_value[RPM_ACK_ARRAY_CHUNK] = { false };
+    BACNET_APPLICATION_DATA_VALUE *pValue = NULL;
+    BACNET_APPLICATION_DATA_VALUE *next_value = NULL;
+    uint8_t tag_number = BACNET_APPLICATION_TAG_NULL;
+    uint32_t offset = 0;
+    uint32_t count = 0;
+    uint32_t i = 0;
+    int len = 0;
+
+    if (!apdu || !value || !*value) {
+        return 0;
+    }
+    if (property == PROP_PRIORITY_ARRAY) {
+        /* the datatype is that of the first slot that is not NULL */
+        while ((offset < apdu_size) &&
+            (apdu[offset] == BACNET_APPLICATION_TAG_NULL)) {
+            offset++;
+        }
+        if ((offset < apdu_size) && !IS_CONTEXT_SPECIFIC(apdu[offset])) {
+            tag_number = (uint8_t)(apdu[offset] >> 4);
+        } else {
+            /* every slot is NULL */
+            tag_number = BACNET_APPLICATION_TAG_ENUMERATED;
+        }
+    } else if (property == PROP_OBJECT_LIST) {
+        tag_number = BACNET_APPLICATION_TAG_OBJECT_ID;
+    } else {
+        return 0;
+    }
+    switch (tag_number) {
+#if defined(BACAPP_UNSIGNED)
+        case BACNET_APPLICATION_TAG_UNSIGNED_INT:
+            len = bacnet_unsigned_application_array_decode(apdu, apdu_size,
+                element.Unsigned_Int, null_value, RPM_ACK_ARRAY_CHUNK, &count);
+            break;
+#endif
+#if defined(BACAPP_ENUMERATED)
+        case BACNET_APPLICATION_TAG_ENUMERATED:
+            len = bacnet_enumerated_application_array_decode(apdu, apdu_size,
+                element.Enumerated, null_value, RPM_ACK_ARRAY_CHUNK, &count);
+            break;
+#endif
+#if defined(BACAPP_REAL)
+        case BACNET_APPLICATION_TAG_REAL:
+            len = bacnet_real_application_array_decode(apdu, apdu_size,
+                element.Real, null_value, RPM_ACK_ARRAY_CHUNK, &count);
+            break;
+#endif
+#if defined(BACAPP_OBJECT_ID)
+        case BACNET_APPLICATION_TAG_OBJECT_ID:
+            len = bacnet_object_id_application_array_decode(apdu, apdu_size,
+                element.Object_Id, RPM_ACK_ARRAY_CHUNK, &count);
+            break;
+#endif
+        default:
+            break;
+    }
+    if ((len <= 0) || (count == 0)) {
+        /* malformed data is reported by the per-element decoder */
+        return 0;
+    }
+    /* allocate the values first, so that nothing is decoded twice */
+    for (i = 1; i < count; i++) {
+        pValue = calloc(1, sizeof(BACNET_APPLICATION_DATA_VALUE));
+        if (!pValue) {
+            while (next_value) {
+                pValue = next_value;
+                next_value = next_value->next;
+                free(pValue);
+            }
+            return 0;
+        }
+        pValue->next = next_value;
+        next_value = pValue;
+    }
+    pValue = *value;
+    for (i = 0; i < count; i++) {
+        if (i > 0) {
+            pValue->next = next_value;
+            pValue = next_value;
+            next_value = next_value->next;
+            pValue->next = NULL;
+        }
+        pValue->context_specific = false;
+        if (null_value[i]) {
+            pValue->tag = BACNET_APPLICATION_TAG_NULL;
+            continue;
+        }
+        pValue->tag = tag_number;
+        switch (tag_number) {
+#if defined(BACAPP_UNSIGNED)
+            case BACNET_APPLICATION_TAG_UNSIGNED_INT:
+                pValue->type.Unsigned_Int = element.Unsigned_Int[i];
+                break;
+#endif
+#if defined(BACAPP_ENUMERATED)
+            case BACNET_APPLICATION_TAG_ENUMERATED:
+                pValue->type.Enumerated = element.Enumerated[i];
+                break;
+#endif
+#if defined(BACAPP_REAL)
+            case BACNET_APPLICATION_TAG_REAL:
+                pValue->type.Real = element.Real[i];
+                break;
+#endif
+#if defined(BACAPP_OBJECT_ID)
+            case BACNET_APPLICATION_TAG_OBJECT_ID:
+                pValue->type.Object_Id = element.Object_Id[i];
+                break;
+#endif
+            default:
+                break;
+        }
+    }
+    *value = pValue;
+
+    return len;
+}
+
 /** Decode the received RPM data and make a linked list of the results.
  * @ingroup DSRPM
  *
@@ -131,9 +288,14 @@ int rpm_ack_decode_service_request(
                     apdu++;
                 } else {
                     while (value && (apdu_len > 0)) {
-                        len = bacapp_decode_known_property(apdu,
-                            (unsigned)apdu_len, value, rpm_object->object_type,
-                            rpm_property->propertyIdentifier);
+                        len = rpm_ack_array_decode(apdu, (uint32_t)apdu_len,
+                            rpm_property->propertyIdentifier, &value);
+                        if (len == 0) {
+                            len = bacapp_decode_known_property(apdu,
+                                (unsigned)apdu_len, value,
+                                rpm_object->object_type,
+                                rpm_property->propertyIdentifier);
+                        }
                         /* If len == 0 then it's an empty structure, which is
                          * OK. */
                         if (len < 0) {
@@ -30,15 +30,248 @@
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
+#include "bacnet/bacaddr.h"
 #include "bacnet/bacdcode.h"
 #include "bacnet/whois.h"
 #include "bacnet/iam.h"
 #include "bacnet/basic/object/device.h"
 #include "bacnet/basic/services.h"
+#include "bacnet/basic/sys/mstimer.h"
 #include "bacnet/basic/tsm/tsm.h"
 
 /** @file h_whois.c  Handles Who-Is requests. */
 
+/* number of Who-Is source addresses with a token bucket */
+#ifndef WHO_IS_RATE_LIMIT_SIZE
+#define WHO_IS_RATE_LIMIT_SIZE 16
+#endif
+/* number of recent I-Am responses remembered for coalescing */
+#ifndef WHO_IS_COALESCE_SIZE
+#define WHO_IS_COALESCE_SIZE (4 * MAX_NUM_DEVICES)
+#endif
+
+struct who_is_rate_limit {
+    BACNET_ADDRESS src;
+    uint16_t tokens;
+    /* mstimer_now() value when the bucket was last refilled */
+    unsigned long time;
+};
+static struct who_is_rate_limit Rate_Limit[WHO_IS_RATE_LIMIT_SIZE];
+static unsigned Rate_Limit_Count;
+/* token bucket size - zero disables the rate limit */
+static uint16_t Rate_Limit_Tokens;
+static uint16_t Rate_Limit_Interval;
+
+struct who_is_coalesce {
+    uint32_t device_id;
+    BACNET_ADDRESS dest;
+    /* mstimer_now() value when the I-Am was sent */
+    unsigned long time;
+    bool in_use;
+};
+static struct who_is_coalesce Coalesce[WHO_IS_COALESCE_SIZE];
+/* coalescing window in milliseconds - zero disables coalescing */
+static uint16_t Coalesce_Window;
+
+/**
+ * @brief Configure the Who-Is flood suppression.  Each source address
+ *  has a bucket of tokens, and each Who-Is from that address that is
+ *  answered with an I-Am takes a token.  Who-Is requests are ignored
+ *  while the bucket is empty.  One token is returned to each bucket
+ *  every interval, counted with mstimer_now() when the next Who-Is
+ *  arrives, so no timer is needed.
+ * @param tokens - size of the token bucket, or zero to disable
+ * @param interval - milliseconds to refill one token
+ */
+void handler_who_is_rate_limit_set(uint16_t tokens, uint16_t interval)
+{
+    Rate_Limit_Tokens = tokens;
+    Rate_Limit_Interval = interval;
+    Rate_Limit_Count = 0;
+}
+
+/**
+ * @brief Configure the coalescing of I-Am responses.  An I-Am that is
+ *  the same as one sent to the same destination within the window is
+ *  not sent again, so overlapping Who-Is ranges get a single response.
+ * @param milliseconds - coalescing window, or zero to disable
+ */
+void handler_who_is_coalesce_window_set(uint16_t milliseconds)
+{
+    Coalesce_Window = milliseconds;
+    memset(Coalesce, 0, sizeof(Coalesce));
+}
+
+/**
+ * @brief Return the tokens of the intervals since the bucket was last
+ *  refilled.  A full bucket starts its interval again.
+ * @param bucket - token bucket of a source address
+ */
+static void who_is_rate_limit_refill(struct who_is_rate_limit *bucket)
+{
+    unsigned long now = mstimer_now();
+    unsigned long count;
+
+    if ((bucket->tokens < Rate_Limit_Tokens) && (Rate_Limit_Interval > 0)) {
+        count = (now - bucket->time) / Rate_Limit_Interval;
+        if (count < (unsigned long)(Rate_Limit_Tokens - bucket->tokens)) {
+            bucket->tokens += (uint16_t)count;
+            bucket->time += count * Rate_Limit_Interval;
+            return;
+        }
+        bucket->tokens = Rate_Limit_Tokens;
+    }
+    if (bucket->tokens == Rate_Limit_Tokens) {
+        bucket->time = now;
+    }
+}
+
+/**
+ * @brief Take a token from the bucket of the Who-Is source address
+ * @param src - source address of the Who-Is, or NULL
+ * @return true if the Who-Is may be answered
+ */
+static bool who_is_rate_limit_take(BACNET_ADDRESS *src)
+{
+    BACNET_ADDRESS unknown = { 0 };
+    struct who_is_rate_limit *bucket = NULL;
+    unsigned i;
+
+    if (Rate_Limit_Tokens == 0) {
+        return true;
+    }
+    if (!src) {
+        src = &unknown;
+    }
+    for (i = 0; i < Rate_Limit_Count; i++) {
+        if (bacnet_address_same(&Rate_Limit[i].src, src)) {
+            bucket = &Rate_Limit[i];
+            break;
+        }
+    }
+    if (!bucket) {
+        if (Rate_Limit_Count < WHO_IS_RATE_LIMIT_SIZE) {
+            bucket = &Rate_Limit[Rate_Limit_Count];
+            Rate_Limit_Count++;
+        } else {
+            /* reuse the fullest bucket - the quietest source */
+            bucket = &Rate_Limit[0];
+            for (i = 1; i < Rate_Limit_Count; i++) {
+                if (Rate_Limit[i].tokens > bucket->tokens) {
+                    bucket = &Rate_Limit[i];
+                }
+            }
+        }
+        bacnet_address_copy(&bucket->src, src);
+        bucket->tokens = Rate_Limit_Tokens;
+    }
+    who_is_rate_limit_refill(bucket);
+    if (bucket->tokens == 0) {
+        return false;
+    }
+    bucket->tokens--;
+
+    return true;
+}
+
+/**
+ * @brief Determine if a coalescing entry was sent within the window
+ * @param entry - coalescing entry
+ * @return true if the entry has not expired
+ */
+static bool who_is_coalesce_active(const struct who_is_coalesce *entry)
+{
+    return entry->in_use && ((mstimer_now() - entry->time) < Coalesce_Window);
+}
+
+/**
+ * @brief Find the coalescing entry of an I-Am sent within the window
+ * @param device_id - device instance of the I-Am
+ * @param dest - destination of the I-Am
+ * @return true if the same I-Am was sent to the same destination
+ */
+static bool who_is_coalesce_find(uint32_t device_id, BACNET_ADDRESS *dest)
+{
+    unsigned i;
+
+    for (i = 0; i < WHO_IS_COALESCE_SIZE; i++) {
+        if (who_is_coalesce_active(&Coalesce[i]) &&
+            (Coalesce[i].device_id == device_id) &&
+            bacnet_address_same(&Coalesce[i].dest, dest)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Remember an I-Am that was sent, replacing an expired entry or
+ *  else the entry closest to expiring
+ * @param device_id - device instance of the I-Am
+ * @param dest - destination of the I-Am
+ */
+static void who_is_coalesce_add(uint32_t device_id, BACNET_ADDRESS *dest)
+{
+    struct who_is_coalesce *entry = &Coalesce[0];
+    unsigned i;
+
+    for (i = 1; i < WHO_IS_COALESCE_SIZE; i++) {
+        if (!who_is_coalesce_active(entry)) {
+            break;
+        }
+        if (!who_is_coalesce_active(&Coalesce[i]) ||
+            ((long)(Coalesce[i].time - entry->time) < 0)) {
+            entry = &Coalesce[i];
+        }
+    }
+    entry->device_id = device_id;
+    bacnet_address_copy(&entry->dest, dest);
+    entry->time = mstimer_now();
+    entry->in_use = true;
+}
+
+/**
+ * @brief Send the I-Am of the current device unless the same I-Am was
+ *  sent to the same destination within the coalescing window.  The first
+ *  I-Am sent in reply to a Who-Is takes a token from the bucket of the
+ *  Who-Is source, so coalesced replies are not charged.
+ * @param dest - destination of a unicast I-Am, or NULL to broadcast
+ * @param src - source address of the Who-Is
+ * @param charged - true once a token was taken for this Who-Is
+ */
+static void who_is_send_i_am(
+    BACNET_ADDRESS *dest, BACNET_ADDRESS *src, bool *charged)
+{
+    BACNET_ADDRESS broadcast = { 0 };
+    BACNET_ADDRESS *coalesce_dest = dest;
+    uint32_t device_id = Device_Object_Instance_Number();
+
+    if (Coalesce_Window > 0) {
+        if (!coalesce_dest) {
+            broadcast.net = BACNET_BROADCAST_NETWORK;
+            coalesce_dest = &broadcast;
+        }
+        if (who_is_coalesce_find(device_id, coalesce_dest)) {
+            return;
+        }
+    }
+    if (!*charged) {
+        if (!who_is_rate_limit_take(src)) {
+            return;
+        }
+        *charged = true;
+    }
+    if (Coalesce_Window > 0) {
+        who_is_coalesce_add(device_id, coalesce_dest);
+    }
+    if (dest) {
+        Send_I_Am_Unicast(&Handler_Transmit_Buffer[0], dest);
+    } else {
+        Send_I_Am(&Handler_Transmit_Buffer[0]);
+    }
+}
+
 /** Handler for Who-Is requests, with broadcast I-Am response.
  * @ingroup DMDDB
  * @param service_request [in] The received message to be handled.
@@ -51,17 +284,17 @@ void handler_who_is(
     int len = 0;
     int32_t low_limit = 0;
     int32_t high_limit = 0;
+    bool charged = false;
 
-    (void)src;
     len = whois_decode_service_request(
         service_request, service_len, &low_limit, &high_limit);
     if (len == 0) {
-        Send_I_Am(&Handler_Transmit_Buffer[0]);
+        who_is_send_i_am(NULL, src, &charged);
     } else if (len != BACNET_STATUS_ERROR) {
         /* is my device id within the limits? */
         if ((Device_Object_Instance_Number() >= (uint32_t)low_limit) &&
             (Device_Object_Instance_Number() <= (uint32_t)high_limit)) {
-            Send_I_Am(&Handler_Transmit_Buffer[0]);
+            who_is_send_i_am(NULL, src, &charged);
         }
     }
 
@@ -82,17 +315,18 @@ void handler_who_is_unicast(
     int len = 0;
     int32_t low_limit = 0;
     int32_t high_limit = 0;
+    bool charged = false;
 
     len = whois_decode_service_request(
         service_request, service_len, &low_limit, &high_limit);
     /* If no limits, then always respond */
     if (len == 0) {
-        Send_I_Am_Unicast(&Handler_Transmit_Buffer[0], src);
+        who_is_send_i_am(src, src, &charged);
     } else if (len != BACNET_STATUS_ERROR) {
         /* is my device id within the limits? */
         if ((Device_Object_Instance_Number() >= (uint32_t)low_limit) &&
             (Device_Object_Instance_Number() <= (uint32_t)high_limit)) {
-            Send_I_Am_Unicast(&Handler_Transmit_Buffer[0], src);
+            who_is_send_i_am(src, src, &charged);
         }
     }
 
@@ -129,6 +363,7 @@ static void check_who_is_for_routing(uint8_t *service_request,
     int cursor = 0; /* Starting hint */
     int my_list[2] = { 0, -1 }; /* Not really used, so dummy values */
     BACNET_ADDRESS bcast_net;
+    bool charged = false;
 
     len = whois_decode_service_request(
         service_request, service_len, &low_limit, &high_limit);
@@ -145,10 +380,8 @@ static void check_who_is_for_routing(uint8_t *service_request,
         /* If len == 0, no limits and always respond */
         if ((len == 0) ||
             ((dev_instance >= low_limit) && (dev_instance <= high_limit))) {
-            if (is_unicast)
-                Send_I_Am_Unicast(&Handler_Transmit_Buffer[0], src);
-            else
-                Send_I_Am(&Handler_Transmit_Buffer[0]);
+            /* one token answers for every routed device */
+            who_is_send_i_am(is_unicast ? src : NULL, src, &charged);
         }
     }
 }
@@ -65,6 +65,14 @@ extern "C" {
         uint16_t service_len,
         BACNET_ADDRESS * src);
 
+    BACNET_STACK_EXPORT
+    void handler_who_is_rate_limit_set(
+        uint16_t tokens,
+        uint16_t interval);
+    BACNET_STACK_EXPORT
+    void handler_who_is_coalesce_window_set(
+        uint16_t milliseconds);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
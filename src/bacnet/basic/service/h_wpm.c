@@ -169,8 +169,15 @@ void handler_write_property_multiple(uint8_t *service_request,
         len = write_property_multiple_decode(
             service_request, service_len, &wp_data, NULL);
         if (len > 0) {
+            /* then write the data in order as one batch, so that each
+               written object reports its side effects once.  The values
+               are only checked as they are written, so the writes before
+               a failed write remain written, and their side effects are
+               applied when the batch ends. */
+            Device_Write_Property_Batch_Begin();
             len = write_property_multiple_decode(
                 service_request, service_len, &wp_data, Device_Write_Property);
+            Device_Write_Property_Batch_End();
         }
     }
     /* encode the confirmed reply */
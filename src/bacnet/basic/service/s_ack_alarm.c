@@ -90,8 +90,11 @@ uint8_t Send_Alarm_Acknowledgement_Address(uint8_t *pdu,
            we have a way to check for that and update the
            max_apdu in the address binding table. */
         if ((uint16_t)pdu_len < pdu_size) {
-            tsm_set_confirmed_unsegmented_transaction(
-                invoke_id, dest, &npdu_data, pdu, (uint16_t)pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(
+                    invoke_id, dest, &npdu_data, pdu, (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
             bytes_sent = datalink_send_pdu(dest, &npdu_data, pdu, pdu_len);
             if (bytes_sent <= 0) {
                 PRINTF("Failed to Send Alarm Ack Request (%s)!\n",
@@ -95,8 +95,12 @@ uint8_t Send_Atomic_Write_File_Stream(uint32_t device_id,
                we have a way to check for that and update the
                max_apdu in the address binding table. */
             if ((unsigned)pdu_len <= max_apdu) {
-                tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
-                    &npdu_data, &Handler_Transmit_Buffer[0], (uint16_t)pdu_len);
+                if (!tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
+                        &npdu_data, &Handler_Transmit_Buffer[0],
+                        (uint16_t)pdu_len)) {
+                    /* the invoke ID was freed: no buffer to send it again */
+                    return 0;
+                }
 #if PRINT_ENABLED
                 bytes_sent =
 #endif
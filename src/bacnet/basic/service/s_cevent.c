@@ -83,8 +83,11 @@ uint8_t Send_CEvent_Notify_Address(uint8_t *pdu,
            we have a way to check for that and update the
            max_apdu in the address binding table. */
         if ((uint16_t)pdu_len < pdu_size) {
-            tsm_set_confirmed_unsegmented_transaction(
-                invoke_id, dest, &npdu_data, pdu, (uint16_t)pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(
+                    invoke_id, dest, &npdu_data, pdu, (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
 #if PRINT_ENABLED
             bytes_sent =
 #endif
@@ -160,8 +160,12 @@ uint8_t Send_COV_Subscribe(
            we have a way to check for that and update the
            max_apdu in the address binding table. */
         if ((unsigned)pdu_len < max_apdu) {
-            tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
-                &npdu_data, &Handler_Transmit_Buffer[0], (uint16_t)pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
+                    &npdu_data, &Handler_Transmit_Buffer[0],
+                    (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
             bytes_sent = datalink_send_pdu(
                 &dest, &npdu_data, &Handler_Transmit_Buffer[0], pdu_len);
             if (bytes_sent <= 0) {
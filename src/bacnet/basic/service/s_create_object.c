@@ -98,8 +98,12 @@ uint8_t Send_Create_Object_Request_Data(
             len = create_object_encode_service_request(
                 &Handler_Transmit_Buffer[pdu_len], &data);
             pdu_len += len;
-            tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
-                &npdu_data, &Handler_Transmit_Buffer[0], (uint16_t)pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(invoke_id, &dest,
+                    &npdu_data, &Handler_Transmit_Buffer[0],
+                    (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
             bytes_sent = datalink_send_pdu(
                 &dest, &npdu_data, &Handler_Transmit_Buffer[0], pdu_len);
             if (bytes_sent <= 0) {
@@ -29,6 +29,7 @@
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
+#include "bacnet/bacaddr.h"
 #include "bacnet/bacdcode.h"
 #include "bacnet/dcc.h"
 #include "bacnet/npdu.h"
@@ -43,6 +44,52 @@
 
 /** @file s_iam.c  Send an I-Am message. */
 
+/* number of devices with a cached I-Am - one per routed device */
+#ifndef BACNET_IAM_CACHE_SIZE
+#define BACNET_IAM_CACHE_SIZE MAX_NUM_DEVICES
+#endif
+/* I-Am header, object identifier, 2 unsigned, and enumerated */
+#define BACNET_IAM_APDU_MAX 24
+
+struct iam_cache_entry {
+    /* the APDU is encoded from the Device ID and vendor identifier */
+    uint32_t device_id;
+    uint16_t vendor_id;
+    uint8_t apdu_len;
+    uint8_t apdu[BACNET_IAM_APDU_MAX];
+    /* the broadcast NPDU is encoded from the datalink addresses */
+    BACNET_ADDRESS my_address;
+    BACNET_ADDRESS dest;
+    uint8_t npdu_len;
+    uint8_t npdu[MAX_NPDU];
+};
+static struct iam_cache_entry IAm_Cache[BACNET_IAM_CACHE_SIZE];
+
+/**
+ * @brief Get the cache entry of the current device, with the I-Am APDU
+ *  encoded again if the Device ID or vendor identifier changed
+ * @return cache entry of the current device
+ */
+static struct iam_cache_entry *iam_cache_entry(void)
+{
+    struct iam_cache_entry *entry;
+    uint32_t device_id = Device_Object_Instance_Number();
+    uint16_t vendor_id = Device_Vendor_Identifier();
+
+    entry = &IAm_Cache[device_id % BACNET_IAM_CACHE_SIZE];
+    if ((entry->apdu_len == 0) || (entry->device_id != device_id) ||
+        (entry->vendor_id != vendor_id)) {
+        entry->device_id = device_id;
+        entry->vendor_id = vendor_id;
+        entry->apdu_len = (uint8_t)iam_encode_apdu(
+            entry->apdu, device_id, MAX_APDU, SEGMENTATION_NONE, vendor_id);
+        /* the broadcast PDU of another device is not reused */
+        entry->npdu_len = 0;
+    }
+
+    return entry;
+}
+
 /** Send a I-Am request to a remote network for a specific device.
  * @param target_address [in] BACnet address of target router
  * @param device_id [in] Device Instance 0 - 4194303
@@ -91,20 +138,28 @@ void Send_I_Am_To_Network(BACNET_ADDRESS *target_address,
 int iam_encode_pdu(
     uint8_t *buffer, BACNET_ADDRESS *dest, BACNET_NPDU_DATA *npdu_data)
 {
-    int len = 0;
     int pdu_len = 0;
     BACNET_ADDRESS my_address;
-    datalink_get_my_address(&my_address);
+    struct iam_cache_entry *entry;
 
+    datalink_get_my_address(&my_address);
     datalink_get_broadcast_address(dest);
-    /* encode the NPDU portion of the packet */
     npdu_encode_npdu_data(npdu_data, false, MESSAGE_PRIORITY_NORMAL);
-    pdu_len = npdu_encode_pdu(&buffer[0], dest, &my_address, npdu_data);
-
-    /* encode the APDU portion of the packet */
-    len = iam_encode_apdu(&buffer[pdu_len], Device_Object_Instance_Number(),
-        MAX_APDU, SEGMENTATION_NONE, Device_Vendor_Identifier());
-    pdu_len += len;
+    entry = iam_cache_entry();
+    if ((entry->npdu_len == 0) ||
+        !bacnet_address_same(&entry->my_address, &my_address) ||
+        !bacnet_address_same(&entry->dest, dest)) {
+        /* encode the NPDU portion of the packet */
+        bacnet_address_copy(&entry->my_address, &my_address);
+        bacnet_address_copy(&entry->dest, dest);
+        entry->npdu_len =
+            (uint8_t)npdu_encode_pdu(entry->npdu, dest, &my_address, npdu_data);
+    }
+    /* the cached NPDU and APDU portions of the packet */
+    memcpy(&buffer[0], entry->npdu, entry->npdu_len);
+    pdu_len = entry->npdu_len;
+    memcpy(&buffer[pdu_len], entry->apdu, entry->apdu_len);
+    pdu_len += entry->apdu_len;
 
     return pdu_len;
 }
@@ -163,6 +218,7 @@ int iam_unicast_encode_pdu(uint8_t *buffer,
     int apdu_len = 0;
     int pdu_len = 0;
     BACNET_ADDRESS my_address;
+    struct iam_cache_entry *entry;
     /* The destination will be the same as the src, so copy it over. */
     bacnet_address_copy(dest, src);
     /* dest->net = 0; - no, must direct back to src->net to meet BTL tests */
@@ -171,10 +227,10 @@ int iam_unicast_encode_pdu(uint8_t *buffer,
     /* encode the NPDU portion of the packet */
     npdu_encode_npdu_data(npdu_data, false, MESSAGE_PRIORITY_NORMAL);
     npdu_len = npdu_encode_pdu(&buffer[0], dest, &my_address, npdu_data);
-    /* encode the APDU portion of the packet */
-    apdu_len =
-        iam_encode_apdu(&buffer[npdu_len], Device_Object_Instance_Number(),
-            MAX_APDU, SEGMENTATION_NONE, Device_Vendor_Identifier());
+    /* the cached APDU portion of the packet */
+    entry = iam_cache_entry();
+    memcpy(&buffer[npdu_len], entry->apdu, entry->apdu_len);
+    apdu_len = entry->apdu_len;
     pdu_len = npdu_len + apdu_len;
 
     return pdu_len;
@@ -68,6 +68,7 @@ uint8_t Send_Read_Property_Request_Address(BACNET_ADDRESS *dest,
 {
     BACNET_ADDRESS my_address;
     uint8_t invoke_id = 0;
+    uint8_t *pdu = NULL;
     int len = 0;
     int pdu_len = 0;
     int bytes_sent = 0;
@@ -83,18 +84,23 @@ uint8_t Send_Read_Property_Request_Address(BACNET_ADDRESS *dest,
     /* is there a tsm available? */
     invoke_id = tsm_next_free_invokeID();
     if (invoke_id) {
-        /* encode the NPDU portion of the packet */
         datalink_get_my_address(&my_address);
         npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
-        pdu_len = npdu_encode_pdu(
-            &Handler_Transmit_Buffer[0], dest, &my_address, &npdu_data);
-        /* encode the APDU portion of the packet */
         data.object_type = object_type;
         data.object_instance = object_instance;
         data.object_property = object_property;
         data.array_index = array_index;
-        len =
-            rp_encode_apdu(&Handler_Transmit_Buffer[pdu_len], invoke_id, &data);
+        /* encode into the TSM buffer that is used for any retry */
+        pdu_len = npdu_encode_pdu(NULL, dest, &my_address, &npdu_data);
+        pdu_len += rp_encode_apdu(NULL, invoke_id, &data);
+        pdu = tsm_transaction_pdu_buffer(invoke_id, (uint16_t)pdu_len);
+        if (!pdu) {
+            pdu = &Handler_Transmit_Buffer[0];
+        }
+        /* encode the NPDU portion of the packet */
+        pdu_len = npdu_encode_pdu(pdu, dest, &my_address, &npdu_data);
+        /* encode the APDU portion of the packet */
+        len = rp_encode_apdu(&pdu[pdu_len], invoke_id, &data);
         pdu_len += len;
         /* will it fit in the sender?
            note: if there is a bottleneck router in between
@@ -102,10 +108,12 @@ uint8_t Send_Read_Property_Request_Address(BACNET_ADDRESS *dest,
            we have a way to check for that and update the
            max_apdu in the address binding table. */
         if ((uint16_t)pdu_len < max_apdu) {
-            tsm_set_confirmed_unsegmented_transaction(invoke_id, dest,
-                &npdu_data, &Handler_Transmit_Buffer[0], (uint16_t)pdu_len);
-            bytes_sent = datalink_send_pdu(
-                dest, &npdu_data, &Handler_Transmit_Buffer[0], pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(
+                    invoke_id, dest, &npdu_data, pdu, (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
+            bytes_sent = datalink_send_pdu(dest, &npdu_data, pdu, pdu_len);
             if (bytes_sent <= 0) {
 #if PRINT_ENABLED
                 fprintf(stderr, "Failed to Send ReadProperty Request (%s)!\n",
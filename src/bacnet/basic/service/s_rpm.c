@@ -99,8 +99,11 @@ uint8_t Send_Read_Property_Multiple_Request(uint8_t *pdu,
            we have a way to check for that and update the
            max_apdu in the address binding table. */
         if ((unsigned)pdu_len < max_apdu) {
-            tsm_set_confirmed_unsegmented_transaction(
-                invoke_id, &dest, &npdu_data, &pdu[0], (uint16_t)pdu_len);
+            if (!tsm_set_confirmed_unsegmented_transaction(
+                    invoke_id, &dest, &npdu_data, &pdu[0], (uint16_t)pdu_len)) {
+                /* the invoke ID was freed: no buffer to send it again */
+                return 0;
+            }
 #if PRINT_ENABLED
             bytes_sent =
 #endif
@@ -0,0 +1,179 @@
+/**
+ * @file
+ * @brief Pool of fixed size buffers in several size classes
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/basic/sys/bufpool.h"
+
+/**
+ * @brief Get the index of the free buffer linked from a free buffer
+ * @param pool_class - size class
+ * @param index - index of a free buffer
+ * @return index of the next free buffer, or count if none
+ */
+static uint16_t bufpool_next_free(
+    const struct bufpool_class *pool_class, uint16_t index)
+{
+    uint16_t next;
+
+    /* the buffers are not aligned, so copy the link */
+    memcpy(&next, &pool_class->data[(size_t)index * pool_class->size],
+        sizeof(next));
+
+    return next;
+}
+
+/**
+ * @brief Link a buffer into the free list of its size class
+ * @param pool_class - size class
+ * @param index - index of the buffer being freed
+ */
+static void bufpool_link_free(struct bufpool_class *pool_class, uint16_t index)
+{
+    memcpy(&pool_class->data[(size_t)index * pool_class->size],
+        &pool_class->free_head, sizeof(pool_class->free_head));
+    pool_class->free_head = index;
+    pool_class->free_count++;
+}
+
+/**
+ * @brief Initialize a size class with every buffer free
+ * @param pool_class - size class
+ * @param data - block of memory of at least size * count bytes
+ * @param size - size of each buffer, at least 2 bytes
+ * @param count - number of buffers
+ */
+void bufpool_class_init(struct bufpool_class *pool_class,
+    uint8_t *data,
+    uint16_t size,
+    uint16_t count)
+{
+    uint16_t i;
+
+    if (!pool_class) {
+        return;
+    }
+    if (!data || (size < sizeof(uint16_t))) {
+        count = 0;
+    }
+    pool_class->data = data;
+    pool_class->size = size;
+    pool_class->count = count;
+    pool_class->free_head = count;
+    pool_class->free_count = 0;
+    /* link in reverse so that the first buffer is used first */
+    for (i = count; i > 0; i--) {
+        bufpool_link_free(pool_class, i - 1);
+    }
+}
+
+/**
+ * @brief Initialize a pool from its size classes
+ * @param pool - buffer pool
+ * @param classes - initialized size classes in order of increasing size
+ * @param class_count - number of size classes
+ */
+void bufpool_init(
+    struct bufpool *pool, struct bufpool_class *classes, unsigned class_count)
+{
+    if (pool) {
+        pool->classes = classes;
+        pool->class_count = classes ? class_count : 0;
+    }
+}
+
+/**
+ * @brief Take a buffer from the smallest size class that fits
+ * @param pool - buffer pool
+ * @param size - number of bytes needed
+ * @param capacity [out] size of the buffer, may be NULL
+ * @return buffer, or NULL if no size class that fits has a free buffer
+ */
+uint8_t *bufpool_alloc(struct bufpool *pool, uint16_t size, uint16_t *capacity)
+{
+    struct bufpool_class *pool_class;
+    uint16_t index;
+    unsigned i;
+
+    if (!pool) {
+        return NULL;
+    }
+    for (i = 0; i < pool->class_count; i++) {
+        pool_class = &pool->classes[i];
+        if ((pool_class->size >= size) && (pool_class->free_count > 0)) {
+            index = pool_class->free_head;
+            pool_class->free_head = bufpool_next_free(pool_class, index);
+            pool_class->free_count--;
+            if (capacity) {
+                *capacity = pool_class->size;
+            }
+            return &pool_class->data[(size_t)index * pool_class->size];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Return a buffer to its size class
+ * @param pool - buffer pool
+ * @param buffer - buffer from bufpool_alloc()
+ * @return true if the buffer belongs to the pool and was returned
+ */
+bool bufpool_free(struct bufpool *pool, uint8_t *buffer)
+{
+    struct bufpool_class *pool_class;
+    size_t offset;
+    unsigned i;
+
+    if (!pool || !buffer) {
+        return false;
+    }
+    for (i = 0; i < pool->class_count; i++) {
+        pool_class = &pool->classes[i];
+        if ((pool_class->count == 0) || (buffer < pool_class->data)) {
+            continue;
+        }
+        offset = (size_t)(buffer - pool_class->data);
+        if (offset >= ((size_t)pool_class->count * pool_class->size)) {
+            continue;
+        }
+        if ((offset % pool_class->size) != 0) {
+            return false;
+        }
+        bufpool_link_free(pool_class, (uint16_t)(offset / pool_class->size));
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Count the free buffers that can hold a given size
+ * @param pool - buffer pool
+ * @param size - number of bytes needed
+ * @return number of free buffers of at least the size
+ */
+unsigned bufpool_available(const struct bufpool *pool, uint16_t size)
+{
+    unsigned count = 0;
+    unsigned i;
+
+    if (pool) {
+        for (i = 0; i < pool->class_count; i++) {
+            if (pool->classes[i].size >= size) {
+                count += pool->classes[i].free_count;
+            }
+        }
+    }
+
+    return count;
+}
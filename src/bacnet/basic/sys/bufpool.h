@@ -0,0 +1,60 @@
+/**
+ * @file
+ * @brief API for a pool of fixed size buffers in several size classes
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ * Each size class is a block of memory given by the caller, split into
+ * buffers of the same size.  The free buffers of a class are linked
+ * through their first two bytes, so allocating and freeing are constant
+ * time and the pool needs no memory of its own beyond the classes.
+ * An allocation takes a buffer from the smallest class that fits the
+ * requested size and has a free buffer.
+ */
+#ifndef BACNET_SYS_BUFPOOL_H
+#define BACNET_SYS_BUFPOOL_H
+#include <stdint.h>
+#include <stdbool.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+
+struct bufpool_class {
+    /* count buffers of size bytes each */
+    uint8_t *data;
+    uint16_t size;
+    uint16_t count;
+    /* index of the first free buffer, or count if none are free */
+    uint16_t free_head;
+    uint16_t free_count;
+};
+
+struct bufpool {
+    /* size classes in order of increasing size */
+    struct bufpool_class *classes;
+    unsigned class_count;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+BACNET_STACK_EXPORT
+void bufpool_class_init(struct bufpool_class *pool_class,
+    uint8_t *data,
+    uint16_t size,
+    uint16_t count);
+BACNET_STACK_EXPORT
+void bufpool_init(struct bufpool *pool,
+    struct bufpool_class *classes,
+    unsigned class_count);
+BACNET_STACK_EXPORT
+uint8_t *bufpool_alloc(struct bufpool *pool, uint16_t size, uint16_t *capacity);
+BACNET_STACK_EXPORT
+bool bufpool_free(struct bufpool *pool, uint8_t *buffer);
+BACNET_STACK_EXPORT
+unsigned bufpool_available(const struct bufpool *pool, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
@@ -0,0 +1,200 @@
+/**
+ * @file
+ * @brief Priority array of commandable object properties using
+ *  a bitmask of the commanded priorities
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ */
+#include <stdint.h>
+#include <stdbool.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/basic/sys/commandable.h"
+
+/**
+ * @brief Find the least significant set bit of a mask
+ * @param mask - bits to search
+ * @return bit number 0..15 of the lowest set bit, or 16 if none are set
+ */
+unsigned commandable_lowest_bit(uint16_t mask)
+{
+#if defined(__GNUC__)
+    if (mask == 0) {
+        return 16;
+    }
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned bit = 0;
+
+    if (mask == 0) {
+        return 16;
+    }
+    if ((mask & 0x00FF) == 0) {
+        bit += 8;
+        mask >>= 8;
+    }
+    if ((mask & 0x000F) == 0) {
+        bit += 4;
+        mask >>= 4;
+    }
+    if ((mask & 0x0003) == 0) {
+        bit += 2;
+        mask >>= 2;
+    }
+    if ((mask & 0x0001) == 0) {
+        bit += 1;
+    }
+
+    return bit;
+#endif
+}
+
+/**
+ * @brief Resolve and cache the winning priority
+ * @param cmd - priority array
+ */
+static void commandable_resolve(struct commandable *cmd)
+{
+    if (cmd->active) {
+        cmd->priority = (uint8_t)(commandable_lowest_bit(cmd->active) + 1);
+    } else {
+        cmd->priority = 0;
+    }
+}
+
+/**
+ * @brief Initialize a priority array with every priority relinquished
+ * @param cmd - priority array
+ */
+void commandable_init(struct commandable *cmd)
+{
+    if (cmd) {
+        cmd->active = 0;
+        cmd->priority = 0;
+    }
+}
+
+/**
+ * @brief Mark a priority as holding a value.  The caller stores the value.
+ * @param cmd - priority array
+ * @param priority - priority 1..16
+ * @return true if the priority is now the winner, and the effective value
+ *  needs to be updated with the value stored at this priority
+ */
+bool commandable_command(struct commandable *cmd, unsigned priority)
+{
+    if (!cmd || (priority < 1) || (priority > BACNET_MAX_PRIORITY)) {
+        return false;
+    }
+    cmd->active |= (uint16_t)(1U << (priority - 1));
+    if ((cmd->priority == 0) || (priority <= cmd->priority)) {
+        cmd->priority = (uint8_t)priority;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Mark a priority as relinquished
+ * @param cmd - priority array
+ * @param priority - priority 1..16
+ * @return true if the winner changed, and the effective value needs to be
+ *  updated from the new winning priority or from the relinquish default
+ */
+bool commandable_relinquish(struct commandable *cmd, unsigned priority)
+{
+    uint8_t old_priority;
+
+    if (!cmd || (priority < 1) || (priority > BACNET_MAX_PRIORITY)) {
+        return false;
+    }
+    cmd->active &= (uint16_t)~(1U << (priority - 1));
+    old_priority = cmd->priority;
+    if (old_priority == priority) {
+        commandable_resolve(cmd);
+    }
+
+    return cmd->priority != old_priority;
+}
+
+/**
+ * @brief Get the winning priority
+ * @param cmd - priority array
+ * @return highest active priority 1..16, or 0 if all are relinquished
+ */
+unsigned commandable_priority(const struct commandable *cmd)
+{
+    if (cmd) {
+        return cmd->priority;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Determine if a priority holds a value
+ * @param cmd - priority array
+ * @param priority - priority 1..16
+ * @return true if the priority holds a value
+ */
+bool commandable_active(const struct commandable *cmd, unsigned priority)
+{
+    if (cmd && (priority >= 1) && (priority <= BACNET_MAX_PRIORITY)) {
+        return (cmd->active & (1U << (priority - 1))) != 0;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Find the next active priority after a given priority
+ * @param cmd - priority array
+ * @param priority - priority 0..16, where 0 finds the winner
+ * @return next lower active priority, numerically greater than the given
+ *  priority, or 0 if there is none
+ */
+unsigned commandable_next_priority(
+    const struct commandable *cmd, unsigned priority)
+{
+    uint16_t mask;
+
+    if (!cmd || (priority >= BACNET_MAX_PRIORITY)) {
+        return 0;
+    }
+    mask = cmd->active & (uint16_t)(0xFFFFU << priority);
+    if (mask) {
+        return commandable_lowest_bit(mask) + 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Determine if a REAL value changed by at least the COV increment
+ *  since it was last reported, and remember it when it did
+ * @param prior_value [in,out] value last reported
+ * @param value - new effective value
+ * @param increment - COV increment
+ * @return true if the value changed enough to report
+ */
+bool commandable_cov_real(float *prior_value, float value, float increment)
+{
+    float delta;
+
+    if (!prior_value) {
+        return false;
+    }
+    if (*prior_value > value) {
+        delta = *prior_value - value;
+    } else {
+        delta = value - *prior_value;
+    }
+    if (delta >= increment) {
+        *prior_value = value;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file
+ * @brief API for the priority array of commandable object properties
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ * The commanded priorities are kept as a 16-bit mask where bit 0 is
+ * priority 1.  The winning priority is resolved with a count of trailing
+ * zeros when a priority is commanded or relinquished, and cached, so that
+ * the object can cache its effective Present_Value as well and read it
+ * in constant time.  The values themselves stay in the object, in
+ * whatever type the object uses.
+ */
+#ifndef BACNET_SYS_COMMANDABLE_H
+#define BACNET_SYS_COMMANDABLE_H
+#include <stdint.h>
+#include <stdbool.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+
+struct commandable {
+    /* bit N is set when priority N+1 holds a value */
+    uint16_t active;
+    /* highest active priority 1..16, or 0 for the relinquish default */
+    uint8_t priority;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+BACNET_STACK_EXPORT
+unsigned commandable_lowest_bit(uint16_t mask);
+BACNET_STACK_EXPORT
+void commandable_init(struct commandable *cmd);
+BACNET_STACK_EXPORT
+bool commandable_command(struct commandable *cmd, unsigned priority);
+BACNET_STACK_EXPORT
+bool commandable_relinquish(struct commandable *cmd, unsigned priority);
+BACNET_STACK_EXPORT
+unsigned commandable_priority(const struct commandable *cmd);
+BACNET_STACK_EXPORT
+bool commandable_active(const struct commandable *cmd, unsigned priority);
+BACNET_STACK_EXPORT
+unsigned commandable_next_priority(
+    const struct commandable *cmd, unsigned priority);
+BACNET_STACK_EXPORT
+bool commandable_cov_real(float *prior_value, float value, float increment);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
@@ -33,9 +33,10 @@
 /** @file keylist.c  Keyed Linked List Library */
 
 /* */
-/* This is an enhanced array of pointers to data. */
+/* This is an enhanced array of data pointers. */
 /* The list is sorted, indexed, and keyed. */
-/* The array is much faster than a linked list. */
+/* The nodes are stored inline in one contiguous array */
+/* which is much faster than a linked list. */
 /* It stores a pointer to data, which you must */
 /* malloc and free on your own, or just use */
 /* static data */
@@ -43,78 +44,89 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include "bacnet/basic/sys/keylist.h"
 
+/* minimum number of nodes to allocate memory for */
+#define KEYLIST_CHUNK_SIZE 8
+
 /******************************************************************** */
 /* Generic node routines */
 /******************************************************************** */
 
-/** Grab memory for a node (Keylist_Node).
+/** Grab memory for a list (Keylist).
  *
  * @return Pointer to the allocated memory or
  *         NULL under an Out Of Memory situation.
  */
-static struct Keylist_Node *NodeCreate(void)
+static struct Keylist *KeylistCreate(void)
 {
-    return calloc(1, sizeof(struct Keylist_Node));
+    return calloc(1, sizeof(struct Keylist));
 }
 
-/** Grab memory for a list (Keylist).
+/** Resize the node array to hold the given number of nodes.
  *
- * @return Pointer to the allocated memory or
- *         NULL under an Out Of Memory situation.
+ * @param list  Pointer to the list to be resized.
+ * @param new_size  Number of nodes the array shall hold.
+ *
+ * @return Returns true if success, false if failed
  */
-static struct Keylist *KeylistCreate(void)
+static bool ResizeArray(OS_Keylist list, int new_size)
 {
-    return calloc(1, sizeof(struct Keylist));
+    struct Keylist_Node *new_array = NULL; /* new array of nodes */
+
+    new_array =
+        realloc(list->array, (size_t)new_size * sizeof(struct Keylist_Node));
+    if (!new_array) {
+        return false;
+    }
+    list->array = new_array;
+    list->size = new_size;
+
+    return true;
 }
 
-/** Check to see if the array is big enough for an addition
- * or is too big when we are deleting and we can shrink.
+/** Check to see if the array is big enough for an addition.
+ * The array grows by doubling, so that adding N nodes copies
+ * the array O(log N) times instead of O(N) times.
  *
  * @param list  Pointer to the list to be tested.
+ * @param count  Number of nodes the array shall hold.
  *
  * @return Returns true if success, false if failed
  */
-static bool CheckArraySize(OS_Keylist list)
+static bool CheckArrayGrow(OS_Keylist list, int count)
 {
-    int new_size = 0; /* set it up so that no size change is the default */
-    const int chunk = 8; /* minimum number of nodes to allocate memory for */
-    struct Keylist_Node **new_array = NULL; /* new array of nodes, if needed */
-    int i; /* counter */
+    int new_size;
+
     if (!list) {
         return false;
     }
-
-    /* indicates the need for more memory allocation */
-    if (list->count == list->size) {
-        new_size = list->size + chunk;
-
-        /* allow for shrinking memory */
-    } else if ((list->size > chunk) && (list->count < (list->size - chunk))) {
-        new_size = list->size - chunk;
+    if (count <= list->size) {
+        return true;
+    }
+    new_size = list->size;
+    while (new_size < count) {
+        new_size = (new_size < KEYLIST_CHUNK_SIZE) ? KEYLIST_CHUNK_SIZE
+                                                   : new_size * 2;
     }
-    if (new_size > 0) {
-        /* Allocate more room for node pointer array */
-        new_array = calloc((size_t)new_size, sizeof(struct Keylist_Node *));
 
-        /* See if we got the memory we wanted */
-        if (!new_array) {
-            return true;
-        }
+    return ResizeArray(list, new_size);
+}
 
-        /* copy the nodes from the old array to the new array */
-        if (list->array) {
-            for (i = 0; i < list->count; i++) {
-                new_array[i] = list->array[i];
-            }
-            free(list->array);
-        }
-        list->array = new_array;
-        list->size = new_size;
+/** Check to see if the array is too big when we are deleting
+ * and we can shrink.  The array shrinks by half when it is less
+ * than a quarter full, so that add and delete at the boundary
+ * do not thrash.
+ *
+ * @param list  Pointer to the list to be tested.
+ */
+static void CheckArrayShrink(OS_Keylist list)
+{
+    if ((list->size > KEYLIST_CHUNK_SIZE) && (list->count < (list->size / 4))) {
+        /* shrinking is optional, so failure is not an error */
+        (void)ResizeArray(list, list->size / 2);
     }
-
-    return true;
 }
 
 /** Find the index of the key that we are looking for.
@@ -123,6 +135,7 @@ static bool CheckArraySize(OS_Keylist list)
  * Returns the found key and the index where it was found in parameters.
  * If the key is not found, the nearest index from the bottom will be returned,
  * allowing the ability to find where an key should go into the list.
+ * When a key is duplicated, the index of the first one is returned.
  *
  * @param list  Pointer to the list
  * @param key  Key to search for
@@ -133,59 +146,40 @@ static bool CheckArraySize(OS_Keylist list)
  */
 static bool FindIndex(OS_Keylist list, KEY key, int *pIndex)
 {
-    struct Keylist_Node *node; /* holds the new node */
-    int left = 0; /* the left branch of tree, beginning of list */
-    int right = 0; /* the right branch on the tree, end of list */
-    int index = 0; /* our current search place in the array */
-    KEY current_key = 0; /* place holder for current node key */
-    bool status = false; /* return value */
+    const struct Keylist_Node *base; /* start of the search range */
+    int length; /* number of nodes in the search range */
+    int half;
 
-    if (!list) {
-        *pIndex = 0;
-        return false;
-    }
-    if (!list->array || !list->count) {
+    if (!list || !list->array || !list->count) {
         *pIndex = 0;
         return false;
     }
-    right = list->count - 1;
-    /* assume that the list is sorted */
-    do {
-        /* A binary search */
-        index = (left + right) / 2;
-        node = list->array[index];
-        if (!node) {
-            break;
-        }
-        current_key = node->key;
-        if (key < current_key) {
-            right = index - 1;
-
+    /* A lower bound binary search over the inline nodes, which has
+       a single data dependent step per probe and no pointer chasing */
+    base = list->array;
+    length = list->count;
+    while (length > 1) {
+        half = length / 2;
+        if (base[half - 1].key < key) {
+            base += half;
+            length -= half;
         } else {
-            left = index + 1;
-        }
-    } while ((key != current_key) && (left <= right));
-
-    if (key == current_key) {
-        status = true;
-        *pIndex = index;
-
-    } else {
-        /* where the index should be */
-        if (key > current_key) {
-            *pIndex = index + 1;
-
-        } else {
-            *pIndex = index;
+            length = half;
         }
     }
-    return status;
+    if (base->key < key) {
+        base++;
+    }
+    *pIndex = (int)(base - list->array);
+
+    return (*pIndex < list->count) && (base->key == key);
 }
 
 /******************************************************************** */
 /* list data functions */
 /******************************************************************** */
 /** Inserts a node into its sorted position.
+ * Keys that are added in increasing order are appended without a search.
  *
  * @param list  Pointer to the list
  * @param key  Key to be inserted
@@ -197,40 +191,56 @@ static bool FindIndex(OS_Keylist list, KEY key, int *pIndex)
  */
 int Keylist_Data_Add(OS_Keylist list, KEY key, void *data)
 {
-    struct Keylist_Node *node; /* holds the new node */
     int index = -1; /* return value */
-    int i; /* counts through the array */
 
-    if (list && CheckArraySize(list)) {
+    if (list && CheckArrayGrow(list, list->count + 1)) {
         /* figure out where to put the new node */
-        if (list->count) {
-            (void)FindIndex(list, key, &index);
-            if (index < 0) {
-                /* Add to the beginning of the list */
-                index = 0;
-
-            } else if (index > list->count) {
-                /* Add to the end of the list */
-                index = list->count;
+        if ((list->count == 0) || (list->array[list->count - 1].key < key)) {
+            index = list->count;
+        } else {
+            if (FindIndex(list, key, &index)) {
+                list->duplicates = true;
             }
             /* Move all the items up to make room for the new one */
-            for (i = list->count; i > index; i--) {
-                list->array[i] = list->array[i - 1];
-            }
-        } else {
-            index = 0;
+            memmove(&list->array[index + 1], &list->array[index],
+                (size_t)(list->count - index) * sizeof(struct Keylist_Node));
         }
+        list->array[index].key = key;
+        list->array[index].data = data;
+        list->count++;
+    }
+    return index;
+}
+
+/** Inserts many nodes into their sorted positions, for example
+ * when the list is initially loaded.  The array is grown once,
+ * and keys that are in increasing order are appended without
+ * a search or a move.
+ *
+ * @param list  Pointer to the list
+ * @param keys  Array of keys to be inserted
+ * @param data  Array of data pointers, one for each key, or NULL
+ * @param count  Number of keys to be inserted
+ * @return Number of nodes that were added
+ */
+int Keylist_Data_Add_Bulk(OS_Keylist list, const KEY *keys, void **data,
+    int count)
+{
+    int i;
 
-        /* create and add the node */
-        node = NodeCreate();
-        if (node) {
-            list->count++;
-            node->key = key;
-            node->data = data;
-            list->array[index] = node;
+    if (!list || !keys || (count <= 0)) {
+        return 0;
+    }
+    if (!CheckArrayGrow(list, list->count + count)) {
+        return 0;
+    }
+    for (i = 0; i < count; i++) {
+        if (Keylist_Data_Add(list, keys[i], data ? data[i] : NULL) < 0) {
+            break;
         }
     }
-    return index;
+
+    return i;
 }
 
 /** Deletes a node specified by its index
@@ -243,37 +253,22 @@ int Keylist_Data_Add(OS_Keylist list, KEY key, void *data)
  */
 void *Keylist_Data_Delete_By_Index(OS_Keylist list, int index)
 {
-    struct Keylist_Node *node;
     void *data = NULL;
 
     if (list) {
         if (list->array && list->count && (index >= 0) &&
             (index < list->count)) {
-            node = list->array[index];
-            if (node) {
-                data = node->data;
-            }
-            /* move the nodes to account for the deleted one */
-            if (list->count == 1) {
-                /* There is no node shifting to do */
-            } else if (index == (list->count - 1)) {
-                /* We are the last one */
-                /* There is no node shifting to do */
-            } else {
-                /* Move all the nodes down one */
-                int i; /* counter */
-                int count = list->count - 1;
-                for (i = index; i < count; i++) {
-                    list->array[i] = list->array[i + 1];
-                }
-            }
+            data = list->array[index].data;
+            /* Move all the nodes down one */
+            memmove(&list->array[index], &list->array[index + 1],
+                (size_t)(list->count - index - 1) *
+                    sizeof(struct Keylist_Node));
             list->count--;
-            if (node) {
-                free(node);
+            if (list->count == 0) {
+                list->duplicates = false;
             }
-
             /* potentially reduce the size of the array */
-            (void)CheckArraySize(list);
+            CheckArrayShrink(list);
         }
     }
     return (data);
@@ -346,17 +341,17 @@ void *Keylist_Data_Pop(OS_Keylist list)
  */
 void *Keylist_Data(OS_Keylist list, KEY key)
 {
-    struct Keylist_Node *node = NULL;
+    void *data = NULL;
     int index = 0; /* used to look up the index of node */
 
     if (list) {
         if (list->array && list->count) {
             if (FindIndex(list, key, &index)) {
-                node = list->array[index];
+                data = list->array[index].data;
             }
         }
     }
-    return node ? node->data : NULL;
+    return data;
 }
 
 /** Returns the index from the node specified by key.
@@ -389,15 +384,15 @@ int Keylist_Index(OS_Keylist list, KEY key)
  */
 void *Keylist_Data_Index(OS_Keylist list, int index)
 {
-    struct Keylist_Node *node = NULL;
+    void *data = NULL;
 
     if (list) {
         if (list->array && list->count && (index >= 0) &&
             (index < list->count)) {
-            node = list->array[index];
+            data = list->array[index].data;
         }
     }
-    return node ? node->data : NULL;
+    return data;
 }
 
 /** Return the key at the given index.
@@ -411,15 +406,11 @@ void *Keylist_Data_Index(OS_Keylist list, int index)
 KEY Keylist_Key(OS_Keylist list, int index)
 {
     KEY key = UINT32_MAX; /* return value */
-    struct Keylist_Node *node;
 
     if (list) {
         if (list->array && list->count && (index >= 0) &&
             (index < list->count)) {
-            node = list->array[index];
-            if (node) {
-                key = node->key;
-            }
+            key = list->array[index].key;
         }
     }
     return key;
@@ -436,17 +427,13 @@ KEY Keylist_Key(OS_Keylist list, int index)
 bool Keylist_Index_Key(OS_Keylist list, int index, KEY *pKey)
 {
     bool status = false; /* return value */
-    struct Keylist_Node *node;
 
     if (list) {
         if (list->array && list->count && (index >= 0) &&
             (index < list->count)) {
-            node = list->array[index];
-            if (node) {
-                status = true;
-                if (pKey) {
-                    *pKey = node->key;
-                }
+            status = true;
+            if (pKey) {
+                *pKey = list->array[index].key;
             }
         }
     }
@@ -455,6 +442,10 @@ bool Keylist_Index_Key(OS_Keylist list, int index, KEY *pKey)
 }
 
 /** Returns the next empty key from the list.
+ * With unique keys, the end of a run of consecutive keys is found
+ * with a binary search for the first gap, since the difference
+ * between two keys equals the difference between their indexes
+ * only when there is no gap between them.
  *
  * @param list  Pointer to the list
  * @param key  Key whose index shall be retrieved.
@@ -464,13 +455,31 @@ bool Keylist_Index_Key(OS_Keylist list, int index, KEY *pKey)
 KEY Keylist_Next_Empty_Key(OS_Keylist list, KEY key)
 {
     int index;
+    int left, right, middle;
+    KEY last_key;
 
     if (list) {
         while (FindIndex(list, key, &index)) {
-            if (KEY_LAST(key)) {
+            if (list->duplicates) {
+                last_key = key;
+            } else {
+                left = index;
+                right = list->count - 1;
+                while (left < right) {
+                    middle = left + ((right - left + 1) / 2);
+                    if ((list->array[middle].key - key) ==
+                        (KEY)(middle - index)) {
+                        left = middle;
+                    } else {
+                        right = middle - 1;
+                    }
+                }
+                last_key = list->array[left].key;
+            }
+            if (KEY_LAST(last_key)) {
                 break;
             }
-            key++;
+            key = last_key + 1;
         }
     }
 
@@ -508,7 +517,7 @@ OS_Keylist Keylist_Create(void)
 
     list = KeylistCreate();
     if (list) {
-        CheckArraySize(list);
+        (void)CheckArrayGrow(list, KEYLIST_CHUNK_SIZE);
     }
 
     return list;
@@ -521,10 +530,6 @@ OS_Keylist Keylist_Create(void)
 void Keylist_Delete(OS_Keylist list)
 { /* list number to be deleted */
     if (list) {
-        /* clean out the list */
-        while (list->count) {
-            (void)Keylist_Data_Delete_By_Index(list, 0);
-        }
         if (list->array) {
             free(list->array);
         }
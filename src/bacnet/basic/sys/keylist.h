@@ -24,6 +24,8 @@
 #ifndef KEYLIST_H
 #define KEYLIST_H
 
+#include <stdbool.h>
+#include <stdint.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -40,9 +42,10 @@ struct Keylist_Node {
 };
 
 typedef struct Keylist {
-    struct Keylist_Node **array;        /* array of nodes */
+    struct Keylist_Node *array;        /* contiguous array of nodes */
     int count;  /* number of nodes in this list - more efficient than loop */
     int size;   /* number of available nodes on this list - can grow or shrink */
+    bool duplicates; /* true if a key was added more than once */
 } KEYLIST_TYPE;
 typedef KEYLIST_TYPE *OS_Keylist;
 
@@ -69,6 +72,15 @@ extern "C" {
         KEY key,
         void *data);
 
+/* inserts many nodes into their sorted positions */
+/* returns the number of nodes added */
+    BACNET_STACK_EXPORT
+    int Keylist_Data_Add_Bulk(
+        OS_Keylist list,
+        const KEY *keys,
+        void **data,
+        int count);
+
 /* deletes a node specified by its key */
     BACNET_STACK_EXPORT
 /* returns the data from the node */
@@ -0,0 +1,323 @@
+/**
+ * @file
+ * @brief Cache of encoded property values
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/basic/sys/propcache.h"
+
+#if PROPCACHE_SETS
+#if (PROPCACHE_SETS & (PROPCACHE_SETS - 1))
+#error "PROPCACHE_SETS must be a power of two"
+#endif
+#if (PROPCACHE_DATA_SIZE > 255)
+#error "PROPCACHE_DATA_SIZE must be less than 256"
+#endif
+
+struct propcache_entry {
+    uint32_t object_instance;
+    uint32_t object_property;
+    BACNET_ARRAY_INDEX array_index;
+    uint16_t object_type;
+    /* length of the encoded value, or 0 if the entry is empty */
+    uint8_t length;
+    uint8_t data[PROPCACHE_DATA_SIZE];
+};
+
+struct propcache_set {
+    struct propcache_entry entry[PROPCACHE_WAYS];
+    /* entry replaced next when the set is full */
+    uint8_t victim;
+};
+
+static struct propcache_set Cache_Sets[PROPCACHE_SETS];
+/* object types that are cached */
+static uint8_t Cache_Enabled[(MAX_BACNET_OBJECT_TYPE + 7) / 8];
+
+/**
+ * @brief Get the set that holds the values of an object
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @return set of the object
+ */
+static struct propcache_set *
+propcache_set(BACNET_OBJECT_TYPE object_type, uint32_t object_instance)
+{
+    /* consecutive instances of a type use consecutive sets */
+    uint32_t index = object_instance + ((uint32_t)object_type * 7U);
+
+    return &Cache_Sets[index & (PROPCACHE_SETS - 1)];
+}
+
+/**
+ * @brief Determine if an entry holds the values of an object
+ * @param entry - cache entry
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @return true if the entry is in use by the object
+ */
+static bool propcache_entry_object(
+    const struct propcache_entry *entry,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance)
+{
+    return (entry->length > 0) && (entry->object_type == object_type) &&
+        (entry->object_instance == object_instance);
+}
+
+/**
+ * @brief Find the entry of a property value
+ * @param pSet - set of the object
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @param object_property - property identifier
+ * @param array_index - array index, or BACNET_ARRAY_ALL
+ * @return entry, or NULL if the value is not cached
+ */
+static struct propcache_entry *propcache_find(
+    struct propcache_set *pSet,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index)
+{
+    struct propcache_entry *entry;
+    unsigned i;
+
+    for (i = 0; i < PROPCACHE_WAYS; i++) {
+        entry = &pSet->entry[i];
+        if (propcache_entry_object(entry, object_type, object_instance) &&
+            (entry->object_property == object_property) &&
+            (entry->array_index == array_index)) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+#endif
+
+/**
+ * @brief Enable or disable the cache for an object type
+ * @param object_type - object type
+ * @param enable - true if the values of the object type are cached
+ */
+void propcache_enable(BACNET_OBJECT_TYPE object_type, bool enable)
+{
+#if PROPCACHE_SETS
+    unsigned i, j;
+
+    if (object_type >= MAX_BACNET_OBJECT_TYPE) {
+        return;
+    }
+    if (enable) {
+        Cache_Enabled[object_type / 8] |= (uint8_t)(1U << (object_type % 8));
+    } else {
+        Cache_Enabled[object_type / 8] &= (uint8_t)~(1U << (object_type % 8));
+        for (i = 0; i < PROPCACHE_SETS; i++) {
+            for (j = 0; j < PROPCACHE_WAYS; j++) {
+                if (Cache_Sets[i].entry[j].object_type == object_type) {
+                    Cache_Sets[i].entry[j].length = 0;
+                }
+            }
+        }
+    }
+#else
+    (void)object_type;
+    (void)enable;
+#endif
+}
+
+/**
+ * @brief Determine if the cache is enabled for an object type
+ * @param object_type - object type
+ * @return true if the values of the object type are cached
+ */
+bool propcache_enabled(BACNET_OBJECT_TYPE object_type)
+{
+#if PROPCACHE_SETS
+    if (object_type < MAX_BACNET_OBJECT_TYPE) {
+        return Cache_Enabled[object_type / 8] & (1U << (object_type % 8));
+    }
+#else
+    (void)object_type;
+#endif
+
+    return false;
+}
+
+/**
+ * @brief Copy a cached property value
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @param object_property - property identifier
+ * @param array_index - array index, or BACNET_ARRAY_ALL
+ * @param apdu - buffer for the encoded value
+ * @param apdu_size - size of the buffer
+ * @return length of the encoded value, or 0 if the value is not cached
+ *  or does not fit in the buffer
+ */
+int propcache_read(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index,
+    uint8_t *apdu,
+    size_t apdu_size)
+{
+#if PROPCACHE_SETS
+    struct propcache_entry *entry;
+
+    if (!apdu) {
+        return 0;
+    }
+    entry = propcache_find(
+        propcache_set(object_type, object_instance), object_type,
+        object_instance, object_property, array_index);
+    if (entry && (entry->length <= apdu_size)) {
+        memcpy(apdu, entry->data, entry->length);
+        return entry->length;
+    }
+#else
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)array_index;
+    (void)apdu;
+    (void)apdu_size;
+#endif
+
+    return 0;
+}
+
+/**
+ * @brief Store the encoded value of a property of an enabled object type
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @param object_property - property identifier
+ * @param array_index - array index, or BACNET_ARRAY_ALL
+ * @param apdu - encoded value
+ * @param apdu_len - length of the encoded value
+ * @return true if the value was stored
+ */
+bool propcache_store(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index,
+    const uint8_t *apdu,
+    int apdu_len)
+{
+#if PROPCACHE_SETS
+    struct propcache_set *pSet;
+    struct propcache_entry *entry;
+    unsigned i;
+
+    if (!apdu || (apdu_len <= 0) || (apdu_len > PROPCACHE_DATA_SIZE) ||
+        !propcache_enabled(object_type)) {
+        return false;
+    }
+    pSet = propcache_set(object_type, object_instance);
+    entry = propcache_find(
+        pSet, object_type, object_instance, object_property, array_index);
+    for (i = 0; !entry && (i < PROPCACHE_WAYS); i++) {
+        if (pSet->entry[i].length == 0) {
+            entry = &pSet->entry[i];
+        }
+    }
+    if (!entry) {
+        entry = &pSet->entry[pSet->victim];
+        pSet->victim = (uint8_t)((pSet->victim + 1) % PROPCACHE_WAYS);
+    }
+    entry->object_type = (uint16_t)object_type;
+    entry->object_instance = object_instance;
+    entry->object_property = (uint32_t)object_property;
+    entry->array_index = array_index;
+    memcpy(entry->data, apdu, (size_t)apdu_len);
+    entry->length = (uint8_t)apdu_len;
+
+    return true;
+#else
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)array_index;
+    (void)apdu;
+    (void)apdu_len;
+
+    return false;
+#endif
+}
+
+/**
+ * @brief Drop every cached property value of an object
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ */
+void propcache_invalidate(
+    BACNET_OBJECT_TYPE object_type, uint32_t object_instance)
+{
+#if PROPCACHE_SETS
+    struct propcache_set *pSet;
+    unsigned i;
+
+    pSet = propcache_set(object_type, object_instance);
+    for (i = 0; i < PROPCACHE_WAYS; i++) {
+        if (propcache_entry_object(
+                &pSet->entry[i], object_type, object_instance)) {
+            pSet->entry[i].length = 0;
+        }
+    }
+#else
+    (void)object_type;
+    (void)object_instance;
+#endif
+}
+
+/**
+ * @brief Drop the cached values of one property of an object,
+ *  for every array index
+ * @param object_type - object type
+ * @param object_instance - object instance number
+ * @param object_property - property identifier
+ */
+void propcache_invalidate_property(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property)
+{
+#if PROPCACHE_SETS
+    struct propcache_set *pSet;
+    unsigned i;
+
+    pSet = propcache_set(object_type, object_instance);
+    for (i = 0; i < PROPCACHE_WAYS; i++) {
+        if (propcache_entry_object(
+                &pSet->entry[i], object_type, object_instance) &&
+            (pSet->entry[i].object_property == object_property)) {
+            pSet->entry[i].length = 0;
+        }
+    }
+#else
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+#endif
+}
+
+/**
+ * @brief Drop every cached property value
+ */
+void propcache_clear(void)
+{
+#if PROPCACHE_SETS
+    memset(Cache_Sets, 0, sizeof(Cache_Sets));
+#endif
+}
@@ -0,0 +1,77 @@
+/**
+ * @file
+ * @brief API for a cache of encoded property values
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ * The cache holds the application tagged encoding of small property
+ * values keyed by object type, object instance, property and array
+ * index, so that a repeated read of an unchanged value is a copy.
+ * The entries of one object share a set of PROPCACHE_WAYS entries,
+ * chosen from the object type and instance, so that an object can drop
+ * every cached property without searching the whole cache.
+ *
+ * Only the object types that are enabled are cached, and an object
+ * type that enables the cache must invalidate its cached values when
+ * they change, including the values derived from other properties.
+ */
+#ifndef BACNET_SYS_PROPCACHE_H
+#define BACNET_SYS_PROPCACHE_H
+#include <stdint.h>
+#include <stdbool.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+#include "bacnet/bacenum.h"
+
+/* number of sets - a power of two, or 0 to leave out the cache */
+#ifndef PROPCACHE_SETS
+#define PROPCACHE_SETS 32
+#endif
+/* number of entries in each set */
+#ifndef PROPCACHE_WAYS
+#define PROPCACHE_WAYS 4
+#endif
+/* largest encoded value that is cached */
+#ifndef PROPCACHE_DATA_SIZE
+#define PROPCACHE_DATA_SIZE 32
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+BACNET_STACK_EXPORT
+void propcache_enable(BACNET_OBJECT_TYPE object_type, bool enable);
+BACNET_STACK_EXPORT
+bool propcache_enabled(BACNET_OBJECT_TYPE object_type);
+BACNET_STACK_EXPORT
+int propcache_read(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index,
+    uint8_t *apdu,
+    size_t apdu_size);
+BACNET_STACK_EXPORT
+bool propcache_store(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index,
+    const uint8_t *apdu,
+    int apdu_len);
+BACNET_STACK_EXPORT
+void propcache_invalidate(
+    BACNET_OBJECT_TYPE object_type, uint32_t object_instance);
+BACNET_STACK_EXPORT
+void propcache_invalidate_property(
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property);
+BACNET_STACK_EXPORT
+void propcache_clear(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
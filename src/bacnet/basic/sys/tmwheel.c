@@ -0,0 +1,454 @@
+/**
+ * @file
+ * @brief A hierarchical timer wheel of millisecond deadlines
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ * Level 0 has one slot per millisecond.  Each slot of level N spans the
+ * whole of level N-1, and its timers are cascaded down a level when the
+ * wheel time reaches the start of the slot.  Arming and cancelling a
+ * timer are constant time, and the work done by tmwheel_run() depends on
+ * the number of timers that expire rather than the number armed.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/tmwheel.h"
+
+/* timer level value while it is being expired by tmwheel_run() */
+#define TMWHEEL_LEVEL_RUNNING (TMWHEEL_LEVELS + 1)
+#define TMWHEEL_SLOT_MASK (TMWHEEL_LEVEL_SLOTS - 1)
+/* furthest deadline the wheel can hold; later timers are parked at the
+   top level and placed again as the wheel turns */
+#define TMWHEEL_DELTA_MAX \
+    ((1UL << (TMWHEEL_LEVEL_BITS * TMWHEEL_LEVELS)) - 1)
+
+static struct tmwheel_timer *Wheel_Slot[TMWHEEL_LEVELS][TMWHEEL_LEVEL_SLOTS];
+static unsigned Level_Count[TMWHEEL_LEVELS];
+static struct tmwheel_timer *Running_Head;
+static unsigned Timer_Count;
+/* the next millisecond tick to be processed */
+static unsigned long Wheel_Time;
+static bool Wheel_Initialized;
+
+/**
+ * @brief Compare two timestamps that may have wrapped
+ * @return negative if a is before b, zero if equal, positive if after
+ */
+static long tmwheel_diff(unsigned long a, unsigned long b)
+{
+    return (long)(a - b);
+}
+
+/**
+ * @brief Get the list a linked timer is on
+ * @param timer - linked timer
+ * @return the head of the list
+ */
+static struct tmwheel_timer **tmwheel_head(struct tmwheel_timer *timer)
+{
+    if (timer->level == TMWHEEL_LEVEL_RUNNING) {
+        return &Running_Head;
+    }
+
+    return &Wheel_Slot[timer->level - 1][timer->slot];
+}
+
+/**
+ * @brief Remove a linked timer from its list
+ * @param timer - linked timer
+ */
+static void tmwheel_unlink(struct tmwheel_timer *timer)
+{
+    struct tmwheel_timer **head = tmwheel_head(timer);
+
+    if (timer->prev) {
+        timer->prev->next = timer->next;
+    } else {
+        *head = timer->next;
+    }
+    if (timer->next) {
+        timer->next->prev = timer->prev;
+    }
+    if (timer->level <= TMWHEEL_LEVELS) {
+        Level_Count[timer->level - 1]--;
+    }
+    Timer_Count--;
+    timer->next = NULL;
+    timer->prev = NULL;
+    timer->level = 0;
+}
+
+/**
+ * @brief Link an idle timer into the slot for its deadline
+ * @param timer - idle timer with its expires value set
+ */
+static void tmwheel_place(struct tmwheel_timer *timer)
+{
+    unsigned long delta = 0;
+    unsigned long placement = timer->expires;
+    unsigned level = 0;
+    struct tmwheel_timer **head;
+
+    if (tmwheel_diff(timer->expires, Wheel_Time) > 0) {
+        delta = timer->expires - Wheel_Time;
+    } else {
+        /* overdue - expire on the next tick */
+        placement = Wheel_Time;
+    }
+    if (delta > TMWHEEL_DELTA_MAX) {
+        delta = TMWHEEL_DELTA_MAX;
+        placement = Wheel_Time + delta;
+    }
+    while ((level < (TMWHEEL_LEVELS - 1)) &&
+        (delta >= (1UL << (TMWHEEL_LEVEL_BITS * (level + 1))))) {
+        level++;
+    }
+    timer->level = (uint8_t)(level + 1);
+    timer->slot = (uint8_t)((placement >> (TMWHEEL_LEVEL_BITS * level)) &
+        TMWHEEL_SLOT_MASK);
+    head = &Wheel_Slot[level][timer->slot];
+    timer->prev = NULL;
+    timer->next = *head;
+    if (*head) {
+        (*head)->prev = timer;
+    }
+    *head = timer;
+    Level_Count[level]++;
+    Timer_Count++;
+}
+
+/**
+ * @brief Move the timers of one slot down to the levels below
+ * @param level - wheel level, 1..TMWHEEL_LEVELS-1
+ * @param slot - slot index in the level
+ */
+static void tmwheel_cascade(unsigned level, unsigned slot)
+{
+    struct tmwheel_timer *timer;
+
+    while ((timer = Wheel_Slot[level][slot]) != NULL) {
+        tmwheel_unlink(timer);
+        tmwheel_place(timer);
+    }
+}
+
+/**
+ * @brief Find the earliest deadline in a slot
+ * @param timer - head of the slot list
+ * @param expires - [in,out] earliest deadline found so far
+ * @param found - [in,out] true if expires holds a deadline
+ */
+static void tmwheel_slot_earliest(
+    struct tmwheel_timer *timer, unsigned long *expires, bool *found)
+{
+    while (timer) {
+        if (!*found || (tmwheel_diff(timer->expires, *expires) < 0)) {
+            *expires = timer->expires;
+            *found = true;
+        }
+        timer = timer->next;
+    }
+}
+
+/**
+ * @brief Initialize the timer wheel, dropping any armed timers.
+ *  The dropped timers are left idle, so they may be armed again.
+ */
+void tmwheel_init(void)
+{
+    unsigned level, slot;
+
+    for (level = 0; level < TMWHEEL_LEVELS; level++) {
+        for (slot = 0; slot < TMWHEEL_LEVEL_SLOTS; slot++) {
+            while (Wheel_Slot[level][slot]) {
+                tmwheel_unlink(Wheel_Slot[level][slot]);
+            }
+        }
+        Level_Count[level] = 0;
+    }
+    while (Running_Head) {
+        tmwheel_unlink(Running_Head);
+    }
+    Timer_Count = 0;
+    Wheel_Time = mstimer_now();
+    Wheel_Initialized = true;
+}
+
+/**
+ * @brief Initialize an idle timer
+ * @param timer - timer that is not armed
+ * @param callback - function called when the timer expires
+ * @param context - passed to the callback
+ */
+void tmwheel_timer_init(struct tmwheel_timer *timer,
+    tmwheel_callback_function callback,
+    void *context)
+{
+    if (timer) {
+        timer->next = NULL;
+        timer->prev = NULL;
+        timer->expires = 0;
+        timer->interval = 0;
+        timer->callback = callback;
+        timer->context = context;
+        timer->level = 0;
+        timer->slot = 0;
+    }
+}
+
+/**
+ * @brief Arm a timer to expire some milliseconds from now.
+ *  An armed timer is moved to the new deadline.
+ * @param timer - timer to arm
+ * @param interval - milliseconds from now
+ */
+void tmwheel_timer_set(struct tmwheel_timer *timer, unsigned long interval)
+{
+    if (!timer) {
+        return;
+    }
+    if (!Wheel_Initialized) {
+        tmwheel_init();
+    }
+    if (timer->level) {
+        tmwheel_unlink(timer);
+    }
+    timer->interval = interval;
+    timer->expires = mstimer_now() + interval;
+    tmwheel_place(timer);
+}
+
+/**
+ * @brief Arm a timer again with the same interval, starting from
+ *  its previous deadline so a periodic timer does not drift
+ * @param timer - timer to arm
+ */
+void tmwheel_timer_reset(struct tmwheel_timer *timer)
+{
+    if (!timer) {
+        return;
+    }
+    if (!Wheel_Initialized) {
+        tmwheel_init();
+    }
+    if (timer->level) {
+        tmwheel_unlink(timer);
+    }
+    timer->expires += timer->interval;
+    tmwheel_place(timer);
+}
+
+/**
+ * @brief Arm a timer again with the same interval, starting from now
+ * @param timer - timer to arm
+ */
+void tmwheel_timer_restart(struct tmwheel_timer *timer)
+{
+    if (timer) {
+        tmwheel_timer_set(timer, timer->interval);
+    }
+}
+
+/**
+ * @brief Cancel a timer. Cancelling an idle timer does nothing.
+ * @param timer - timer to cancel
+ */
+void tmwheel_timer_cancel(struct tmwheel_timer *timer)
+{
+    if (timer && timer->level) {
+        tmwheel_unlink(timer);
+    }
+}
+
+/**
+ * @brief Determine if a timer is armed
+ * @param timer - timer to check
+ * @return true if the timer is armed and has not yet expired
+ */
+bool tmwheel_timer_pending(struct tmwheel_timer *timer)
+{
+    return (timer && timer->level);
+}
+
+/**
+ * @brief Get the time until a timer expires
+ * @param timer - timer to check
+ * @return milliseconds until the timer expires, or 0 if it is idle
+ */
+unsigned long tmwheel_timer_remaining(struct tmwheel_timer *timer)
+{
+    long remaining;
+
+    if (timer && timer->level) {
+        remaining = tmwheel_diff(timer->expires, mstimer_now());
+        if (remaining > 0) {
+            return (unsigned long)remaining;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the interval of a timer
+ * @param timer - timer to check
+ * @return the interval given to tmwheel_timer_set()
+ */
+unsigned long tmwheel_timer_interval(struct tmwheel_timer *timer)
+{
+    if (timer) {
+        return timer->interval;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the number of armed timers
+ * @return number of armed timers
+ */
+unsigned tmwheel_count(void)
+{
+    return Timer_Count;
+}
+
+/**
+ * @brief Get the time until the next timer expires, which is how long
+ *  a main loop may sleep
+ * @param limit - longest time to return, in milliseconds
+ * @return milliseconds until the next deadline, at most limit
+ */
+unsigned long tmwheel_next(unsigned long limit)
+{
+    unsigned long expires = 0;
+    bool found = false;
+    unsigned level, current, slot, i;
+    long remaining;
+
+    if (Timer_Count == 0) {
+        return limit;
+    }
+    for (level = 0; level < TMWHEEL_LEVELS; level++) {
+        if (Level_Count[level] == 0) {
+            continue;
+        }
+        /* the current slot holds either timers that are about to be
+           cascaded or timers a full turn away, so check it and then
+           the first busy slot after it */
+        current = (Wheel_Time >> (TMWHEEL_LEVEL_BITS * level)) &
+            TMWHEEL_SLOT_MASK;
+        tmwheel_slot_earliest(Wheel_Slot[level][current], &expires, &found);
+        for (i = 1; i < TMWHEEL_LEVEL_SLOTS; i++) {
+            slot = (current + i) & TMWHEEL_SLOT_MASK;
+            if (Wheel_Slot[level][slot]) {
+                tmwheel_slot_earliest(
+                    Wheel_Slot[level][slot], &expires, &found);
+                break;
+            }
+        }
+    }
+    if (!found) {
+        return limit;
+    }
+    remaining = tmwheel_diff(expires, mstimer_now());
+    if (remaining <= 0) {
+        return 0;
+    }
+    if ((unsigned long)remaining < limit) {
+        return (unsigned long)remaining;
+    }
+
+    return limit;
+}
+
+/**
+ * @brief Call the callback of every timer that has expired.
+ *  A callback may arm or cancel any timer, including its own.
+ * @return number of timers that expired
+ */
+unsigned tmwheel_run(void)
+{
+    unsigned long now;
+    unsigned long span, target;
+    unsigned level, slot;
+    unsigned count = 0;
+    struct tmwheel_timer *timer;
+
+    if (!Wheel_Initialized) {
+        tmwheel_init();
+    }
+    now = mstimer_now();
+    while (tmwheel_diff(now, Wheel_Time) >= 0) {
+        if (Timer_Count == 0) {
+            Wheel_Time = now + 1;
+            break;
+        }
+        /* when the lower levels are empty, nothing happens until
+           the start of the next slot of the lowest busy level */
+        for (level = 0; level < TMWHEEL_LEVELS; level++) {
+            if (Level_Count[level]) {
+                break;
+            }
+        }
+        slot = Wheel_Time & TMWHEEL_SLOT_MASK;
+        target = Wheel_Time;
+        if ((level > 0) && (level < TMWHEEL_LEVELS)) {
+            span = 1UL << (TMWHEEL_LEVEL_BITS * level);
+            if (Wheel_Time & (span - 1)) {
+                target = (Wheel_Time | (span - 1)) + 1;
+            }
+        } else if ((level == 0) && (slot != 0) && !Wheel_Slot[0][slot]) {
+            /* skip to the next busy slot or the next cascade */
+            while ((slot < TMWHEEL_LEVEL_SLOTS) && !Wheel_Slot[0][slot]) {
+                slot++;
+            }
+            target = Wheel_Time + (slot - (Wheel_Time & TMWHEEL_SLOT_MASK));
+        }
+        if (target != Wheel_Time) {
+            if (tmwheel_diff(target, now) > 0) {
+                target = now + 1;
+            }
+            Wheel_Time = target;
+            continue;
+        }
+        /* cascade the upper level slots that start at this tick */
+        for (level = 1; level < TMWHEEL_LEVELS; level++) {
+            if (Wheel_Time & ((1UL << (TMWHEEL_LEVEL_BITS * level)) - 1)) {
+                break;
+            }
+            slot = (Wheel_Time >> (TMWHEEL_LEVEL_BITS * level)) &
+                TMWHEEL_SLOT_MASK;
+            tmwheel_cascade(level, slot);
+        }
+        /* move this tick's timers aside so callbacks can rearm them */
+        slot = Wheel_Time & TMWHEEL_SLOT_MASK;
+        while ((timer = Wheel_Slot[0][slot]) != NULL) {
+            tmwheel_unlink(timer);
+            timer->level = TMWHEEL_LEVEL_RUNNING;
+            timer->prev = NULL;
+            timer->next = Running_Head;
+            if (Running_Head) {
+                Running_Head->prev = timer;
+            }
+            Running_Head = timer;
+            Timer_Count++;
+        }
+        Wheel_Time++;
+        while ((timer = Running_Head) != NULL) {
+            tmwheel_unlink(timer);
+            if (tmwheel_diff(timer->expires, now) > 0) {
+                /* not due yet */
+                tmwheel_place(timer);
+            } else {
+                count++;
+                if (timer->callback) {
+                    timer->callback(timer, timer->context);
+                }
+            }
+        }
+    }
+
+    return count;
+}
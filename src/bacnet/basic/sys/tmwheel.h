@@ -0,0 +1,76 @@
+/**
+ * @file
+ * @brief API for a hierarchical timer wheel of millisecond deadlines
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ *
+ * Each timer is owned by its user (an object, a service handler, the main
+ * loop) and is armed or cancelled in constant time.  tmwheel_run() calls
+ * the expired timers, and tmwheel_next() tells the main loop how long it
+ * may sleep before the next deadline.  The time base is mstimer_now().
+ */
+#ifndef TMWHEEL_H
+#define TMWHEEL_H
+#include <stdint.h>
+#include <stdbool.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+
+/* each level of the wheel has 2^TMWHEEL_LEVEL_BITS slots,
+   and each slot of a level spans all of the slots of the level below */
+#define TMWHEEL_LEVEL_BITS 6
+#define TMWHEEL_LEVEL_SLOTS (1UL << TMWHEEL_LEVEL_BITS)
+#define TMWHEEL_LEVELS 4
+
+struct tmwheel_timer;
+typedef void (*tmwheel_callback_function)(
+    struct tmwheel_timer *timer, void *context);
+
+struct tmwheel_timer {
+    struct tmwheel_timer *next;
+    struct tmwheel_timer *prev;
+    /* mstimer_now() value when the timer expires */
+    unsigned long expires;
+    unsigned long interval;
+    tmwheel_callback_function callback;
+    void *context;
+    /* 0=idle, otherwise where the timer is linked */
+    uint8_t level;
+    uint8_t slot;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+BACNET_STACK_EXPORT
+void tmwheel_init(void);
+BACNET_STACK_EXPORT
+void tmwheel_timer_init(struct tmwheel_timer *timer,
+    tmwheel_callback_function callback,
+    void *context);
+BACNET_STACK_EXPORT
+void tmwheel_timer_set(struct tmwheel_timer *timer, unsigned long interval);
+BACNET_STACK_EXPORT
+void tmwheel_timer_reset(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+void tmwheel_timer_restart(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+void tmwheel_timer_cancel(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+bool tmwheel_timer_pending(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+unsigned long tmwheel_timer_remaining(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+unsigned long tmwheel_timer_interval(struct tmwheel_timer *timer);
+BACNET_STACK_EXPORT
+unsigned tmwheel_count(void);
+BACNET_STACK_EXPORT
+unsigned long tmwheel_next(unsigned long limit);
+BACNET_STACK_EXPORT
+unsigned tmwheel_run(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
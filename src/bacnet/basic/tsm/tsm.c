@@ -35,6 +35,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <string.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -45,6 +46,8 @@
 #include "bacnet/datalink/datalink.h"
 #include "bacnet/basic/services.h"
 #include "bacnet/basic/binding/address.h"
+#include "bacnet/basic/sys/bufpool.h"
+#include "bacnet/basic/sys/tmwheel.h"
 
 /** @file tsm.c  BACnet Transaction State Machine operations  */
 /* FIXME: modify basic service handlers to use TSM rather than this buffer! */
@@ -61,17 +64,224 @@ uint8_t Handler_Transmit_Buffer[MAX_PDU];
 /* declare space for the TSM transactions, and set it up in the init. */
 /* table rules: an Invoke ID = 0 is an unused spot in the table */
 static BACNET_TSM_DATA TSM_List[MAX_TSM_TRANSACTIONS];
+/* the request deadline of each transaction on the timer wheel */
+static struct tmwheel_timer TSM_Timer[MAX_TSM_TRANSACTIONS];
+
+/* buffers for the PDU of each active transaction, in size classes */
+static uint8_t TSM_Pool_Small[TSM_POOL_SMALL_COUNT][TSM_POOL_SMALL_SIZE];
+#if (MAX_PDU > TSM_POOL_MEDIUM_SIZE) && (TSM_POOL_MEDIUM_COUNT)
+#define TSM_POOL_MEDIUM 1
+static uint8_t TSM_Pool_Medium[TSM_POOL_MEDIUM_COUNT][TSM_POOL_MEDIUM_SIZE];
+#endif
+#if (TSM_POOL_LARGE_COUNT)
+#define TSM_POOL_LARGE 1
+static uint8_t TSM_Pool_Large[TSM_POOL_LARGE_COUNT][MAX_PDU];
+#endif
+static struct bufpool_class TSM_Pool_Classes[3];
+static struct bufpool TSM_Pool;
 
 /* invoke ID for incrementing between subsequent calls. */
 static uint8_t Current_Invoke_ID = 1;
 
 static tsm_timeout_function Timeout_Function;
+/* learns the largest request that a destination path can carry */
+static tsm_max_apdu_function Max_APDU_Function;
+/* list of callbacks for the end of each confirmed request */
+static BACNET_TSM_COMPLETE_NOTIFICATION TSM_Complete_Notification_Head;
+
+/** Initialize the buffer pool on first use. */
+static void tsm_pool_init(void)
+{
+    unsigned count = 0;
+
+    if (TSM_Pool.classes) {
+        return;
+    }
+    bufpool_class_init(&TSM_Pool_Classes[count++], &TSM_Pool_Small[0][0],
+        TSM_POOL_SMALL_SIZE, TSM_POOL_SMALL_COUNT);
+#if defined(TSM_POOL_MEDIUM)
+    bufpool_class_init(&TSM_Pool_Classes[count++], &TSM_Pool_Medium[0][0],
+        TSM_POOL_MEDIUM_SIZE, TSM_POOL_MEDIUM_COUNT);
+#endif
+#if defined(TSM_POOL_LARGE)
+    bufpool_class_init(&TSM_Pool_Classes[count++], &TSM_Pool_Large[0][0],
+        MAX_PDU, TSM_POOL_LARGE_COUNT);
+#endif
+    bufpool_init(&TSM_Pool, TSM_Pool_Classes, count);
+}
+
+/** Return the PDU buffer of a transaction to the pool.
+ *
+ * @param plist  Transaction
+ */
+static void tsm_pdu_buffer_free(BACNET_TSM_DATA *plist)
+{
+    if (plist->apdu) {
+        bufpool_free(&TSM_Pool, plist->apdu);
+        plist->apdu = NULL;
+    }
+    plist->apdu_size = 0;
+    plist->apdu_len = 0;
+}
+
+/** Get a PDU buffer from the pool for a transaction, unless the
+ *  transaction already has one that is large enough.
+ *
+ * @param plist  Transaction
+ * @param size  Number of bytes needed
+ *
+ * @return true if the transaction has a large enough buffer
+ */
+static bool tsm_pdu_buffer_alloc(BACNET_TSM_DATA *plist, uint16_t size)
+{
+    if (plist->apdu && (plist->apdu_size >= size)) {
+        return true;
+    }
+    tsm_pdu_buffer_free(plist);
+    tsm_pool_init();
+    plist->apdu = bufpool_alloc(&TSM_Pool, size, &plist->apdu_size);
+    if (!plist->apdu) {
+        plist->apdu_size = 0;
+        return false;
+    }
+
+    return true;
+}
+
+/** Get the length of the APDU of a transaction, without the NPDU
+ *  header that is stored with it, to compare with a max APDU size.
+ *
+ * @param plist  Transaction
+ * @return length of the APDU
+ */
+static uint16_t tsm_transaction_apdu_len(BACNET_TSM_DATA *plist)
+{
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    int npdu_len;
+
+    npdu_len = bacnet_npdu_decode(
+        plist->apdu, (uint16_t)plist->apdu_len, NULL, NULL, &npdu_data);
+    if ((npdu_len > 0) && ((unsigned)npdu_len < plist->apdu_len)) {
+        return (uint16_t)(plist->apdu_len - (unsigned)npdu_len);
+    }
+
+    return (uint16_t)plist->apdu_len;
+}
+
+/** Tell each callback in the list that a confirmed request ended.
+ *
+ * @param plist  Transaction that ended
+ * @param status  How the request ended
+ */
+static void tsm_complete_notify(
+    BACNET_TSM_DATA *plist, BACNET_TSM_TRANSACTION_STATUS status)
+{
+    BACNET_TSM_COMPLETE_NOTIFICATION *head;
+
+    head = TSM_Complete_Notification_Head.next;
+    while (head) {
+        if (head->callback) {
+            head->callback(&plist->dest, plist->InvokeID, status);
+        }
+        head = head->next;
+    }
+}
+
+/** Send a request again, or fail the transaction after the last retry,
+ *  when its request timer expires.
+ *
+ * @param plist  Transaction awaiting confirmation
+ */
+static void tsm_request_timeout(BACNET_TSM_DATA *plist)
+{
+    struct tmwheel_timer *timer = &TSM_Timer[plist - &TSM_List[0]];
+
+    if (plist->RetryCount < apdu_retries()) {
+        plist->RequestTimer = apdu_timeout();
+        tmwheel_timer_set(timer, apdu_timeout());
+        plist->RetryCount++;
+        if (plist->apdu_len) {
+            datalink_send_pdu(
+                &plist->dest, &plist->npdu_data, plist->apdu, plist->apdu_len);
+        }
+    } else {
+        tmwheel_timer_cancel(timer);
+        /* note: the invoke id has not been cleared yet
+           and this indicates a failed message:
+           IDLE and a valid invoke id */
+        plist->state = TSM_STATE_IDLE;
+        if (plist->InvokeID != 0) {
+            if (Max_APDU_Function && plist->apdu_len) {
+                Max_APDU_Function(&plist->dest,
+                    tsm_transaction_apdu_len(plist), TSM_PDU_TIMEOUT);
+            }
+            if (Timeout_Function) {
+                Timeout_Function(plist->InvokeID);
+            }
+            tsm_complete_notify(plist, TSM_TRANSACTION_TIMEOUT);
+        }
+    }
+}
+
+/** Handle the request deadline of a transaction on the timer wheel.
+ *
+ * @param timer  Timer that expired
+ * @param context  Transaction of the timer
+ */
+static void tsm_request_timer_handler(
+    struct tmwheel_timer *timer, void *context)
+{
+    BACNET_TSM_DATA *plist = context;
+
+    (void)timer;
+    if (plist->state == TSM_STATE_AWAIT_CONFIRMATION) {
+        tsm_request_timeout(plist);
+    }
+}
 
 void tsm_set_timeout_handler(tsm_timeout_function pFunction)
 {
     Timeout_Function = pFunction;
 }
 
+/** Set a handler that is told the size of each confirmed request
+ *  and whether it was delivered, too long, or lost, so that the
+ *  usable max-APDU of the path to each destination can be learned.
+ *
+ * @param pFunction  Function to call, or NULL for none
+ */
+void tsm_set_max_apdu_handler(tsm_max_apdu_function pFunction)
+{
+    Max_APDU_Function = pFunction;
+}
+
+/** Add a callback that is told when each confirmed request ends: when
+ *  a reply comes back, just before the invoke ID is freed, or when the
+ *  last retry times out.  After a timeout the invoke ID is held until
+ *  its owner frees it.  The callback is given the address the request
+ *  was sent to, so that the owner of an invoke ID can match both.
+ *
+ * @param notification  Callback node, which must stay in memory
+ */
+void tsm_complete_notification_add(
+    BACNET_TSM_COMPLETE_NOTIFICATION *notification)
+{
+    BACNET_TSM_COMPLETE_NOTIFICATION *head;
+
+    head = &TSM_Complete_Notification_Head;
+    do {
+        if (head->next == notification) {
+            /* already here! */
+            break;
+        } else if (!head->next) {
+            /* first available free node */
+            head->next = notification;
+            break;
+        }
+        head = head->next;
+    } while (head);
+}
+
 /** Find the given Invoke-Id in the list and
  *  return the index.
  *
@@ -225,22 +435,57 @@ uint8_t tsm_next_free_invokeID(void)
     return invokeID;
 }
 
+/** Get a buffer from the TSM pool to encode the PDU of a request into,
+ *  so that the request can be sent again without a copy.  The buffer
+ *  belongs to the transaction until its invoke ID is freed.
+ *
+ * @param invokeID  Invoke-ID from tsm_next_free_invokeID()
+ * @param size  Number of bytes needed for the PDU
+ *
+ * @return buffer of at least size bytes, or NULL if the invoke ID is
+ *  not in use or no buffer of that size is free
+ */
+uint8_t *tsm_transaction_pdu_buffer(uint8_t invokeID, uint16_t size)
+{
+    uint8_t index;
+    BACNET_TSM_DATA *plist;
+
+    if (invokeID && (size > 0)) {
+        index = tsm_find_invokeID_index(invokeID);
+        if (index < MAX_TSM_TRANSACTIONS) {
+            plist = &TSM_List[index];
+            if (tsm_pdu_buffer_alloc(plist, size)) {
+                plist->apdu_len = 0;
+                return plist->apdu;
+            }
+        }
+    }
+
+    return NULL;
+}
+
 /** Set for an unsegmented transaction
- *  the state to await confirmation.
+ *  the state to await confirmation.  The PDU is copied into a buffer
+ *  of the TSM pool, unless it was encoded into the buffer from
+ *  tsm_transaction_pdu_buffer().  If no buffer is free, the request
+ *  could not be sent again, so the invoke ID is freed and the caller
+ *  does not send the request.
  *
  * @param invokeID  Invoke-ID
  * @param dest  Pointer to the BACnet destination address.
  * @param ndpu_data  Pointer to the NPDU structure.
  * @param apdu  Pointer to the received message.
  * @param apdu_len  Bytes valid in the received message.
+ *
+ * @return true if the transaction awaits confirmation, or false if
+ *  the invoke ID was not valid or was freed because no buffer was free
  */
-void tsm_set_confirmed_unsegmented_transaction(uint8_t invokeID,
+bool tsm_set_confirmed_unsegmented_transaction(uint8_t invokeID,
     BACNET_ADDRESS *dest,
     BACNET_NPDU_DATA *ndpu_data,
     uint8_t *apdu,
     uint16_t apdu_len)
 {
-    uint16_t j = 0;
     uint8_t index;
     BACNET_TSM_DATA *plist;
 
@@ -248,22 +493,33 @@ void tsm_set_confirmed_unsegmented_transaction(uint8_t invokeID,
         index = tsm_find_invokeID_index(invokeID);
         if (index < MAX_TSM_TRANSACTIONS) {
             plist = &TSM_List[index];
+            if ((apdu == plist->apdu) && (apdu_len <= plist->apdu_size)) {
+                /* encoded in place */
+                plist->apdu_len = apdu_len;
+            } else if (tsm_pdu_buffer_alloc(plist, apdu_len)) {
+                memcpy(plist->apdu, apdu, apdu_len);
+                plist->apdu_len = apdu_len;
+            } else {
+                tsm_free_invoke_id(invokeID);
+                return false;
+            }
             /* SendConfirmedUnsegmented */
             plist->state = TSM_STATE_AWAIT_CONFIRMATION;
             plist->RetryCount = 0;
             /* start the timer */
             plist->RequestTimer = apdu_timeout();
-            /* copy the data */
-            for (j = 0; j < apdu_len; j++) {
-                plist->apdu[j] = apdu[j];
-            }
-            plist->apdu_len = apdu_len;
+            tmwheel_timer_cancel(&TSM_Timer[index]);
+            tmwheel_timer_init(
+                &TSM_Timer[index], tsm_request_timer_handler, plist);
+            tmwheel_timer_set(&TSM_Timer[index], apdu_timeout());
             npdu_copy_data(&plist->npdu_data, ndpu_data);
             bacnet_address_copy(&plist->dest, dest);
+
+            return true;
         }
     }
 
-    return;
+    return false;
 }
 
 /** Used to retrieve the transaction payload. Used
@@ -284,7 +540,6 @@ bool tsm_get_transaction_pdu(uint8_t invokeID,
     uint8_t *apdu,
     uint16_t *apdu_len)
 {
-    uint16_t j = 0;
     uint8_t index;
     bool found = false;
     BACNET_TSM_DATA *plist;
@@ -292,7 +547,7 @@ bool tsm_get_transaction_pdu(uint8_t invokeID,
     if (invokeID && apdu && ndpu_data && apdu_len) {
         index = tsm_find_invokeID_index(invokeID);
         /* how much checking is needed?  state?  dest match? just invokeID? */
-        if (index < MAX_TSM_TRANSACTIONS) {
+        if ((index < MAX_TSM_TRANSACTIONS) && TSM_List[index].apdu_len) {
             /* FIXME: we may want to free the transaction so it doesn't timeout
              */
             /* retrieve the transaction */
@@ -301,9 +556,7 @@ bool tsm_get_transaction_pdu(uint8_t invokeID,
             if (*apdu_len > MAX_PDU) {
                 *apdu_len = MAX_PDU;
             }
-            for (j = 0; j < *apdu_len; j++) {
-                apdu[j] = plist->apdu[j];
-            }
+            memcpy(apdu, plist->apdu, *apdu_len);
             npdu_copy_data(ndpu_data, &plist->npdu_data);
             bacnet_address_copy(dest, &plist->dest);
             found = true;
@@ -317,6 +570,10 @@ bool tsm_get_transaction_pdu(uint8_t invokeID,
  *  This function calls the handler for a
  *  timeout 'Timeout_Function', if necessary.
  *
+ *  Each request also has a deadline on the timer wheel, so applications
+ *  that call tmwheel_run() do not need to call this function.  When both
+ *  are used, a retry restarts both timers.
+ *
  * @param milliseconds - Count of milliseconds passed, since the last call.
  */
 void tsm_timer_milliseconds(uint16_t milliseconds)
@@ -334,22 +591,7 @@ void tsm_timer_milliseconds(uint16_t milliseconds)
             }
             /* AWAIT_CONFIRMATION */
             if (plist->RequestTimer == 0) {
-                if (plist->RetryCount < apdu_retries()) {
-                    plist->RequestTimer = apdu_timeout();
-                    plist->RetryCount++;
-                    datalink_send_pdu(&plist->dest, &plist->npdu_data,
-                        &plist->apdu[0], plist->apdu_len);
-                } else {
-                    /* note: the invoke id has not been cleared yet
-                       and this indicates a failed message:
-                       IDLE and a valid invoke id */
-                    plist->state = TSM_STATE_IDLE;
-                    if (plist->InvokeID != 0) {
-                        if (Timeout_Function) {
-                            Timeout_Function(plist->InvokeID);
-                        }
-                    }
-                }
+                tsm_request_timeout(plist);
             }
         }
     }
@@ -369,6 +611,72 @@ void tsm_free_invoke_id(uint8_t invokeID)
         plist = &TSM_List[index];
         plist->state = TSM_STATE_IDLE;
         plist->InvokeID = 0;
+        tmwheel_timer_cancel(&TSM_Timer[index]);
+        tsm_pdu_buffer_free(plist);
+    }
+}
+
+/** Report the reply to a confirmed request, so that the size of the
+ *  request is learned as delivered or as too long for the path, and
+ *  the callbacks are told that the request ended.
+ *  Call before the invoke ID is freed.
+ *
+ * @param src  Address the reply came from
+ * @param invokeID  Invoke-ID of the reply
+ * @param status  Kind of reply: ACK, Error, or too long
+ */
+void tsm_transaction_reply(BACNET_ADDRESS *src,
+    uint8_t invokeID,
+    BACNET_TSM_TRANSACTION_STATUS status)
+{
+    uint8_t index;
+    BACNET_TSM_DATA *plist;
+
+    if (!src || (invokeID == 0)) {
+        return;
+    }
+    index = tsm_find_invokeID_index(invokeID);
+    if (index < MAX_TSM_TRANSACTIONS) {
+        plist = &TSM_List[index];
+        if (Max_APDU_Function && plist->apdu_len &&
+            bacnet_address_same(src, &plist->dest)) {
+            Max_APDU_Function(&plist->dest, tsm_transaction_apdu_len(plist),
+                (status == TSM_TRANSACTION_TOO_LONG) ? TSM_PDU_TOO_LONG
+                                                     : TSM_PDU_DELIVERED);
+        }
+        /* a timed out request was already reported */
+        if (plist->state == TSM_STATE_AWAIT_CONFIRMATION) {
+            tsm_complete_notify(plist, status);
+        }
+    }
+}
+
+/** A router rejected a message to a network because it was too long.
+ *  The reject does not say which message, so the largest request
+ *  awaiting confirmation on that network is reported as too long.
+ *
+ * @param dnet  Network number from the Reject-Message-To-Network
+ */
+void tsm_network_too_long(uint16_t dnet)
+{
+    unsigned i = 0;
+    BACNET_TSM_DATA *plist = NULL;
+
+    if (!Max_APDU_Function) {
+        return;
+    }
+    for (i = 0; i < MAX_TSM_TRANSACTIONS; i++) {
+        if ((TSM_List[i].InvokeID != 0) &&
+            (TSM_List[i].state == TSM_STATE_AWAIT_CONFIRMATION) &&
+            (TSM_List[i].dest.net == dnet) && TSM_List[i].apdu_len) {
+            if (!plist || (TSM_List[i].apdu_len > plist->apdu_len)) {
+                plist = &TSM_List[i];
+            }
+        }
+    }
+    if (plist) {
+        Max_APDU_Function(
+            &plist->dest, tsm_transaction_apdu_len(plist), TSM_PDU_TOO_LONG);
     }
 }
 
@@ -47,10 +47,70 @@ extern "C" {
 }
 #endif /* __cplusplus */
 
+/* what happened to a confirmed request of a given size */
+typedef enum {
+    /* a reply came back, so the path carried the request */
+    TSM_PDU_DELIVERED,
+    /* the request was rejected or aborted as too long */
+    TSM_PDU_TOO_LONG,
+    /* no reply came back after all the retries */
+    TSM_PDU_TIMEOUT
+} BACNET_TSM_PDU_STATUS;
+
+typedef void (
+    *tsm_max_apdu_function) (
+    BACNET_ADDRESS * dest,
+    uint16_t apdu_len,
+    BACNET_TSM_PDU_STATUS status);
+
+/* how a confirmed request ended */
+typedef enum {
+    /* a SimpleACK or ComplexACK came back */
+    TSM_TRANSACTION_ACK,
+    /* an Error, Reject, or Abort came back */
+    TSM_TRANSACTION_ERROR,
+    /* a Reject or Abort came back because the request was too long */
+    TSM_TRANSACTION_TOO_LONG,
+    /* no reply came back after all the retries */
+    TSM_TRANSACTION_TIMEOUT
+} BACNET_TSM_TRANSACTION_STATUS;
+
+/* callback for the end of a confirmed request, with the address
+   the request was sent to */
+typedef void (*tsm_complete_function)(
+    BACNET_ADDRESS *dest,
+    uint8_t invoke_id,
+    BACNET_TSM_TRANSACTION_STATUS status);
+struct BACnet_TSM_Complete_Notification;
+typedef struct BACnet_TSM_Complete_Notification {
+    struct BACnet_TSM_Complete_Notification *next;
+    tsm_complete_function callback;
+} BACNET_TSM_COMPLETE_NOTIFICATION;
 
 #if (!MAX_TSM_TRANSACTIONS)
 #define tsm_free_invoke_id(x) (void)x;
+#define tsm_set_max_apdu_handler(x) (void)x;
+#define tsm_complete_notification_add(x) (void)x;
+#define tsm_transaction_reply(s, x, t) (void)x;
+#define tsm_network_too_long(x) (void)x;
 #else
+/* The PDU of each confirmed request is held for retries in a buffer
+   from a pool of size classes, rather than in each TSM entry. */
+#ifndef TSM_POOL_SMALL_SIZE
+#define TSM_POOL_SMALL_SIZE 64
+#endif
+#ifndef TSM_POOL_SMALL_COUNT
+#define TSM_POOL_SMALL_COUNT MAX_TSM_TRANSACTIONS
+#endif
+#ifndef TSM_POOL_MEDIUM_SIZE
+#define TSM_POOL_MEDIUM_SIZE 512
+#endif
+#ifndef TSM_POOL_MEDIUM_COUNT
+#define TSM_POOL_MEDIUM_COUNT 16
+#endif
+#ifndef TSM_POOL_LARGE_COUNT
+#define TSM_POOL_LARGE_COUNT 4
+#endif
 typedef enum {
     TSM_STATE_IDLE,
     TSM_STATE_AWAIT_CONFIRMATION,
@@ -91,8 +151,9 @@ typedef struct BACnet_TSM_Data {
     BACNET_ADDRESS dest;
     /* the network layer info */
     BACNET_NPDU_DATA npdu_data;
-    /* copy of the APDU, should we need to send it again */
-    uint8_t apdu[MAX_PDU];
+    /* the PDU in a buffer of the TSM pool, should we need to send it again */
+    uint8_t *apdu;
+    uint16_t apdu_size;
     unsigned apdu_len;
 } BACNET_TSM_DATA;
 
@@ -108,6 +169,12 @@ extern "C" {
     BACNET_STACK_EXPORT
     void tsm_set_timeout_handler(
         tsm_timeout_function pFunction);
+    BACNET_STACK_EXPORT
+    void tsm_set_max_apdu_handler(
+        tsm_max_apdu_function pFunction);
+    BACNET_STACK_EXPORT
+    void tsm_complete_notification_add(
+        BACNET_TSM_COMPLETE_NOTIFICATION * notification);
 
     BACNET_STACK_EXPORT
     bool tsm_transaction_available(
@@ -129,14 +196,18 @@ extern "C" {
     BACNET_STACK_EXPORT
     void tsm_invokeID_set(
         uint8_t invokeID);
-/* returns the same invoke ID that was given */
+/* returns false if the invoke ID was freed and the request is not sent */
     BACNET_STACK_EXPORT
-    void tsm_set_confirmed_unsegmented_transaction(
+    bool tsm_set_confirmed_unsegmented_transaction(
         uint8_t invokeID,
         BACNET_ADDRESS * dest,
         BACNET_NPDU_DATA * ndpu_data,
         uint8_t * apdu,
         uint16_t apdu_len);
+    BACNET_STACK_EXPORT
+    uint8_t *tsm_transaction_pdu_buffer(
+        uint8_t invokeID,
+        uint16_t size);
 /* returns true if transaction is found */
     BACNET_STACK_EXPORT
     bool tsm_get_transaction_pdu(
@@ -152,6 +223,15 @@ extern "C" {
     BACNET_STACK_EXPORT
     bool tsm_invoke_id_failed(
         uint8_t invokeID);
+/* report the reply to a request before its invoke ID is freed */
+    BACNET_STACK_EXPORT
+    void tsm_transaction_reply(
+        BACNET_ADDRESS * src,
+        uint8_t invokeID,
+        BACNET_TSM_TRANSACTION_STATUS status);
+    BACNET_STACK_EXPORT
+    void tsm_network_too_long(
+        uint16_t dnet);
 
 #ifdef __cplusplus
 }
@@ -299,4 +299,147 @@
 #define BACNET_USE_SIGNED 0
 #endif
 
+/*
+** Select the basic object types in the object table of the Device object
+** in bacnet/basic/object/device.c. The object types that are left out are
+** not linked, along with their property lists, unless the application
+** uses them directly. Define BACNET_BASIC_OBJECT_xxx for each object type
+** that is needed, or BACNET_BASIC_OBJECTS_ALL, which is the default when
+** none are defined.
+*/
+#if !(defined(BACNET_BASIC_OBJECTS_ALL) || \
+    defined(BACNET_BASIC_OBJECT_ACCUMULATOR) || \
+    defined(BACNET_BASIC_OBJECT_ANALOG_INPUT) || \
+    defined(BACNET_BASIC_OBJECT_ANALOG_OUTPUT) || \
+    defined(BACNET_BASIC_OBJECT_ANALOG_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_BINARY_INPUT) || \
+    defined(BACNET_BASIC_OBJECT_BINARY_LIGHTING_OUTPUT) || \
+    defined(BACNET_BASIC_OBJECT_BINARY_OUTPUT) || \
+    defined(BACNET_BASIC_OBJECT_BINARY_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_BITSTRING_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_CALENDAR) || \
+    defined(BACNET_BASIC_OBJECT_CHANNEL) || \
+    defined(BACNET_BASIC_OBJECT_CHARACTERSTRING_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_COLOR) || \
+    defined(BACNET_BASIC_OBJECT_COLOR_TEMPERATURE) || \
+    defined(BACNET_BASIC_OBJECT_COMMAND) || \
+    defined(BACNET_BASIC_OBJECT_FILE) || \
+    defined(BACNET_BASIC_OBJECT_INTEGER_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_LIFE_SAFETY_POINT) || \
+    defined(BACNET_BASIC_OBJECT_LIFE_SAFETY_ZONE) || \
+    defined(BACNET_BASIC_OBJECT_LIGHTING_OUTPUT) || \
+    defined(BACNET_BASIC_OBJECT_LOAD_CONTROL) || \
+    defined(BACNET_BASIC_OBJECT_MULTISTATE_INPUT) || \
+    defined(BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT) || \
+    defined(BACNET_BASIC_OBJECT_MULTISTATE_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_NETWORK_PORT) || \
+    defined(BACNET_BASIC_OBJECT_NOTIFICATION_CLASS) || \
+    defined(BACNET_BASIC_OBJECT_OCTET_STRING_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_POSITIVE_INTEGER_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_SCHEDULE) || \
+    defined(BACNET_BASIC_OBJECT_STRUCTURED_VIEW) || \
+    defined(BACNET_BASIC_OBJECT_TIME_VALUE) || \
+    defined(BACNET_BASIC_OBJECT_TRENDLOG))
+#define BACNET_BASIC_OBJECTS_ALL
+#endif
+
+#if defined(BACNET_BASIC_OBJECTS_ALL)
+#ifndef BACNET_BASIC_OBJECT_ACCUMULATOR
+#define BACNET_BASIC_OBJECT_ACCUMULATOR
+#endif
+#ifndef BACNET_BASIC_OBJECT_ANALOG_INPUT
+#define BACNET_BASIC_OBJECT_ANALOG_INPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_ANALOG_OUTPUT
+#define BACNET_BASIC_OBJECT_ANALOG_OUTPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_ANALOG_VALUE
+#define BACNET_BASIC_OBJECT_ANALOG_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_BINARY_INPUT
+#define BACNET_BASIC_OBJECT_BINARY_INPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_BINARY_LIGHTING_OUTPUT
+#define BACNET_BASIC_OBJECT_BINARY_LIGHTING_OUTPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_BINARY_OUTPUT
+#define BACNET_BASIC_OBJECT_BINARY_OUTPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_BINARY_VALUE
+#define BACNET_BASIC_OBJECT_BINARY_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_BITSTRING_VALUE
+#define BACNET_BASIC_OBJECT_BITSTRING_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_CALENDAR
+#define BACNET_BASIC_OBJECT_CALENDAR
+#endif
+#ifndef BACNET_BASIC_OBJECT_CHANNEL
+#define BACNET_BASIC_OBJECT_CHANNEL
+#endif
+#ifndef BACNET_BASIC_OBJECT_CHARACTERSTRING_VALUE
+#define BACNET_BASIC_OBJECT_CHARACTERSTRING_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_COLOR
+#define BACNET_BASIC_OBJECT_COLOR
+#endif
+#ifndef BACNET_BASIC_OBJECT_COLOR_TEMPERATURE
+#define BACNET_BASIC_OBJECT_COLOR_TEMPERATURE
+#endif
+#ifndef BACNET_BASIC_OBJECT_COMMAND
+#define BACNET_BASIC_OBJECT_COMMAND
+#endif
+#ifndef BACNET_BASIC_OBJECT_FILE
+#define BACNET_BASIC_OBJECT_FILE
+#endif
+#ifndef BACNET_BASIC_OBJECT_INTEGER_VALUE
+#define BACNET_BASIC_OBJECT_INTEGER_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_LIFE_SAFETY_POINT
+#define BACNET_BASIC_OBJECT_LIFE_SAFETY_POINT
+#endif
+#ifndef BACNET_BASIC_OBJECT_LIFE_SAFETY_ZONE
+#define BACNET_BASIC_OBJECT_LIFE_SAFETY_ZONE
+#endif
+#ifndef BACNET_BASIC_OBJECT_LIGHTING_OUTPUT
+#define BACNET_BASIC_OBJECT_LIGHTING_OUTPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_LOAD_CONTROL
+#define BACNET_BASIC_OBJECT_LOAD_CONTROL
+#endif
+#ifndef BACNET_BASIC_OBJECT_MULTISTATE_INPUT
+#define BACNET_BASIC_OBJECT_MULTISTATE_INPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT
+#define BACNET_BASIC_OBJECT_MULTISTATE_OUTPUT
+#endif
+#ifndef BACNET_BASIC_OBJECT_MULTISTATE_VALUE
+#define BACNET_BASIC_OBJECT_MULTISTATE_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_NETWORK_PORT
+#define BACNET_BASIC_OBJECT_NETWORK_PORT
+#endif
+#ifndef BACNET_BASIC_OBJECT_NOTIFICATION_CLASS
+#define BACNET_BASIC_OBJECT_NOTIFICATION_CLASS
+#endif
+#ifndef BACNET_BASIC_OBJECT_OCTET_STRING_VALUE
+#define BACNET_BASIC_OBJECT_OCTET_STRING_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_POSITIVE_INTEGER_VALUE
+#define BACNET_BASIC_OBJECT_POSITIVE_INTEGER_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_SCHEDULE
+#define BACNET_BASIC_OBJECT_SCHEDULE
+#endif
+#ifndef BACNET_BASIC_OBJECT_STRUCTURED_VIEW
+#define BACNET_BASIC_OBJECT_STRUCTURED_VIEW
+#endif
+#ifndef BACNET_BASIC_OBJECT_TIME_VALUE
+#define BACNET_BASIC_OBJECT_TIME_VALUE
+#endif
+#ifndef BACNET_BASIC_OBJECT_TRENDLOG
+#define BACNET_BASIC_OBJECT_TRENDLOG
+#endif
+#endif
+
 #endif
@@ -331,6 +331,98 @@ int cov_notify_decode_service_request(
     return len;
 }
 
+/**
+ * @brief Find one property value in a COV notification without decoding
+ *  any of the other values.  Only the tag headers are walked, using their
+ *  lengths to jump over the values, so the cost depends on the number of
+ *  tags and not on the size of the values.
+ * @param apdu  Pointer to the COV notification service request buffer.
+ * @param apdu_size  Number of valid bytes in the buffer.
+ * @param property  Property identifier of the value to find.
+ * @param array_index  Array index of the value to find, or
+ *  BACNET_ARRAY_ALL if the property-array-index was omitted.
+ * @param value_len  Number of bytes in the property value.
+ * @return offset of the property value in the buffer, zero if the value
+ *  is not in the buffer, or BACNET_STATUS_ERROR if the buffer is malformed.
+ */
+int cov_notify_property_value_find(uint8_t *apdu,
+    unsigned apdu_size,
+    BACNET_PROPERTY_ID property,
+    BACNET_ARRAY_INDEX array_index,
+    int *value_len)
+{
+    int len = 0, tag_len = 0, data_len = 0;
+    unsigned apdu_len = 0;
+    uint32_t decoded_property = 0;
+    BACNET_UNSIGNED_INTEGER decoded_index = 0;
+    BACNET_ARRAY_INDEX index = BACNET_ARRAY_ALL;
+
+    if (!apdu) {
+        return BACNET_STATUS_ERROR;
+    }
+    /* subscriber-process-identifier [0], initiating-device-identifier [1],
+       monitored-object-identifier [2], time-remaining [3] */
+    len = bacnet_elements_skip(apdu, apdu_size, 4);
+    if (len <= 0) {
+        return BACNET_STATUS_ERROR;
+    }
+    apdu_len += len;
+    /* list-of-values [4] SEQUENCE OF BACnetPropertyValue */
+    if (!bacnet_is_opening_tag_number(
+            &apdu[apdu_len], apdu_size - apdu_len, 4, &len)) {
+        return BACNET_STATUS_ERROR;
+    }
+    apdu_len += len;
+    while (!bacnet_is_closing_tag_number(
+        &apdu[apdu_len], apdu_size - apdu_len, 4, &len)) {
+        /* property-identifier [0] BACnetPropertyIdentifier */
+        len = bacnet_enumerated_context_decode(
+            &apdu[apdu_len], apdu_size - apdu_len, 0, &decoded_property);
+        if (len <= 0) {
+            return BACNET_STATUS_ERROR;
+        }
+        apdu_len += len;
+        /* property-array-index [1] Unsigned OPTIONAL */
+        if (bacnet_is_context_tag_number(
+                &apdu[apdu_len], apdu_size - apdu_len, 1, NULL, NULL)) {
+            len = bacnet_unsigned_context_decode(
+                &apdu[apdu_len], apdu_size - apdu_len, 1, &decoded_index);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+            index = (BACNET_ARRAY_INDEX)decoded_index;
+        } else {
+            index = BACNET_ARRAY_ALL;
+        }
+        /* property-value [2] ABSTRACT-SYNTAX.&Type */
+        data_len = bacnet_enclosed_data_length(
+            &apdu[apdu_len], apdu_size - apdu_len, 2, &tag_len);
+        if (data_len < 0) {
+            return BACNET_STATUS_ERROR;
+        }
+        if ((decoded_property == (uint32_t)property) &&
+            (index == array_index)) {
+            if (value_len) {
+                *value_len = data_len;
+            }
+            return (int)(apdu_len + tag_len);
+        }
+        apdu_len += data_len + tag_len + tag_len;
+        /* priority [3] Unsigned (1..16) OPTIONAL */
+        if (bacnet_is_context_tag_number(
+                &apdu[apdu_len], apdu_size - apdu_len, 3, NULL, NULL)) {
+            len = bacnet_element_skip(&apdu[apdu_len], apdu_size - apdu_len);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+        }
+    }
+
+    return 0;
+}
+
 /*
 12.11.38Active_COV_Subscriptions
 The Active_COV_Subscriptions property is a List of BACnetCOVSubscription,
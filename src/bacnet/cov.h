@@ -103,6 +103,12 @@ int ccov_notify_decode_apdu(uint8_t *apdu,
 BACNET_STACK_EXPORT
 int cov_notify_decode_service_request(
     uint8_t *apdu, unsigned apdu_len, BACNET_COV_DATA *data);
+BACNET_STACK_EXPORT
+int cov_notify_property_value_find(uint8_t *apdu,
+    unsigned apdu_size,
+    BACNET_PROPERTY_ID property,
+    BACNET_ARRAY_INDEX array_index,
+    int *value_len);
 
 BACNET_STACK_EXPORT
 int cov_subscribe_property_decode_service_request(
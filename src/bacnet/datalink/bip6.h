@@ -80,6 +80,9 @@ extern "C" {
     BACNET_STACK_EXPORT
     uint16_t bip6_get_port(
         void);
+    BACNET_STACK_EXPORT
+    int bip6_get_socket(
+        void);
 
     BACNET_STACK_EXPORT
     bool bip6_set_broadcast_addr(
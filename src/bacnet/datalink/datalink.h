@@ -180,6 +180,8 @@ extern "C" {
  *                     chosen at runtime from among these choices.
  * - BACDL_NONE      -- Unspecified for the build for unit testing
  * - BACDL_CUSTOM    -- For externally linked datalink_xxx functions
+ *                     such as the in-memory loopback datalink, which
+ *                     binds them when BACDL_LOOPBACK is also defined.
  * - Clause 10 POINT-TO-POINT (PTP) and Clause 11 EIA/CEA-709.1 ("LonTalk") LAN
  *   are not currently supported by this project.
                                                                                                                                                                                               *//** @defgroup DLTemplates DataLink Template Functions
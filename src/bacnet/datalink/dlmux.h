@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @brief API for a datalink multiplexer that waits on several
+ *  datalinks at once, each attached to its own BACnet network number
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ * @defgroup DLMUX BACnet Datalink Multiplexer
+ * @ingroup DataLink
+ *
+ * The multiplexer lets one process (typically a router) service BACnet/IP,
+ * BACnet/IPv6, Ethernet and MS/TP together.  Each port is registered with
+ * its receive and send functions and the file descriptors that become
+ * readable when a frame arrives.  dlmux_task() blocks on all of them at
+ * once and passes each received NPDU to the handler along with the network
+ * number of the port it arrived on.  Ports without a file descriptor
+ * (for example MS/TP, which is serviced by its own thread) are polled.
+ */
+#ifndef DLMUX_H
+#define DLMUX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/npdu.h"
+
+/* number of datalink ports that can be registered */
+#ifndef DLMUX_PORTS_MAX
+#define DLMUX_PORTS_MAX 4
+#endif
+/* longest wait, in milliseconds, when any port has to be polled */
+#ifndef DLMUX_POLL_MILLISECONDS
+#define DLMUX_POLL_MILLISECONDS 5
+#endif
+/* most NPDUs taken from one port per wakeup, so a busy port
+   cannot starve the others */
+#ifndef DLMUX_RECEIVE_BURST
+#define DLMUX_RECEIVE_BURST 8
+#endif
+
+/**
+ * @brief Handles an NPDU received on one of the ports
+ * @param snet - network number of the port the NPDU arrived on
+ * @param src - source address of the NPDU
+ * @param pdu - NPDU data
+ * @param pdu_len - number of bytes of NPDU data
+ */
+typedef void (*dlmux_npdu_function)(
+    uint16_t snet, BACNET_ADDRESS *src, uint8_t *pdu, uint16_t pdu_len);
+/** @brief datalink receive function, such as bip_receive() */
+typedef uint16_t (*dlmux_receive_function)(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout);
+/** @brief datalink send function, such as bip_send_pdu() */
+typedef int (*dlmux_send_pdu_function)(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len);
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+    BACNET_STACK_EXPORT
+    bool dlmux_init(
+        dlmux_npdu_function handler);
+    BACNET_STACK_EXPORT
+    bool dlmux_port_add(
+        uint16_t net,
+        dlmux_receive_function receive,
+        dlmux_send_pdu_function send_pdu,
+        int fd,
+        int broadcast_fd);
+    BACNET_STACK_EXPORT
+    unsigned dlmux_port_count(
+        void);
+    BACNET_STACK_EXPORT
+    uint16_t dlmux_port_net(
+        unsigned index);
+    BACNET_STACK_EXPORT
+    int dlmux_send_pdu(
+        uint16_t net,
+        BACNET_ADDRESS * dest,
+        BACNET_NPDU_DATA * npdu_data,
+        uint8_t * pdu,
+        unsigned pdu_len);
+    BACNET_STACK_EXPORT
+    int dlmux_task(
+        unsigned timeout);
+    BACNET_STACK_EXPORT
+    void dlmux_cleanup(
+        void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
@@ -44,6 +44,9 @@ extern "C" {
     bool ethernet_valid(
         void);
     BACNET_STACK_EXPORT
+    int ethernet_get_socket(
+        void);
+    BACNET_STACK_EXPORT
     void ethernet_cleanup(
         void);
     BACNET_STACK_EXPORT
@@ -0,0 +1,449 @@
+/**
+ * @file
+ * @brief In-memory loopback datalink connecting virtual ports through
+ *  ring buffers, with configurable latency, loss, and MTU
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ * @ingroup DLLOOPBACK
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/basic/sys/mstimer.h"
+#include "bacnet/basic/sys/ringbuf.h"
+#include "bacnet/datalink/loopback.h"
+
+struct loopback_frame {
+    /* mstimer_now() value when the frame may be received */
+    unsigned long due;
+    uint16_t pdu_len;
+    uint8_t src;
+    uint8_t pdu[LOOPBACK_MPDU_MAX];
+};
+
+struct loopback_port {
+    bool open;
+    RING_BUFFER queue;
+    struct loopback_frame frames[LOOPBACK_FRAMES_MAX];
+};
+
+static struct loopback_port Loopback_Port[LOOPBACK_PORTS_MAX];
+/* MAC address of the port that sends and receives, or 0 for none */
+static uint8_t Loopback_Selected;
+static unsigned long Loopback_Latency;
+static unsigned Loopback_Loss_Percent;
+static uint32_t Loopback_Loss_State = 1;
+static uint16_t Loopback_MTU = LOOPBACK_MPDU_MAX;
+static unsigned long Loopback_Sent_Count;
+static unsigned long Loopback_Dropped_Count;
+
+/**
+ * @brief Get the port with a given MAC address
+ * @param mac - MAC address 1..LOOPBACK_PORTS_MAX
+ * @return port, or NULL if the MAC address is not a port
+ */
+static struct loopback_port *loopback_port(uint8_t mac)
+{
+    if ((mac >= 1) && (mac <= LOOPBACK_PORTS_MAX)) {
+        return &Loopback_Port[mac - 1];
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Decide if a frame is lost, using a repeatable xorshift sequence
+ * @return true if the frame is lost
+ */
+static bool loopback_frame_lost(void)
+{
+    uint32_t x;
+
+    if (Loopback_Loss_Percent == 0) {
+        return false;
+    }
+    x = Loopback_Loss_State;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    Loopback_Loss_State = x;
+
+    return (x % 100U) < Loopback_Loss_Percent;
+}
+
+/**
+ * @brief Queue a frame at one port
+ * @param dst - destination port
+ * @param src - MAC address of the sending port
+ * @param pdu - NPDU data
+ * @param pdu_len - number of bytes of NPDU data
+ */
+static void loopback_frame_put(
+    struct loopback_port *dst, uint8_t src, uint8_t *pdu, uint16_t pdu_len)
+{
+    struct loopback_frame *frame;
+
+    if (!dst->open || loopback_frame_lost()) {
+        Loopback_Dropped_Count++;
+        return;
+    }
+    frame = (struct loopback_frame *)(void *)Ringbuf_Data_Peek(&dst->queue);
+    if (!frame) {
+        /* a full queue drops the frame, as a busy network would */
+        Loopback_Dropped_Count++;
+        return;
+    }
+    frame->due = mstimer_now() + Loopback_Latency;
+    frame->pdu_len = pdu_len;
+    frame->src = src;
+    memcpy(frame->pdu, pdu, pdu_len);
+    (void)Ringbuf_Data_Put(&dst->queue, (volatile uint8_t *)frame);
+    Loopback_Sent_Count++;
+}
+
+/**
+ * @brief Open a virtual port and empty its queue
+ * @param mac - MAC address of the port, 1..LOOPBACK_PORTS_MAX
+ * @return true if the port is open
+ */
+bool loopback_port_open(uint8_t mac)
+{
+    struct loopback_port *port = loopback_port(mac);
+
+    if (!port) {
+        return false;
+    }
+    Ringbuf_Init(&port->queue, (volatile uint8_t *)port->frames,
+        sizeof(port->frames[0]), LOOPBACK_FRAMES_MAX);
+    port->open = true;
+
+    return true;
+}
+
+/**
+ * @brief Close a virtual port.  Frames sent to it are dropped.
+ * @param mac - MAC address of the port
+ */
+void loopback_port_close(uint8_t mac)
+{
+    struct loopback_port *port = loopback_port(mac);
+
+    if (port) {
+        port->open = false;
+        if (Loopback_Selected == mac) {
+            Loopback_Selected = 0;
+        }
+    }
+}
+
+/**
+ * @brief Select the open port used by the send and receive functions,
+ *  which lets one process act as several devices
+ * @param mac - MAC address of the port
+ * @return true if the port is selected
+ */
+bool loopback_port_select(uint8_t mac)
+{
+    struct loopback_port *port = loopback_port(mac);
+
+    if (port && port->open) {
+        Loopback_Selected = mac;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get the selected port
+ * @return MAC address of the selected port, or 0 if none is selected
+ */
+uint8_t loopback_port_selected(void)
+{
+    return Loopback_Selected;
+}
+
+/**
+ * @brief Get the number of frames queued at a port, including any that
+ *  are still delayed by the latency
+ * @param mac - MAC address of the port
+ * @return number of queued frames
+ */
+unsigned loopback_port_pending(uint8_t mac)
+{
+    struct loopback_port *port = loopback_port(mac);
+
+    if (port && port->open) {
+        return Ringbuf_Count(&port->queue);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Initialize the loopback datalink, open a port and select it.
+ *  Other ports stay open, so each simulated device can call this.
+ * @param ifname - MAC address of the port as a decimal string,
+ *  or NULL for port 1
+ * @return true if the port is open and selected
+ */
+bool loopback_init(char *ifname)
+{
+    long mac = 1;
+
+    if (ifname && ifname[0]) {
+        mac = strtol(ifname, NULL, 10);
+    }
+    if ((mac < 1) || (mac > LOOPBACK_PORTS_MAX)) {
+        return false;
+    }
+    if (!loopback_port_open((uint8_t)mac)) {
+        return false;
+    }
+
+    return loopback_port_select((uint8_t)mac);
+}
+
+/**
+ * @brief Send an NPDU from the selected port
+ * @param dest - destination address: a MAC address of a port, or
+ *  an empty MAC address or the global broadcast network for all ports
+ * @param npdu_data - network information (not used)
+ * @param pdu - NPDU data to send
+ * @param pdu_len - number of bytes of NPDU data
+ * @return number of bytes sent, or -1 if no port is selected
+ *  or the NPDU is larger than the MTU.  Lost frames count as sent.
+ */
+int loopback_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    struct loopback_port *port;
+    uint8_t mac;
+
+    (void)npdu_data;
+    if (!dest || !pdu || (Loopback_Selected == 0) ||
+        (pdu_len > Loopback_MTU)) {
+        return -1;
+    }
+    if ((dest->net == BACNET_BROADCAST_NETWORK) || (dest->mac_len == 0) ||
+        (dest->mac[0] == LOOPBACK_BROADCAST_MAC)) {
+        for (mac = 1; mac <= LOOPBACK_PORTS_MAX; mac++) {
+            port = loopback_port(mac);
+            if ((mac != Loopback_Selected) && port->open) {
+                loopback_frame_put(
+                    port, Loopback_Selected, pdu, (uint16_t)pdu_len);
+            }
+        }
+    } else {
+        port = loopback_port(dest->mac[0]);
+        if (port) {
+            loopback_frame_put(
+                port, Loopback_Selected, pdu, (uint16_t)pdu_len);
+        } else {
+            Loopback_Dropped_Count++;
+        }
+    }
+
+    return (int)pdu_len;
+}
+
+/**
+ * @brief Receive the next NPDU queued at the selected port.
+ *  Frames are in memory, so this never waits.
+ * @param src - source address of the NPDU
+ * @param pdu - buffer for the NPDU data
+ * @param max_pdu - size of the buffer
+ * @param timeout - not used
+ * @return number of bytes of NPDU data, or 0 if none is ready
+ */
+uint16_t loopback_receive(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout)
+{
+    struct loopback_port *port;
+    struct loopback_frame *frame;
+    uint16_t pdu_len = 0;
+
+    (void)timeout;
+    port = loopback_port(Loopback_Selected);
+    if (!port || !src || !pdu) {
+        return 0;
+    }
+    frame = (struct loopback_frame *)(void *)Ringbuf_Peek(&port->queue);
+    if (!frame) {
+        return 0;
+    }
+    /* frames share one latency, so the oldest is due first */
+    if ((long)(mstimer_now() - frame->due) < 0) {
+        return 0;
+    }
+    if (frame->pdu_len <= max_pdu) {
+        pdu_len = frame->pdu_len;
+        memcpy(pdu, frame->pdu, pdu_len);
+        memset(src, 0, sizeof(*src));
+        src->mac_len = 1;
+        src->mac[0] = frame->src;
+    } else {
+        Loopback_Dropped_Count++;
+    }
+    (void)Ringbuf_Pop(&port->queue, NULL);
+
+    return pdu_len;
+}
+
+/**
+ * @brief Close every port and restore the default settings
+ */
+void loopback_cleanup(void)
+{
+    uint8_t mac;
+
+    for (mac = 1; mac <= LOOPBACK_PORTS_MAX; mac++) {
+        loopback_port_close(mac);
+    }
+    Loopback_Selected = 0;
+    Loopback_Latency = 0;
+    Loopback_Loss_Percent = 0;
+    Loopback_Loss_State = 1;
+    Loopback_MTU = LOOPBACK_MPDU_MAX;
+    Loopback_Sent_Count = 0;
+    Loopback_Dropped_Count = 0;
+}
+
+/**
+ * @brief Get the local broadcast address
+ * @param dest - address to fill in
+ */
+void loopback_get_broadcast_address(BACNET_ADDRESS *dest)
+{
+    if (dest) {
+        memset(dest, 0, sizeof(*dest));
+        dest->mac_len = 1;
+        dest->mac[0] = LOOPBACK_BROADCAST_MAC;
+        dest->net = BACNET_BROADCAST_NETWORK;
+    }
+}
+
+/**
+ * @brief Get the address of the selected port
+ * @param my_address - address to fill in
+ */
+void loopback_get_my_address(BACNET_ADDRESS *my_address)
+{
+    if (my_address) {
+        memset(my_address, 0, sizeof(*my_address));
+        my_address->mac_len = 1;
+        my_address->mac[0] = Loopback_Selected;
+    }
+}
+
+/**
+ * @brief Set the delay between sending a frame and it being received
+ * @param milliseconds - latency
+ */
+void loopback_latency_set(unsigned long milliseconds)
+{
+    Loopback_Latency = milliseconds;
+}
+
+/**
+ * @brief Set the share of frames that are lost.  The same seed loses
+ *  the same frames, so tests are repeatable.
+ * @param percent - 0..100 percent of frames lost
+ * @param seed - non-zero seed of the loss sequence
+ */
+void loopback_loss_set(unsigned percent, uint32_t seed)
+{
+    if (percent > 100) {
+        percent = 100;
+    }
+    Loopback_Loss_Percent = percent;
+    Loopback_Loss_State = seed ? seed : 1;
+}
+
+/**
+ * @brief Set the largest NPDU that can be sent
+ * @param mtu - bytes, up to LOOPBACK_MPDU_MAX
+ */
+void loopback_mtu_set(uint16_t mtu)
+{
+    if (mtu > LOOPBACK_MPDU_MAX) {
+        mtu = LOOPBACK_MPDU_MAX;
+    }
+    Loopback_MTU = mtu;
+}
+
+/**
+ * @brief Get the number of frames queued at a port since the cleanup
+ * @return number of frames
+ */
+unsigned long loopback_sent_count(void)
+{
+    return Loopback_Sent_Count;
+}
+
+/**
+ * @brief Get the number of frames that were lost, sent to a closed port,
+ *  or did not fit in a full queue or a receive buffer
+ * @return number of frames
+ */
+unsigned long loopback_dropped_count(void)
+{
+    return Loopback_Dropped_Count;
+}
+
+#if defined(BACDL_CUSTOM) && defined(BACDL_LOOPBACK)
+bool datalink_init(char *ifname)
+{
+    return loopback_init(ifname);
+}
+
+int datalink_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    return loopback_send_pdu(dest, npdu_data, pdu, pdu_len);
+}
+
+uint16_t datalink_receive(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout)
+{
+    return loopback_receive(src, pdu, max_pdu, timeout);
+}
+
+void datalink_cleanup(void)
+{
+    loopback_cleanup();
+}
+
+void datalink_get_broadcast_address(BACNET_ADDRESS *dest)
+{
+    loopback_get_broadcast_address(dest);
+}
+
+void datalink_get_my_address(BACNET_ADDRESS *my_address)
+{
+    loopback_get_my_address(my_address);
+}
+
+void datalink_set_interface(char *ifname)
+{
+    (void)ifname;
+}
+
+void datalink_set(char *datalink_string)
+{
+    (void)datalink_string;
+}
+
+void datalink_maintenance_timer(uint16_t seconds)
+{
+    (void)seconds;
+}
+#endif
@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @brief API for an in-memory loopback datalink with virtual ports
+ * @date 2026
+ * @copyright SPDX-License-Identifier: MIT
+ * @defgroup DLLOOPBACK BACnet In-Memory Loopback Datalink
+ * @ingroup DataLink
+ *
+ * The loopback datalink connects virtual ports in one process.  Each port
+ * has a one byte MAC address 1..LOOPBACK_PORTS_MAX and a ring buffer of
+ * received frames, so sending is a copy into the ring buffer of the
+ * destination port and receiving is a copy out of the ring buffer of the
+ * selected port.  Latency, loss, and MTU are configurable, which makes
+ * the datalink useful for benchmarks and deterministic tests of server,
+ * client, and router code without a network.
+ *
+ * The ring buffers have a single producer and a single consumer, so the
+ * ports are intended to be serviced from one thread.  Build with
+ * BACDL_CUSTOM and BACDL_LOOPBACK to bind the datalink_xxx functions to
+ * this datalink.
+ */
+#ifndef LOOPBACK_H
+#define LOOPBACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+/* BACnet Stack defines - first */
+#include "bacnet/bacdef.h"
+/* BACnet Stack API */
+#include "bacnet/npdu.h"
+
+/* number of virtual ports, which are also their MAC addresses */
+#ifndef LOOPBACK_PORTS_MAX
+#define LOOPBACK_PORTS_MAX 8
+#endif
+/* frames queued at each port - must be a power of two */
+#ifndef LOOPBACK_FRAMES_MAX
+#define LOOPBACK_FRAMES_MAX 16
+#endif
+/* largest NPDU that can be sent */
+#ifndef LOOPBACK_MPDU_MAX
+#define LOOPBACK_MPDU_MAX MAX_PDU
+#endif
+#define LOOPBACK_BROADCAST_MAC 0xFF
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+BACNET_STACK_EXPORT
+bool loopback_init(char *ifname);
+BACNET_STACK_EXPORT
+bool loopback_port_open(uint8_t mac);
+BACNET_STACK_EXPORT
+void loopback_port_close(uint8_t mac);
+BACNET_STACK_EXPORT
+bool loopback_port_select(uint8_t mac);
+BACNET_STACK_EXPORT
+uint8_t loopback_port_selected(void);
+BACNET_STACK_EXPORT
+unsigned loopback_port_pending(uint8_t mac);
+
+BACNET_STACK_EXPORT
+int loopback_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len);
+BACNET_STACK_EXPORT
+uint16_t loopback_receive(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout);
+BACNET_STACK_EXPORT
+void loopback_cleanup(void);
+BACNET_STACK_EXPORT
+void loopback_get_broadcast_address(BACNET_ADDRESS *dest);
+BACNET_STACK_EXPORT
+void loopback_get_my_address(BACNET_ADDRESS *my_address);
+
+BACNET_STACK_EXPORT
+void loopback_latency_set(unsigned long milliseconds);
+BACNET_STACK_EXPORT
+void loopback_loss_set(unsigned percent, uint32_t seed);
+BACNET_STACK_EXPORT
+void loopback_mtu_set(uint16_t mtu);
+BACNET_STACK_EXPORT
+unsigned long loopback_sent_count(void);
+BACNET_STACK_EXPORT
+unsigned long loopback_dropped_count(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif
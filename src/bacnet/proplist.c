@@ -32,6 +32,7 @@
  -------------------------------------------
 ####COPYRIGHTEND####*/
 #include <stdint.h>
+#include <string.h>
 /* BACnet Stack defines - first */
 #include "bacnet/bacdef.h"
 /* BACnet Stack API */
@@ -112,6 +113,127 @@ bool property_lists_member(
     return found;
 }
 
+/**
+ * @brief Precompute the special property lists of an object type
+ * into counts and a membership bitmap of the standard property range.
+ * @param pBitmap - structure to be initialized
+ * @param pRequired - array of type 'int' that is a list of BACnet properties
+ * @param pOptional - array of type 'int' that is a list of BACnet properties
+ * @param pProprietary - array of type 'int' that is a list of BACnet properties
+ */
+void property_list_bitmap_init(
+    struct special_property_list_bitmap_t *pBitmap,
+    const int *pRequired,
+    const int *pOptional,
+    const int *pProprietary)
+{
+    const int *pList[3];
+    unsigned i = 0;
+    int property = 0;
+
+    if (!pBitmap) {
+        return;
+    }
+    pBitmap->List.Required.pList = pRequired;
+    pBitmap->List.Required.count = property_list_count(pRequired);
+    pBitmap->List.Optional.pList = pOptional;
+    pBitmap->List.Optional.count = property_list_count(pOptional);
+    pBitmap->List.Proprietary.pList = pProprietary;
+    pBitmap->List.Proprietary.count = property_list_count(pProprietary);
+    memset(pBitmap->Bitmap, 0, sizeof(pBitmap->Bitmap));
+    pList[0] = pRequired;
+    pList[1] = pOptional;
+    pList[2] = pProprietary;
+    for (i = 0; i < 3; i++) {
+        if (pList[i]) {
+            while (*pList[i] != -1) {
+                property = *pList[i];
+                if ((property >= 0) && (property <= PROP_RESERVED_RANGE_MAX)) {
+                    pBitmap->Bitmap[property / 8] |= (1 << (property % 8));
+                }
+                pList[i]++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Determine if the precomputed lists were built from these lists
+ * @param pBitmap - precomputed special property lists
+ * @param pRequired - array of type 'int' that is a list of BACnet properties
+ * @param pOptional - array of type 'int' that is a list of BACnet properties
+ * @param pProprietary - array of type 'int' that is a list of BACnet properties
+ * @return true if the precomputed lists are still valid for these lists
+ */
+bool property_list_bitmap_same(
+    const struct special_property_list_bitmap_t *pBitmap,
+    const int *pRequired,
+    const int *pOptional,
+    const int *pProprietary)
+{
+    if (!pBitmap) {
+        return false;
+    }
+
+    return (pBitmap->List.Required.pList == pRequired) &&
+        (pBitmap->List.Optional.pList == pOptional) &&
+        (pBitmap->List.Proprietary.pList == pProprietary);
+}
+
+/**
+ * @brief Determine if the object property is a member of any of the
+ * precomputed special property lists
+ * @param pBitmap - precomputed special property lists
+ * @param object_property - object-property to be checked
+ * @return true if the property is a member of any of these lists
+ */
+bool property_list_bitmap_member(
+    const struct special_property_list_bitmap_t *pBitmap,
+    int object_property)
+{
+    if (!pBitmap || (object_property < 0)) {
+        return false;
+    }
+    if (object_property <= PROP_RESERVED_RANGE_MAX) {
+        return (pBitmap->Bitmap[object_property / 8] &
+                   (1 << (object_property % 8))) != 0;
+    }
+
+    return property_lists_member(pBitmap->List.Required.pList,
+        pBitmap->List.Optional.pList, pBitmap->List.Proprietary.pList,
+        object_property);
+}
+
+/**
+ * @brief Determine if the object property is a member of any of the lists,
+ * using a bitmap that is precomputed on first use and rebuilt whenever
+ * the lists change
+ * @param pBitmap - precomputed special property lists of the caller
+ * @param pRequired - array of type 'int' that is a list of BACnet properties
+ * @param pOptional - array of type 'int' that is a list of BACnet properties
+ * @param pProprietary - array of type 'int' that is a list of BACnet properties
+ * @param object_property - object-property to be checked
+ * @return true if the property is a member of any of these lists
+ */
+bool property_lists_bitmap_member(
+    struct special_property_list_bitmap_t *pBitmap,
+    const int *pRequired,
+    const int *pOptional,
+    const int *pProprietary,
+    int object_property)
+{
+    if (!pBitmap) {
+        return property_lists_member(
+            pRequired, pOptional, pProprietary, object_property);
+    }
+    if (!property_list_bitmap_same(
+            pBitmap, pRequired, pOptional, pProprietary)) {
+        property_list_bitmap_init(pBitmap, pRequired, pOptional, pProprietary);
+    }
+
+    return property_list_bitmap_member(pBitmap, object_property);
+}
+
 /**
  * ReadProperty handler for this property.  For the given ReadProperty
  * data, the application_data is loaded or the error flags are set.
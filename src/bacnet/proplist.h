@@ -43,6 +43,20 @@ struct special_property_list_t {
     struct property_list_t Proprietary;
 };
 
+/* one bit for each property in the standard (non-proprietary) range */
+#define PROPERTY_LIST_BITMAP_SIZE ((PROP_RESERVED_RANGE_MAX + 1 + 7) / 8)
+
+/**
+ * Special property lists of an object type precomputed once:
+ * the lists with their counts, plus a bitmap of the members in the
+ * standard property range so that a membership test is a bit test.
+ * Proprietary properties are not in the bitmap and are found by list.
+ */
+struct special_property_list_bitmap_t {
+    struct special_property_list_t List;
+    uint8_t Bitmap[PROPERTY_LIST_BITMAP_SIZE];
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -61,6 +75,33 @@ extern "C" {
         const int *pProprietary,
         int object_property);
     BACNET_STACK_EXPORT
+    void property_list_bitmap_init(
+        struct special_property_list_bitmap_t *pBitmap,
+        const int *pRequired,
+        const int *pOptional,
+        const int *pProprietary);
+    BACNET_STACK_EXPORT
+    bool property_list_bitmap_same(
+        const struct special_property_list_bitmap_t *pBitmap,
+        const int *pRequired,
+        const int *pOptional,
+        const int *pProprietary);
+    BACNET_STACK_EXPORT
+    bool property_list_bitmap_member(
+        const struct special_property_list_bitmap_t *pBitmap,
+        int object_property);
+    /* An object module keeps one static special_property_list_bitmap_t
+       for its object type and passes it, with its property lists, in the
+       membership test of the WriteProperty default case.  The bitmap is
+       built on the first call and rebuilt if the lists change. */
+    BACNET_STACK_EXPORT
+    bool property_lists_bitmap_member(
+        struct special_property_list_bitmap_t *pBitmap,
+        const int *pRequired,
+        const int *pOptional,
+        const int *pProprietary,
+        int object_property);
+    BACNET_STACK_EXPORT
     int property_list_encode(
         BACNET_READ_PROPERTY_DATA * rpdata,
         const int *pListRequired,
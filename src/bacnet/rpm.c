@@ -681,6 +681,10 @@ void rpm_ack_object_property_process(
         apdu_len -= len;
         apdu += len;
         while (apdu_len) {
+            if (bacnet_is_closing_tag_number(apdu, apdu_len, 1, NULL)) {
+                /* end of the list-of-results for this object */
+                break;
+            }
             len = rpm_ack_decode_object_property(
                 apdu, apdu_len, &rp_data->object_property,
                 &rp_data->array_index);
@@ -696,12 +700,11 @@ void rpm_ack_object_property_process(
                 /* propertyValue */
                 apdu_len -= len;
                 apdu += len;
-                if (application_data_len) {
-                    rp_data->application_data_len = application_data_len;
-                    rp_data->application_data = apdu;
-                    apdu_len -= application_data_len;
-                    apdu += application_data_len;
-                }
+                /* an empty list has no application data */
+                rp_data->application_data_len = application_data_len;
+                rp_data->application_data = apdu;
+                apdu_len -= application_data_len;
+                apdu += application_data_len;
                 if (bacnet_is_closing_tag_number(apdu, apdu_len, 4, &len)) {
                     apdu_len -= len;
                     apdu += len;
@@ -757,4 +760,98 @@ void rpm_ack_object_property_process(
         }
     }
 }
+
+/**
+ * @brief Find one property value in a ReadPropertyMultiple-Ack without
+ *  decoding any of the other values.  Only the tag headers are walked,
+ *  using their lengths to jump over the values, so the cost depends on
+ *  the number of tags and not on the size of the values.  The value
+ *  found can be decoded with bacapp_decode_application_data() or a
+ *  bacnet_x_application_decode() function.
+ * @param apdu [in] ReadPropertyMultiple-Ack service request buffer
+ * @param apdu_size [in] Count of valid bytes in the buffer
+ * @param object_type [in] object type of the value to find
+ * @param object_instance [in] object instance of the value to find
+ * @param object_property [in] property identifier of the value to find
+ * @param array_index [in] array index of the value to find, or
+ *  BACNET_ARRAY_ALL if the property-array-index was omitted
+ * @param value_len [out] number of bytes in the property value
+ * @return offset of the property value in the buffer, zero if the
+ *  value is not in the buffer or was returned as a property-access-error,
+ *  or BACNET_STATUS_ERROR if the buffer is malformed.
+ */
+int rpm_ack_property_value_find(uint8_t *apdu,
+    unsigned apdu_size,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_ARRAY_INDEX array_index,
+    int *value_len)
+{
+    int len = 0, tag_len = 0, data_len = 0;
+    unsigned apdu_len = 0;
+    BACNET_OBJECT_TYPE decoded_type = OBJECT_NONE;
+    uint32_t decoded_instance = 0;
+    BACNET_PROPERTY_ID decoded_property = PROP_ALL;
+    BACNET_ARRAY_INDEX decoded_index = BACNET_ARRAY_ALL;
+    bool object_match = false;
+
+    if (!apdu) {
+        return BACNET_STATUS_ERROR;
+    }
+    while (apdu_len < apdu_size) {
+        len = rpm_ack_decode_object_id(&apdu[apdu_len], apdu_size - apdu_len,
+            &decoded_type, &decoded_instance);
+        if (len <= 0) {
+            return BACNET_STATUS_ERROR;
+        }
+        apdu_len += len;
+        object_match = (decoded_type == object_type) &&
+            (decoded_instance == object_instance);
+        while (!bacnet_is_closing_tag_number(
+            &apdu[apdu_len], apdu_size - apdu_len, 1, &len)) {
+            len = rpm_ack_decode_object_property(&apdu[apdu_len],
+                apdu_size - apdu_len, &decoded_property, &decoded_index);
+            if (len <= 0) {
+                return BACNET_STATUS_ERROR;
+            }
+            apdu_len += len;
+            if (bacnet_is_opening_tag_number(
+                    &apdu[apdu_len], apdu_size - apdu_len, 4, NULL)) {
+                /* property-value [4] ABSTRACT-SYNTAX.&Type */
+                data_len = bacnet_enclosed_data_length(
+                    &apdu[apdu_len], apdu_size - apdu_len, 4, &tag_len);
+                if (data_len < 0) {
+                    return BACNET_STATUS_ERROR;
+                }
+                if (object_match && (decoded_property == object_property) &&
+                    (decoded_index == array_index)) {
+                    if (value_len) {
+                        *value_len = data_len;
+                    }
+                    return (int)(apdu_len + tag_len);
+                }
+                apdu_len += data_len + tag_len + tag_len;
+            } else if (bacnet_is_opening_tag_number(
+                           &apdu[apdu_len], apdu_size - apdu_len, 5, NULL)) {
+                /* property-access-error [5] Error */
+                len = bacnet_element_skip(
+                    &apdu[apdu_len], apdu_size - apdu_len);
+                if (len <= 0) {
+                    return BACNET_STATUS_ERROR;
+                }
+                if (object_match && (decoded_property == object_property) &&
+                    (decoded_index == array_index)) {
+                    return 0;
+                }
+                apdu_len += len;
+            } else {
+                return BACNET_STATUS_ERROR;
+            }
+        }
+        apdu_len += len;
+    }
+
+    return 0;
+}
 #endif
@@ -187,6 +187,15 @@ extern "C" {
         uint32_t device_id,
         BACNET_READ_PROPERTY_DATA *rp_data,
         read_property_ack_process callback);
+    BACNET_STACK_EXPORT
+    int rpm_ack_property_value_find(
+        uint8_t *apdu,
+        unsigned apdu_size,
+        BACNET_OBJECT_TYPE object_type,
+        uint32_t object_instance,
+        BACNET_PROPERTY_ID object_property,
+        BACNET_ARRAY_INDEX array_index,
+        int *value_len);
 
 #ifdef __cplusplus
 }
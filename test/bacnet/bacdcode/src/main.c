@@ -2010,6 +2010,225 @@ static void test_bacnet_array_encode(void)
     zassert_true(apdu_len == BACNET_STATUS_ABORT, NULL);
 }
 
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(bacdcode_tests, test_bacnet_tag_decode_octets)
+#else
+static void test_bacnet_tag_decode_octets(void)
+#endif
+{
+    uint8_t apdu[8] = { 0 };
+    BACNET_TAG tag = { 0 };
+    uint8_t tag_number = 0;
+    uint32_t len_value = 0;
+    unsigned octet = 0;
+    int len, test_len;
+
+    /* every initial tag octet matches the deprecated decoder */
+    apdu[1] = 42;
+    apdu[2] = 0x12;
+    apdu[3] = 0x34;
+    for (octet = 0; octet <= 255; octet++) {
+        apdu[0] = (uint8_t)octet;
+        len = bacnet_tag_decode(apdu, sizeof(apdu), &tag);
+        test_len = decode_tag_number_and_value(apdu, &tag_number, &len_value);
+        zassert_equal(len, test_len, "octet=0x%02X", octet);
+        zassert_equal(tag.number, tag_number, "octet=0x%02X", octet);
+        zassert_equal(tag.len_value_type, len_value, "octet=0x%02X", octet);
+        zassert_equal(tag.application, !IS_CONTEXT_SPECIFIC(octet), NULL);
+        zassert_equal(tag.opening,
+            IS_CONTEXT_SPECIFIC(octet) && IS_OPENING_TAG(octet), NULL);
+        zassert_equal(tag.closing,
+            IS_CONTEXT_SPECIFIC(octet) && IS_CLOSING_TAG(octet), NULL);
+        zassert_equal(tag.context,
+            IS_CONTEXT_SPECIFIC(octet) && !IS_OPENING_TAG(octet) &&
+                !IS_CLOSING_TAG(octet),
+            NULL);
+        /* truncated */
+        if (IS_EXTENDED_TAG_NUMBER(octet) || IS_EXTENDED_VALUE(octet)) {
+            len = bacnet_tag_decode(apdu, 1, &tag);
+            zassert_equal(len, 0, "octet=0x%02X", octet);
+        }
+    }
+    /* extended 16-bit and 32-bit lengths */
+    apdu[0] = 0x65;
+    apdu[1] = 254;
+    apdu[2] = 0x01;
+    apdu[3] = 0x02;
+    len = bacnet_tag_decode(apdu, 4, &tag);
+    zassert_equal(len, 4, NULL);
+    zassert_equal(tag.len_value_type, 0x0102, NULL);
+    len = bacnet_tag_decode(apdu, 3, &tag);
+    zassert_equal(len, 0, NULL);
+    apdu[1] = 255;
+    apdu[4] = 0x03;
+    apdu[5] = 0x04;
+    len = bacnet_tag_decode(apdu, 6, &tag);
+    zassert_equal(len, 6, NULL);
+    zassert_equal(tag.len_value_type, 0x01020304, NULL);
+    len = bacnet_tag_decode(apdu, 5, &tag);
+    zassert_equal(len, 0, NULL);
+}
+
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(bacdcode_tests, test_bacnet_application_array_decode)
+#else
+static void test_bacnet_application_array_decode(void)
+#endif
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    float real_value[BACNET_MAX_PRIORITY] = { 0 };
+    BACNET_UNSIGNED_INTEGER unsigned_value[BACNET_MAX_PRIORITY] = { 0 };
+    uint32_t enumerated_value[BACNET_MAX_PRIORITY] = { 0 };
+    bool null_value[BACNET_MAX_PRIORITY] = { 0 };
+    BACNET_OBJECT_ID object_id[10] = { 0 };
+    uint32_t count = 0;
+    unsigned i = 0;
+    int apdu_len = 0, len = 0;
+
+    /* priority array of REAL with relinquished slots */
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        if (i % 3) {
+            apdu_len += encode_application_null(&apdu[apdu_len]);
+        } else {
+            apdu_len += encode_application_real(&apdu[apdu_len], 1.5f * i);
+        }
+    }
+    apdu_len += encode_closing_tag(&apdu[apdu_len], 3);
+    len = bacnet_real_application_array_decode(apdu, apdu_len, real_value,
+        null_value, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, apdu_len - 1, NULL);
+    zassert_equal(count, BACNET_MAX_PRIORITY, NULL);
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        if (i % 3) {
+            zassert_true(null_value[i], NULL);
+        } else {
+            zassert_false(null_value[i], NULL);
+            zassert_false(islessgreater(real_value[i], 1.5f * i), NULL);
+        }
+    }
+    /* NULL not expected - stops at the first NULL element */
+    len = bacnet_real_application_array_decode(
+        apdu, apdu_len, real_value, NULL, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, 5, NULL);
+    zassert_equal(count, 1, NULL);
+    /* fewer elements than the encoding */
+    len = bacnet_real_application_array_decode(
+        apdu, apdu_len, NULL, null_value, 2, &count);
+    zassert_equal(len, 6, NULL);
+    zassert_equal(count, 2, NULL);
+    /* malformed */
+    len = bacnet_real_application_array_decode(
+        apdu, 3, real_value, null_value, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    /* unsigned and enumerated */
+    apdu_len = 0;
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        apdu_len += encode_application_unsigned(&apdu[apdu_len], i * 1000);
+    }
+    len = bacnet_unsigned_application_array_decode(apdu, apdu_len,
+        unsigned_value, null_value, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, apdu_len, NULL);
+    zassert_equal(count, BACNET_MAX_PRIORITY, NULL);
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        zassert_equal(unsigned_value[i], i * 1000, NULL);
+        zassert_false(null_value[i], NULL);
+    }
+    len = bacnet_enumerated_application_array_decode(apdu, apdu_len,
+        enumerated_value, null_value, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, 0, NULL);
+    zassert_equal(count, 0, NULL);
+    apdu_len = 0;
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        if (i == 7) {
+            apdu_len += encode_application_null(&apdu[apdu_len]);
+        } else {
+            apdu_len += encode_application_enumerated(&apdu[apdu_len], i % 2);
+        }
+    }
+    len = bacnet_enumerated_application_array_decode(apdu, apdu_len,
+        enumerated_value, null_value, BACNET_MAX_PRIORITY, &count);
+    zassert_equal(len, apdu_len, NULL);
+    zassert_equal(count, BACNET_MAX_PRIORITY, NULL);
+    for (i = 0; i < BACNET_MAX_PRIORITY; i++) {
+        zassert_equal(null_value[i], (i == 7), NULL);
+        if (i != 7) {
+            zassert_equal(enumerated_value[i], i % 2, NULL);
+        }
+    }
+    /* object list */
+    apdu_len = 0;
+    for (i = 0; i < 10; i++) {
+        apdu_len += encode_application_object_id(
+            &apdu[apdu_len], OBJECT_ANALOG_INPUT, i + 100);
+    }
+    len = bacnet_object_id_application_array_decode(
+        apdu, apdu_len, object_id, 10, &count);
+    zassert_equal(len, apdu_len, NULL);
+    zassert_equal(count, 10, NULL);
+    for (i = 0; i < 10; i++) {
+        zassert_equal(object_id[i].type, OBJECT_ANALOG_INPUT, NULL);
+        zassert_equal(object_id[i].instance, i + 100, NULL);
+    }
+}
+
+/**
+ * @brief Test skipping over elements using only the tag headers
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(bacdcode_tests, test_bacnet_element_skip)
+#else
+static void test_bacnet_element_skip(void)
+#endif
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    BACNET_CHARACTER_STRING char_string = { 0 };
+    int apdu_len = 0, len = 0, tag_len = 0;
+    int value_len = 0, boolean_len = 0, nested_len = 0;
+
+    /* [2] { [2] { true, "..." } [0] 5 } followed by [2] closing */
+    len = encode_opening_tag(&apdu[apdu_len], 2);
+    apdu_len += len;
+    tag_len = len;
+    apdu_len += encode_opening_tag(&apdu[apdu_len], 2);
+    boolean_len = encode_application_boolean(&apdu[apdu_len], true);
+    apdu_len += boolean_len;
+    characterstring_init_ansi(&char_string, "a long character string value");
+    value_len =
+        encode_application_character_string(&apdu[apdu_len], &char_string);
+    apdu_len += value_len;
+    apdu_len += encode_closing_tag(&apdu[apdu_len], 2);
+    apdu_len += encode_context_unsigned(&apdu[apdu_len], 0, 5);
+    apdu_len += encode_closing_tag(&apdu[apdu_len], 2);
+    nested_len = apdu_len;
+    apdu_len += encode_closing_tag(&apdu[apdu_len], 2);
+
+    len = bacnet_element_skip(apdu, apdu_len);
+    zassert_equal(len, nested_len, NULL);
+    len = bacnet_element_skip(&apdu[tag_len + 1], apdu_len);
+    zassert_equal(len, boolean_len, NULL);
+    len = bacnet_element_skip(&apdu[tag_len + 1 + boolean_len], apdu_len);
+    zassert_equal(len, value_len, NULL);
+    len = bacnet_elements_skip(&apdu[tag_len + 1], apdu_len, 2);
+    zassert_equal(len, boolean_len + value_len, NULL);
+    len = bacnet_elements_skip(&apdu[tag_len + 1], apdu_len, 3);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    len = bacnet_element_skip(&apdu[nested_len], apdu_len - nested_len);
+    zassert_equal(len, 0, NULL);
+    len = bacnet_enclosed_data_length(apdu, apdu_len, 2, &tag_len);
+    zassert_equal(len, nested_len - (2 * tag_len), NULL);
+    len = bacnet_enclosed_data_length(apdu, apdu_len, 3, NULL);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    /* truncated */
+    len = bacnet_element_skip(apdu, nested_len - 1);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    len = bacnet_element_skip(&apdu[tag_len + 1 + boolean_len], value_len - 1);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    /* mismatched closing tag */
+    apdu[nested_len - 1] = 0x3F;
+    len = bacnet_element_skip(apdu, apdu_len);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+}
+
 /**
  * @}
  */
@@ -2049,7 +2268,10 @@ void test_main(void)
         ztest_unit_test(testDateRangeContextDecodes),
         ztest_unit_test(testOctetStringContextDecodes),
         ztest_unit_test(testBACDCodeDouble),
-        ztest_unit_test(test_bacnet_array_encode));
+        ztest_unit_test(test_bacnet_array_encode),
+        ztest_unit_test(test_bacnet_tag_decode_octets),
+        ztest_unit_test(test_bacnet_application_array_decode),
+        ztest_unit_test(test_bacnet_element_skip));
 
     ztest_run_test_suite(bacdcode_tests);
 }
@@ -11,6 +11,8 @@
 #include <zephyr/ztest.h>
 #include <bacnet/bacaddr.h>
 #include <bacnet/basic/binding/address.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/sys/tmwheel.h>
 
 /* we are likely compiling the demo command line tools if print enabled */
 #if !defined(BACNET_ADDRESS_CACHE_FILE)
@@ -25,6 +27,19 @@
  */
 
 static const char *Address_Cache_Filename = "address_cache";
+static tsm_max_apdu_function Max_APDU_Function;
+/* stub clock */
+static unsigned long Milliseconds = 1000;
+
+void tsm_set_max_apdu_handler(tsm_max_apdu_function pFunction)
+{
+    Max_APDU_Function = pFunction;
+}
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
 
 /**
  * @brief Test
@@ -197,6 +212,137 @@ static void testAddress(void)
         zassert_equal(count, (MAX_ADDRESS_CACHE - i - 1), NULL);
     }
 }
+
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(address_tests, testAddressMaxAPDU)
+#else
+static void testAddressMaxAPDU(void)
+#endif
+{
+    BACNET_ADDRESS src, test_address;
+    uint32_t device_id = 1234;
+    unsigned test_max_apdu = 0;
+    unsigned i;
+
+    address_init();
+    zassert_equal(Max_APDU_Function, address_max_apdu_learn, NULL);
+    set_address(1, &src);
+    address_add(device_id, 1476, &src);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1476, NULL);
+    /* a timeout without any confirmed request is not learned */
+    for (i = 0; i < 3; i++) {
+        Max_APDU_Function(&src, 1400, TSM_PDU_TIMEOUT);
+    }
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1476, NULL);
+    /* too long: the next smaller standard size */
+    Max_APDU_Function(&src, 1400, TSM_PDU_TOO_LONG);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1024, NULL);
+    /* timeouts of a request larger than a confirmed one, in a row */
+    Max_APDU_Function(&src, 300, TSM_PDU_DELIVERED);
+    Max_APDU_Function(&src, 1000, TSM_PDU_TIMEOUT);
+    Max_APDU_Function(&src, 1000, TSM_PDU_TIMEOUT);
+    Max_APDU_Function(&src, 200, TSM_PDU_DELIVERED);
+    Max_APDU_Function(&src, 1000, TSM_PDU_TIMEOUT);
+    Max_APDU_Function(&src, 1000, TSM_PDU_TIMEOUT);
+    zassert_true(address_bind_request(device_id, &test_max_apdu, &test_address),
+        NULL);
+    zassert_equal(test_max_apdu, 1024, NULL);
+    Max_APDU_Function(&src, 1000, TSM_PDU_TIMEOUT);
+    zassert_true(address_bind_request(device_id, &test_max_apdu, &test_address),
+        NULL);
+    zassert_equal(test_max_apdu, 480, NULL);
+    /* timeouts alone do not go below the MS/TP max APDU */
+    for (i = 0; i < 3; i++) {
+        Max_APDU_Function(&src, 470, TSM_PDU_TIMEOUT);
+    }
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 480, NULL);
+    Max_APDU_Function(&src, 470, TSM_PDU_DELIVERED);
+    Max_APDU_Function(&src, 480, TSM_PDU_TOO_LONG);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 470, NULL);
+    /* the advertised size is kept for the device */
+    zassert_true(
+        address_get_by_index(0, NULL, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1476, NULL);
+    /* renewing the binding keeps what was learned */
+    address_add(device_id, 1476, &src);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 470, NULL);
+    /* what was learned expires, and the next request probes the path */
+    Milliseconds += 3600UL * 1000UL;
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1476, NULL);
+    Max_APDU_Function(&src, 1400, TSM_PDU_TOO_LONG);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1024, NULL);
+    /* another address is another path */
+    set_address(2, &src);
+    address_add(device_id, 1476, &src);
+    zassert_true(
+        address_get_by_device(device_id, &test_max_apdu, &test_address), NULL);
+    zassert_equal(test_max_apdu, 1476, NULL);
+    address_remove_device(device_id);
+}
+
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(address_tests, testAddressTimeToLive)
+#else
+static void testAddressTimeToLive(void)
+#endif
+{
+    BACNET_ADDRESS src, test_address;
+    unsigned test_max_apdu = 0;
+    uint32_t test_ttl = 0;
+
+    address_init();
+    zassert_equal(tmwheel_next(1000), 1000, NULL);
+    set_address(1, &src);
+    /* an opportunistic entry lives for an hour */
+    address_add(1, 480, &src);
+    zassert_true(tmwheel_next(0xFFFFFFFFUL) > 3600UL * 1000UL, NULL);
+    Milliseconds += 1800UL * 1000UL;
+    tmwheel_run();
+    /* a renewed binding lives for a day, and the hour runs out first */
+    set_address(2, &src);
+    address_add(2, 480, &src);
+    address_add(2, 480, &src);
+    zassert_true(
+        address_device_bind_request(2, &test_ttl, &test_max_apdu, &test_address),
+        NULL);
+    zassert_equal(test_ttl, 86400UL, NULL);
+    zassert_true(tmwheel_next(0xFFFFFFFFUL) <= 1801UL * 1000UL, NULL);
+    Milliseconds += 1801UL * 1000UL;
+    tmwheel_run();
+    zassert_false(
+        address_get_by_device(1, &test_max_apdu, &test_address), NULL);
+    zassert_true(
+        address_get_by_device(2, &test_max_apdu, &test_address), NULL);
+    /* the legacy timer does not age the entries twice */
+    address_cache_timer(60);
+    zassert_true(
+        address_device_bind_request(2, &test_ttl, &test_max_apdu, &test_address),
+        NULL);
+    zassert_equal(test_ttl, 86400UL - 1801UL, NULL);
+    /* the binding expires a day after it was made */
+    Milliseconds += 86400UL * 1000UL;
+    tmwheel_run();
+    zassert_false(
+        address_get_by_device(2, &test_max_apdu, &test_address), NULL);
+    zassert_equal(address_count(), 0, NULL);
+    zassert_equal(tmwheel_next(1000), 1000, NULL);
+}
 /**
  * @}
  */
@@ -209,11 +355,14 @@ void test_main(void)
 #ifdef BACNET_ADDRESS_CACHE_FILE
     ztest_test_suite(
         address_tests, ztest_unit_test(testAddressFile),
-        ztest_unit_test(testAddress));
+        ztest_unit_test(testAddress), ztest_unit_test(testAddressMaxAPDU),
+        ztest_unit_test(testAddressTimeToLive));
 
     ztest_run_test_suite(address_tests);
 #else
-    ztest_test_suite(address_tests, ztest_unit_test(testAddress));
+    ztest_test_suite(address_tests, ztest_unit_test(testAddress),
+        ztest_unit_test(testAddressMaxAPDU),
+        ztest_unit_test(testAddressTimeToLive));
 
     ztest_run_test_suite(address_tests);
 #endif
@@ -0,0 +1,591 @@
+/**
+ * @file
+ * @brief test the client point cache
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <math.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/bacdef.h>
+#include <bacnet/rpm.h>
+#include <bacnet/basic/binding/address.h>
+#include <bacnet/basic/client/bac-data.h>
+#include <bacnet/basic/client/bac-rw.h>
+#include <bacnet/basic/services.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/tsm/tsm.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+/* stub clock */
+static unsigned long Milliseconds;
+/* stub binding */
+static bool Device_Bound = true;
+static unsigned WhoIs_Count;
+/* stub transaction state machine */
+static uint8_t Invoke_ID;
+static bool Invoke_ID_Free[256];
+static bool Invoke_ID_Failed[256];
+/* stub requests */
+static bool Subscribe_Refused;
+static unsigned Subscribe_Count;
+static uint32_t Subscribe_Device_ID;
+static BACNET_SUBSCRIBE_COV_DATA Subscribe_Data;
+static uint8_t Subscribe_Invoke_ID;
+static unsigned RPM_Count;
+static uint32_t RPM_Device_ID;
+static unsigned RPM_Object_Count;
+static unsigned RPM_Property_Count;
+static uint8_t RPM_Invoke_ID;
+static unsigned Read_Property_Count;
+/* the handlers registered by the module */
+static BACNET_READ_WRITE_RPM_ACK_NODE *RPM_Ack_Node;
+static confirmed_simple_ack_function Subscribe_Ack_Handler;
+static BACNET_COV_NOTIFICATION *COV_Notification;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+uint16_t apdu_timeout(void)
+{
+    return 3000;
+}
+
+void apdu_set_confirmed_simple_ack_handler(
+    BACNET_CONFIRMED_SERVICE service_choice,
+    confirmed_simple_ack_function pFunction)
+{
+    (void)service_choice;
+    Subscribe_Ack_Handler = pFunction;
+}
+
+void apdu_set_confirmed_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, confirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_unconfirmed_handler(
+    BACNET_UNCONFIRMED_SERVICE service_choice, unconfirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void handler_ucov_notification(
+    uint8_t *service_request, uint16_t service_len, BACNET_ADDRESS *src)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+}
+
+void handler_ucov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    COV_Notification = callback;
+}
+
+void handler_ccov_notification(uint8_t *service_request,
+    uint16_t service_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_DATA *service_data)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+    (void)service_data;
+}
+
+void handler_ccov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    (void)callback;
+}
+
+bool address_bind_request(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    (void)device_id;
+    (void)src;
+    *max_apdu = MAX_APDU;
+
+    return Device_Bound;
+}
+
+bool address_get_device_id(BACNET_ADDRESS *src, uint32_t *device_id)
+{
+    /* the test addresses carry the device instance */
+    memcpy(device_id, src->mac, sizeof(*device_id));
+
+    return true;
+}
+
+void Send_WhoIs(int32_t low_limit, int32_t high_limit)
+{
+    (void)low_limit;
+    (void)high_limit;
+    WhoIs_Count++;
+}
+
+/**
+ * @brief Allocate the next stub invoke ID
+ * @return invoke ID of the request
+ */
+static uint8_t test_invoke_id(void)
+{
+    Invoke_ID++;
+    if (Invoke_ID == 0) {
+        Invoke_ID = 1;
+    }
+    Invoke_ID_Free[Invoke_ID] = false;
+    Invoke_ID_Failed[Invoke_ID] = false;
+
+    return Invoke_ID;
+}
+
+uint8_t Send_COV_Subscribe(
+    uint32_t device_id, BACNET_SUBSCRIBE_COV_DATA *cov_data)
+{
+    if (Subscribe_Refused) {
+        return 0;
+    }
+    Subscribe_Count++;
+    Subscribe_Device_ID = device_id;
+    Subscribe_Data = *cov_data;
+    Subscribe_Invoke_ID = test_invoke_id();
+
+    return Subscribe_Invoke_ID;
+}
+
+uint8_t Send_Read_Property_Multiple_Request(uint8_t *pdu,
+    size_t max_pdu,
+    uint32_t device_id,
+    BACNET_READ_ACCESS_DATA *read_access_data)
+{
+    BACNET_PROPERTY_REFERENCE *property;
+
+    (void)pdu;
+    (void)max_pdu;
+    RPM_Count++;
+    RPM_Device_ID = device_id;
+    RPM_Object_Count = 0;
+    RPM_Property_Count = 0;
+    while (read_access_data) {
+        RPM_Object_Count++;
+        property = read_access_data->listOfProperties;
+        while (property) {
+            RPM_Property_Count++;
+            property = property->next;
+        }
+        read_access_data = read_access_data->next;
+    }
+    RPM_Invoke_ID = test_invoke_id();
+
+    return RPM_Invoke_ID;
+}
+
+bool tsm_invoke_id_free(uint8_t invokeID)
+{
+    return Invoke_ID_Free[invokeID];
+}
+
+bool tsm_invoke_id_failed(uint8_t invokeID)
+{
+    return Invoke_ID_Failed[invokeID];
+}
+
+void tsm_free_invoke_id(uint8_t invokeID)
+{
+    Invoke_ID_Free[invokeID] = true;
+    Invoke_ID_Failed[invokeID] = false;
+}
+
+void bacnet_read_write_init(void)
+{
+}
+
+void bacnet_read_write_task(void)
+{
+}
+
+void bacnet_read_write_value_callback_set(
+    bacnet_read_write_value_callback_t callback)
+{
+    (void)callback;
+}
+
+void bacnet_read_write_rpm_ack_callback_add(
+    BACNET_READ_WRITE_RPM_ACK_NODE *node)
+{
+    RPM_Ack_Node = node;
+}
+
+bool bacnet_read_property_queue(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    uint32_t array_index)
+{
+    (void)device_id;
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)array_index;
+    Read_Property_Count++;
+
+    return true;
+}
+
+/**
+ * @brief Set up the module and the stubs for a test
+ * @param cov_lifetime - subscription lifetime, or zero to poll only
+ */
+static void test_setup(unsigned cov_lifetime)
+{
+    Milliseconds = 1000;
+    Device_Bound = true;
+    WhoIs_Count = 0;
+    Subscribe_Refused = false;
+    Subscribe_Count = 0;
+    RPM_Count = 0;
+    Read_Property_Count = 0;
+    bacnet_data_init();
+    bacnet_data_cov_lifetime_set(cov_lifetime);
+    bacnet_data_poll_seconds_set(60);
+}
+
+/**
+ * @brief Run the task after some time has passed
+ * @param milliseconds - time that passed
+ */
+static void test_task(unsigned long milliseconds)
+{
+    Milliseconds += milliseconds;
+    bacnet_data_task();
+}
+
+/**
+ * @brief Build the test address of a device
+ * @param device_id - device instance
+ * @param src - address to fill in
+ */
+static void test_address(uint32_t device_id, BACNET_ADDRESS *src)
+{
+    memset(src, 0, sizeof(*src));
+    memcpy(src->mac, &device_id, sizeof(device_id));
+    src->mac_len = sizeof(device_id);
+}
+
+/**
+ * @brief Test subscribing to points and storing COV notifications
+ */
+static void test_bac_data_subscribe(void)
+{
+    BACNET_ADDRESS src = { 0 };
+    BACNET_COV_DATA cov_data = { 0 };
+    BACNET_PROPERTY_VALUE property_value = { 0 };
+    BACNET_DATA_VALUE value = { 0 };
+    uint8_t invoke_id;
+
+    test_setup(300);
+    zassert_true(bacnet_data_object_add(10, OBJECT_ANALOG_INPUT, 1), NULL);
+    zassert_true(bacnet_data_property_add(
+                     10, OBJECT_ANALOG_INPUT, 2, PROP_OUT_OF_SERVICE),
+        NULL);
+    zassert_true(bacnet_data_object_add(20, OBJECT_BINARY_INPUT, 1), NULL);
+    zassert_false(bacnet_data_object_add(20, OBJECT_DEVICE, 20), NULL);
+    zassert_false(
+        bacnet_data_property_add(20, OBJECT_BINARY_INPUT, 1, PROP_ALL), NULL);
+    /* one request to each device at a time */
+    test_task(1);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 2, NULL);
+    zassert_equal(Subscribe_Device_ID, 20, NULL);
+    zassert_false(Subscribe_Data.covSubscribeToProperty, NULL);
+    zassert_equal(Subscribe_Data.lifetime, 300, NULL);
+    /* the acknowledgement of device 10 lets its next point subscribe */
+    invoke_id = Subscribe_Invoke_ID - 1;
+    test_address(10, &src);
+    Subscribe_Ack_Handler(&src, invoke_id);
+    tsm_free_invoke_id(invoke_id);
+    test_task(1);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 3, NULL);
+    zassert_equal(Subscribe_Device_ID, 10, NULL);
+    zassert_true(Subscribe_Data.covSubscribeToProperty, NULL);
+    zassert_equal(Subscribe_Data.monitoredProperty.propertyIdentifier,
+        PROP_OUT_OF_SERVICE, NULL);
+    /* the subscription is renewed at 80 percent of the lifetime */
+    test_task(239UL * 1000UL);
+    zassert_equal(Subscribe_Count, 3, NULL);
+    test_task(2000);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 3, NULL);
+    invoke_id = Subscribe_Invoke_ID;
+    Subscribe_Ack_Handler(&src, invoke_id);
+    tsm_free_invoke_id(invoke_id);
+    test_task(1);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 4, NULL);
+    zassert_equal(Subscribe_Data.monitoredObjectIdentifier.instance, 1, NULL);
+    /* notifications are stored in the points */
+    zassert_false(bacnet_data_value(
+                      10, OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, &value),
+        NULL);
+    cov_data.initiatingDeviceIdentifier = 10;
+    cov_data.monitoredObjectIdentifier.type = OBJECT_ANALOG_INPUT;
+    cov_data.monitoredObjectIdentifier.instance = 1;
+    cov_data.listOfValues = &property_value;
+    property_value.propertyIdentifier = PROP_PRESENT_VALUE;
+    property_value.value.tag = BACNET_APPLICATION_TAG_REAL;
+    property_value.value.type.Real = 42.0f;
+    COV_Notification->callback(&cov_data);
+    zassert_true(bacnet_data_value(
+                     10, OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, &value),
+        NULL);
+    zassert_equal(value.tag, BACNET_APPLICATION_TAG_REAL, NULL);
+    zassert_false(islessgreater(value.type.Real, 42.0f), NULL);
+    zassert_true(value.cov, NULL);
+    /* other devices are not changed */
+    cov_data.initiatingDeviceIdentifier = 30;
+    COV_Notification->callback(&cov_data);
+    zassert_false(bacnet_data_value(
+                      30, OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, &value),
+        NULL);
+}
+
+/**
+ * @brief Test polling the points of a device with one ReadPropertyMultiple
+ */
+static void test_bac_data_rpm_batch(void)
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    uint8_t application_data[16] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_CONFIRMED_SERVICE_ACK_DATA service_data = { 0 };
+    BACNET_ADDRESS src = { 0 };
+    float real_value = 0.0f;
+    bool binary_value = false;
+    int apdu_len, len;
+
+    test_setup(0);
+    zassert_true(bacnet_data_object_add(10, OBJECT_ANALOG_INPUT, 1), NULL);
+    zassert_true(bacnet_data_object_add(10, OBJECT_BINARY_INPUT, 2), NULL);
+    zassert_true(
+        bacnet_data_property_add(10, OBJECT_ANALOG_INPUT, 1, PROP_UNITS), NULL);
+    test_task(1);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 0, NULL);
+    zassert_equal(RPM_Count, 1, NULL);
+    zassert_equal(RPM_Device_ID, 10, NULL);
+    zassert_equal(RPM_Object_Count, 2, NULL);
+    zassert_equal(RPM_Property_Count, 3, NULL);
+    /* an acknowledgement that is not ours is left for other modules */
+    test_address(10, &src);
+    service_data.invoke_id = RPM_Invoke_ID + 1;
+    zassert_false(RPM_Ack_Node->callback(apdu, 0, &src, &service_data), NULL);
+    test_address(20, &src);
+    service_data.invoke_id = RPM_Invoke_ID;
+    zassert_false(RPM_Ack_Node->callback(apdu, 0, &src, &service_data), NULL);
+    test_address(10, &src);
+    /* our acknowledgement is stored */
+    rpmdata.object_type = OBJECT_ANALOG_INPUT;
+    rpmdata.object_instance = 1;
+    apdu_len = rpm_ack_encode_apdu_object_begin(&apdu[0], &rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+    len = encode_application_real(application_data, 12.5f);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    rpmdata.object_type = OBJECT_BINARY_INPUT;
+    rpmdata.object_instance = 2;
+    apdu_len += rpm_ack_encode_apdu_object_begin(&apdu[apdu_len], &rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+    len = encode_application_enumerated(application_data, BINARY_ACTIVE);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    service_data.invoke_id = RPM_Invoke_ID;
+    zassert_true(
+        RPM_Ack_Node->callback(apdu, apdu_len, &src, &service_data), NULL);
+    tsm_free_invoke_id(RPM_Invoke_ID);
+    zassert_true(bacnet_data_analog_present_value(
+                     10, OBJECT_ANALOG_INPUT, 1, &real_value),
+        NULL);
+    zassert_false(islessgreater(real_value, 12.5f), NULL);
+    zassert_true(bacnet_data_binary_present_value(
+                     10, OBJECT_BINARY_INPUT, 2, &binary_value),
+        NULL);
+    zassert_true(binary_value, NULL);
+    /* the points are polled again after the poll interval */
+    test_task(1);
+    test_task(59UL * 1000UL);
+    zassert_equal(RPM_Count, 1, NULL);
+    test_task(1000);
+    test_task(1);
+    zassert_equal(RPM_Count, 2, NULL);
+    zassert_equal(RPM_Property_Count, 3, NULL);
+}
+
+/**
+ * @brief Test the fallback to polling, and to ReadProperty
+ */
+static void test_bac_data_refused(void)
+{
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    uint32_t unsigned_value = 0;
+
+    test_setup(300);
+    zassert_true(
+        bacnet_data_object_add(10, OBJECT_MULTI_STATE_INPUT, 1), NULL);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 1, NULL);
+    /* the subscription is refused - the point is polled */
+    tsm_free_invoke_id(Subscribe_Invoke_ID);
+    test_task(1);
+    test_task(1);
+    test_task(1);
+    zassert_equal(RPM_Count, 1, NULL);
+    zassert_equal(Subscribe_Count, 1, NULL);
+    /* the ReadPropertyMultiple is refused - ReadProperty is used */
+    tsm_free_invoke_id(RPM_Invoke_ID);
+    test_task(1);
+    test_task(1);
+    test_task(1);
+    zassert_equal(RPM_Count, 1, NULL);
+    zassert_equal(Read_Property_Count, 1, NULL);
+    test_task(1);
+    zassert_equal(Read_Property_Count, 1, NULL);
+    rp_data.object_type = OBJECT_MULTI_STATE_INPUT;
+    rp_data.object_instance = 1;
+    rp_data.object_property = PROP_PRESENT_VALUE;
+    rp_data.error_code = ERROR_CODE_SUCCESS;
+    value.tag = BACNET_APPLICATION_TAG_UNSIGNED_INT;
+    value.type.Unsigned_Int = 3;
+    bacnet_data_value_save(10, &rp_data, &value);
+    zassert_true(bacnet_data_multistate_present_value(
+                     10, OBJECT_MULTI_STATE_INPUT, 1, &unsigned_value),
+        NULL);
+    zassert_equal(unsigned_value, 3, NULL);
+    test_task(60UL * 1000UL);
+    test_task(1);
+    zassert_equal(Read_Property_Count, 2, NULL);
+    zassert_equal(RPM_Count, 1, NULL);
+}
+
+/**
+ * @brief Test binding to a device, and requests that time out
+ */
+static void test_bac_data_timeout(void)
+{
+    BACNET_ADDRESS src = { 0 };
+
+    test_setup(300);
+    Device_Bound = false;
+    zassert_true(bacnet_data_object_add(10, OBJECT_ANALOG_INPUT, 1), NULL);
+    zassert_true(bacnet_data_object_add(10, OBJECT_ANALOG_INPUT, 2), NULL);
+    test_task(1);
+    test_task(1);
+    test_task(1);
+    zassert_equal(WhoIs_Count, 1, NULL);
+    zassert_equal(Subscribe_Count, 0, NULL);
+    test_task(3000);
+    zassert_equal(WhoIs_Count, 2, NULL);
+    Device_Bound = true;
+    test_task(3000);
+    zassert_equal(Subscribe_Count, 1, NULL);
+    /* no invoke ID - try again after an APDU timeout */
+    Invoke_ID_Failed[Subscribe_Invoke_ID] = true;
+    Subscribe_Refused = true;
+    test_task(1);
+    test_task(1);
+    zassert_true(Invoke_ID_Free[Subscribe_Invoke_ID], NULL);
+    zassert_equal(Subscribe_Count, 1, NULL);
+    Subscribe_Refused = false;
+    test_task(1);
+    zassert_equal(Subscribe_Count, 1, NULL);
+    test_task(3000);
+    zassert_equal(Subscribe_Count, 2, NULL);
+    zassert_equal(Subscribe_Data.monitoredObjectIdentifier.instance, 2, NULL);
+    /* the point that timed out subscribes after a poll interval */
+    test_address(10, &src);
+    Subscribe_Ack_Handler(&src, Subscribe_Invoke_ID);
+    tsm_free_invoke_id(Subscribe_Invoke_ID);
+    test_task(56UL * 1000UL);
+    zassert_equal(Subscribe_Count, 2, NULL);
+    test_task(1000);
+    test_task(1);
+    zassert_equal(Subscribe_Count, 3, NULL);
+    zassert_equal(Subscribe_Data.monitoredObjectIdentifier.instance, 1, NULL);
+}
+
+/**
+ * @brief Test many points on many devices
+ */
+static void test_bac_data_scale(void)
+{
+    const uint32_t device_count = 100;
+    const uint32_t object_count = 200;
+    uint32_t device_id, instance;
+    BACNET_DATA_VALUE value = { 0 };
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    BACNET_APPLICATION_DATA_VALUE data = { 0 };
+    unsigned i;
+
+    test_setup(0);
+    for (device_id = 1; device_id <= device_count; device_id++) {
+        for (instance = 1; instance <= object_count; instance++) {
+            zassert_true(bacnet_data_object_add(
+                             device_id, OBJECT_ANALOG_VALUE, instance),
+                NULL);
+        }
+    }
+    /* a request is in progress to every device at once */
+    for (i = 0; i < 200; i++) {
+        test_task(1);
+    }
+    zassert_equal(RPM_Count, device_count, NULL);
+    /* every point is found */
+    rp_data.object_type = OBJECT_ANALOG_VALUE;
+    rp_data.object_property = PROP_PRESENT_VALUE;
+    rp_data.error_code = ERROR_CODE_SUCCESS;
+    data.tag = BACNET_APPLICATION_TAG_REAL;
+    for (device_id = 1; device_id <= device_count; device_id++) {
+        for (instance = 1; instance <= object_count; instance++) {
+            rp_data.object_instance = instance;
+            data.type.Real = (float)instance;
+            bacnet_data_value_save(device_id, &rp_data, &data);
+        }
+    }
+    zassert_true(bacnet_data_value(device_count, OBJECT_ANALOG_VALUE,
+                     object_count, PROP_PRESENT_VALUE, &value),
+        NULL);
+    zassert_false(islessgreater(value.type.Real, (float)object_count), NULL);
+    zassert_false(bacnet_data_value(device_count + 1, OBJECT_ANALOG_VALUE,
+                      object_count, PROP_PRESENT_VALUE, &value),
+        NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(bac_data_tests, ztest_unit_test(test_bac_data_subscribe),
+        ztest_unit_test(test_bac_data_rpm_batch),
+        ztest_unit_test(test_bac_data_refused),
+        ztest_unit_test(test_bac_data_timeout),
+        ztest_unit_test(test_bac_data_scale));
+
+    ztest_run_test_suite(bac_data_tests);
+}
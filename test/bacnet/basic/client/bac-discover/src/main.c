@@ -0,0 +1,636 @@
+/**
+ * @file
+ * @brief test the device discovery snapshot file
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/bacdef.h>
+#include <bacnet/bacdcode.h>
+#include <bacnet/rpm.h>
+#include <bacnet/basic/binding/address.h>
+#include <bacnet/basic/client/bac-discover.h>
+#include <bacnet/basic/client/bac-rw.h>
+#include <bacnet/basic/object/device.h>
+#include <bacnet/basic/services.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/tsm/tsm.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+#define TEST_SNAPSHOT "bac-discover-test.snapshot"
+#define TEST_SNAPSHOT_BAD "bac-discover-test-bad.snapshot"
+#define TEST_DEVICE_ID 20
+
+/* stub clock */
+static unsigned long Milliseconds = 1000;
+/* stub transaction state machine */
+static uint8_t Invoke_ID;
+static bool Invoke_ID_Free[256];
+/* the last ReadPropertyMultiple request */
+static unsigned RPM_Count;
+static uint32_t RPM_Device_ID;
+static BACNET_OBJECT_TYPE RPM_Object_Type;
+static BACNET_PROPERTY_ID RPM_Property;
+static BACNET_ARRAY_INDEX RPM_Array_Index;
+static uint8_t RPM_Invoke_ID;
+/* the handler registered for the ReadPropertyMultiple ACK */
+static confirmed_ack_function RPM_Ack_Handler;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+uint16_t apdu_timeout(void)
+{
+    return 3000;
+}
+
+uint32_t Device_Object_Instance_Number(void)
+{
+    return 1;
+}
+
+void apdu_set_confirmed_ack_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, confirmed_ack_function pFunction)
+{
+    if (service_choice == SERVICE_CONFIRMED_READ_PROP_MULTIPLE) {
+        RPM_Ack_Handler = pFunction;
+    }
+}
+
+void apdu_set_confirmed_simple_ack_handler(
+    BACNET_CONFIRMED_SERVICE service_choice,
+    confirmed_simple_ack_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_confirmed_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, confirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_unconfirmed_handler(
+    BACNET_UNCONFIRMED_SERVICE service_choice, unconfirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_error_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, error_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_abort_handler(abort_function pFunction)
+{
+    (void)pFunction;
+}
+
+void apdu_set_reject_handler(reject_function pFunction)
+{
+    (void)pFunction;
+}
+
+void handler_ucov_notification(
+    uint8_t *service_request, uint16_t service_len, BACNET_ADDRESS *src)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+}
+
+void handler_ucov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    (void)callback;
+}
+
+void handler_ccov_notification(uint8_t *service_request,
+    uint16_t service_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_DATA *service_data)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+    (void)service_data;
+}
+
+void handler_ccov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    (void)callback;
+}
+
+void address_init(void)
+{
+}
+
+void address_own_device_id_set(uint32_t own_id)
+{
+    (void)own_id;
+}
+
+void address_cache_timer(uint16_t uSeconds)
+{
+    (void)uSeconds;
+}
+
+void address_add_binding(
+    uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
+{
+    (void)device_id;
+    (void)max_apdu;
+    (void)src;
+}
+
+bool address_get_by_device(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    return address_bind_request(device_id, max_apdu, src);
+}
+
+bool address_bind_request(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    memset(src, 0, sizeof(*src));
+    memcpy(src->mac, &device_id, sizeof(device_id));
+    src->mac_len = sizeof(device_id);
+    *max_apdu = MAX_APDU;
+
+    return true;
+}
+
+bool address_get_device_id(BACNET_ADDRESS *src, uint32_t *device_id)
+{
+    /* the test addresses carry the device instance */
+    memcpy(device_id, src->mac, sizeof(*device_id));
+
+    return true;
+}
+
+void Send_WhoIs(int32_t low_limit, int32_t high_limit)
+{
+    (void)low_limit;
+    (void)high_limit;
+}
+
+void Send_WhoIs_To_Network(
+    BACNET_ADDRESS *target_address, int32_t low_limit, int32_t high_limit)
+{
+    (void)target_address;
+    (void)low_limit;
+    (void)high_limit;
+}
+
+uint8_t Send_COV_Subscribe(
+    uint32_t device_id, BACNET_SUBSCRIBE_COV_DATA *cov_data)
+{
+    (void)device_id;
+    (void)cov_data;
+
+    return 0;
+}
+
+uint8_t Send_Read_Property_Request(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    uint32_t array_index)
+{
+    (void)device_id;
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)array_index;
+
+    return 0;
+}
+
+uint8_t Send_Write_Property_Request_Data(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    uint8_t *application_data,
+    int application_data_len,
+    uint8_t priority,
+    uint32_t array_index)
+{
+    (void)device_id;
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)application_data;
+    (void)application_data_len;
+    (void)priority;
+    (void)array_index;
+
+    return 0;
+}
+
+uint8_t Send_Read_Property_Multiple_Request(uint8_t *pdu,
+    size_t max_pdu,
+    uint32_t device_id,
+    BACNET_READ_ACCESS_DATA *read_access_data)
+{
+    (void)pdu;
+    (void)max_pdu;
+    RPM_Count++;
+    RPM_Device_ID = device_id;
+    RPM_Object_Type = read_access_data->object_type;
+    RPM_Property = read_access_data->listOfProperties->propertyIdentifier;
+    RPM_Array_Index =
+        read_access_data->listOfProperties->propertyArrayIndex;
+    Invoke_ID++;
+    Invoke_ID_Free[Invoke_ID] = false;
+    RPM_Invoke_ID = Invoke_ID;
+
+    return RPM_Invoke_ID;
+}
+
+bool tsm_invoke_id_free(uint8_t invokeID)
+{
+    return Invoke_ID_Free[invokeID];
+}
+
+bool tsm_invoke_id_failed(uint8_t invokeID)
+{
+    (void)invokeID;
+
+    return false;
+}
+
+void tsm_free_invoke_id(uint8_t invokeID)
+{
+    Invoke_ID_Free[invokeID] = true;
+}
+
+/* one property value of a ReadPropertyMultiple ACK */
+struct test_value {
+    BACNET_OBJECT_TYPE object_type;
+    uint32_t object_instance;
+    BACNET_PROPERTY_ID object_property;
+    BACNET_ARRAY_INDEX array_index;
+    /* encoded value, or an error if the length is zero */
+    uint8_t data[32];
+    int len;
+};
+
+/**
+ * @brief Deliver a ReadPropertyMultiple ACK of the last request
+ * @param device_id - device that sent the ACK
+ * @param values - property values, grouped by object
+ * @param count - number of property values
+ */
+static void
+test_rpm_ack(uint32_t device_id, const struct test_value *values, unsigned count)
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    BACNET_CONFIRMED_SERVICE_ACK_DATA service_data = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_ADDRESS src = { 0 };
+    unsigned max_apdu = 0, i;
+    int apdu_len = 0;
+
+    for (i = 0; i < count; i++) {
+        if ((i == 0) || (values[i].object_type != rpmdata.object_type) ||
+            (values[i].object_instance != rpmdata.object_instance)) {
+            if (i > 0) {
+                apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+            }
+            rpmdata.object_type = values[i].object_type;
+            rpmdata.object_instance = values[i].object_instance;
+            apdu_len +=
+                rpm_ack_encode_apdu_object_begin(&apdu[apdu_len], &rpmdata);
+        }
+        apdu_len += rpm_ack_encode_apdu_object_property(
+            &apdu[apdu_len], values[i].object_property,
+            values[i].array_index);
+        if (values[i].len > 0) {
+            apdu_len += rpm_ack_encode_apdu_object_property_value(
+                &apdu[apdu_len], (uint8_t *)values[i].data, values[i].len);
+        } else {
+            apdu_len += rpm_ack_encode_apdu_object_property_error(
+                &apdu[apdu_len], ERROR_CLASS_PROPERTY,
+                ERROR_CODE_UNKNOWN_PROPERTY);
+        }
+    }
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    address_bind_request(device_id, &max_apdu, &src);
+    service_data.invoke_id = RPM_Invoke_ID;
+    RPM_Ack_Handler(apdu, apdu_len, &src, &service_data);
+    tsm_free_invoke_id(RPM_Invoke_ID);
+}
+
+/**
+ * @brief Run the discovery task until a request is sent
+ * @param rpm_count - number of requests sent once the request is sent
+ * @return true if the request was sent
+ */
+static bool test_discover_request(unsigned rpm_count)
+{
+    unsigned i;
+
+    for (i = 0; (i < 10) && (RPM_Count < rpm_count); i++) {
+        Milliseconds += 10;
+        bacnet_discover_task();
+    }
+
+    return RPM_Count == rpm_count;
+}
+
+/**
+ * @brief Discover a device with two objects
+ * @param database_revision - Database_Revision of the device
+ */
+static void test_discover_device(uint32_t database_revision)
+{
+    struct test_value values[3] = { 0 };
+    unsigned i;
+
+    bacnet_discover_device_add(TEST_DEVICE_ID, MAX_APDU, SEGMENTATION_NONE, 0);
+    zassert_true(test_discover_request(RPM_Count + 1), NULL);
+    zassert_equal(RPM_Device_ID, TEST_DEVICE_ID, NULL);
+    zassert_equal(RPM_Property, PROP_OBJECT_LIST, NULL);
+    zassert_equal(RPM_Array_Index, 0, NULL);
+    values[0].object_type = OBJECT_DEVICE;
+    values[0].object_instance = TEST_DEVICE_ID;
+    values[0].object_property = PROP_OBJECT_LIST;
+    values[0].array_index = 0;
+    values[0].len = encode_application_unsigned(values[0].data, 2);
+    test_rpm_ack(TEST_DEVICE_ID, values, 1);
+    /* the elements of the object list */
+    zassert_true(test_discover_request(RPM_Count + 1), NULL);
+    zassert_equal(RPM_Array_Index, 1, NULL);
+    values[0].array_index = 1;
+    values[0].len = encode_application_object_id(
+        values[0].data, OBJECT_DEVICE, TEST_DEVICE_ID);
+    values[1] = values[0];
+    values[1].array_index = 2;
+    values[1].len =
+        encode_application_object_id(values[1].data, OBJECT_ANALOG_INPUT, 1);
+    test_rpm_ack(TEST_DEVICE_ID, values, 2);
+    /* every property of each object */
+    values[0].object_type = OBJECT_ANALOG_INPUT;
+    values[0].object_instance = 1;
+    values[0].object_property = PROP_PRESENT_VALUE;
+    values[0].array_index = BACNET_ARRAY_ALL;
+    values[0].len = encode_application_real(values[0].data, 42.5f);
+    values[1].object_type = OBJECT_DEVICE;
+    values[1].object_instance = TEST_DEVICE_ID;
+    values[1].object_property = PROP_DATABASE_REVISION;
+    values[1].array_index = BACNET_ARRAY_ALL;
+    values[1].len =
+        encode_application_unsigned(values[1].data, database_revision);
+    values[2] = values[1];
+    values[2].object_property = PROP_VENDOR_IDENTIFIER;
+    values[2].len = encode_application_unsigned(values[2].data, 260);
+    for (i = 0; i < 2; i++) {
+        zassert_true(test_discover_request(RPM_Count + 1), NULL);
+        zassert_equal(RPM_Property, PROP_ALL, NULL);
+        if (RPM_Object_Type == OBJECT_ANALOG_INPUT) {
+            test_rpm_ack(TEST_DEVICE_ID, &values[0], 1);
+        } else {
+            test_rpm_ack(TEST_DEVICE_ID, &values[1], 2);
+        }
+    }
+    /* done until the next discovery */
+    zassert_false(test_discover_request(RPM_Count + 1), NULL);
+}
+
+/**
+ * @brief Check the values of the discovered device
+ */
+static void test_discover_device_check(void)
+{
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+
+    zassert_equal(bacnet_discover_device_count(), 1, NULL);
+    zassert_equal(bacnet_discover_device_object_count(TEST_DEVICE_ID), 2, NULL);
+    zassert_true(
+        bacnet_discover_property_value(
+            TEST_DEVICE_ID, OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE,
+            &value),
+        NULL);
+    zassert_equal(value.tag, BACNET_APPLICATION_TAG_REAL, NULL);
+    zassert_false(islessgreater(value.type.Real, 42.5f), NULL);
+    zassert_true(
+        bacnet_discover_property_value(
+            TEST_DEVICE_ID, OBJECT_DEVICE, TEST_DEVICE_ID,
+            PROP_VENDOR_IDENTIFIER, &value),
+        NULL);
+    zassert_equal(value.tag, BACNET_APPLICATION_TAG_UNSIGNED_INT, NULL);
+    zassert_equal(value.type.Unsigned_Int, 260, NULL);
+}
+
+/**
+ * @brief Read a whole file
+ * @param pathname - name of the file
+ * @param buffer - buffer for the file contents
+ * @param buffer_size - size of the buffer
+ * @return size of the file
+ */
+static size_t
+test_file_read(const char *pathname, uint8_t *buffer, size_t buffer_size)
+{
+    FILE *file;
+    size_t size = 0;
+
+    file = fopen(pathname, "rb");
+    if (file) {
+        size = fread(buffer, 1, buffer_size, file);
+        fclose(file);
+    }
+
+    return size;
+}
+
+/**
+ * @brief Write a whole file
+ * @param pathname - name of the file
+ * @param buffer - file contents
+ * @param size - size of the file
+ */
+static void
+test_file_write(const char *pathname, const uint8_t *buffer, size_t size)
+{
+    FILE *file;
+
+    file = fopen(pathname, "wb");
+    zassert_not_null(file, NULL);
+    zassert_equal(fwrite(buffer, 1, size, file), size, NULL);
+    fclose(file);
+}
+
+/**
+ * @brief Restart the discovery with no devices
+ */
+static void test_discover_restart(void)
+{
+    bacnet_discover_cleanup();
+    bacnet_discover_init();
+    bacnet_discover_seconds_set(3600);
+}
+
+/**
+ * @brief Test that a saved snapshot loads the same devices
+ */
+static void test_discover_snapshot_round_trip(void)
+{
+    test_discover_restart();
+    RPM_Count = 0;
+    test_discover_device(5);
+    test_discover_device_check();
+    zassert_true(bacnet_discover_snapshot_save(TEST_SNAPSHOT), NULL);
+    zassert_false(bacnet_discover_snapshot_save(NULL), NULL);
+    /* only into an empty device list */
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT), NULL);
+    test_discover_restart();
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    zassert_true(bacnet_discover_snapshot_load(TEST_SNAPSHOT), NULL);
+    test_discover_device_check();
+    /* once */
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT), NULL);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT ".missing"), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    bacnet_discover_cleanup();
+    remove(TEST_SNAPSHOT);
+}
+
+/**
+ * @brief Test that a truncated or corrupt snapshot is refused
+ */
+static void test_discover_snapshot_corrupt(void)
+{
+    uint8_t buffer[1024] = { 0 };
+    uint8_t bad[sizeof(buffer)] = { 0 };
+    size_t size, length;
+
+    test_discover_restart();
+    RPM_Count = 0;
+    test_discover_device(5);
+    zassert_true(bacnet_discover_snapshot_save(TEST_SNAPSHOT), NULL);
+    size = test_file_read(TEST_SNAPSHOT, buffer, sizeof(buffer));
+    zassert_true(size > 16, NULL);
+    zassert_true(size < sizeof(buffer), NULL);
+    /* truncated anywhere */
+    for (length = 0; length < size; length += 4) {
+        test_file_write(TEST_SNAPSHOT_BAD, buffer, length);
+        test_discover_restart();
+        zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+        zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    }
+    test_file_write(TEST_SNAPSHOT_BAD, buffer, size - 1);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    /* bad magic */
+    memcpy(bad, buffer, size);
+    bad[0] ^= 0xFF;
+    test_file_write(TEST_SNAPSHOT_BAD, bad, size);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    /* another file format revision */
+    memcpy(bad, buffer, size);
+    bad[7]++;
+    test_file_write(TEST_SNAPSHOT_BAD, bad, size);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    /* a device instance out of range */
+    memcpy(bad, buffer, size);
+    encode_unsigned32(&bad[16], BACNET_MAX_INSTANCE);
+    test_file_write(TEST_SNAPSHOT_BAD, bad, size);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    /* a property value longer than the file */
+    memcpy(bad, buffer, size);
+    encode_unsigned32(&bad[40], 0xFFFFFFFFUL);
+    test_file_write(TEST_SNAPSHOT_BAD, bad, size);
+    test_discover_restart();
+    zassert_false(bacnet_discover_snapshot_load(TEST_SNAPSHOT_BAD), NULL);
+    zassert_equal(bacnet_discover_device_count(), 0, NULL);
+    /* the good file still loads after the refused ones */
+    test_discover_restart();
+    zassert_true(bacnet_discover_snapshot_load(TEST_SNAPSHOT), NULL);
+    test_discover_device_check();
+    bacnet_discover_cleanup();
+    remove(TEST_SNAPSHOT);
+    remove(TEST_SNAPSHOT_BAD);
+}
+
+/**
+ * @brief Test that a loaded device is only rediscovered if it changed
+ */
+static void test_discover_snapshot_revision(void)
+{
+    struct test_value values[2] = { 0 };
+    uint32_t database_revision;
+
+    test_discover_restart();
+    RPM_Count = 0;
+    test_discover_device(5);
+    zassert_true(bacnet_discover_snapshot_save(TEST_SNAPSHOT), NULL);
+    for (database_revision = 5; database_revision <= 6; database_revision++) {
+        test_discover_restart();
+        zassert_true(bacnet_discover_snapshot_load(TEST_SNAPSHOT), NULL);
+        RPM_Count = 0;
+        /* a loaded device reads its revision first */
+        zassert_true(test_discover_request(1), NULL);
+        zassert_equal(RPM_Device_ID, TEST_DEVICE_ID, NULL);
+        zassert_equal(RPM_Object_Type, OBJECT_DEVICE, NULL);
+        zassert_equal(RPM_Property, PROP_DATABASE_REVISION, NULL);
+        values[0].object_type = OBJECT_DEVICE;
+        values[0].object_instance = TEST_DEVICE_ID;
+        values[0].object_property = PROP_DATABASE_REVISION;
+        values[0].array_index = BACNET_ARRAY_ALL;
+        values[0].len =
+            encode_application_unsigned(values[0].data, database_revision);
+        values[1] = values[0];
+        values[1].object_property = PROP_LAST_RESTORE_TIME;
+        values[1].len = 0;
+        test_rpm_ack(TEST_DEVICE_ID, values, 2);
+        if (database_revision == 5) {
+            /* unchanged: the snapshot is used as is */
+            zassert_false(test_discover_request(2), NULL);
+        } else {
+            /* changed: the device is discovered again */
+            zassert_true(test_discover_request(2), NULL);
+            zassert_equal(RPM_Property, PROP_OBJECT_LIST, NULL);
+            zassert_equal(RPM_Array_Index, 0, NULL);
+            tsm_free_invoke_id(RPM_Invoke_ID);
+        }
+        test_discover_device_check();
+    }
+    bacnet_discover_cleanup();
+    remove(TEST_SNAPSHOT);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(
+        bac_discover_tests, ztest_unit_test(test_discover_snapshot_round_trip),
+        ztest_unit_test(test_discover_snapshot_corrupt),
+        ztest_unit_test(test_discover_snapshot_revision));
+
+    ztest_run_test_suite(bac_discover_tests);
+}
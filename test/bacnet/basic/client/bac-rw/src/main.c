@@ -0,0 +1,388 @@
+/**
+ * @file
+ * @brief test the client modules that share the ReadPropertyMultiple ACK
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <math.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/bacdef.h>
+#include <bacnet/rpm.h>
+#include <bacnet/basic/binding/address.h>
+#include <bacnet/basic/client/bac-data.h>
+#include <bacnet/basic/client/bac-discover.h>
+#include <bacnet/basic/client/bac-rw.h>
+#include <bacnet/basic/object/device.h>
+#include <bacnet/basic/services.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/tsm/tsm.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+/* stub clock */
+static unsigned long Milliseconds = 1000;
+/* stub transaction state machine */
+static uint8_t Invoke_ID;
+static bool Invoke_ID_Free[256];
+/* the last ReadPropertyMultiple request */
+static unsigned RPM_Count;
+static uint32_t RPM_Device_ID;
+static BACNET_ARRAY_INDEX RPM_Array_Index;
+static uint8_t RPM_Invoke_ID;
+/* the handler registered for the ReadPropertyMultiple ACK */
+static confirmed_ack_function RPM_Ack_Handler;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+uint16_t apdu_timeout(void)
+{
+    return 3000;
+}
+
+uint32_t Device_Object_Instance_Number(void)
+{
+    return 1;
+}
+
+void apdu_set_confirmed_ack_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, confirmed_ack_function pFunction)
+{
+    if (service_choice == SERVICE_CONFIRMED_READ_PROP_MULTIPLE) {
+        RPM_Ack_Handler = pFunction;
+    }
+}
+
+void apdu_set_confirmed_simple_ack_handler(
+    BACNET_CONFIRMED_SERVICE service_choice,
+    confirmed_simple_ack_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_confirmed_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, confirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_unconfirmed_handler(
+    BACNET_UNCONFIRMED_SERVICE service_choice, unconfirmed_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_error_handler(
+    BACNET_CONFIRMED_SERVICE service_choice, error_function pFunction)
+{
+    (void)service_choice;
+    (void)pFunction;
+}
+
+void apdu_set_abort_handler(abort_function pFunction)
+{
+    (void)pFunction;
+}
+
+void apdu_set_reject_handler(reject_function pFunction)
+{
+    (void)pFunction;
+}
+
+void handler_ucov_notification(
+    uint8_t *service_request, uint16_t service_len, BACNET_ADDRESS *src)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+}
+
+void handler_ucov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    (void)callback;
+}
+
+void handler_ccov_notification(uint8_t *service_request,
+    uint16_t service_len,
+    BACNET_ADDRESS *src,
+    BACNET_CONFIRMED_SERVICE_DATA *service_data)
+{
+    (void)service_request;
+    (void)service_len;
+    (void)src;
+    (void)service_data;
+}
+
+void handler_ccov_notification_add(BACNET_COV_NOTIFICATION *callback)
+{
+    (void)callback;
+}
+
+void address_init(void)
+{
+}
+
+void address_own_device_id_set(uint32_t own_id)
+{
+    (void)own_id;
+}
+
+void address_cache_timer(uint16_t uSeconds)
+{
+    (void)uSeconds;
+}
+
+void address_add_binding(
+    uint32_t device_id, unsigned max_apdu, BACNET_ADDRESS *src)
+{
+    (void)device_id;
+    (void)max_apdu;
+    (void)src;
+}
+
+bool address_get_by_device(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    return address_bind_request(device_id, max_apdu, src);
+}
+
+bool address_bind_request(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    memset(src, 0, sizeof(*src));
+    memcpy(src->mac, &device_id, sizeof(device_id));
+    src->mac_len = sizeof(device_id);
+    *max_apdu = MAX_APDU;
+
+    return true;
+}
+
+bool address_get_device_id(BACNET_ADDRESS *src, uint32_t *device_id)
+{
+    /* the test addresses carry the device instance */
+    memcpy(device_id, src->mac, sizeof(*device_id));
+
+    return true;
+}
+
+void Send_WhoIs(int32_t low_limit, int32_t high_limit)
+{
+    (void)low_limit;
+    (void)high_limit;
+}
+
+void Send_WhoIs_To_Network(
+    BACNET_ADDRESS *target_address, int32_t low_limit, int32_t high_limit)
+{
+    (void)target_address;
+    (void)low_limit;
+    (void)high_limit;
+}
+
+uint8_t Send_COV_Subscribe(
+    uint32_t device_id, BACNET_SUBSCRIBE_COV_DATA *cov_data)
+{
+    (void)device_id;
+    (void)cov_data;
+
+    return 0;
+}
+
+uint8_t Send_Read_Property_Request(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    uint32_t array_index)
+{
+    (void)device_id;
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)array_index;
+
+    return 0;
+}
+
+uint8_t Send_Write_Property_Request_Data(uint32_t device_id,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    uint8_t *application_data,
+    int application_data_len,
+    uint8_t priority,
+    uint32_t array_index)
+{
+    (void)device_id;
+    (void)object_type;
+    (void)object_instance;
+    (void)object_property;
+    (void)application_data;
+    (void)application_data_len;
+    (void)priority;
+    (void)array_index;
+
+    return 0;
+}
+
+uint8_t Send_Read_Property_Multiple_Request(uint8_t *pdu,
+    size_t max_pdu,
+    uint32_t device_id,
+    BACNET_READ_ACCESS_DATA *read_access_data)
+{
+    (void)pdu;
+    (void)max_pdu;
+    RPM_Count++;
+    RPM_Device_ID = device_id;
+    RPM_Array_Index =
+        read_access_data->listOfProperties->propertyArrayIndex;
+    Invoke_ID++;
+    Invoke_ID_Free[Invoke_ID] = false;
+    RPM_Invoke_ID = Invoke_ID;
+
+    return RPM_Invoke_ID;
+}
+
+bool tsm_invoke_id_free(uint8_t invokeID)
+{
+    return Invoke_ID_Free[invokeID];
+}
+
+bool tsm_invoke_id_failed(uint8_t invokeID)
+{
+    (void)invokeID;
+
+    return false;
+}
+
+void tsm_free_invoke_id(uint8_t invokeID)
+{
+    Invoke_ID_Free[invokeID] = true;
+}
+
+/**
+ * @brief Deliver a ReadPropertyMultiple ACK with one property value
+ * @param device_id - device that sent the ACK
+ * @param invoke_id - invoke ID of the acknowledged request
+ * @param rpmdata - object and property of the value
+ * @param application_data - encoded value
+ * @param application_data_len - length of the encoded value
+ */
+static void test_rpm_ack(uint32_t device_id,
+    uint8_t invoke_id,
+    BACNET_RPM_DATA *rpmdata,
+    uint8_t *application_data,
+    int application_data_len)
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    BACNET_CONFIRMED_SERVICE_ACK_DATA service_data = { 0 };
+    BACNET_ADDRESS src = { 0 };
+    unsigned max_apdu = 0;
+    int apdu_len;
+
+    apdu_len = rpm_ack_encode_apdu_object_begin(&apdu[0], rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], rpmdata->object_property, rpmdata->array_index);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, application_data_len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    address_bind_request(device_id, &max_apdu, &src);
+    service_data.invoke_id = invoke_id;
+    RPM_Ack_Handler(apdu, apdu_len, &src, &service_data);
+    tsm_free_invoke_id(invoke_id);
+}
+
+/**
+ * @brief Test that polling and discovery each receive their own ACKs
+ *  whichever module is initialized last
+ */
+static void test_bac_rw_rpm_ack_shared(void)
+{
+    uint8_t application_data[16] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    float real_value = 0.0f;
+    unsigned pass, i;
+    int len;
+
+    for (pass = 0; pass < 2; pass++) {
+        if (pass == 0) {
+            bacnet_data_init();
+            bacnet_discover_init();
+        } else {
+            bacnet_discover_cleanup();
+            bacnet_discover_init();
+            bacnet_data_init();
+        }
+        bacnet_data_cov_lifetime_set(0);
+        bacnet_discover_seconds_set(60);
+        /* a polled point */
+        RPM_Count = 0;
+        zassert_true(bacnet_data_object_add(10, OBJECT_ANALOG_INPUT, 1), NULL);
+        Milliseconds += 1;
+        bacnet_data_task();
+        zassert_equal(RPM_Count, 1, NULL);
+        zassert_equal(RPM_Device_ID, 10, NULL);
+        rpmdata.object_type = OBJECT_ANALOG_INPUT;
+        rpmdata.object_instance = 1;
+        rpmdata.object_property = PROP_PRESENT_VALUE;
+        rpmdata.array_index = BACNET_ARRAY_ALL;
+        len = encode_application_real(application_data, 21.0f + pass);
+        test_rpm_ack(10, RPM_Invoke_ID, &rpmdata, application_data, len);
+        bacnet_data_task();
+        zassert_true(bacnet_data_analog_present_value(
+                         10, OBJECT_ANALOG_INPUT, 1, &real_value),
+            NULL);
+        zassert_false(islessgreater(real_value, 21.0f + pass), NULL);
+        /* a discovered device reads the size of its object list */
+        bacnet_discover_device_add(20, MAX_APDU, SEGMENTATION_NONE, 0);
+        for (i = 0; (i < 10) && (RPM_Count < 2); i++) {
+            Milliseconds += 10;
+            bacnet_discover_task();
+        }
+        zassert_equal(RPM_Count, 2, NULL);
+        zassert_equal(RPM_Device_ID, 20, NULL);
+        zassert_equal(RPM_Array_Index, 0, NULL);
+        rpmdata.object_type = OBJECT_DEVICE;
+        rpmdata.object_instance = 20;
+        rpmdata.object_property = PROP_OBJECT_LIST;
+        rpmdata.array_index = 0;
+        len = encode_application_unsigned(application_data, 2);
+        test_rpm_ack(20, RPM_Invoke_ID, &rpmdata, application_data, len);
+        /* and then reads the elements of the object list */
+        for (i = 0; (i < 10) && (RPM_Count < 3); i++) {
+            Milliseconds += 10;
+            bacnet_discover_task();
+        }
+        zassert_equal(RPM_Count, 3, NULL);
+        zassert_equal(RPM_Device_ID, 20, NULL);
+        zassert_equal(RPM_Array_Index, 1, NULL);
+        /* the polled point is not refused and polls with RPM again */
+        Milliseconds += 60UL * 1000UL;
+        bacnet_data_task();
+        bacnet_data_task();
+        zassert_equal(RPM_Count, 4, NULL);
+        zassert_equal(RPM_Device_ID, 10, NULL);
+        tsm_free_invoke_id(RPM_Invoke_ID);
+    }
+    bacnet_discover_cleanup();
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(
+        bac_rw_tests, ztest_unit_test(test_bac_rw_rpm_ack_shared));
+
+    ztest_run_test_suite(bac_rw_tests);
+}
@@ -73,6 +73,119 @@ static void testAccessCredential(void)
 
     return;
 }
+/**
+ * @brief Set a card number authentication factor
+ */
+static void test_card_factor(
+    BACNET_CREDENTIAL_AUTHENTICATION_FACTOR *value, uint32_t card)
+{
+    uint8_t card_value[4];
+
+    card_value[0] = (uint8_t)(card >> 24);
+    card_value[1] = (uint8_t)(card >> 16);
+    card_value[2] = (uint8_t)(card >> 8);
+    card_value[3] = (uint8_t)card;
+    value->disable = ACCESS_AUTHENTICATION_FACTOR_DISABLE_NONE;
+    value->authentication_factor.format_type =
+        AUTHENTICATION_FACTOR_SIMPLE_NUMBER32;
+    value->authentication_factor.format_class = 0;
+    octetstring_init(
+        &value->authentication_factor.value, card_value, sizeof(card_value));
+}
+
+/**
+ * @brief Test finding credentials from their authentication factors
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(access_credential_tests, testAccessCredentialFactorIndex)
+#else
+static void testAccessCredentialFactorIndex(void)
+#endif
+{
+    const uint32_t count = 1000;
+    BACNET_CREDENTIAL_AUTHENTICATION_FACTOR value;
+    ACCESS_CREDENTIAL_DESCR *pObject;
+    BACNET_DATE_TIME now;
+    uint32_t instance, test_instance;
+    uint32_t i;
+
+    Access_Credential_Cleanup();
+    Access_Credential_Init();
+    zassert_equal(Access_Credential_Count(), MAX_ACCESS_CREDENTIALS, NULL);
+    for (i = 0; i < count; i++) {
+        instance = 1000 + i;
+        zassert_equal(Access_Credential_Create(instance), instance, NULL);
+        test_card_factor(&value, 0x12340000UL + i);
+        zassert_true(
+            Access_Credential_Authentication_Factor_Add(instance, &value),
+            NULL);
+    }
+    zassert_equal(
+        Access_Credential_Count(), MAX_ACCESS_CREDENTIALS + count, NULL);
+    /* a factor can belong to only one credential */
+    test_card_factor(&value, 0x12340000UL);
+    zassert_false(
+        Access_Credential_Authentication_Factor_Add(0, &value), NULL);
+    for (i = 0; i < count; i++) {
+        test_card_factor(&value, 0x12340000UL + i);
+        zassert_true(Access_Credential_Authentication_Factor_Find(
+                         &value.authentication_factor, &test_instance),
+            NULL);
+        zassert_equal(test_instance, 1000 + i, NULL);
+    }
+    test_card_factor(&value, 0x12350000UL);
+    zassert_false(Access_Credential_Authentication_Factor_Find(
+                      &value.authentication_factor, &test_instance),
+        NULL);
+    /* deleted credentials are not found, and the others still are */
+    for (i = 0; i < count; i += 2) {
+        zassert_true(Access_Credential_Delete(1000 + i), NULL);
+    }
+    for (i = 0; i < count; i++) {
+        test_card_factor(&value, 0x12340000UL + i);
+        zassert_equal(Access_Credential_Authentication_Factor_Find(
+                          &value.authentication_factor, &test_instance),
+            (i % 2) != 0, NULL);
+        if (i % 2) {
+            zassert_equal(test_instance, 1000 + i, NULL);
+        }
+    }
+    zassert_true(
+        Access_Credential_Authentication_Factor_Delete_All(1001), NULL);
+    test_card_factor(&value, 0x12340001UL);
+    zassert_false(Access_Credential_Authentication_Factor_Find(
+                      &value.authentication_factor, NULL),
+        NULL);
+    /* the credential decides whether the factor is accepted */
+    test_card_factor(&value, 0x12340003UL);
+    datetime_set_values(&now, 2026, 10, 19, 12, 0, 0, 0);
+    zassert_equal(Access_Credential_Authorize(
+                      &value.authentication_factor, &now, &test_instance),
+        ACCESS_EVENT_DENIED_CREDENTIAL_DISABLED, NULL);
+    zassert_equal(test_instance, 1003, NULL);
+    pObject = Access_Credential_Data(1003);
+    zassert_not_null(pObject, NULL);
+    pObject->credential_status = true;
+    zassert_equal(Access_Credential_Authorize(
+                      &value.authentication_factor, &now, NULL),
+        ACCESS_EVENT_GRANTED, NULL);
+    datetime_set_values(
+        &pObject->expiration_time, 2026, 10, 18, 0, 0, 0, 0);
+    zassert_equal(Access_Credential_Authorize(
+                      &value.authentication_factor, &now, NULL),
+        ACCESS_EVENT_DENIED_CREDENTIAL_EXPIRED, NULL);
+    datetime_wildcard_set(&pObject->expiration_time);
+    pObject->auth_factors[0].disable =
+        ACCESS_AUTHENTICATION_FACTOR_DISABLE_DISABLED_LOST;
+    zassert_equal(Access_Credential_Authorize(
+                      &value.authentication_factor, &now, NULL),
+        ACCESS_EVENT_DENIED_AUTHENTICATION_FACTOR_LOST, NULL);
+    test_card_factor(&value, 0x12340000UL);
+    zassert_equal(Access_Credential_Authorize(
+                      &value.authentication_factor, &now, NULL),
+        ACCESS_EVENT_DENIED_UNKNOWN_CREDENTIAL, NULL);
+    Access_Credential_Cleanup();
+}
 /**
  * @}
  */
@@ -83,7 +196,8 @@ ZTEST_SUITE(access_credential_tests, NULL, NULL, NULL, NULL, NULL);
 void test_main(void)
 {
     ztest_test_suite(
-        access_credential_tests, ztest_unit_test(testAccessCredential));
+        access_credential_tests, ztest_unit_test(testAccessCredential),
+        ztest_unit_test(testAccessCredentialFactorIndex));
 
     ztest_run_test_suite(access_credential_tests);
 }
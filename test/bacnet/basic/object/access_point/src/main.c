@@ -10,7 +10,9 @@
 
 #include <zephyr/ztest.h>
 #include <bacnet/bacdcode.h>
+#include <bacnet/basic/object/access_credential.h>
 #include <bacnet/basic/object/access_point.h>
+#include <bacnet/basic/object/access_rights.h>
 #include <bacnet/bactext.h>
 
 /**
@@ -71,6 +73,110 @@ static void testAccessPoint(void)
         required_property++;
     }
 }
+
+/**
+ * @brief Test the access decision for an authentication factor
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(access_point_tests, testAccessPointAuthenticate)
+#else
+static void testAccessPointAuthenticate(void)
+#endif
+{
+    const uint32_t point_instance = 1;
+    const uint32_t credential_instance = 42;
+    const uint32_t rights_instance = 2;
+    uint8_t card_value[4] = { 0x00, 0x12, 0xD6, 0x87 };
+    BACNET_CREDENTIAL_AUTHENTICATION_FACTOR value = { 0 };
+    BACNET_ACCESS_RULE *rule;
+    ACCESS_CREDENTIAL_DESCR *credential;
+    ACCESS_RIGHTS_DESCR *rights;
+    ACCESS_POINT_DESCR *point;
+    BACNET_DATE_TIME now;
+
+    Access_Point_Init();
+    Access_Rights_Init();
+    Access_Credential_Init();
+    datetime_set_values(&now, 2026, 10, 19, 8, 30, 0, 0);
+    value.authentication_factor.format_type =
+        AUTHENTICATION_FACTOR_SIMPLE_NUMBER32;
+    octetstring_init(
+        &value.authentication_factor.value, card_value, sizeof(card_value));
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_DENIED_UNKNOWN_CREDENTIAL, NULL);
+    point = Access_Point_Data(point_instance);
+    zassert_not_null(point, NULL);
+    zassert_equal(point->access_event_tag, 1, NULL);
+    zassert_equal(
+        point->access_event_credential.objectIdentifier.type, OBJECT_NONE,
+        NULL);
+    /* an active credential without access rights */
+    zassert_equal(
+        Access_Credential_Create(credential_instance), credential_instance,
+        NULL);
+    zassert_true(Access_Credential_Authentication_Factor_Add(
+                     credential_instance, &value),
+        NULL);
+    credential = Access_Credential_Data(credential_instance);
+    credential->credential_status = true;
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_DENIED_NO_ACCESS_RIGHTS, NULL);
+    zassert_equal(point->access_event_credential.objectIdentifier.type,
+        OBJECT_ACCESS_CREDENTIAL, NULL);
+    zassert_equal(point->access_event_credential.objectIdentifier.instance,
+        credential_instance, NULL);
+    /* access rights permit this access point */
+    credential->assigned_access_rights[0].assigned_access_rights
+        .deviceIdentifier.type = OBJECT_NONE;
+    credential->assigned_access_rights[0].assigned_access_rights
+        .objectIdentifier.type = OBJECT_ACCESS_RIGHTS;
+    credential->assigned_access_rights[0].assigned_access_rights
+        .objectIdentifier.instance = rights_instance;
+    credential->assigned_access_rights[0].enable = true;
+    credential->assigned_access_rights_count = 1;
+    rights = Access_Rights_Data(rights_instance);
+    zassert_not_null(rights, NULL);
+    rights->enable = true;
+    rule = &rights->positive_access_rules[0];
+    rule->time_range_specifier = TIME_RANGE_SPECIFIER_ALWAYS;
+    rule->location_specifier = LOCATION_SPECIFIER_SPECIFIED;
+    rule->location.objectIdentifier.type = OBJECT_ACCESS_POINT;
+    rule->location.objectIdentifier.instance = point_instance;
+    rule->enable = true;
+    rights->positive_access_rules_count = 1;
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_GRANTED, NULL);
+    zassert_equal(point->access_event, ACCESS_EVENT_GRANTED, NULL);
+    zassert_equal(Access_Point_Authenticate(point_instance + 1,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_DENIED_NO_ACCESS_RIGHTS, NULL);
+    /* a negative rule overrides the positive rule */
+    rule = &rights->negative_access_rules[0];
+    rule->time_range_specifier = TIME_RANGE_SPECIFIER_ALWAYS;
+    rule->location_specifier = LOCATION_SPECIFIER_ALL;
+    rule->enable = true;
+    rights->negative_access_rules_count = 1;
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_DENIED_POINT_NO_ACCESS_RIGHTS, NULL);
+    /* the access point may not evaluate the access rights */
+    point->authorization_mode = AUTHORIZATION_MODE_GRANT_ACTIVE;
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_GRANTED, NULL);
+    point->authorization_mode = AUTHORIZATION_MODE_DENY_ALL;
+    zassert_equal(Access_Point_Authenticate(point_instance,
+                      &value.authentication_factor, &now),
+        ACCESS_EVENT_DENIED_DENY_ALL, NULL);
+    zassert_equal(point->access_event_tag, 6, NULL);
+
+    Access_Credential_Cleanup();
+    Access_Rights_Cleanup();
+    Access_Point_Cleanup();
+}
 /**
  * @}
  */
@@ -80,7 +186,8 @@ ZTEST_SUITE(access_point_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(access_point_tests, ztest_unit_test(testAccessPoint));
+    ztest_test_suite(access_point_tests, ztest_unit_test(testAccessPoint),
+        ztest_unit_test(testAccessPointAuthenticate));
 
     ztest_run_test_suite(access_point_tests);
 }
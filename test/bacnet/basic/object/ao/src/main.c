@@ -7,6 +7,7 @@
  *
  * SPDX-License-Identifier: MIT
  */
+#include <math.h>
 #include <zephyr/ztest.h>
 #include <bacnet/basic/object/ao.h>
 #include <property_test.h>
@@ -40,6 +41,35 @@ static void testAnalogOutput(void)
         OBJECT_ANALOG_OUTPUT, object_instance, Analog_Output_Property_Lists,
         Analog_Output_Read_Property, Analog_Output_Write_Property,
         skip_fail_property_list);
+    /* priority array resolution */
+    status = Analog_Output_Relinquish_Default_Set(object_instance, 5.0f);
+    zassert_true(status, NULL);
+    zassert_false(
+        islessgreater(Analog_Output_Present_Value(object_instance), 5.0f),
+        NULL);
+    zassert_equal(Analog_Output_Present_Value_Priority(object_instance), 0,
+        NULL);
+    status = Analog_Output_Present_Value_Set(object_instance, 20.0f, 16);
+    zassert_true(status, NULL);
+    status = Analog_Output_Present_Value_Set(object_instance, 10.0f, 8);
+    zassert_true(status, NULL);
+    status = Analog_Output_Present_Value_Set(object_instance, 30.0f, 12);
+    zassert_true(status, NULL);
+    zassert_false(
+        islessgreater(Analog_Output_Present_Value(object_instance), 10.0f),
+        NULL);
+    zassert_equal(Analog_Output_Present_Value_Priority(object_instance), 8,
+        NULL);
+    status = Analog_Output_Present_Value_Relinquish(object_instance, 8);
+    zassert_true(status, NULL);
+    zassert_false(
+        islessgreater(Analog_Output_Present_Value(object_instance), 30.0f),
+        NULL);
+    Analog_Output_Present_Value_Relinquish(object_instance, 12);
+    Analog_Output_Present_Value_Relinquish(object_instance, 16);
+    zassert_false(
+        islessgreater(Analog_Output_Present_Value(object_instance), 5.0f),
+        NULL);
     status = Analog_Output_Delete(object_instance);
     zassert_true(status, NULL);
 }
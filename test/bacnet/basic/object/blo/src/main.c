@@ -9,12 +9,21 @@
 #include <zephyr/ztest.h>
 #include <bacnet/bactext.h>
 #include <bacnet/basic/object/blo.h>
+#include <bacnet/basic/sys/tmwheel.h>
 
 /**
  * @addtogroup bacnet_tests
  * @{
  */
 
+static unsigned long Test_Now;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
 /**
  * @brief Test
  */
@@ -129,6 +138,25 @@ static void testBinaryLightingOutput(void)
     zassert_equal(len, BACNET_STATUS_ERROR, NULL);
     status = Binary_Lighting_Output_Write_Property(&wpdata);
     zassert_false(status, NULL);
+    /* the highest commanded priority wins */
+    status = Binary_Lighting_Output_Present_Value_Set(
+        instance, BINARY_LIGHTING_PV_OFF, 16);
+    zassert_true(status, NULL);
+    status = Binary_Lighting_Output_Present_Value_Set(
+        instance, BINARY_LIGHTING_PV_ON, 8);
+    zassert_true(status, NULL);
+    zassert_equal(
+        Binary_Lighting_Output_Present_Value(instance), BINARY_LIGHTING_PV_ON,
+        NULL);
+    zassert_equal(
+        Binary_Lighting_Output_Present_Value_Priority(instance), 8, NULL);
+    status = Binary_Lighting_Output_Present_Value_Relinquish(instance, 8);
+    zassert_true(status, NULL);
+    zassert_equal(
+        Binary_Lighting_Output_Present_Value(instance),
+        BINARY_LIGHTING_PV_OFF, NULL);
+    zassert_equal(
+        Binary_Lighting_Output_Present_Value_Priority(instance), 16, NULL);
     /* check the delete function */
     status = Binary_Lighting_Output_Delete(instance);
     zassert_true(status, NULL);
@@ -270,6 +298,13 @@ static void testBinaryLightingOutputBlink(void)
         zassert_equal(BLO_Value.pv, expect_pv, NULL);
         milliseconds -= milliseconds_elapsed;
     }
+    /* the writes arm the output timer, which idles when done */
+    zassert_equal(tmwheel_count(), 1, NULL);
+    Test_Now += 100;
+    zassert_equal(tmwheel_run(), 1, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+    zassert_equal(BLO_Value.count, 2, "count=%u", BLO_Value.count);
+    Binary_Lighting_Output_Cleanup();
 }
 /**
  * @}
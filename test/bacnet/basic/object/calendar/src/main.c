@@ -16,6 +16,15 @@
  * @{
  */
 
+static unsigned Date_List_Changed_Count;
+static uint32_t Date_List_Changed_Instance;
+
+static void test_date_list_changed(uint32_t object_instance)
+{
+    Date_List_Changed_Instance = object_instance;
+    Date_List_Changed_Count++;
+}
+
 /**
  * @brief Test Calendar handling
  */
@@ -237,6 +246,97 @@ static void testPresentValue(void)
     zassert_true(Calendar_Delete(instance), NULL);
 }
 
+#ifdef CONFIG_ZTEST_NEW_API
+ZTEST(bacnet_calendar, testDateActive)
+#else
+static void testDateActive(void)
+#endif
+{
+    const uint32_t instance = 2;
+    BACNET_CALENDAR_ENTRY entry[2];
+    BACNET_CALENDAR_ENTRY *value;
+    BACNET_DATE date;
+    BACNET_DATE_TIME bdatetime;
+    uint32_t day;
+    bool active;
+
+    Calendar_Init();
+    zassert_equal(Calendar_Create(instance), instance, NULL);
+    /* Mondays of May, and the first week of December */
+    entry[0].tag = BACNET_CALENDAR_WEEK_N_DAY;
+    entry[0].type.WeekNDay.month = 5;
+    entry[0].type.WeekNDay.weekofmonth = 0xff;
+    entry[0].type.WeekNDay.dayofweek = 1;
+    Calendar_Date_List_Add(instance, &entry[0]);
+    entry[1].tag = BACNET_CALENDAR_DATE_RANGE;
+    datetime_set_date(&entry[1].type.DateRange.startdate, 2024, 12, 1);
+    datetime_set_date(&entry[1].type.DateRange.enddate, 2025, 12, 7);
+    Calendar_Date_List_Add(instance, &entry[1]);
+    /* the bitmap agrees with the Date_List for every day of the year */
+    for (day = 1; day <= 366; day++) {
+        datetime_day_of_year_into_date(day, 2024, &date);
+        active = bacapp_date_in_calendar_entry(&date, &entry[0]) ||
+            bacapp_date_in_calendar_entry(&date, &entry[1]);
+        zassert_equal(Calendar_Date_Active(instance, &date), active, NULL);
+    }
+    datetime_set_date(&date, 2024, 5, 27);
+    zassert_true(Calendar_Date_Active(instance, &date), NULL);
+    datetime_set_date(&date, 2024, 5, 21);
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    /* the year rolls over */
+    datetime_set_date(&date, 2025, 5, 26);
+    zassert_true(Calendar_Date_Active(instance, &date), NULL);
+    datetime_set_date(&date, 2025, 12, 8);
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    /* an entry changed through the pointer takes effect at once,
+       and the bitmap is used again when the entry is stored */
+    datetime_set_date(&date, 2024, 5, 27);
+    zassert_true(Calendar_Date_Active(instance, &date), NULL);
+    value = Calendar_Date_List_Get(instance, 0);
+    zassert_not_null(value, NULL);
+    value->type.WeekNDay.month = 6;
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    zassert_true(Calendar_Date_List_Set(instance, 0, value), NULL);
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    datetime_set_date(&date, 2024, 6, 3);
+    zassert_true(Calendar_Date_Active(instance, &date), NULL);
+    zassert_false(Calendar_Date_List_Set(instance, 2, &entry[0]), NULL);
+    /* a date with a wildcard is not in the bitmap */
+    datetime_set_date(&date, 2024, 12, 3);
+    datetime_wildcard_year_set(&date);
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    /* a change to the Date_List is compiled again, and reported */
+    Calendar_Date_List_Changed_Callback_Set(test_date_list_changed);
+    Date_List_Changed_Count = 0;
+    Calendar_Date_List_Delete_All(instance);
+    zassert_equal(Date_List_Changed_Count, 1, NULL);
+    zassert_equal(Date_List_Changed_Instance, instance, NULL);
+    datetime_set_date(&date, 2024, 5, 27);
+    zassert_false(Calendar_Date_Active(instance, &date), NULL);
+    /* present-value changes at the day boundary */
+    Calendar_Date_List_Add(instance, &entry[0]);
+    zassert_equal(Date_List_Changed_Count, 2, NULL);
+    Calendar_Date_List_Changed_Callback_Set(NULL);
+    datetime_set_date(&bdatetime.date, 2024, 5, 26);
+    datetime_set_time(&bdatetime.time, 23, 59, 0, 0);
+    zassert_equal(Calendar_Task(&bdatetime), 60000UL, NULL);
+    zassert_false(Calendar_Change_Of_Value(instance), NULL);
+    datetime_set_date(&bdatetime.date, 2024, 5, 27);
+    datetime_set_time(&bdatetime.time, 0, 0, 0, 0);
+    zassert_equal(Calendar_Task(&bdatetime), 86400000UL, NULL);
+    zassert_true(Calendar_Change_Of_Value(instance), NULL);
+    Calendar_Change_Of_Value_Clear(instance);
+    zassert_false(Calendar_Change_Of_Value(instance), NULL);
+    datetime_set_time(&bdatetime.time, 12, 0, 0, 0);
+    zassert_equal(Calendar_Task(&bdatetime), 43200000UL, NULL);
+    zassert_false(Calendar_Change_Of_Value(instance), NULL);
+    datetime_set_date(&bdatetime.date, 2024, 5, 28);
+    (void)Calendar_Task(&bdatetime);
+    zassert_true(Calendar_Change_Of_Value(instance), NULL);
+
+    zassert_true(Calendar_Delete(instance), NULL);
+}
+
 /**
  * @}
  */
@@ -248,7 +348,7 @@ void test_main(void)
 {
     ztest_test_suite(
         calendar_tests, ztest_unit_test(testCalendar),
-        ztest_unit_test(testPresentValue));
+        ztest_unit_test(testPresentValue), ztest_unit_test(testDateActive));
 
     ztest_run_test_suite(calendar_tests);
 }
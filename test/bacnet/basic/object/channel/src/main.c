@@ -10,6 +10,7 @@
 #include <zephyr/ztest.h>
 #include <bacnet/basic/object/channel.h>
 #include <bacnet/bactext.h>
+#include <bacnet/basic/tsm/tsm.h>
 
 /**
  * @addtogroup bacnet_tests
@@ -135,13 +136,186 @@ static void test_Channel_ReadProperty(void)
     status = Channel_Delete(instance);
     zassert_true(status, NULL);
 }
+
+/* stub data in stubs.c */
+extern unsigned Stub_Max_APDU;
+extern unsigned Stub_WPM_Count;
+extern uint32_t Stub_WPM_Device_ID[];
+extern unsigned Stub_WPM_Objects[];
+extern BACNET_TSM_COMPLETE_NOTIFICATION *Stub_TSM_Complete;
+extern uint32_t Stub_Routed_Device_Current;
+
+/* members written directly */
+static unsigned Local_Write_Count;
+static uint32_t Local_Write_Instance[8];
+
+static bool test_Channel_Write_Property_Internal(
+    BACNET_WRITE_PROPERTY_DATA *wp_data)
+{
+    if (Local_Write_Count < 8) {
+        Local_Write_Instance[Local_Write_Count] = wp_data->object_instance;
+    }
+    Local_Write_Count++;
+
+    return true;
+}
+
+/**
+ * @brief End a WritePropertyMultiple request to a member device
+ * @param device_id - member device instance, which is its address
+ * @param invoke_id - invoke ID of the request
+ * @param status - how the request ended
+ */
+static void test_Channel_Write_Complete(uint32_t device_id,
+    uint8_t invoke_id,
+    BACNET_TSM_TRANSACTION_STATUS status)
+{
+    BACNET_ADDRESS dest = { 0 };
+
+    dest.mac_len = 1;
+    dest.mac[0] = (uint8_t)device_id;
+    Stub_TSM_Complete->callback(&dest, invoke_id, status);
+}
+
+/**
+ * @brief Test writing members in other devices
+ */
+static void test_Channel_Write_Members_Remote(void)
+{
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE member = { 0 };
+    BACNET_WRITE_PROPERTY_DATA wpdata = { 0 };
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    const uint32_t instance = 124;
+    unsigned m;
+    bool status;
+
+    Channel_Init();
+    Channel_Create(instance);
+    /* three members in device 2, three in device 3 */
+    for (m = 0; m < 6; m++) {
+        member.objectIdentifier.type = OBJECT_ANALOG_VALUE;
+        member.objectIdentifier.instance = m;
+        member.propertyIdentifier = PROP_PRESENT_VALUE;
+        member.arrayIndex = BACNET_ARRAY_ALL;
+        member.deviceIdentifier.type = OBJECT_DEVICE;
+        member.deviceIdentifier.instance = 2 + (m & 1);
+        status =
+            Channel_Reference_List_Member_Element_Set(instance, m + 1, &member);
+        zassert_true(status, NULL);
+    }
+    wpdata.object_type = OBJECT_CHANNEL;
+    wpdata.object_instance = instance;
+    wpdata.priority = 8;
+    value.tag = BACNET_APPLICATION_TAG_REAL;
+    value.type.Real = 100.0f;
+    /* one request per device */
+    Stub_Max_APDU = MAX_APDU;
+    Stub_WPM_Count = 0;
+    status = Channel_Present_Value_Set(&wpdata, &value);
+    zassert_true(status, NULL);
+    zassert_equal(Stub_WPM_Count, 2, NULL);
+    zassert_equal(Stub_WPM_Device_ID[0], 2, NULL);
+    zassert_equal(Stub_WPM_Objects[0], 3, NULL);
+    zassert_equal(Stub_WPM_Device_ID[1], 3, NULL);
+    zassert_equal(Stub_WPM_Objects[1], 3, NULL);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_IN_PROGRESS, NULL);
+    /* a reply with the invoke ID from another device is not its own */
+    test_Channel_Write_Complete(3, 1, TSM_TRANSACTION_ERROR);
+    test_Channel_Write_Complete(2, 1, TSM_TRANSACTION_ACK);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_IN_PROGRESS, NULL);
+    test_Channel_Write_Complete(3, 2, TSM_TRANSACTION_ACK);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_SUCCESSFUL, NULL);
+    /* two members per request, and one request is not acknowledged */
+    Stub_Max_APDU = MAX_NPDU + 4 + 40;
+    Stub_WPM_Count = 0;
+    status = Channel_Present_Value_Set(&wpdata, &value);
+    zassert_true(status, NULL);
+    zassert_equal(Stub_WPM_Count, 4, NULL);
+    zassert_equal(Stub_WPM_Objects[0], 2, NULL);
+    zassert_equal(Stub_WPM_Objects[1], 1, NULL);
+    zassert_equal(Stub_WPM_Objects[2], 2, NULL);
+    zassert_equal(Stub_WPM_Objects[3], 1, NULL);
+    test_Channel_Write_Complete(2, 1, TSM_TRANSACTION_ACK);
+    test_Channel_Write_Complete(2, 2, TSM_TRANSACTION_ACK);
+    test_Channel_Write_Complete(3, 3, TSM_TRANSACTION_ACK);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_IN_PROGRESS, NULL);
+    test_Channel_Write_Complete(3, 4, TSM_TRANSACTION_TIMEOUT);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_FAILED, NULL);
+    status = Channel_Delete(instance);
+    zassert_true(status, NULL);
+}
+
+/**
+ * @brief Test writing members in this device and in routed devices
+ */
+static void test_Channel_Write_Members_Local(void)
+{
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE member = { 0 };
+    BACNET_WRITE_PROPERTY_DATA wpdata = { 0 };
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    const uint32_t instance = 125;
+    /* this device, a routed device, and another device */
+    const uint32_t device_id[3] = { 0, 5, 7 };
+    unsigned m;
+    bool status;
+
+    Channel_Init();
+    Channel_Create(instance);
+    Channel_Write_Property_Internal_Callback_Set(
+        test_Channel_Write_Property_Internal);
+    for (m = 0; m < 3; m++) {
+        member.objectIdentifier.type = OBJECT_ANALOG_VALUE;
+        member.objectIdentifier.instance = m;
+        member.propertyIdentifier = PROP_PRESENT_VALUE;
+        member.arrayIndex = BACNET_ARRAY_ALL;
+        member.deviceIdentifier.type = OBJECT_DEVICE;
+        member.deviceIdentifier.instance = device_id[m];
+        status =
+            Channel_Reference_List_Member_Element_Set(instance, m + 1, &member);
+        zassert_true(status, NULL);
+    }
+    wpdata.object_type = OBJECT_CHANNEL;
+    wpdata.object_instance = instance;
+    wpdata.priority = 8;
+    value.tag = BACNET_APPLICATION_TAG_REAL;
+    value.type.Real = 50.0f;
+    Stub_Max_APDU = MAX_APDU;
+    Stub_WPM_Count = 0;
+    Stub_Routed_Device_Current = 0;
+    Local_Write_Count = 0;
+    status = Channel_Present_Value_Set(&wpdata, &value);
+    zassert_true(status, NULL);
+    zassert_equal(Local_Write_Count, 2, NULL);
+    zassert_equal(Local_Write_Instance[0], 0, NULL);
+    zassert_equal(Local_Write_Instance[1], 1, NULL);
+    zassert_equal(Stub_WPM_Count, 1, NULL);
+    zassert_equal(Stub_WPM_Device_ID[0], 7, NULL);
+    zassert_equal(Stub_WPM_Objects[0], 1, NULL);
+    /* the current routed device is selected again */
+    zassert_equal(Stub_Routed_Device_Current, 0, NULL);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_IN_PROGRESS, NULL);
+    test_Channel_Write_Complete(7, 1, TSM_TRANSACTION_ACK);
+    zassert_equal(
+        Channel_Write_Status(instance), BACNET_WRITE_STATUS_SUCCESSFUL, NULL);
+    Channel_Write_Property_Internal_Callback_Set(NULL);
+    status = Channel_Delete(instance);
+    zassert_true(status, NULL);
+}
 /**
  * @}
  */
 
 void test_main(void)
 {
-    ztest_test_suite(channel_tests, ztest_unit_test(test_Channel_ReadProperty));
+    ztest_test_suite(channel_tests, ztest_unit_test(test_Channel_ReadProperty),
+        ztest_unit_test(test_Channel_Write_Members_Remote),
+        ztest_unit_test(test_Channel_Write_Members_Local));
 
     ztest_run_test_suite(channel_tests);
 }
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @brief Stub functions for unit test of the Channel object members
+ *  in other devices
+ * @date October 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "bacnet/bacdef.h"
+#include "bacnet/wpm.h"
+#include "bacnet/basic/tsm/tsm.h"
+
+/* the stubs record each WritePropertyMultiple request */
+#define STUB_WPM_MAX 8
+unsigned Stub_Max_APDU = MAX_APDU;
+unsigned Stub_WPM_Count;
+uint32_t Stub_WPM_Device_ID[STUB_WPM_MAX];
+unsigned Stub_WPM_Objects[STUB_WPM_MAX];
+BACNET_TSM_COMPLETE_NOTIFICATION *Stub_TSM_Complete;
+/* the devices routed by this stack, and the selected device */
+uint32_t Stub_Routed_Device_ID[2] = { 0, 5 };
+uint32_t Stub_Routed_Device_Current;
+
+bool Routed_Device_Valid_Object_Instance_Number(uint32_t object_id)
+{
+    unsigned i;
+
+    for (i = 0; i < 2; i++) {
+        if (Stub_Routed_Device_ID[i] == object_id) {
+            Stub_Routed_Device_Current = object_id;
+            return true;
+        }
+    }
+    /* not found selects the gateway device */
+    Stub_Routed_Device_Current = Stub_Routed_Device_ID[0];
+
+    return false;
+}
+
+bool address_get_by_device(
+    uint32_t device_id, unsigned *max_apdu, BACNET_ADDRESS *src)
+{
+    if (src) {
+        /* the address of each device is its instance */
+        memset(src, 0, sizeof(*src));
+        src->mac_len = 1;
+        src->mac[0] = (uint8_t)device_id;
+    }
+    if (max_apdu) {
+        *max_apdu = Stub_Max_APDU;
+    }
+
+    return true;
+}
+
+void Send_WhoIs(int32_t low_limit, int32_t high_limit)
+{
+    (void)low_limit;
+    (void)high_limit;
+}
+
+uint8_t Send_Write_Property_Multiple_Request(uint8_t *pdu,
+    size_t max_pdu,
+    uint32_t device_id,
+    BACNET_WRITE_ACCESS_DATA *write_access_data)
+{
+    unsigned count = 0;
+
+    (void)pdu;
+    (void)max_pdu;
+    if (Stub_WPM_Count >= STUB_WPM_MAX) {
+        return 0;
+    }
+    while (write_access_data) {
+        count++;
+        write_access_data = write_access_data->next;
+    }
+    Stub_WPM_Device_ID[Stub_WPM_Count] = device_id;
+    Stub_WPM_Objects[Stub_WPM_Count] = count;
+    Stub_WPM_Count++;
+
+    return (uint8_t)Stub_WPM_Count;
+}
+
+void tsm_complete_notification_add(
+    BACNET_TSM_COMPLETE_NOTIFICATION *notification)
+{
+    Stub_TSM_Complete = notification;
+}
+
+void tsm_free_invoke_id(uint8_t invokeID)
+{
+    (void)invokeID;
+}
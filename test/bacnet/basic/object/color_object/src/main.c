@@ -6,15 +6,25 @@
  *
  * SPDX-License-Identifier: MIT
  */
+#include <math.h>
 #include <zephyr/ztest.h>
 #include <bacnet/bactext.h>
 #include <bacnet/basic/object/color_object.h>
+#include <bacnet/basic/sys/tmwheel.h>
 
 /**
  * @addtogroup bacnet_tests
  * @{
  */
 
+static unsigned long Test_Now;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
 /**
  * @brief Test
  */
@@ -130,6 +140,58 @@ static void testColorObject(void)
 
     return;
 }
+
+/**
+ * @brief Test the color fades run from the timer wheel, which is armed
+ *  only while a fade is in progress
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(color_object_tests, testColorTransition)
+#else
+static void testColorTransition(void)
+#endif
+{
+    const uint32_t instance = 1;
+    BACNET_COLOR_COMMAND command = { 0 };
+    BACNET_XY_COLOR color = { 0 };
+    unsigned i;
+
+    Color_Init();
+    Color_Create(instance);
+    /* the power up fade to the default color */
+    zassert_equal(tmwheel_count(), 1, NULL);
+    for (i = 0; i < 10; i++) {
+        Test_Now += 100;
+        tmwheel_run();
+    }
+    zassert_equal(tmwheel_count(), 0, NULL);
+    zassert_equal(
+        Color_In_Progress(instance), BACNET_COLOR_OPERATION_IN_PROGRESS_IDLE,
+        NULL);
+    /* a new fade arms the timer until the fade is done */
+    command.operation = BACNET_COLOR_OPERATION_FADE_TO_COLOR;
+    xy_color_set(&command.target.color, 0.5f, 0.5f);
+    command.transit.fade_time = 1000;
+    zassert_true(Color_Command_Set(instance, &command), NULL);
+    zassert_equal(tmwheel_count(), 1, NULL);
+    for (i = 0; i < 5; i++) {
+        Test_Now += 100;
+        tmwheel_run();
+    }
+    zassert_equal(
+        Color_In_Progress(instance),
+        BACNET_COLOR_OPERATION_IN_PROGRESS_FADE_ACTIVE, NULL);
+    zassert_equal(tmwheel_count(), 1, NULL);
+    for (i = 0; i < 5; i++) {
+        Test_Now += 100;
+        tmwheel_run();
+    }
+    zassert_equal(tmwheel_count(), 0, NULL);
+    zassert_true(Color_Tracking_Value(instance, &color), NULL);
+    zassert_false(islessgreater(color.x_coordinate, 0.5f), NULL);
+    zassert_false(islessgreater(color.y_coordinate, 0.5f), NULL);
+    Color_Cleanup();
+}
 /**
  * @}
  */
@@ -139,7 +201,8 @@ ZTEST_SUITE(color_object_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(color_object_tests, ztest_unit_test(testColorObject));
+    ztest_test_suite(color_object_tests, ztest_unit_test(testColorObject),
+        ztest_unit_test(testColorTransition));
 
     ztest_run_test_suite(color_object_tests);
 }
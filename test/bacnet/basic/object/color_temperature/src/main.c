@@ -9,12 +9,21 @@
 #include <zephyr/ztest.h>
 #include <bacnet/bactext.h>
 #include <bacnet/basic/object/color_temperature.h>
+#include <bacnet/basic/sys/tmwheel.h>
 
 /**
  * @addtogroup bacnet_tests
  * @{
  */
 
+static unsigned long Test_Now;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
 /**
  * @brief Test
  */
@@ -125,6 +134,42 @@ static void testColorTemperature(void)
 
     return;
 }
+
+/**
+ * @brief Test the color temperature transitions run from the timer wheel,
+ *  which is armed only while a transition is in progress
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(color_temperature_tests, testColorTemperatureTransition)
+#else
+static void testColorTemperatureTransition(void)
+#endif
+{
+    const uint32_t instance = 1;
+    BACNET_COLOR_COMMAND command = { 0 };
+    uint32_t value;
+
+    Color_Temperature_Init();
+    Color_Temperature_Create(instance);
+    /* the power up fade to the default color temperature */
+    zassert_equal(tmwheel_count(), 1, NULL);
+    Test_Now += 100;
+    tmwheel_run();
+    zassert_equal(tmwheel_count(), 0, NULL);
+    value = Color_Temperature_Tracking_Value(instance);
+    zassert_equal(value, 5000, "value=%u", value);
+    /* a step runs once */
+    command.operation = BACNET_COLOR_OPERATION_STEP_UP_CCT;
+    command.transit.step_increment = 100;
+    zassert_true(Color_Temperature_Command_Set(instance, &command), NULL);
+    zassert_equal(tmwheel_count(), 1, NULL);
+    Test_Now += 100;
+    tmwheel_run();
+    zassert_equal(tmwheel_count(), 0, NULL);
+    value = Color_Temperature_Tracking_Value(instance);
+    zassert_equal(value, 5100, "value=%u", value);
+    Color_Temperature_Cleanup();
+}
 /**
  * @}
  */
@@ -135,7 +180,8 @@ ZTEST_SUITE(color_temperature_tests, NULL, NULL, NULL, NULL, NULL);
 void test_main(void)
 {
     ztest_test_suite(
-        color_temperature_tests, ztest_unit_test(testColorTemperature));
+        color_temperature_tests, ztest_unit_test(testColorTemperature),
+        ztest_unit_test(testColorTemperatureTransition));
 
     ztest_run_test_suite(color_temperature_tests);
 }
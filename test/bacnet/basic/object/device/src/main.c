@@ -9,7 +9,11 @@
  */
 
 #include <zephyr/ztest.h>
+#include <bacnet/basic/object/ai.h>
+#include <bacnet/basic/object/ao.h>
+#include <bacnet/basic/object/calendar.h>
 #include <bacnet/basic/object/device.h>
+#include <bacnet/basic/sys/propcache.h>
 #include <bacnet/bactext.h>
 
 /**
@@ -17,6 +21,197 @@
  * @{
  */
 
+static unsigned Write_Callback_Count;
+static float Write_Callback_Old_Value;
+static float Write_Callback_New_Value;
+
+static void test_analog_output_write(
+    uint32_t object_instance, float old_value, float value)
+{
+    (void)object_instance;
+    Write_Callback_Count++;
+    Write_Callback_Old_Value = old_value;
+    Write_Callback_New_Value = value;
+}
+
+/**
+ * @brief Encode a value to write into a WriteProperty request
+ */
+static void test_write_data_init(BACNET_WRITE_PROPERTY_DATA *wp_data,
+    BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_APPLICATION_DATA_VALUE *value)
+{
+    memset(wp_data, 0, sizeof(*wp_data));
+    wp_data->object_type = object_type;
+    wp_data->object_instance = object_instance;
+    wp_data->object_property = object_property;
+    wp_data->array_index = BACNET_ARRAY_ALL;
+    wp_data->priority = BACNET_MAX_PRIORITY;
+    wp_data->application_data_len =
+        bacapp_encode_application_data(wp_data->application_data, value);
+}
+
+/**
+ * @brief Test the side effects of a batch of writes are applied once
+ */
+static void test_Device_Write_Property_Batch(void)
+{
+    BACNET_WRITE_PROPERTY_DATA wp_data[4];
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    const uint32_t instance = 123;
+    uint32_t revision = 0;
+    unsigned count = 0;
+
+    Device_Init(NULL);
+    zassert_equal(Analog_Output_Create(instance), instance, NULL);
+    Analog_Output_Write_Present_Value_Callback_Set(test_analog_output_write);
+    value.tag = BACNET_APPLICATION_TAG_REAL;
+    value.type.Real = 10.0f;
+    test_write_data_init(&wp_data[0], OBJECT_ANALOG_OUTPUT, instance,
+        PROP_PRESENT_VALUE, &value);
+    value.type.Real = 20.0f;
+    test_write_data_init(&wp_data[1], OBJECT_ANALOG_OUTPUT, instance,
+        PROP_PRESENT_VALUE, &value);
+    value.tag = BACNET_APPLICATION_TAG_CHARACTER_STRING;
+    characterstring_init_ansi(&value.type.Character_String, "Batch 1");
+    test_write_data_init(&wp_data[2], OBJECT_DEVICE,
+        Device_Object_Instance_Number(), PROP_OBJECT_NAME, &value);
+    characterstring_init_ansi(&value.type.Character_String, "Batch 2");
+    test_write_data_init(&wp_data[3], OBJECT_DEVICE,
+        Device_Object_Instance_Number(), PROP_OBJECT_NAME, &value);
+    /* one callback for the object, and one new database revision */
+    Write_Callback_Count = 0;
+    revision = Device_Database_Revision();
+    count = Device_Write_Property_Batch(wp_data, 4);
+    zassert_equal(count, 4, NULL);
+    zassert_equal(Write_Callback_Count, 1, NULL);
+    zassert_false(islessgreater(Write_Callback_Old_Value, 0.0f), NULL);
+    zassert_false(islessgreater(Write_Callback_New_Value, 20.0f), NULL);
+    zassert_equal(Device_Database_Revision(), revision + 1, NULL);
+    /* a batch of one write calls back once */
+    count = Device_Write_Property_Batch(wp_data, 1);
+    zassert_equal(count, 1, NULL);
+    zassert_equal(Write_Callback_Count, 2, NULL);
+    /* a write outside of a batch calls back right away */
+    zassert_true(Device_Write_Property(&wp_data[1]), NULL);
+    zassert_equal(Write_Callback_Count, 3, NULL);
+    /* the writes before a failure are kept */
+    wp_data[1].object_instance = instance + 1;
+    Write_Callback_Count = 0;
+    count = Device_Write_Property_Batch(wp_data, 4);
+    zassert_equal(count, 1, NULL);
+    zassert_equal(wp_data[1].error_class, ERROR_CLASS_OBJECT, NULL);
+    zassert_equal(wp_data[1].error_code, ERROR_CODE_UNKNOWN_OBJECT, NULL);
+    zassert_equal(Write_Callback_Count, 1, NULL);
+    zassert_false(islessgreater(Write_Callback_New_Value, 10.0f), NULL);
+    /* nested batches apply the side effects at the end of the outer one */
+    Write_Callback_Count = 0;
+    revision = Device_Database_Revision();
+    Device_Write_Property_Batch_Begin();
+    zassert_equal(Device_Write_Property_Batch(&wp_data[2], 2), 2, NULL);
+    zassert_equal(Device_Database_Revision(), revision, NULL);
+    zassert_true(Device_Write_Property(&wp_data[0]), NULL);
+    zassert_equal(Write_Callback_Count, 0, NULL);
+    Device_Write_Property_Batch_End();
+    zassert_equal(Device_Database_Revision(), revision + 1, NULL);
+    zassert_equal(Write_Callback_Count, 1, NULL);
+    Analog_Output_Write_Present_Value_Callback_Set(NULL);
+    Analog_Output_Delete(instance);
+}
+
+/**
+ * @brief Read a property of an object and decode its value
+ */
+static int test_read_property_value(BACNET_OBJECT_TYPE object_type,
+    uint32_t object_instance,
+    BACNET_PROPERTY_ID object_property,
+    BACNET_APPLICATION_DATA_VALUE *value)
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    BACNET_READ_PROPERTY_DATA rpdata = { 0 };
+    int len;
+
+    rpdata.application_data = apdu;
+    rpdata.application_data_len = sizeof(apdu);
+    rpdata.object_type = object_type;
+    rpdata.object_instance = object_instance;
+    rpdata.object_property = object_property;
+    rpdata.array_index = BACNET_ARRAY_ALL;
+    len = Device_Read_Property(&rpdata);
+    if (len > 0) {
+        bacapp_decode_application_data(apdu, len, value);
+    }
+
+    return len;
+}
+
+/**
+ * @brief Test the cached property values follow the object
+ */
+static void test_Device_Read_Property_Cache(void)
+{
+    BACNET_WRITE_PROPERTY_DATA wp_data;
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    uint8_t apdu[MAX_APDU] = { 0 };
+    const uint32_t instance = 321;
+    char name[] = "Cached Input";
+    int len;
+
+    Device_Init(NULL);
+    zassert_equal(Analog_Input_Create(instance), instance, NULL);
+    len = test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_PRESENT_VALUE, &value);
+    zassert_true(len > 0, NULL);
+    zassert_false(islessgreater(value.type.Real, 0.0f), NULL);
+    zassert_equal(propcache_read(OBJECT_ANALOG_INPUT, instance,
+                      PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu, sizeof(apdu)),
+        len, NULL);
+    /* a new present-value is read */
+    Analog_Input_Present_Value_Set(instance, 42.0f);
+    test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_PRESENT_VALUE, &value);
+    zassert_false(islessgreater(value.type.Real, 42.0f), NULL);
+    /* a derived status flag changes with a write */
+    test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_STATUS_FLAGS, &value);
+    zassert_false(
+        bitstring_bit(&value.type.Bit_String, STATUS_FLAG_OUT_OF_SERVICE),
+        NULL);
+    value.tag = BACNET_APPLICATION_TAG_BOOLEAN;
+    value.type.Boolean = true;
+    test_write_data_init(&wp_data, OBJECT_ANALOG_INPUT, instance,
+        PROP_OUT_OF_SERVICE, &value);
+    zassert_true(Device_Write_Property(&wp_data), NULL);
+    test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_STATUS_FLAGS, &value);
+    zassert_true(
+        bitstring_bit(&value.type.Bit_String, STATUS_FLAG_OUT_OF_SERVICE),
+        NULL);
+    /* the units and the name */
+    test_read_property_value(OBJECT_ANALOG_INPUT, instance, PROP_UNITS, &value);
+    zassert_equal(value.type.Enumerated, UNITS_PERCENT, NULL);
+    zassert_true(Analog_Input_Units_Set(instance, UNITS_DEGREES_CELSIUS), NULL);
+    test_read_property_value(OBJECT_ANALOG_INPUT, instance, PROP_UNITS, &value);
+    zassert_equal(value.type.Enumerated, UNITS_DEGREES_CELSIUS, NULL);
+    test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_OBJECT_NAME, &value);
+    zassert_true(Analog_Input_Name_Set(instance, name), NULL);
+    test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_OBJECT_NAME, &value);
+    zassert_true(
+        characterstring_ansi_same(&value.type.Character_String, name), NULL);
+    /* a deleted object is not read from the cache */
+    zassert_true(Analog_Input_Delete(instance), NULL);
+    len = test_read_property_value(
+        OBJECT_ANALOG_INPUT, instance, PROP_PRESENT_VALUE, &value);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    zassert_equal(propcache_read(OBJECT_ANALOG_INPUT, instance,
+                      PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu, sizeof(apdu)),
+        0, NULL);
+}
+
 /**
  * @brief Test ReadProperty API
  */
@@ -124,6 +319,46 @@ static void test_Device_Data_Sharing(void)
     }
 }
 
+/**
+ * @brief Test the change of value of a Calendar at a day boundary
+ *  through the object functions of the device
+ */
+static void test_Device_Calendar_COV(void)
+{
+    BACNET_PROPERTY_VALUE value_list[2] = { 0 };
+    BACNET_CALENDAR_ENTRY entry = { 0 };
+    BACNET_DATE_TIME bdatetime = { 0 };
+    const uint32_t instance = 1;
+
+    Device_Init(NULL);
+    zassert_equal(Calendar_Create(instance), instance, NULL);
+    entry.tag = BACNET_CALENDAR_DATE;
+    datetime_set_date(&entry.type.Date, 2026, 10, 20);
+    zassert_true(Calendar_Date_List_Add(instance, &entry), NULL);
+    datetime_set_date(&bdatetime.date, 2026, 10, 19);
+    datetime_set_time(&bdatetime.time, 23, 59, 0, 0);
+    (void)Calendar_Task(&bdatetime);
+    Device_COV_Clear(OBJECT_CALENDAR, instance);
+    zassert_false(Device_COV(OBJECT_CALENDAR, instance), NULL);
+    /* the present-value changes at midnight */
+    datetime_set_date(&bdatetime.date, 2026, 10, 20);
+    datetime_set_time(&bdatetime.time, 0, 0, 0, 0);
+    (void)Calendar_Task(&bdatetime);
+    zassert_true(Device_COV(OBJECT_CALENDAR, instance), NULL);
+    value_list[0].next = &value_list[1];
+    zassert_true(Device_Encode_Value_List(
+                     OBJECT_CALENDAR, instance, &value_list[0]),
+        NULL);
+    zassert_equal(value_list[0].propertyIdentifier, PROP_PRESENT_VALUE, NULL);
+    zassert_equal(
+        value_list[0].value.tag, BACNET_APPLICATION_TAG_BOOLEAN, NULL);
+    zassert_true(value_list[0].value.type.Boolean, NULL);
+    zassert_is_null(value_list[0].next, NULL);
+    Device_COV_Clear(OBJECT_CALENDAR, instance);
+    zassert_false(Device_COV(OBJECT_CALENDAR, instance), NULL);
+    zassert_true(Calendar_Delete(instance), NULL);
+}
+
 /**
  * @brief Test basic API
  */
@@ -238,7 +473,10 @@ void test_main(void)
 {
     ztest_test_suite(
         device_tests, ztest_unit_test(testDevice),
-        ztest_unit_test(test_Device_Data_Sharing));
+        ztest_unit_test(test_Device_Data_Sharing),
+        ztest_unit_test(test_Device_Write_Property_Batch),
+        ztest_unit_test(test_Device_Read_Property_Cache),
+        ztest_unit_test(test_Device_Calendar_COV));
 
     ztest_run_test_suite(device_tests);
 }
@@ -30,6 +30,7 @@
 #include "bacnet/datetime.h"
 #include "bacnet/bacdef.h"
 #include "bacnet/npdu.h"
+#include "bacnet/wpm.h"
 
 void datetime_init(void)
 {
@@ -56,3 +57,20 @@ int bip_send_pdu(
 {
     return 0;
 }
+
+void Send_WhoIs(int32_t low_limit, int32_t high_limit)
+{
+}
+
+uint8_t Send_Write_Property_Multiple_Request(uint8_t *pdu,
+    size_t max_pdu,
+    uint32_t device_id,
+    BACNET_WRITE_ACCESS_DATA *write_access_data)
+{
+    return 0;
+}
+
+unsigned long mstimer_now(void)
+{
+    return 0;
+}
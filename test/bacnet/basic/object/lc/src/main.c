@@ -8,6 +8,7 @@
  * @brief test BACnet load control object
  */
 
+#include <math.h>
 #include <zephyr/ztest.h>
 #include <bacnet/bacdcode.h>
 #include <bacnet/bacstr.h>
@@ -36,10 +37,6 @@ ZTEST(lc_tests, test_Load_Control_Count)
 static void test_Load_Control_Count(void)
 #endif
 {
-    /* Verify the same value is returned on successive calls without init */
-    zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS, NULL);
-    zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS, NULL);
-
     /* Verify the same value is returned on successive calls with init */
     Load_Control_Init();
     zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS, NULL);
@@ -211,168 +208,208 @@ static void Load_Control_WriteProperty_Start_Time(
     zassert_true(status, NULL);
 }
 
+static void Load_Control_Test_Reset(void)
+{
+    Load_Control_Cleanup();
+    Load_Control_Init();
+    Analog_Output_Cleanup();
+    Analog_Output_Init();
+    Analog_Output_Create(0);
+}
+
+static BACNET_SHED_STATE Load_Control_Test_Task(uint16_t year,
+    uint8_t month,
+    uint8_t day,
+    uint8_t hour,
+    uint8_t minute,
+    uint8_t seconds)
+{
+    BACNET_DATE_TIME bdatetime;
+
+    datetime_set_values(&bdatetime, year, month, day, hour, minute, seconds, 0);
+    (void)Load_Control_Task(&bdatetime);
+
+    return Load_Control_Present_Value(0);
+}
+
 #if defined(CONFIG_ZTEST_NEW_API)
 ZTEST(lc_tests, testLoadControlStateMachine)
 #else
 static void testLoadControlStateMachine(void)
 #endif
 {
-    // TODO:    unsigned i = 0, j = 0;
-    uint8_t level = 0;
-
-    Load_Control_Init();
+    BACNET_DATE_TIME bdatetime;
+    BACNET_SHED_STATE state;
+    float level = 0;
 
-    // TODO:    /* validate the triggers for each state change */
-    // TODO:    for (j = 0; j < 20; j++) {
-    // TODO:        Load_Control_State_Machine(0);
-    // TODO:        for (i = 0; i < MAX_LOAD_CONTROLS; i++) {
-    // TODO:            zassert_equal(Load_Control_State[i], SHED_INACTIVE,
-    // NULL);
-    // TODO:        }
-    // TODO:    }
+    Load_Control_Test_Reset();
+    /* nothing to evaluate */
+    datetime_set_values(&bdatetime, 2007, 2, 27, 15, 0, 0, 0);
+    zassert_equal(Load_Control_Task(&bdatetime), UINT32_MAX, NULL);
+    zassert_equal(Load_Control_Present_Value(0), BACNET_SHED_INACTIVE, NULL);
 
     /* SHED_REQUEST_PENDING */
     /* CancelShed - Start time has wildcards */
     Load_Control_WriteProperty_Enable(0, true);
     Load_Control_WriteProperty_Shed_Duration(0, 60);
     Load_Control_WriteProperty_Start_Time_Wildcards(0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_INACTIVE, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_INACTIVE, NULL);
 
     /* CancelShed - Requested_Shed_Level equal to default value */
-    Load_Control_Init();
+    Load_Control_Test_Reset();
     Load_Control_WriteProperty_Request_Shed_Level(0, 0);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 0);
     Load_Control_WriteProperty_Shed_Duration(0, 5);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 15, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_INACTIVE, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_INACTIVE, NULL);
 
     /* CancelShed - Non-default values, but Start time is passed */
-    Load_Control_Init();
+    Load_Control_Test_Reset();
     Load_Control_WriteProperty_Enable(0, true);
     Load_Control_WriteProperty_Request_Shed_Level(0, 1);
     Load_Control_WriteProperty_Shed_Duration(0, 5);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 0);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 28, 15, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_INACTIVE, NULL);
+    state = Load_Control_Test_Task(2007, 2, 28, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 28, 15, 0, 0);
+    zassert_equal(state, BACNET_SHED_INACTIVE, NULL);
 
     /* ReconfigurePending - new write received while pending */
-    Load_Control_Init();
+    Load_Control_Test_Reset();
     Load_Control_WriteProperty_Enable(0, true);
     Load_Control_WriteProperty_Request_Shed_Level(0, 1);
     Load_Control_WriteProperty_Shed_Duration(0, 5);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 0);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 5, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     Load_Control_WriteProperty_Request_Shed_Level(0, 2);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 1);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     Load_Control_WriteProperty_Shed_Duration(0, 6);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 2);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     Load_Control_WriteProperty_Duty_Window(0, 60);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 3);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 1);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 4);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    /* the next deadline is the start time */
+    datetime_set_values(&bdatetime, 2007, 2, 27, 5, 0, 5, 0);
+    zassert_equal(Load_Control_Task(&bdatetime),
+        ((10UL * 60UL * 60UL) - 5UL + 1UL) * 1000UL, NULL);
+    zassert_equal(Load_Control_Present_Value(0), BACNET_SHED_REQUEST_PENDING,
+        NULL);
 
     /* CannotMeetShed -> FinishedUnsuccessfulShed */
-    Load_Control_Init();
+    Load_Control_Test_Reset();
     Load_Control_WriteProperty_Enable(0, true);
     Load_Control_WriteProperty_Request_Shed_Level(0, 1);
     Load_Control_WriteProperty_Shed_Duration(0, 120);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 0);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 5, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     /* set to lowest value so we cannot meet the shed level */
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 16, 0, 0, 0);
     Analog_Output_Present_Value_Set(0, 0, 16);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_NON_COMPLIANT, NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_NON_COMPLIANT, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 0);
+    zassert_equal(state, BACNET_SHED_NON_COMPLIANT, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 1);
+    zassert_equal(state, BACNET_SHED_NON_COMPLIANT, NULL);
     /* FinishedUnsuccessfulShed */
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 23, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_INACTIVE, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 23, 0, 0);
+    zassert_equal(state, BACNET_SHED_INACTIVE, NULL);
+    datetime_set_values(&bdatetime, 2007, 2, 27, 23, 0, 1, 0);
+    zassert_equal(Load_Control_Task(&bdatetime), UINT32_MAX, NULL);
 
     /* CannotMeetShed -> UnsuccessfulShedReconfigured */
-    Load_Control_Init();
+    Load_Control_Test_Reset();
     Load_Control_WriteProperty_Enable(0, true);
     Load_Control_WriteProperty_Request_Shed_Level(0, 1);
     Load_Control_WriteProperty_Shed_Duration(0, 120);
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 15, 0, 0, 0);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 5, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 5, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
     /* set to lowest value so we cannot meet the shed level */
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 16, 0, 0, 0);
     Analog_Output_Present_Value_Set(0, 0, 16);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_NON_COMPLIANT, NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_NON_COMPLIANT, NULL);
-    /* FinishedUnsuccessfulShed */
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 0);
+    zassert_equal(state, BACNET_SHED_NON_COMPLIANT, NULL);
+    /* the ability of the load to comply is polled while shedding */
+    datetime_set_values(&bdatetime, 2007, 2, 27, 16, 0, 0, 0);
+    zassert_equal(Load_Control_Task(&bdatetime), 1000, NULL);
+    /* UnsuccessfulShedReconfigured */
     Load_Control_WriteProperty_Start_Time(0, 2007, 2, 27, 16, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_REQUEST_PENDING,
-    // NULL);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 16, 0, 1, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_NON_COMPLIANT, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 0);
+    zassert_equal(state, BACNET_SHED_REQUEST_PENDING, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 1);
+    zassert_equal(state, BACNET_SHED_NON_COMPLIANT, NULL);
     /* CanNowComplyWithShed */
     Analog_Output_Present_Value_Set(0, 100, 16);
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 16, 0, 2, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_COMPLIANT, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 16, 0, 2);
+    zassert_equal(state, BACNET_SHED_COMPLIANT, NULL);
     level = Analog_Output_Present_Value(0);
-    // TODO: Fails:    zassert_equal(level, 90, NULL);
+    zassert_false(islessgreater(level, 90.0f), NULL);
     /* FinishedSuccessfulShed */
-    // TODO:    datetime_set_values(&Current_Time, 2007, 2, 27, 23, 0, 0, 0);
-    Load_Control_State_Machine(0);
-    // TODO:    zassert_equal(Load_Control_State[0], SHED_INACTIVE, NULL);
+    state = Load_Control_Test_Task(2007, 2, 27, 23, 0, 0);
+    zassert_equal(state, BACNET_SHED_INACTIVE, NULL);
     level = Analog_Output_Present_Value(0);
-    // TODO: Fails:    zassert_equal(level, 100, NULL);
-    (void)level; // TODO: remove when level will be checked
+    zassert_false(islessgreater(level, 100.0f), NULL);
+}
+
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(lc_tests, testLoadControlCreateDelete)
+#else
+static void testLoadControlCreateDelete(void)
+#endif
+{
+    const unsigned count = 1000;
+    BACNET_DATE_TIME bdatetime;
+    uint32_t instance;
+    unsigned i;
+
+    Load_Control_Test_Reset();
+    instance = Load_Control_Create(BACNET_MAX_INSTANCE);
+    zassert_equal(instance, MAX_LOAD_CONTROLS, NULL);
+    zassert_true(Load_Control_Valid_Instance(instance), NULL);
+    zassert_true(Load_Control_Delete(instance), NULL);
+    zassert_false(Load_Control_Valid_Instance(instance), NULL);
+    zassert_false(Load_Control_Delete(instance), NULL);
+    zassert_equal(
+        Load_Control_Create(BACNET_MAX_INSTANCE + 1), BACNET_MAX_INSTANCE,
+        NULL);
+    for (i = 0; i < count; i++) {
+        instance = Load_Control_Create(1000 + i);
+        zassert_equal(instance, 1000 + i, NULL);
+    }
+    zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS + count, NULL);
+    /* only the objects with a shed request are evaluated */
+    Load_Control_WriteProperty_Request_Shed_Level(1500, 1);
+    Load_Control_WriteProperty_Shed_Duration(1500, 5);
+    Load_Control_WriteProperty_Start_Time(1500, 2007, 2, 27, 15, 0, 0, 0);
+    datetime_set_values(&bdatetime, 2007, 2, 27, 14, 0, 0, 0);
+    (void)Load_Control_Task(&bdatetime);
+    zassert_equal(Load_Control_Present_Value(1500),
+        BACNET_SHED_REQUEST_PENDING, NULL);
+    zassert_equal(Load_Control_Present_Value(1501), BACNET_SHED_INACTIVE,
+        NULL);
+    /* an object with a shed request can be deleted */
+    zassert_true(Load_Control_Delete(1500), NULL);
+    zassert_equal(Load_Control_Task(&bdatetime), UINT32_MAX, NULL);
+    zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS + count - 1, NULL);
+    Load_Control_Cleanup();
+    zassert_equal(Load_Control_Count(), 0, NULL);
 }
 
 #ifndef MAX_LOAD_CONTROLS
@@ -387,21 +424,22 @@ static void test_api_stubs(void)
 {
     BACNET_CHARACTER_STRING object_name_st = { 0 };
 
+    Load_Control_Init();
     zassert_equal(Load_Control_Count(), MAX_LOAD_CONTROLS, NULL);
 
     zassert_false(Load_Control_Valid_Instance(MAX_LOAD_CONTROLS), NULL);
     zassert_equal(
-        Load_Control_Index_To_Instance(MAX_LOAD_CONTROLS), Load_Control_Count(),
-        NULL);
-    zassert_equal(
-        Load_Control_Instance_To_Index(MAX_LOAD_CONTROLS), Load_Control_Count(),
+        Load_Control_Index_To_Instance(MAX_LOAD_CONTROLS), UINT32_MAX, NULL);
+    zassert_true(
+        Load_Control_Instance_To_Index(MAX_LOAD_CONTROLS) >=
+            Load_Control_Count(),
         NULL);
 
     zassert_false(Load_Control_Valid_Instance(UINT32_MAX), NULL);
-    zassert_equal(
-        Load_Control_Index_To_Instance(UINT32_MAX), Load_Control_Count(), NULL);
-    zassert_equal(
-        Load_Control_Instance_To_Index(UINT32_MAX), Load_Control_Count(), NULL);
+    zassert_equal(Load_Control_Index_To_Instance(UINT32_MAX), UINT32_MAX, NULL);
+    zassert_true(
+        Load_Control_Instance_To_Index(UINT32_MAX) >= Load_Control_Count(),
+        NULL);
 
     zassert_true(Load_Control_Valid_Instance(0), NULL);
     zassert_equal(Load_Control_Index_To_Instance(0), 0, NULL);
@@ -451,9 +489,9 @@ static void test_Load_Control_Read_Write_Property(void)
         len = Load_Control_Read_Property(&rpdata);
         zassert_not_equal(len, BACNET_STATUS_ERROR, NULL);
         if (len > 0) {
-            test_len = bacapp_decode_application_data(
-                rpdata.application_data, (uint8_t)rpdata.application_data_len,
-                &value);
+            test_len = bacapp_decode_known_property(
+                rpdata.application_data, len, &value, rpdata.object_type,
+                rpdata.object_property);
             zassert_true(test_len >= 0, NULL);
         }
         pRequired++;
@@ -464,9 +502,9 @@ static void test_Load_Control_Read_Write_Property(void)
         len = Load_Control_Read_Property(&rpdata);
         zassert_not_equal(len, BACNET_STATUS_ERROR, NULL);
         if (len > 0) {
-            test_len = bacapp_decode_application_data(
-                rpdata.application_data, (uint8_t)rpdata.application_data_len,
-                &value);
+            test_len = bacapp_decode_known_property(
+                rpdata.application_data, len, &value, rpdata.object_type,
+                rpdata.object_property);
             zassert_true(test_len >= 0, NULL);
         }
         pOptional++;
@@ -540,127 +578,6 @@ static void test_ShedInactive_gets_RcvShedRequests(void)
     // default returns error
 }
 
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedReqPending_gets_ReconfigPending)
-#else
-static void test_ShedReqPending_gets_ReconfigPending(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedReqPending_gets_CancelShed)
-#else
-static void test_ShedReqPending_gets_CancelShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedReqPending_gets_CannotMeetShed)
-#else
-static void test_ShedReqPending_gets_CannotMeetShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedReqPending_gets_PrepareToShed)
-#else
-static void test_ShedReqPending_gets_PrepareToShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedReqPending_gets_AbleToMeetShed)
-#else
-static void test_ShedReqPending_gets_AbleToMeetShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedNonCommpliant_gets_UnsuccessfulShedReconfig)
-#else
-static void test_ShedNonCommpliant_gets_UnsuccessfulShedReconfig(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedNonCommpliant_gets_FinishedUnsuccessfulShed)
-#else
-static void test_ShedNonCommpliant_gets_FinishedUnsuccessfulShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedNonCommpliant_gets_CanNowComplyWithShed)
-#else
-static void test_ShedNonCommpliant_gets_CanNowComplyWithShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedCommpliant_gets_FinishedSuccessfulShed)
-#else
-static void test_ShedCommpliant_gets_FinishedSuccessfulShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedCommpliant_gets_SuccessfulShedReconfig)
-#else
-static void test_ShedCommpliant_gets_SuccessfulShedReconfig(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
-#if defined(CONFIG_ZTEST_NEW_API)
-ZTEST(lc_tests, test_ShedCommpliant_gets_CanNoLongerComplyWithShed)
-#else
-static void test_ShedCommpliant_gets_CanNoLongerComplyWithShed(void)
-#endif
-{
-#ifndef UNIT_TESTING
-    ztest_test_skip();
-#endif
-}
-
 /**
  * @}
  */
@@ -675,18 +592,8 @@ void test_main(void)
         ztest_unit_test(test_Load_Control_Count),
         ztest_unit_test(test_Load_Control_Read_Write_Property),
         ztest_unit_test(testLoadControlStateMachine),
-        ztest_unit_test(test_ShedInactive_gets_RcvShedRequests),
-        ztest_unit_test(test_ShedReqPending_gets_ReconfigPending),
-        ztest_unit_test(test_ShedReqPending_gets_CancelShed),
-        ztest_unit_test(test_ShedReqPending_gets_CannotMeetShed),
-        ztest_unit_test(test_ShedReqPending_gets_PrepareToShed),
-        ztest_unit_test(test_ShedReqPending_gets_AbleToMeetShed),
-        ztest_unit_test(test_ShedNonCommpliant_gets_UnsuccessfulShedReconfig),
-        ztest_unit_test(test_ShedNonCommpliant_gets_FinishedUnsuccessfulShed),
-        ztest_unit_test(test_ShedNonCommpliant_gets_CanNowComplyWithShed),
-        ztest_unit_test(test_ShedCommpliant_gets_FinishedSuccessfulShed),
-        ztest_unit_test(test_ShedCommpliant_gets_SuccessfulShedReconfig),
-        ztest_unit_test(test_ShedCommpliant_gets_CanNoLongerComplyWithShed));
+        ztest_unit_test(testLoadControlCreateDelete),
+        ztest_unit_test(test_ShedInactive_gets_RcvShedRequests));
 
     ztest_run_test_suite(lc_tests);
 }
@@ -11,12 +11,22 @@
 #include <zephyr/ztest.h>
 #include <bacnet/bactext.h>
 #include <bacnet/basic/object/lo.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/sys/tmwheel.h>
 
 /**
  * @addtogroup bacnet_tests
  * @{
  */
 
+static unsigned long Test_Now;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
 /**
  * @brief Test
  */
@@ -137,6 +147,88 @@ static void testLightingOutput(void)
 
     return;
 }
+/**
+ * @brief Test that only the active outputs are advanced
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(lo_tests, testLightingOutputActive)
+#else
+static void testLightingOutputActive(void)
+#endif
+{
+    BACNET_WRITE_PROPERTY_DATA wpdata = { 0 };
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+    BACNET_LIGHTING_COMMAND command = { 0 };
+    const uint32_t count = 1000;
+    uint32_t instance;
+    unsigned i;
+    bool status;
+
+    Test_Now = 0;
+    tmwheel_init();
+    Lighting_Output_Init();
+    for (instance = 1; instance <= count; instance++) {
+        Lighting_Output_Create(instance);
+    }
+    zassert_equal(Lighting_Output_Active_Count(), 0, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+    /* three outputs fade together, as from one channel write */
+    wpdata.object_type = OBJECT_LIGHTING_OUTPUT;
+    wpdata.object_property = PROP_PRESENT_VALUE;
+    wpdata.array_index = BACNET_ARRAY_ALL;
+    wpdata.priority = 8;
+    value.tag = BACNET_APPLICATION_TAG_REAL;
+    value.type.Real = 100.0f;
+    wpdata.application_data_len =
+        bacapp_encode_application_data(wpdata.application_data, &value);
+    for (instance = 10; instance <= 30; instance += 10) {
+        zassert_true(Lighting_Output_Default_Fade_Time_Set(instance, 1000),
+            NULL);
+        wpdata.object_instance = instance;
+        status = Lighting_Output_Write_Property(&wpdata);
+        zassert_true(status, NULL);
+    }
+    zassert_equal(Lighting_Output_Active_Count(), 3, NULL);
+    zassert_equal(tmwheel_count(), 1, NULL);
+    /* half way */
+    for (i = 0; i < 50; i++) {
+        Test_Now += 10;
+        tmwheel_run();
+    }
+    for (instance = 10; instance <= 30; instance += 10) {
+        zassert_equal(Lighting_Output_In_Progress(instance),
+            BACNET_LIGHTING_FADE_ACTIVE, NULL);
+        zassert_true(Lighting_Output_Tracking_Value(instance) > 49.0f, NULL);
+        zassert_true(Lighting_Output_Tracking_Value(instance) < 51.0f, NULL);
+    }
+    zassert_true(Lighting_Output_Tracking_Value(1) < 1.0f, NULL);
+    /* a step runs once and leaves the active set */
+    command.operation = BACNET_LIGHTS_STEP_ON;
+    command.use_step_increment = true;
+    command.step_increment = 5.0f;
+    zassert_true(Lighting_Output_Lighting_Command_Set(40, &command), NULL);
+    zassert_equal(Lighting_Output_Active_Count(), 4, NULL);
+    Lighting_Output_Active_Timer(10);
+    zassert_equal(Lighting_Output_Active_Count(), 3, NULL);
+    zassert_true(Lighting_Output_Tracking_Value(40) > 4.0f, NULL);
+    /* a deleted output leaves the active set */
+    zassert_true(Lighting_Output_Delete(20), NULL);
+    zassert_equal(Lighting_Output_Active_Count(), 2, NULL);
+    /* the rest of the fade */
+    for (i = 0; i < 60; i++) {
+        Test_Now += 10;
+        tmwheel_run();
+    }
+    zassert_equal(Lighting_Output_Active_Count(), 0, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+    zassert_false(
+        islessgreater(Lighting_Output_Tracking_Value(10), 100.0f), NULL);
+    zassert_false(
+        islessgreater(Lighting_Output_Tracking_Value(30), 100.0f), NULL);
+    zassert_equal(Lighting_Output_In_Progress(30), BACNET_LIGHTING_IDLE, NULL);
+    Lighting_Output_Cleanup();
+    zassert_equal(Lighting_Output_Count(), 0, NULL);
+}
 /**
  * @}
  */
@@ -146,7 +238,8 @@ ZTEST_SUITE(lo_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(lo_tests, ztest_unit_test(testLightingOutput));
+    ztest_test_suite(lo_tests, ztest_unit_test(testLightingOutput),
+        ztest_unit_test(testLightingOutputActive));
 
     ztest_run_test_suite(lo_tests);
 }
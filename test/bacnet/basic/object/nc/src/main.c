@@ -8,9 +8,13 @@
  */
 #include <zephyr/ztest.h>
 #include <bacnet/bactext.h>
+#include <bacnet/npdu.h>
 #include <bacnet/rp.h>
 #include <bacnet/wp.h>
+#include <bacnet/basic/binding/address.h>
 #include <bacnet/basic/object/nc.h>
+#include <bacnet/basic/sys/tmwheel.h>
+#include <bacnet/datalink/datalink.h>
 
 /**
  * @addtogroup bacnet_tests
@@ -132,6 +136,385 @@ static void test_Notification_Class(void)
 
     return;
 }
+static uint8_t Sent_PDU[8][MAX_PDU];
+static unsigned Sent_PDU_Len[8];
+static BACNET_ADDRESS Sent_Dest[8];
+static uint8_t *Sent_Buffer;
+static unsigned Sent_Count;
+static bool DCC_Enabled = true;
+static bool TSM_Available;
+static uint8_t TSM_Invoke_ID;
+static BACNET_ADDRESS TSM_Dest;
+static BACNET_TSM_COMPLETE_NOTIFICATION *TSM_Complete;
+static unsigned TSM_Freed_Count;
+static uint8_t TSM_Buffer[MAX_PDU];
+
+int datalink_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    (void)npdu_data;
+    if (Sent_Count < 8) {
+        memcpy(Sent_PDU[Sent_Count], pdu, pdu_len);
+        Sent_PDU_Len[Sent_Count] = pdu_len;
+        Sent_Dest[Sent_Count] = *dest;
+    }
+    Sent_Buffer = pdu;
+    Sent_Count++;
+
+    return (int)pdu_len;
+}
+
+bool dcc_communication_enabled(void)
+{
+    return DCC_Enabled;
+}
+
+uint8_t tsm_next_free_invokeID(void)
+{
+    if (!TSM_Available) {
+        return 0;
+    }
+    TSM_Invoke_ID++;
+    if (TSM_Invoke_ID == 0) {
+        TSM_Invoke_ID++;
+    }
+
+    return TSM_Invoke_ID;
+}
+
+uint8_t *tsm_transaction_pdu_buffer(uint8_t invokeID, uint16_t size)
+{
+    (void)invokeID;
+    return (size <= sizeof(TSM_Buffer)) ? TSM_Buffer : NULL;
+}
+
+bool tsm_set_confirmed_unsegmented_transaction(uint8_t invokeID,
+    BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *ndpu_data,
+    uint8_t *apdu,
+    uint16_t apdu_len)
+{
+    (void)invokeID;
+    (void)ndpu_data;
+    (void)apdu;
+    (void)apdu_len;
+    TSM_Dest = *dest;
+
+    return true;
+}
+
+void tsm_free_invoke_id(uint8_t invokeID)
+{
+    (void)invokeID;
+    TSM_Freed_Count++;
+}
+
+void tsm_set_max_apdu_handler(tsm_max_apdu_function pFunction)
+{
+    (void)pFunction;
+}
+
+void tsm_complete_notification_add(
+    BACNET_TSM_COMPLETE_NOTIFICATION *notification)
+{
+    TSM_Complete = notification;
+}
+
+/**
+ * @brief End the last confirmed notification that was sent
+ * @param status - how the request ended
+ */
+static void test_tsm_complete(BACNET_TSM_TRANSACTION_STATUS status)
+{
+    TSM_Complete->callback(&TSM_Dest, TSM_Invoke_ID, status);
+}
+
+/**
+ * @brief Decode a sent event notification
+ * @param index - index of the sent PDU
+ * @param confirmed [out] true if a confirmed service request
+ * @return Process Identifier of the notification
+ */
+static uint32_t test_sent_process_identifier(unsigned index, bool *confirmed)
+{
+    BACNET_EVENT_NOTIFICATION_DATA data = { 0 };
+    BACNET_CHARACTER_STRING message_text = { 0 };
+    BACNET_ADDRESS dest = { 0 }, src = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t *apdu;
+    int len, apdu_len, test_len;
+
+    len = bacnet_npdu_decode(Sent_PDU[index], Sent_PDU_Len[index], &dest,
+        &src, &npdu_data);
+    zassert_true(len > 0, NULL);
+    apdu = &Sent_PDU[index][len];
+    apdu_len = Sent_PDU_Len[index] - len;
+    if (apdu[0] == PDU_TYPE_CONFIRMED_SERVICE_REQUEST) {
+        *confirmed = true;
+        zassert_true(npdu_data.data_expecting_reply, NULL);
+        zassert_equal(apdu[3], SERVICE_CONFIRMED_EVENT_NOTIFICATION, NULL);
+        apdu += 4;
+        apdu_len -= 4;
+    } else {
+        *confirmed = false;
+        zassert_equal(apdu[0], PDU_TYPE_UNCONFIRMED_SERVICE_REQUEST, NULL);
+        zassert_equal(apdu[1], SERVICE_UNCONFIRMED_EVENT_NOTIFICATION, NULL);
+        apdu += 2;
+        apdu_len -= 2;
+    }
+    data.messageText = &message_text;
+    test_len = event_notify_decode_service_request(apdu, apdu_len, &data);
+    zassert_equal(test_len, apdu_len, NULL);
+    zassert_equal(data.initiatingObjectIdentifier.type, OBJECT_DEVICE, NULL);
+    zassert_equal(data.eventObjectIdentifier.instance, 7, NULL);
+    zassert_equal(data.toState, EVENT_STATE_OFFNORMAL, NULL);
+    zassert_equal(data.priority, 42, NULL);
+
+    return data.processIdentifier;
+}
+
+/**
+ * @brief Initialize the recipient list of the notification class
+ * @param recipient_list - list of destinations, default initialized
+ */
+static void test_recipient_list_init(BACNET_DESTINATION *recipient_list)
+{
+    unsigned i;
+
+    for (i = 0; i < NC_MAX_RECIPIENTS; i++) {
+        bacnet_destination_default_init(&recipient_list[i]);
+        bitstring_set_bit(
+            &recipient_list[i].Transitions, TRANSITION_TO_OFFNORMAL, true);
+        bitstring_set_bit(
+            &recipient_list[i].Transitions, TRANSITION_TO_FAULT, true);
+        bitstring_set_bit(
+            &recipient_list[i].Transitions, TRANSITION_TO_NORMAL, true);
+    }
+}
+
+/**
+ * @brief Set an address recipient of the notification class
+ */
+static void test_recipient_address(BACNET_DESTINATION *destination,
+    uint16_t net,
+    uint8_t mac,
+    uint32_t process_identifier)
+{
+    BACNET_ADDRESS *address = &destination->Recipient.type.address;
+
+    destination->Recipient.tag = BACNET_RECIPIENT_TAG_ADDRESS;
+    memset(address, 0, sizeof(BACNET_ADDRESS));
+    address->net = net;
+    if (mac) {
+        address->mac_len = 1;
+        address->mac[0] = mac;
+    }
+    destination->ProcessIdentifier = process_identifier;
+    destination->ConfirmedNotify = false;
+}
+
+/**
+ * @brief Report an offnormal event to notification class 1
+ */
+static void test_event_report(void)
+{
+    BACNET_EVENT_NOTIFICATION_DATA data = { 0 };
+    uint32_t priority[MAX_BACNET_EVENT_TRANSITION] = { 42, 42, 42 };
+
+    Notification_Class_Set_Priorities(1, priority);
+    data.notificationClass = 1;
+    data.eventObjectIdentifier.type = OBJECT_ANALOG_INPUT;
+    data.eventObjectIdentifier.instance = 7;
+    data.timeStamp.tag = TIME_STAMP_SEQUENCE;
+    data.timeStamp.value.sequenceNum = 1;
+    data.eventType = EVENT_OUT_OF_RANGE;
+    data.notifyType = NOTIFY_ALARM;
+    data.fromState = EVENT_STATE_NORMAL;
+    data.toState = EVENT_STATE_OFFNORMAL;
+    data.notificationParams.outOfRange.exceedingValue = 3.45f;
+    data.notificationParams.outOfRange.deadband = 2.34f;
+    data.notificationParams.outOfRange.exceededLimit = 1.23f;
+    bitstring_init(&data.notificationParams.outOfRange.statusFlags);
+    bitstring_set_bit(&data.notificationParams.outOfRange.statusFlags,
+        STATUS_FLAG_IN_ALARM, true);
+    bitstring_set_bit(&data.notificationParams.outOfRange.statusFlags,
+        STATUS_FLAG_FAULT, false);
+    bitstring_set_bit(&data.notificationParams.outOfRange.statusFlags,
+        STATUS_FLAG_OVERRIDDEN, false);
+    bitstring_set_bit(&data.notificationParams.outOfRange.statusFlags,
+        STATUS_FLAG_OUT_OF_SERVICE, false);
+    Notification_Class_common_reporting_function(&data);
+}
+
+/**
+ * @brief Test the event outbox sends the confirmed notifications
+ *  when a transaction is available, and again when they fail
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(notification_class_tests, test_Notification_Class_Event_Outbox)
+#else
+static void test_Notification_Class_Event_Outbox(void)
+#endif
+{
+    BACNET_DESTINATION recipient_list[NC_MAX_RECIPIENTS];
+    BACNET_ADDRESS address = { 0 };
+    bool confirmed = false;
+    unsigned i;
+
+    Notification_Class_Init();
+    address_init();
+    address.mac_len = 1;
+    address.mac[0] = 12;
+    address_add(1234, MAX_APDU, &address);
+    test_recipient_list_init(recipient_list);
+    test_recipient_address(&recipient_list[0], 0, 10, 1);
+    test_recipient_address(&recipient_list[1], 0, 11, 2);
+    recipient_list[2].Recipient.type.device.instance = 1234;
+    recipient_list[2].ProcessIdentifier = 3;
+    recipient_list[2].ConfirmedNotify = true;
+    /* not bound */
+    recipient_list[3].Recipient.type.device.instance = 5678;
+    recipient_list[3].ProcessIdentifier = 4;
+    recipient_list[3].ConfirmedNotify = true;
+    zassert_true(
+        Notification_Class_Set_Recipient_List(1, recipient_list), NULL);
+    /* the unconfirmed notifications are sent without a transaction */
+    TSM_Available = false;
+    Sent_Count = 0;
+    test_event_report();
+    zassert_equal(Sent_Count, 2, NULL);
+    zassert_equal(Sent_Dest[0].mac[0], 10, NULL);
+    zassert_equal(test_sent_process_identifier(0, &confirmed), 1, NULL);
+    zassert_false(confirmed, NULL);
+    zassert_equal(Sent_Dest[1].mac[0], 11, NULL);
+    zassert_equal(test_sent_process_identifier(1, &confirmed), 2, NULL);
+    zassert_false(confirmed, NULL);
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 1, NULL);
+    /* the confirmed notification waits for a transaction */
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Sent_Count, 2, NULL);
+    zassert_equal(
+        tmwheel_next(NC_EVENT_TIMER_MS + 1), NC_EVENT_TIMER_MS, NULL);
+    TSM_Available = true;
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Sent_Count, 3, NULL);
+    zassert_equal(Sent_Buffer, TSM_Buffer, NULL);
+    zassert_equal(Sent_Dest[2].mac[0], 12, NULL);
+    zassert_equal(test_sent_process_identifier(2, &confirmed), 3, NULL);
+    zassert_true(confirmed, NULL);
+    /* waiting for the acknowledgment, with no timer armed */
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Sent_Count, 3, NULL);
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 1, NULL);
+    zassert_equal(
+        tmwheel_next(NC_EVENT_TIMER_MS + 1), NC_EVENT_TIMER_MS + 1, NULL);
+    /* sent again from the outbox timer when it fails */
+    TSM_Freed_Count = 0;
+    test_tsm_complete(TSM_TRANSACTION_TIMEOUT);
+    zassert_equal(TSM_Freed_Count, 1, NULL);
+    zassert_equal(tmwheel_next(NC_EVENT_TIMER_MS), 0, NULL);
+    zassert_equal(tmwheel_run(), 1, NULL);
+    zassert_equal(Sent_Count, 4, NULL);
+    zassert_equal(test_sent_process_identifier(3, &confirmed), 3, NULL);
+    zassert_true(confirmed, NULL);
+    /* the end of another request is not taken as its own */
+    TSM_Invoke_ID++;
+    test_tsm_complete(TSM_TRANSACTION_ACK);
+    TSM_Invoke_ID--;
+    TSM_Dest.mac[0]++;
+    test_tsm_complete(TSM_TRANSACTION_ACK);
+    TSM_Dest.mac[0]--;
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 1, NULL);
+    zassert_equal(Sent_Count, 4, NULL);
+    /* and done when acknowledged */
+    test_tsm_complete(TSM_TRANSACTION_ACK);
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 0, NULL);
+    zassert_equal(Sent_Count, 4, NULL);
+    /* given up after the retries */
+    test_event_report();
+    zassert_equal(Sent_Count, 7, NULL);
+    for (i = 0; i < NC_EVENT_RETRIES; i++) {
+        test_tsm_complete(TSM_TRANSACTION_TIMEOUT);
+        Notification_Class_Event_Outbox_Task();
+    }
+    zassert_equal(Sent_Count, 7 + NC_EVENT_RETRIES, NULL);
+    test_tsm_complete(TSM_TRANSACTION_TIMEOUT);
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 0, NULL);
+    /* nothing is sent while communication is disabled */
+    DCC_Enabled = false;
+    Sent_Count = 0;
+    test_event_report();
+    zassert_equal(Sent_Count, 0, NULL);
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 1, NULL);
+    DCC_Enabled = true;
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Sent_Count, 3, NULL);
+    test_tsm_complete(TSM_TRANSACTION_ERROR);
+    Notification_Class_Event_Outbox_Task();
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 0, NULL);
+    /* the oldest events are dropped when the outbox is full, and the
+       transaction of a confirmed notification in progress is freed */
+    TSM_Available = true;
+    test_event_report();
+    TSM_Available = false;
+    TSM_Freed_Count = 0;
+    for (i = 0; i < (NC_EVENT_OUTBOX_SIZE + 1); i++) {
+        test_event_report();
+    }
+    zassert_equal(
+        Notification_Class_Event_Outbox_Count(), NC_EVENT_OUTBOX_SIZE, NULL);
+    zassert_equal(TSM_Freed_Count, 1, NULL);
+}
+
+/**
+ * @brief Test the unconfirmed recipients reached by a broadcast in the
+ *  recipient list are sent the broadcast once
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(notification_class_tests, test_Notification_Class_Event_Broadcast)
+#else
+static void test_Notification_Class_Event_Broadcast(void)
+#endif
+{
+    BACNET_DESTINATION recipient_list[NC_MAX_RECIPIENTS];
+    bool confirmed = false;
+
+    Notification_Class_Init();
+    test_recipient_list_init(recipient_list);
+    test_recipient_address(&recipient_list[0], 0, 10, 1);
+    test_recipient_address(&recipient_list[1], 0, 0, 1);
+    test_recipient_address(&recipient_list[2], 0, 10, 1);
+    test_recipient_address(&recipient_list[3], 0, 11, 2);
+    test_recipient_address(&recipient_list[4], 0, 11, 2);
+    test_recipient_address(&recipient_list[5], 5, 20, 1);
+    test_recipient_address(&recipient_list[6], BACNET_BROADCAST_NETWORK, 0, 3);
+    test_recipient_address(&recipient_list[7], 5, 21, 3);
+    zassert_true(
+        Notification_Class_Set_Recipient_List(1, recipient_list), NULL);
+    Sent_Count = 0;
+    test_event_report();
+    zassert_equal(Notification_Class_Event_Outbox_Count(), 0, NULL);
+    zassert_equal(Sent_Count, 4, NULL);
+    /* the local broadcast instead of the recipients on the local network */
+    zassert_equal(Sent_Dest[0].net, 0, NULL);
+    zassert_equal(Sent_Dest[0].mac_len, 0, NULL);
+    zassert_equal(test_sent_process_identifier(0, &confirmed), 1, NULL);
+    /* each address once */
+    zassert_equal(Sent_Dest[1].mac[0], 11, NULL);
+    zassert_equal(test_sent_process_identifier(1, &confirmed), 2, NULL);
+    /* a broadcast on the local network does not reach another network */
+    zassert_equal(Sent_Dest[2].net, 5, NULL);
+    zassert_equal(Sent_Dest[2].mac[0], 20, NULL);
+    zassert_equal(test_sent_process_identifier(2, &confirmed), 1, NULL);
+    /* a global broadcast reaches every network */
+    zassert_equal(Sent_Dest[3].net, BACNET_BROADCAST_NETWORK, NULL);
+    zassert_equal(test_sent_process_identifier(3, &confirmed), 3, NULL);
+}
 /**
  * @}
  */
@@ -141,8 +524,10 @@ ZTEST_SUITE(notification_class_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(
-        notification_class_tests, ztest_unit_test(test_Notification_Class));
+    ztest_test_suite(notification_class_tests,
+        ztest_unit_test(test_Notification_Class),
+        ztest_unit_test(test_Notification_Class_Event_Outbox),
+        ztest_unit_test(test_Notification_Class_Event_Broadcast));
 
     ztest_run_test_suite(notification_class_tests);
 }
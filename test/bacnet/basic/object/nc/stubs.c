@@ -8,6 +8,7 @@
  */
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "bacnet/datetime.h"
 #include "bacnet/bacdef.h"
 #include "bacnet/npdu.h"
@@ -18,21 +19,21 @@ uint32_t Device_Object_Instance_Number(void)
     return 0;
 }
 
-int Send_UEvent_Notify(
-    uint8_t *buffer, BACNET_EVENT_NOTIFICATION_DATA *data, BACNET_ADDRESS *dest)
+unsigned long mstimer_now(void)
 {
-    (void)buffer;
-    (void)data;
-    (void)dest;
     return 0;
 }
 
-uint8_t
-Send_CEvent_Notify(uint32_t device_id, BACNET_EVENT_NOTIFICATION_DATA *data)
+void datalink_get_my_address(BACNET_ADDRESS *my_address)
 {
-    (void)device_id;
-    (void)data;
-    return 0;
+    memset(my_address, 0, sizeof(BACNET_ADDRESS));
+    my_address->mac_len = 1;
+    my_address->mac[0] = 1;
+}
+
+void datalink_get_broadcast_address(BACNET_ADDRESS *dest)
+{
+    memset(dest, 0, sizeof(BACNET_ADDRESS));
 }
 
 void Send_WhoIs(int32_t low_limit, int32_t high_limit)
@@ -47,9 +48,9 @@ bool datetime_local(
     int16_t *utc_offset_minutes,
     bool *dst_active)
 {
-    (void)bdate;
-    (void)btime;
     (void)utc_offset_minutes;
     (void)dst_active;
+    datetime_set_date(bdate, 2026, 10, 19);
+    datetime_set_time(btime, 12, 0, 0, 0);
     return true;
 }
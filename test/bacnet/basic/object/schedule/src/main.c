@@ -7,8 +7,10 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include <math.h>
 #include <zephyr/ztest.h>
 #include <bacnet/basic/object/schedule.h>
+#include <bacnet/basic/sys/tmwheel.h>
 #include <property_test.h>
 
 /**
@@ -40,6 +42,384 @@ static void testSchedule(void)
         Schedule_Read_Property, Schedule_Write_Property,
         skip_fail_property_list);
 }
+static unsigned Write_Count;
+static BACNET_WRITE_PROPERTY_DATA Write_Data;
+/* stub clock of the timer wheel */
+static unsigned long Milliseconds;
+/* stub local date and time */
+static BACNET_DATE_TIME Local_Time;
+/* calendar 2 includes today */
+static bool Calendar_Today;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+bool datetime_local(BACNET_DATE *bdate,
+    BACNET_TIME *btime,
+    int16_t *utc_offset_minutes,
+    bool *dst_active)
+{
+    (void)utc_offset_minutes;
+    (void)dst_active;
+    datetime_copy_date(bdate, &Local_Time.date);
+    datetime_copy_time(btime, &Local_Time.time);
+
+    return true;
+}
+
+uint32_t Device_Object_Instance_Number(void)
+{
+    return 1234;
+}
+
+static bool test_write_property(BACNET_WRITE_PROPERTY_DATA *wp_data)
+{
+    Write_Data = *wp_data;
+    Write_Count++;
+
+    return true;
+}
+
+static bool test_calendar_date(uint32_t object_instance, BACNET_DATE *date)
+{
+    /* calendar 1 includes Mondays */
+    if (object_instance == 1) {
+        return date->wday == BACNET_WEEKDAY_MONDAY;
+    }
+
+    return (object_instance == 2) && Calendar_Today;
+}
+
+/**
+ * @brief Check the value written to the referenced property
+ */
+static void test_written_real(float value)
+{
+    BACNET_APPLICATION_DATA_VALUE data = { 0 };
+    int len;
+
+    zassert_equal(Write_Data.object_type, OBJECT_ANALOG_OUTPUT, NULL);
+    zassert_equal(Write_Data.object_instance, 1, NULL);
+    zassert_equal(Write_Data.object_property, PROP_PRESENT_VALUE, NULL);
+    zassert_equal(Write_Data.priority, 16, NULL);
+    len = bacapp_decode_application_data(
+        Write_Data.application_data, Write_Data.application_data_len, &data);
+    zassert_true(len > 0, NULL);
+    zassert_equal(data.tag, BACNET_APPLICATION_TAG_REAL, NULL);
+    zassert_false(islessgreater(data.type.Real, value), NULL);
+}
+
+/**
+ * @brief Check the Present_Value of the schedule
+ */
+static void test_present_value_real(uint32_t object_instance, float value)
+{
+    BACNET_APPLICATION_DATA_VALUE data = { 0 };
+
+    zassert_true(Schedule_Present_Value(object_instance, &data), NULL);
+    zassert_equal(data.tag, BACNET_APPLICATION_TAG_REAL, NULL);
+    zassert_false(islessgreater(data.type.Real, value), NULL);
+}
+
+/**
+ * @brief Set a time value with a REAL value
+ */
+static void test_time_value_real(
+    BACNET_TIME_VALUE *time_value, uint8_t hour, uint8_t minute, float value)
+{
+    datetime_set_time(&time_value->Time, hour, minute, 0, 0);
+    time_value->Value.tag = BACNET_APPLICATION_TAG_REAL;
+    time_value->Value.type.Real = value;
+}
+
+/**
+ * @brief Set a time value with a NULL value
+ */
+static void test_time_value_null(
+    BACNET_TIME_VALUE *time_value, uint8_t hour, uint8_t minute)
+{
+    datetime_set_time(&time_value->Time, hour, minute, 0, 0);
+    time_value->Value.tag = BACNET_APPLICATION_TAG_NULL;
+}
+
+/**
+ * @brief Test the schedule is evaluated only at its transitions, with
+ *  the special events of the Exception_Schedule
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(schedule_tests, testScheduleTransitions)
+#else
+static void testScheduleTransitions(void)
+#endif
+{
+    BACNET_OBJ_DAILY_SCHEDULE day = { 0 };
+    BACNET_OBJ_SPECIAL_EVENT special_event = { 0 };
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE reference = { 0 };
+    BACNET_SPECIAL_EVENT test_special_event = { 0 };
+    BACNET_READ_PROPERTY_DATA rpdata = { 0 };
+    BACNET_DATE_TIME bdatetime = { 0 }, next = { 0 };
+    uint8_t apdu[MAX_APDU] = { 0 };
+    const uint32_t object_instance = 1;
+    int len, test_len;
+
+    Schedule_Init();
+    Schedule_Write_Property_Internal_Callback_Set(test_write_property);
+    Schedule_Calendar_Date_Callback_Set(test_calendar_date);
+    reference.objectIdentifier.type = OBJECT_ANALOG_OUTPUT;
+    reference.objectIdentifier.instance = 1;
+    reference.propertyIdentifier = PROP_PRESENT_VALUE;
+    reference.arrayIndex = BACNET_ARRAY_ALL;
+    reference.deviceIdentifier.type = BACNET_NO_DEV_TYPE;
+    reference.deviceIdentifier.instance = BACNET_NO_DEV_ID;
+    zassert_true(
+        Schedule_Object_Property_Reference_Add(object_instance, &reference),
+        NULL);
+    /* every Monday */
+    test_time_value_real(&day.Time_Values[0], 8, 0, 22.5f);
+    test_time_value_null(&day.Time_Values[1], 17, 0);
+    day.TV_Count = 2;
+    zassert_true(Schedule_Weekly_Schedule_Set(
+                     object_instance, BACNET_WEEKDAY_MONDAY, &day),
+        NULL);
+    zassert_false(Schedule_Weekly_Schedule_Set(object_instance, 0, &day), NULL);
+    zassert_false(Schedule_Next_Transition(object_instance, &next), NULL);
+    /* the first evaluation writes the Schedule_Default */
+    datetime_set_date(&bdatetime.date, 2026, 10, 19);
+    datetime_set_time(&bdatetime.time, 7, 0, 0, 0);
+    Write_Count = 0;
+    zassert_equal(Schedule_Task(&bdatetime), 3600UL * 1000UL, NULL);
+    zassert_equal(Write_Count, 1, NULL);
+    test_written_real(21.0f);
+    test_present_value_real(object_instance, 21.0f);
+    zassert_true(Schedule_Next_Transition(object_instance, &next), NULL);
+    zassert_equal(next.time.hour, 8, NULL);
+    zassert_equal(datetime_compare_date(&next.date, &bdatetime.date), 0, NULL);
+    /* nothing changes between transitions */
+    datetime_set_time(&bdatetime.time, 7, 30, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 1800UL * 1000UL, NULL);
+    zassert_equal(Write_Count, 1, NULL);
+    datetime_set_time(&bdatetime.time, 8, 0, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 9UL * 3600UL * 1000UL, NULL);
+    zassert_equal(Write_Count, 2, NULL);
+    test_written_real(22.5f);
+    test_present_value_real(object_instance, 22.5f);
+    /* a special event on this date, and one from a calendar with a
+       higher priority */
+    special_event.periodTag = BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_ENTRY;
+    special_event.period.calendarEntry.tag = BACNET_CALENDAR_DATE;
+    datetime_set_date(
+        &special_event.period.calendarEntry.type.Date, 2026, 10, 19);
+    test_time_value_real(
+        &special_event.timeValues.Time_Values[0], 12, 0, 30.0f);
+    test_time_value_null(&special_event.timeValues.Time_Values[1], 13, 0);
+    special_event.timeValues.TV_Count = 2;
+    special_event.priority = 5;
+    zassert_true(
+        Schedule_Exception_Schedule_Add(object_instance, &special_event), NULL);
+    special_event.periodTag = BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_REFERENCE;
+    special_event.period.calendarReference.type = OBJECT_CALENDAR;
+    special_event.period.calendarReference.instance = 1;
+    test_time_value_real(
+        &special_event.timeValues.Time_Values[0], 12, 30, 40.0f);
+    test_time_value_null(&special_event.timeValues.Time_Values[1], 12, 45);
+    special_event.priority = 3;
+    zassert_true(
+        Schedule_Exception_Schedule_Add(object_instance, &special_event), NULL);
+    zassert_equal(Schedule_Exception_Schedule_Count(object_instance), 2, NULL);
+    datetime_set_time(&bdatetime.time, 9, 0, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 3UL * 3600UL * 1000UL, NULL);
+    zassert_equal(Write_Count, 3, NULL);
+    datetime_set_time(&bdatetime.time, 12, 0, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 1800UL * 1000UL, NULL);
+    test_present_value_real(object_instance, 30.0f);
+    datetime_set_time(&bdatetime.time, 12, 30, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 900UL * 1000UL, NULL);
+    test_present_value_real(object_instance, 40.0f);
+    /* the lower priority special event is in effect again */
+    datetime_set_time(&bdatetime.time, 12, 45, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 900UL * 1000UL, NULL);
+    test_present_value_real(object_instance, 30.0f);
+    test_written_real(30.0f);
+    /* then the weekly schedule */
+    datetime_set_time(&bdatetime.time, 13, 0, 0, 0);
+    zassert_equal(Schedule_Task(&bdatetime), 4UL * 3600UL * 1000UL, NULL);
+    test_present_value_real(object_instance, 22.5f);
+    zassert_equal(Write_Count, 7, NULL);
+    /* the next day has no transitions */
+    datetime_set_date(&bdatetime.date, 2026, 10, 20);
+    datetime_set_time(&bdatetime.time, 0, 0, 1, 0);
+    zassert_equal(Schedule_Task(&bdatetime),
+        (24UL * 3600UL - 1UL) * 1000UL, NULL);
+    test_present_value_real(object_instance, 21.0f);
+    zassert_equal(Write_Count, 8, NULL);
+    /* nothing is written while out of service */
+    Schedule_Out_Of_Service_Set(object_instance, true);
+    datetime_set_date(&bdatetime.date, 2026, 10, 26);
+    datetime_set_time(&bdatetime.time, 8, 0, 0, 0);
+    (void)Schedule_Task(&bdatetime);
+    zassert_equal(Write_Count, 8, NULL);
+    test_present_value_real(object_instance, 21.0f);
+    Schedule_Out_Of_Service_Set(object_instance, false);
+    (void)Schedule_Task(&bdatetime);
+    zassert_equal(Write_Count, 9, NULL);
+    test_present_value_real(object_instance, 22.5f);
+    /* the Exception_Schedule is a BACnetARRAY of special events */
+    rpdata.application_data = &apdu[0];
+    rpdata.application_data_len = sizeof(apdu);
+    rpdata.object_type = OBJECT_SCHEDULE;
+    rpdata.object_instance = object_instance;
+    rpdata.object_property = PROP_EXCEPTION_SCHEDULE;
+    rpdata.array_index = 2;
+    len = Schedule_Read_Property(&rpdata);
+    zassert_true(len > 0, NULL);
+    test_len = bacnet_special_event_decode(apdu, len, &test_special_event);
+    zassert_equal(len, test_len, NULL);
+    zassert_equal(test_special_event.periodTag,
+        BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_REFERENCE, NULL);
+    zassert_equal(
+        test_special_event.period.calendarReference.instance, 1, NULL);
+    zassert_equal(test_special_event.timeValues.TV_Count, 2, NULL);
+    zassert_equal(test_special_event.priority, 3, NULL);
+    rpdata.array_index = 3;
+    len = Schedule_Read_Property(&rpdata);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+    zassert_equal(rpdata.error_code, ERROR_CODE_INVALID_ARRAY_INDEX, NULL);
+    Schedule_Exception_Schedule_Delete_All(object_instance);
+    zassert_equal(Schedule_Exception_Schedule_Count(object_instance), 0, NULL);
+}
+
+/**
+ * @brief Test the schedule timer fires at the transitions, and again
+ *  when a referenced Calendar changes
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(schedule_tests, testScheduleTimer)
+#else
+static void testScheduleTimer(void)
+#endif
+{
+    BACNET_OBJ_DAILY_SCHEDULE day = { 0 };
+    BACNET_OBJ_SPECIAL_EVENT special_event = { 0 };
+    BACNET_DEVICE_OBJECT_PROPERTY_REFERENCE reference = { 0 };
+    const uint32_t object_instance = 1;
+
+    tmwheel_init();
+    Schedule_Init();
+    Schedule_Write_Property_Internal_Callback_Set(test_write_property);
+    Schedule_Calendar_Date_Callback_Set(test_calendar_date);
+    Calendar_Today = false;
+    reference.objectIdentifier.type = OBJECT_ANALOG_OUTPUT;
+    reference.objectIdentifier.instance = 1;
+    reference.propertyIdentifier = PROP_PRESENT_VALUE;
+    reference.arrayIndex = BACNET_ARRAY_ALL;
+    reference.deviceIdentifier.type = BACNET_NO_DEV_TYPE;
+    reference.deviceIdentifier.instance = BACNET_NO_DEV_ID;
+    zassert_true(
+        Schedule_Object_Property_Reference_Add(object_instance, &reference),
+        NULL);
+    test_time_value_real(&day.Time_Values[0], 8, 0, 22.5f);
+    test_time_value_null(&day.Time_Values[1], 17, 0);
+    day.TV_Count = 2;
+    zassert_true(Schedule_Weekly_Schedule_Set(
+                     object_instance, BACNET_WEEKDAY_MONDAY, &day),
+        NULL);
+    /* the days that calendar 2 includes */
+    special_event.periodTag = BACNET_SPECIAL_EVENT_PERIOD_CALENDAR_REFERENCE;
+    special_event.period.calendarReference.type = OBJECT_CALENDAR;
+    special_event.period.calendarReference.instance = 2;
+    test_time_value_real(
+        &special_event.timeValues.Time_Values[0], 12, 0, 30.0f);
+    test_time_value_null(&special_event.timeValues.Time_Values[1], 13, 0);
+    special_event.timeValues.TV_Count = 2;
+    special_event.priority = 1;
+    zassert_true(
+        Schedule_Exception_Schedule_Add(object_instance, &special_event), NULL);
+    /* the first evaluation is due at once */
+    datetime_set_date(&Local_Time.date, 2026, 10, 19);
+    datetime_set_time(&Local_Time.time, 7, 59, 0, 0);
+    Write_Count = 0;
+    zassert_equal(tmwheel_next(1000UL), 0, NULL);
+    tmwheel_run();
+    zassert_equal(Write_Count, 1, NULL);
+    test_written_real(21.0f);
+    /* and then the next transition */
+    zassert_equal(tmwheel_next(SCHEDULE_TIMER_MAX_MS * 2UL), 60000UL, NULL);
+    Milliseconds += 59999UL;
+    tmwheel_run();
+    zassert_equal(Write_Count, 1, NULL);
+    datetime_set_time(&Local_Time.time, 8, 0, 0, 0);
+    Milliseconds += 1UL;
+    tmwheel_run();
+    zassert_equal(Write_Count, 2, NULL);
+    test_written_real(22.5f);
+    /* a transition that is hours away is checked at most every
+       SCHEDULE_TIMER_MAX_MS */
+    zassert_equal(tmwheel_next(SCHEDULE_TIMER_MAX_MS * 2UL),
+        SCHEDULE_TIMER_MAX_MS, NULL);
+    /* a change of another calendar does not wake the schedules */
+    Schedule_Calendar_Changed(3);
+    zassert_equal(tmwheel_next(SCHEDULE_TIMER_MAX_MS * 2UL),
+        SCHEDULE_TIMER_MAX_MS, NULL);
+    /* calendar 2 now includes today, and the day is compiled again */
+    Calendar_Today = true;
+    Schedule_Calendar_Changed(2);
+    zassert_equal(tmwheel_next(SCHEDULE_TIMER_MAX_MS * 2UL), 0, NULL);
+    datetime_set_time(&Local_Time.time, 9, 0, 0, 0);
+    tmwheel_run();
+    test_present_value_real(object_instance, 22.5f);
+    datetime_set_time(&Local_Time.time, 12, 0, 0, 0);
+    Milliseconds += SCHEDULE_TIMER_MAX_MS;
+    tmwheel_run();
+    test_present_value_real(object_instance, 30.0f);
+    test_written_real(30.0f);
+}
+
+/**
+ * @brief Test the day is compiled into the changes of value only
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(schedule_tests, testScheduleCompile)
+#else
+static void testScheduleCompile(void)
+#endif
+{
+    static SCHEDULE_DESCR desc;
+    BACNET_DATE date;
+    BACNET_TIME time;
+
+    memset(&desc, 0, sizeof(desc));
+    datetime_set_date(&desc.Start_Date, 2026, 1, 1);
+    datetime_set_date(&desc.End_Date, 2026, 12, 31);
+    desc.Schedule_Default.tag = BACNET_APPLICATION_TAG_REAL;
+    desc.Schedule_Default.type.Real = 18.0f;
+    /* unsorted, with a repeated value */
+    test_time_value_real(&desc.Weekly_Schedule[0].Time_Values[0], 17, 0, 20.0f);
+    test_time_value_real(&desc.Weekly_Schedule[0].Time_Values[1], 8, 0, 20.0f);
+    test_time_value_real(&desc.Weekly_Schedule[0].Time_Values[2], 12, 0, 20.0f);
+    test_time_value_null(&desc.Weekly_Schedule[0].Time_Values[3], 18, 0);
+    desc.Weekly_Schedule[0].TV_Count = 4;
+    datetime_set_date(&date, 2026, 10, 19);
+    Schedule_Compile(&desc, &date);
+    zassert_equal(desc.Transition_Count, 3, NULL);
+    zassert_equal(desc.Transitions[0].Time.hour, 0, NULL);
+    zassert_equal(
+        desc.Transitions[0].Value.tag, BACNET_APPLICATION_TAG_NULL, NULL);
+    zassert_equal(desc.Transitions[1].Time.hour, 8, NULL);
+    zassert_equal(desc.Transitions[2].Time.hour, 18, NULL);
+    datetime_set_time(&time, 17, 59, 59, 99);
+    Schedule_Evaluate(&desc, &date, &time);
+    zassert_equal(desc.Transition_Next, 2, NULL);
+    zassert_false(islessgreater(desc.Present_Value.type.Real, 20.0f), NULL);
+    datetime_set_time(&time, 18, 0, 0, 0);
+    Schedule_Evaluate(&desc, &date, &time);
+    zassert_false(islessgreater(desc.Present_Value.type.Real, 18.0f), NULL);
+    /* outside of the Effective_Period */
+    datetime_set_date(&date, 2027, 1, 4);
+    Schedule_Compile(&desc, &date);
+    zassert_equal(desc.Transition_Count, 1, NULL);
+}
 /**
  * @}
  */
@@ -49,7 +429,10 @@ ZTEST_SUITE(schedule_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(schedule_tests, ztest_unit_test(testSchedule));
+    ztest_test_suite(schedule_tests, ztest_unit_test(testSchedule),
+        ztest_unit_test(testScheduleTransitions),
+        ztest_unit_test(testScheduleTimer),
+        ztest_unit_test(testScheduleCompile));
 
     ztest_run_test_suite(schedule_tests);
 }
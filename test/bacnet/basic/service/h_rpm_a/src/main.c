@@ -0,0 +1,213 @@
+/**
+ * @file
+ * @brief Unit test for the ReadPropertyMultiple-Ack handler decoding
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <bacnet/bacdcode.h>
+#include <bacnet/rpm.h>
+#include <bacnet/basic/service/h_rpm_a.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+/* elements in the encoded Object_List - more than one bulk decode */
+#define TEST_OBJECT_LIST_SIZE 40
+
+/**
+ * @brief Encode one property value of an RPM-Ack
+ * @param apdu - buffer for the encoding
+ * @param object_property - property identifier
+ * @param application_data - encoded value
+ * @param application_data_len - length of the encoded value
+ * @return number of bytes encoded
+ */
+static int test_rpm_ack_property_encode(
+    uint8_t *apdu,
+    BACNET_PROPERTY_ID object_property,
+    uint8_t *application_data,
+    int application_data_len)
+{
+    int len;
+
+    len = rpm_ack_encode_apdu_object_property(
+        apdu, object_property, BACNET_ARRAY_ALL);
+    len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[len], application_data, application_data_len);
+
+    return len;
+}
+
+/**
+ * @brief Test decoding arrays of a single datatype with the bulk decoders
+ */
+static void test_rpm_ack_decode_arrays(void)
+{
+    uint8_t apdu[MAX_APDU * 2] = { 0 };
+    uint8_t value_apdu[MAX_APDU] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_READ_ACCESS_DATA *rpm_data;
+    BACNET_PROPERTY_REFERENCE *rpm_property;
+    BACNET_APPLICATION_DATA_VALUE *value;
+    int apdu_len = 0, value_len = 0, len = 0;
+    unsigned i;
+
+    rpmdata.object_type = OBJECT_ANALOG_OUTPUT;
+    rpmdata.object_instance = 1;
+    apdu_len = rpm_ack_encode_apdu_object_begin(apdu, &rpmdata);
+    /* Priority_Array of NULL and REAL values */
+    value_len = 0;
+    for (i = 1; i <= BACNET_MAX_PRIORITY; i++) {
+        if (i % 4) {
+            value_len += encode_application_null(&value_apdu[value_len]);
+        } else {
+            value_len +=
+                encode_application_real(&value_apdu[value_len], (float)i);
+        }
+    }
+    apdu_len += test_rpm_ack_property_encode(
+        &apdu[apdu_len], PROP_PRIORITY_ARRAY, value_apdu, value_len);
+    /* Priority_Array of NULL values only */
+    value_len = 0;
+    for (i = 1; i <= BACNET_MAX_PRIORITY; i++) {
+        value_len += encode_application_null(&value_apdu[value_len]);
+    }
+    apdu_len += test_rpm_ack_property_encode(
+        &apdu[apdu_len], PROP_PRIORITY_ARRAY, value_apdu, value_len);
+    /* Object_List */
+    value_len = 0;
+    for (i = 0; i < TEST_OBJECT_LIST_SIZE; i++) {
+        value_len += encode_application_object_id(
+            &value_apdu[value_len], OBJECT_ANALOG_INPUT, i);
+    }
+    apdu_len += test_rpm_ack_property_encode(
+        &apdu[apdu_len], PROP_OBJECT_LIST, value_apdu, value_len);
+    /* a property left to the per-element decoder */
+    value_len = encode_application_real(value_apdu, 42.0f);
+    apdu_len += test_rpm_ack_property_encode(
+        &apdu[apdu_len], PROP_PRESENT_VALUE, value_apdu, value_len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    zassert_true(apdu_len < sizeof(apdu), NULL);
+
+    rpm_data = calloc(1, sizeof(BACNET_READ_ACCESS_DATA));
+    zassert_not_null(rpm_data, NULL);
+    len = rpm_ack_decode_service_request(apdu, apdu_len, rpm_data);
+    zassert_equal(len, apdu_len, NULL);
+    zassert_equal(rpm_data->object_type, OBJECT_ANALOG_OUTPUT, NULL);
+    zassert_equal(rpm_data->object_instance, 1, NULL);
+    rpm_property = rpm_data->listOfProperties;
+    zassert_not_null(rpm_property, NULL);
+    zassert_equal(rpm_property->propertyIdentifier, PROP_PRIORITY_ARRAY, NULL);
+    value = rpm_property->value;
+    for (i = 1; i <= BACNET_MAX_PRIORITY; i++) {
+        zassert_not_null(value, NULL);
+        zassert_false(value->context_specific, NULL);
+        if (i % 4) {
+            zassert_equal(value->tag, BACNET_APPLICATION_TAG_NULL, NULL);
+        } else {
+            zassert_equal(value->tag, BACNET_APPLICATION_TAG_REAL, NULL);
+            zassert_false(islessgreater(value->type.Real, (float)i), NULL);
+        }
+        value = value->next;
+    }
+    zassert_is_null(value, NULL);
+    rpm_property = rpm_property->next;
+    zassert_not_null(rpm_property, NULL);
+    zassert_equal(rpm_property->propertyIdentifier, PROP_PRIORITY_ARRAY, NULL);
+    value = rpm_property->value;
+    for (i = 1; i <= BACNET_MAX_PRIORITY; i++) {
+        zassert_not_null(value, NULL);
+        zassert_equal(value->tag, BACNET_APPLICATION_TAG_NULL, NULL);
+        value = value->next;
+    }
+    zassert_is_null(value, NULL);
+    rpm_property = rpm_property->next;
+    zassert_not_null(rpm_property, NULL);
+    zassert_equal(rpm_property->propertyIdentifier, PROP_OBJECT_LIST, NULL);
+    value = rpm_property->value;
+    for (i = 0; i < TEST_OBJECT_LIST_SIZE; i++) {
+        zassert_not_null(value, NULL);
+        zassert_equal(value->tag, BACNET_APPLICATION_TAG_OBJECT_ID, NULL);
+        zassert_equal(value->type.Object_Id.type, OBJECT_ANALOG_INPUT, NULL);
+        zassert_equal(value->type.Object_Id.instance, i, NULL);
+        value = value->next;
+    }
+    zassert_is_null(value, NULL);
+    rpm_property = rpm_property->next;
+    zassert_not_null(rpm_property, NULL);
+    zassert_equal(rpm_property->propertyIdentifier, PROP_PRESENT_VALUE, NULL);
+    value = rpm_property->value;
+    zassert_not_null(value, NULL);
+    zassert_equal(value->tag, BACNET_APPLICATION_TAG_REAL, NULL);
+    zassert_false(islessgreater(value->type.Real, 42.0f), NULL);
+    zassert_is_null(value->next, NULL);
+    zassert_is_null(rpm_property->next, NULL);
+    while (rpm_data) {
+        rpm_data = rpm_data_free(rpm_data);
+    }
+}
+
+/**
+ * @brief Test an array element of another datatype after a bulk decode
+ */
+static void test_rpm_ack_decode_mixed_array(void)
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    uint8_t value_apdu[MAX_APDU] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_READ_ACCESS_DATA *rpm_data;
+    BACNET_APPLICATION_DATA_VALUE *value;
+    int apdu_len = 0, value_len = 0, len = 0;
+
+    rpmdata.object_type = OBJECT_DEVICE;
+    rpmdata.object_instance = 1234;
+    apdu_len = rpm_ack_encode_apdu_object_begin(apdu, &rpmdata);
+    value_len = encode_application_object_id(value_apdu, OBJECT_DEVICE, 1234);
+    value_len += encode_application_unsigned(&value_apdu[value_len], 5);
+    value_len += encode_application_object_id(
+        &value_apdu[value_len], OBJECT_ANALOG_VALUE, 7);
+    apdu_len += test_rpm_ack_property_encode(
+        &apdu[apdu_len], PROP_OBJECT_LIST, value_apdu, value_len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+
+    rpm_data = calloc(1, sizeof(BACNET_READ_ACCESS_DATA));
+    zassert_not_null(rpm_data, NULL);
+    len = rpm_ack_decode_service_request(apdu, apdu_len, rpm_data);
+    zassert_equal(len, apdu_len, NULL);
+    zassert_not_null(rpm_data->listOfProperties, NULL);
+    value = rpm_data->listOfProperties->value;
+    zassert_not_null(value, NULL);
+    zassert_equal(value->tag, BACNET_APPLICATION_TAG_OBJECT_ID, NULL);
+    zassert_equal(value->type.Object_Id.instance, 1234, NULL);
+    value = value->next;
+    zassert_not_null(value, NULL);
+    zassert_equal(value->tag, BACNET_APPLICATION_TAG_UNSIGNED_INT, NULL);
+    zassert_equal(value->type.Unsigned_Int, 5, NULL);
+    value = value->next;
+    zassert_not_null(value, NULL);
+    zassert_equal(value->tag, BACNET_APPLICATION_TAG_OBJECT_ID, NULL);
+    zassert_equal(value->type.Object_Id.type, OBJECT_ANALOG_VALUE, NULL);
+    zassert_equal(value->type.Object_Id.instance, 7, NULL);
+    zassert_is_null(value->next, NULL);
+    while (rpm_data) {
+        rpm_data = rpm_data_free(rpm_data);
+    }
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(h_rpm_a_tests,
+        ztest_unit_test(test_rpm_ack_decode_arrays),
+        ztest_unit_test(test_rpm_ack_decode_mixed_array));
+
+    ztest_run_test_suite(h_rpm_a_tests);
+}
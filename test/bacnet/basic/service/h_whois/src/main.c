@@ -0,0 +1,236 @@
+/**
+ * @file
+ * @brief Unit test for Who-Is flood suppression and the I-Am cache
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/bacaddr.h>
+#include <bacnet/iam.h>
+#include <bacnet/npdu.h>
+#include <bacnet/whois.h>
+#include <bacnet/basic/services.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/datalink/datalink.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+uint8_t Handler_Transmit_Buffer[MAX_PDU];
+static uint32_t Test_Device_ID = 1234;
+static uint16_t Test_Vendor_ID = 260;
+static uint8_t Test_My_MAC = 1;
+static unsigned Sent_Count;
+static BACNET_ADDRESS Sent_Dest;
+static uint8_t Sent_PDU[MAX_PDU];
+static unsigned Sent_PDU_Len;
+/* stub clock */
+static unsigned long Milliseconds = 1000;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+uint32_t Device_Object_Instance_Number(void)
+{
+    return Test_Device_ID;
+}
+
+uint16_t Device_Vendor_Identifier(void)
+{
+    return Test_Vendor_ID;
+}
+
+void datalink_get_my_address(BACNET_ADDRESS *my_address)
+{
+    memset(my_address, 0, sizeof(BACNET_ADDRESS));
+    my_address->mac_len = 1;
+    my_address->mac[0] = Test_My_MAC;
+}
+
+void datalink_get_broadcast_address(BACNET_ADDRESS *dest)
+{
+    memset(dest, 0, sizeof(BACNET_ADDRESS));
+    dest->net = BACNET_BROADCAST_NETWORK;
+}
+
+int datalink_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    (void)npdu_data;
+    bacnet_address_copy(&Sent_Dest, dest);
+    memcpy(Sent_PDU, pdu, pdu_len);
+    Sent_PDU_Len = pdu_len;
+    Sent_Count++;
+
+    return (int)pdu_len;
+}
+
+/**
+ * @brief Set a local source address
+ * @param src - address to set
+ * @param mac - MAC address of the source
+ */
+static void test_source_address(BACNET_ADDRESS *src, uint8_t mac)
+{
+    memset(src, 0, sizeof(BACNET_ADDRESS));
+    src->mac_len = 1;
+    src->mac[0] = mac;
+}
+
+/**
+ * @brief Check the last PDU sent against a fresh I-Am encoding
+ * @param dest - expected destination
+ */
+static void test_i_am_sent(BACNET_ADDRESS *dest)
+{
+    uint8_t pdu[MAX_PDU] = { 0 };
+    BACNET_ADDRESS my_address;
+    BACNET_NPDU_DATA npdu_data;
+    int pdu_len;
+
+    datalink_get_my_address(&my_address);
+    npdu_encode_npdu_data(&npdu_data, false, MESSAGE_PRIORITY_NORMAL);
+    pdu_len = npdu_encode_pdu(pdu, dest, &my_address, &npdu_data);
+    pdu_len += iam_encode_apdu(&pdu[pdu_len], Test_Device_ID, MAX_APDU,
+        SEGMENTATION_NONE, Test_Vendor_ID);
+    zassert_true(bacnet_address_same(&Sent_Dest, dest), NULL);
+    zassert_equal(Sent_PDU_Len, pdu_len, NULL);
+    zassert_equal(memcmp(Sent_PDU, pdu, pdu_len), 0, NULL);
+}
+
+/**
+ * @brief Test the Who-Is token bucket of each source address
+ */
+static void test_who_is_rate_limit(void)
+{
+    BACNET_ADDRESS src_a, src_b;
+    uint8_t apdu[MAX_APDU] = { 0 };
+    int apdu_len;
+    unsigned i;
+
+    test_source_address(&src_a, 10);
+    test_source_address(&src_b, 11);
+    handler_who_is_coalesce_window_set(0);
+    handler_who_is_rate_limit_set(2, 100);
+    Sent_Count = 0;
+    for (i = 0; i < 3; i++) {
+        handler_who_is_unicast(NULL, 0, &src_a);
+    }
+    zassert_equal(Sent_Count, 2, NULL);
+    /* another source on the same network has its own bucket */
+    handler_who_is_unicast(NULL, 0, &src_b);
+    zassert_equal(Sent_Count, 3, NULL);
+    test_i_am_sent(&src_b);
+    /* one token is returned each interval */
+    Milliseconds += 100;
+    handler_who_is_unicast(NULL, 0, &src_a);
+    handler_who_is_unicast(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 4, NULL);
+    /* a Who-Is that is not answered takes no token */
+    Milliseconds += 100;
+    apdu_len = whois_encode_apdu(apdu, 0, 100);
+    handler_who_is_unicast(&apdu[2], apdu_len - 2, &src_a);
+    zassert_equal(Sent_Count, 4, NULL);
+    handler_who_is_unicast(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 5, NULL);
+    /* disabled */
+    handler_who_is_rate_limit_set(0, 0);
+    for (i = 0; i < 3; i++) {
+        handler_who_is_unicast(NULL, 0, &src_a);
+    }
+    zassert_equal(Sent_Count, 8, NULL);
+}
+
+/**
+ * @brief Test that coalesced I-Am replies are not sent or charged
+ */
+static void test_who_is_coalesce(void)
+{
+    BACNET_ADDRESS src_a, src_b, broadcast;
+    unsigned i;
+
+    test_source_address(&src_a, 10);
+    test_source_address(&src_b, 11);
+    datalink_get_broadcast_address(&broadcast);
+    handler_who_is_rate_limit_set(2, 1000);
+    handler_who_is_coalesce_window_set(100);
+    Sent_Count = 0;
+    handler_who_is_unicast(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 1, NULL);
+    test_i_am_sent(&src_a);
+    for (i = 0; i < 3; i++) {
+        handler_who_is_unicast(NULL, 0, &src_a);
+    }
+    zassert_equal(Sent_Count, 1, NULL);
+    /* another destination is not coalesced */
+    handler_who_is_unicast(NULL, 0, &src_b);
+    zassert_equal(Sent_Count, 2, NULL);
+    /* the coalesced replies took no token */
+    Milliseconds += 100;
+    handler_who_is_unicast(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 3, NULL);
+    Milliseconds += 100;
+    handler_who_is_unicast(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 3, NULL);
+    /* broadcast replies from any source are coalesced */
+    handler_who_is(NULL, 0, &src_b);
+    zassert_equal(Sent_Count, 4, NULL);
+    test_i_am_sent(&broadcast);
+    handler_who_is(NULL, 0, &src_a);
+    zassert_equal(Sent_Count, 4, NULL);
+    handler_who_is_coalesce_window_set(0);
+    handler_who_is_rate_limit_set(0, 0);
+}
+
+/**
+ * @brief Test the cached I-Am follows the device and datalink
+ */
+static void test_i_am_cache(void)
+{
+    BACNET_ADDRESS src, broadcast;
+
+    test_source_address(&src, 10);
+    datalink_get_broadcast_address(&broadcast);
+    Send_I_Am(Handler_Transmit_Buffer);
+    test_i_am_sent(&broadcast);
+    Send_I_Am(Handler_Transmit_Buffer);
+    test_i_am_sent(&broadcast);
+    Send_I_Am_Unicast(Handler_Transmit_Buffer, &src);
+    test_i_am_sent(&src);
+    Test_Vendor_ID = 42;
+    Send_I_Am(Handler_Transmit_Buffer);
+    test_i_am_sent(&broadcast);
+    Send_I_Am_Unicast(Handler_Transmit_Buffer, &src);
+    test_i_am_sent(&src);
+    Test_My_MAC = 2;
+    Send_I_Am(Handler_Transmit_Buffer);
+    test_i_am_sent(&broadcast);
+    Test_Device_ID = 4321;
+    Send_I_Am(Handler_Transmit_Buffer);
+    test_i_am_sent(&broadcast);
+    Send_I_Am_Unicast(Handler_Transmit_Buffer, &src);
+    test_i_am_sent(&src);
+    Test_Device_ID = 1234;
+    Test_Vendor_ID = 260;
+    Test_My_MAC = 1;
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(h_whois_tests, ztest_unit_test(test_who_is_rate_limit),
+        ztest_unit_test(test_who_is_coalesce),
+        ztest_unit_test(test_i_am_cache));
+
+    ztest_run_test_suite(h_whois_tests);
+}
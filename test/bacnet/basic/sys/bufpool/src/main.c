@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @brief test pool of fixed size buffers in several size classes
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <zephyr/ztest.h>
+#include <bacnet/basic/sys/bufpool.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+static uint8_t Small_Data[4][16];
+static uint8_t Large_Data[2][128];
+
+/**
+ * @brief Test allocating from the smallest size class that fits
+ */
+static void test_bufpool_alloc(void)
+{
+    struct bufpool_class classes[2];
+    struct bufpool pool;
+    uint8_t *small[4];
+    uint8_t *buffer;
+    uint16_t capacity = 0;
+    unsigned i;
+
+    bufpool_class_init(&classes[0], &Small_Data[0][0], 16, 4);
+    bufpool_class_init(&classes[1], &Large_Data[0][0], 128, 2);
+    bufpool_init(&pool, classes, 2);
+    zassert_equal(bufpool_available(&pool, 1), 6, NULL);
+    zassert_equal(bufpool_available(&pool, 16), 6, NULL);
+    zassert_equal(bufpool_available(&pool, 17), 2, NULL);
+    zassert_equal(bufpool_available(&pool, 129), 0, NULL);
+    zassert_is_null(bufpool_alloc(&pool, 129, &capacity), NULL);
+    /* the small class is used first, in order */
+    for (i = 0; i < 4; i++) {
+        small[i] = bufpool_alloc(&pool, 10, &capacity);
+        zassert_equal(small[i], &Small_Data[i][0], NULL);
+        zassert_equal(capacity, 16, NULL);
+    }
+    /* then a larger class when the small class is empty */
+    buffer = bufpool_alloc(&pool, 10, &capacity);
+    zassert_equal(buffer, &Large_Data[0][0], NULL);
+    zassert_equal(capacity, 128, NULL);
+    zassert_equal(bufpool_available(&pool, 1), 1, NULL);
+    /* freed buffers are used again */
+    zassert_true(bufpool_free(&pool, small[2]), NULL);
+    zassert_equal(bufpool_alloc(&pool, 16, NULL), small[2], NULL);
+    zassert_true(bufpool_free(&pool, buffer), NULL);
+    for (i = 0; i < 4; i++) {
+        zassert_true(bufpool_free(&pool, small[i]), NULL);
+    }
+    zassert_equal(bufpool_available(&pool, 1), 6, NULL);
+    /* not from the pool */
+    zassert_false(bufpool_free(&pool, NULL), NULL);
+    zassert_false(bufpool_free(&pool, &Small_Data[0][1]), NULL);
+    zassert_false(bufpool_free(&pool, (uint8_t *)&pool), NULL);
+    zassert_equal(bufpool_available(&pool, 1), 6, NULL);
+}
+
+/**
+ * @brief Test a size class without usable memory
+ */
+static void test_bufpool_empty(void)
+{
+    struct bufpool_class classes[1];
+    struct bufpool pool;
+
+    bufpool_class_init(&classes[0], NULL, 16, 4);
+    bufpool_init(&pool, classes, 1);
+    zassert_equal(bufpool_available(&pool, 1), 0, NULL);
+    zassert_is_null(bufpool_alloc(&pool, 1, NULL), NULL);
+    bufpool_class_init(&classes[0], &Small_Data[0][0], 1, 4);
+    zassert_equal(bufpool_available(&pool, 1), 0, NULL);
+    bufpool_init(&pool, NULL, 1);
+    zassert_is_null(bufpool_alloc(&pool, 1, NULL), NULL);
+    zassert_is_null(bufpool_alloc(NULL, 1, NULL), NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(bufpool_tests, ztest_unit_test(test_bufpool_alloc),
+        ztest_unit_test(test_bufpool_empty));
+
+    ztest_run_test_suite(bufpool_tests);
+}
@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief test priority array of commandable object properties
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <math.h>
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <bacnet/basic/sys/commandable.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+/**
+ * @brief Test the lowest set bit search
+ */
+static void test_commandable_lowest_bit(void)
+{
+    unsigned bit;
+
+    zassert_equal(commandable_lowest_bit(0), 16, NULL);
+    for (bit = 0; bit < 16; bit++) {
+        zassert_equal(commandable_lowest_bit((uint16_t)(1U << bit)), bit, NULL);
+        zassert_equal(
+            commandable_lowest_bit((uint16_t)(0xFFFFU << bit)), bit, NULL);
+    }
+}
+
+/**
+ * @brief Test commanding and relinquishing priorities
+ */
+static void test_commandable_priority(void)
+{
+    struct commandable cmd;
+    unsigned priority;
+
+    commandable_init(&cmd);
+    zassert_equal(commandable_priority(&cmd), 0, NULL);
+    zassert_equal(commandable_next_priority(&cmd, 0), 0, NULL);
+    /* out of range */
+    zassert_false(commandable_command(&cmd, 0), NULL);
+    zassert_false(commandable_command(&cmd, 17), NULL);
+    zassert_false(commandable_relinquish(&cmd, 0), NULL);
+    zassert_false(commandable_active(&cmd, 17), NULL);
+    /* the first command wins */
+    zassert_true(commandable_command(&cmd, 8), NULL);
+    zassert_equal(commandable_priority(&cmd), 8, NULL);
+    /* a lower priority does not */
+    zassert_false(commandable_command(&cmd, 16), NULL);
+    zassert_equal(commandable_priority(&cmd), 8, NULL);
+    /* writing the winner again updates the value */
+    zassert_true(commandable_command(&cmd, 8), NULL);
+    /* a higher priority takes over */
+    zassert_true(commandable_command(&cmd, 1), NULL);
+    zassert_equal(commandable_priority(&cmd), 1, NULL);
+    zassert_true(commandable_active(&cmd, 16), NULL);
+    zassert_false(commandable_active(&cmd, 2), NULL);
+    zassert_equal(commandable_next_priority(&cmd, 0), 1, NULL);
+    zassert_equal(commandable_next_priority(&cmd, 1), 8, NULL);
+    zassert_equal(commandable_next_priority(&cmd, 8), 16, NULL);
+    zassert_equal(commandable_next_priority(&cmd, 16), 0, NULL);
+    /* relinquishing a losing priority keeps the winner */
+    zassert_false(commandable_relinquish(&cmd, 8), NULL);
+    zassert_false(commandable_relinquish(&cmd, 8), NULL);
+    zassert_equal(commandable_priority(&cmd), 1, NULL);
+    /* relinquishing the winner falls back to the next one */
+    zassert_true(commandable_relinquish(&cmd, 1), NULL);
+    zassert_equal(commandable_priority(&cmd), 16, NULL);
+    zassert_true(commandable_relinquish(&cmd, 16), NULL);
+    zassert_equal(commandable_priority(&cmd), 0, NULL);
+    zassert_equal(cmd.active, 0, NULL);
+    /* against a linear scan */
+    srand(1);
+    for (priority = 0; priority < 1000; priority++) {
+        unsigned p = 1 + (unsigned)(rand() % 16);
+        unsigned expected = 0;
+        unsigned i;
+
+        if (rand() % 2) {
+            commandable_command(&cmd, p);
+        } else {
+            commandable_relinquish(&cmd, p);
+        }
+        for (i = 1; i <= 16; i++) {
+            if (commandable_active(&cmd, i)) {
+                expected = i;
+                break;
+            }
+        }
+        zassert_equal(commandable_priority(&cmd), expected, NULL);
+    }
+}
+
+/**
+ * @brief Test the REAL change of value detection
+ */
+static void test_commandable_cov_real(void)
+{
+    float prior_value = 0.0f;
+
+    zassert_false(commandable_cov_real(NULL, 1.0f, 1.0f), NULL);
+    zassert_false(commandable_cov_real(&prior_value, 0.5f, 1.0f), NULL);
+    zassert_true(commandable_cov_real(&prior_value, 1.0f, 1.0f), NULL);
+    zassert_false(islessgreater(prior_value, 1.0f), NULL);
+    zassert_false(commandable_cov_real(&prior_value, 0.25f, 1.0f), NULL);
+    zassert_true(commandable_cov_real(&prior_value, -0.5f, 1.0f), NULL);
+    zassert_false(islessgreater(prior_value, -0.5f), NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(commandable_tests,
+        ztest_unit_test(test_commandable_lowest_bit),
+        ztest_unit_test(test_commandable_priority),
+        ztest_unit_test(test_commandable_cov_real));
+
+    ztest_run_test_suite(commandable_tests);
+}
@@ -313,6 +313,63 @@ static void testKeyListLarge(void)
     return;
 }
 
+/* test the bulk add and the next empty key */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(keylist_tests, testKeyListBulkNextEmpty)
+#else
+static void testKeyListBulkNextEmpty(void)
+#endif
+{
+    KEY keys[1000] = { 0 };
+    int data_list[1000] = { 0 };
+    void *data[1000] = { 0 };
+    OS_Keylist list;
+    KEY key;
+    int i, count;
+
+    list = Keylist_Create();
+    zassert_not_null(list, NULL);
+    /* sorted keys 1..1000 except 500 and 501, and out of order 2000 */
+    for (i = 0, key = 1; i < 998; i++, key++) {
+        if (key == 500) {
+            key += 2;
+        }
+        keys[i] = key;
+        data_list[i] = i;
+        data[i] = &data_list[i];
+    }
+    keys[998] = 2000;
+    keys[999] = 0;
+    count = Keylist_Data_Add_Bulk(list, keys, data, 1000);
+    zassert_equal(count, 1000, NULL);
+    zassert_equal(Keylist_Count(list), 1000, NULL);
+    for (i = 1; i < Keylist_Count(list); i++) {
+        zassert_true(list->array[i - 1].key < list->array[i].key, NULL);
+    }
+    for (i = 0; i < 1000; i++) {
+        zassert_equal(Keylist_Data(list, keys[i]), data[i], NULL);
+    }
+    zassert_equal(Keylist_Next_Empty_Key(list, 0), 500, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 1), 500, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 501), 501, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 502), 1001, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 2000), 2001, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 3000), 3000, NULL);
+    /* duplicate keys take the key by key path */
+    zassert_equal(Keylist_Data_Add(list, 502, NULL), 500, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 1), 500, NULL);
+    zassert_equal(Keylist_Next_Empty_Key(list, 502), 1001, NULL);
+    /* shrink and grow */
+    while (Keylist_Count(list) > 1) {
+        (void)Keylist_Data_Pop(list);
+    }
+    zassert_true(list->size < 100, NULL);
+    zassert_equal(Keylist_Data_Add_Bulk(list, keys, NULL, 10), 10, NULL);
+    zassert_equal(Keylist_Count(list), 11, NULL);
+    zassert_equal(Keylist_Data_Add_Bulk(list, NULL, NULL, 10), 0, NULL);
+    Keylist_Delete(list);
+}
+
 /* test the encode and decode macros */
 #if defined(CONFIG_ZTEST_NEW_API)
 ZTEST(keylist_tests, testKeySample)
@@ -358,7 +415,9 @@ void test_main(void)
         keylist_tests, ztest_unit_test(testKeyListFIFO),
         ztest_unit_test(testKeyListFILO), ztest_unit_test(testKeyListDataKey),
         ztest_unit_test(testKeyListDataIndex),
-        ztest_unit_test(testKeyListLarge), ztest_unit_test(testKeySample));
+        ztest_unit_test(testKeyListLarge),
+        ztest_unit_test(testKeyListBulkNextEmpty),
+        ztest_unit_test(testKeySample));
 
     ztest_run_test_suite(keylist_tests);
 }
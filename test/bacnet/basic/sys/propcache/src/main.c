@@ -0,0 +1,248 @@
+/**
+ * @file
+ * @brief test cache of encoded property values
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/basic/sys/propcache.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+static const uint8_t Encoded_Value[] = { 0x44, 0x42, 0x28, 0x00, 0x00 };
+
+/**
+ * @brief Test storing and reading cached values
+ */
+static void test_propcache_read(void)
+{
+    uint8_t apdu[PROPCACHE_DATA_SIZE + 1] = { 0 };
+    int len;
+
+    propcache_clear();
+    /* only enabled object types are cached */
+    zassert_false(propcache_enabled(OBJECT_ANALOG_INPUT), NULL);
+    zassert_false(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL,
+            Encoded_Value, sizeof(Encoded_Value)),
+        NULL);
+    propcache_enable(OBJECT_ANALOG_INPUT, true);
+    zassert_true(propcache_enabled(OBJECT_ANALOG_INPUT), NULL);
+    zassert_false(propcache_enabled(OBJECT_BINARY_INPUT), NULL);
+    zassert_false(propcache_enabled(MAX_BACNET_OBJECT_TYPE), NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+        sizeof(apdu));
+    zassert_equal(len, 0, NULL);
+    zassert_true(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL,
+            Encoded_Value, sizeof(Encoded_Value)),
+        NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+        sizeof(apdu));
+    zassert_equal(len, sizeof(Encoded_Value), NULL);
+    zassert_equal(memcmp(apdu, Encoded_Value, sizeof(Encoded_Value)), 0, NULL);
+    /* the key is the whole property reference */
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, 1, apdu, sizeof(apdu)),
+        0, NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 2, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_UNITS, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+    /* the buffer is too small */
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+            sizeof(Encoded_Value) - 1),
+        0, NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, NULL,
+            sizeof(apdu)),
+        0, NULL);
+    /* values that are too large are not cached */
+    zassert_false(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_OBJECT_NAME, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        NULL);
+    zassert_false(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_OBJECT_NAME, BACNET_ARRAY_ALL, apdu,
+            0),
+        NULL);
+    /* disabling the object type drops its values */
+    propcache_enable(OBJECT_ANALOG_INPUT, false);
+    zassert_equal(
+        propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+}
+
+/**
+ * @brief Test dropping cached values when they change
+ */
+static void test_propcache_invalidate(void)
+{
+    uint8_t apdu[PROPCACHE_DATA_SIZE] = { 0 };
+    BACNET_ARRAY_INDEX array_index;
+    uint32_t instance;
+
+    propcache_clear();
+    propcache_enable(OBJECT_BINARY_INPUT, true);
+    for (instance = 1; instance <= 2; instance++) {
+        zassert_true(
+            propcache_store(
+                OBJECT_BINARY_INPUT, instance, PROP_PRESENT_VALUE,
+                BACNET_ARRAY_ALL, Encoded_Value, sizeof(Encoded_Value)),
+            NULL);
+        zassert_true(
+            propcache_store(
+                OBJECT_BINARY_INPUT, instance, PROP_STATUS_FLAGS,
+                BACNET_ARRAY_ALL, Encoded_Value, sizeof(Encoded_Value)),
+            NULL);
+    }
+    zassert_true(
+        propcache_store(
+            OBJECT_BINARY_INPUT, 1, PROP_PRIORITY_ARRAY, 1, Encoded_Value,
+            sizeof(Encoded_Value)),
+        NULL);
+    zassert_true(
+        propcache_store(
+            OBJECT_BINARY_INPUT, 1, PROP_PRIORITY_ARRAY, 2, Encoded_Value,
+            sizeof(Encoded_Value)),
+        NULL);
+    /* one property, every array index */
+    propcache_invalidate_property(OBJECT_BINARY_INPUT, 1, PROP_PRIORITY_ARRAY);
+    for (array_index = 1; array_index <= 2; array_index++) {
+        zassert_equal(
+            propcache_read(
+                OBJECT_BINARY_INPUT, 1, PROP_PRIORITY_ARRAY, array_index, apdu,
+                sizeof(apdu)),
+            0, NULL);
+    }
+    propcache_invalidate_property(OBJECT_BINARY_INPUT, 1, PROP_PRESENT_VALUE);
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 1, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 1, PROP_STATUS_FLAGS, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        sizeof(Encoded_Value), NULL);
+    /* every property of one object */
+    propcache_invalidate(OBJECT_BINARY_INPUT, 1);
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 1, PROP_STATUS_FLAGS, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 2, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        sizeof(Encoded_Value), NULL);
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 2, PROP_STATUS_FLAGS, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        sizeof(Encoded_Value), NULL);
+    propcache_clear();
+    zassert_equal(
+        propcache_read(
+            OBJECT_BINARY_INPUT, 2, PROP_STATUS_FLAGS, BACNET_ARRAY_ALL, apdu,
+            sizeof(apdu)),
+        0, NULL);
+    propcache_enable(OBJECT_BINARY_INPUT, false);
+}
+
+/**
+ * @brief Test replacing the values of an object when its set is full
+ */
+static void test_propcache_replace(void)
+{
+    uint8_t apdu[PROPCACHE_DATA_SIZE] = { 0 };
+    uint8_t value[2] = { 0x21, 0 };
+    BACNET_ARRAY_INDEX array_index;
+    int len;
+
+    propcache_clear();
+    propcache_enable(OBJECT_ANALOG_INPUT, true);
+    for (array_index = 1; array_index <= PROPCACHE_WAYS; array_index++) {
+        value[1] = (uint8_t)array_index;
+        zassert_true(
+            propcache_store(
+                OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, array_index,
+                value, sizeof(value)),
+            NULL);
+    }
+    /* a stored value replaces the same key */
+    value[1] = 0x55;
+    zassert_true(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, 1, value,
+            sizeof(value)),
+        NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, 1, apdu, sizeof(apdu));
+    zassert_equal(len, sizeof(value), NULL);
+    zassert_equal(apdu[1], 0x55, NULL);
+    for (array_index = 2; array_index <= PROPCACHE_WAYS; array_index++) {
+        len = propcache_read(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, array_index, apdu,
+            sizeof(apdu));
+        zassert_equal(len, sizeof(value), NULL);
+        zassert_equal(apdu[1], array_index, NULL);
+    }
+    /* a new key replaces the entries of the set in turn */
+    value[1] = 0xAA;
+    zassert_true(
+        propcache_store(
+            OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, PROPCACHE_WAYS + 1,
+            value, sizeof(value)),
+        NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, 1, apdu, sizeof(apdu));
+    zassert_equal(len, 0, NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, PROPCACHE_WAYS + 1, apdu,
+        sizeof(apdu));
+    zassert_equal(len, sizeof(value), NULL);
+    zassert_equal(apdu[1], 0xAA, NULL);
+    len = propcache_read(
+        OBJECT_ANALOG_INPUT, 1, PROP_PRIORITY_ARRAY, 2, apdu, sizeof(apdu));
+    zassert_equal(len, sizeof(value), NULL);
+    propcache_enable(OBJECT_ANALOG_INPUT, false);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(
+        propcache_tests, ztest_unit_test(test_propcache_read),
+        ztest_unit_test(test_propcache_invalidate),
+        ztest_unit_test(test_propcache_replace));
+
+    ztest_run_test_suite(propcache_tests);
+}
@@ -0,0 +1,217 @@
+/**
+ * @file
+ * @brief test hierarchical timer wheel
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <zephyr/ztest.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/sys/tmwheel.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+#define TEST_TIMERS_MAX 200
+
+static unsigned long Test_Now;
+static struct tmwheel_timer Test_Timer[TEST_TIMERS_MAX];
+static bool Test_Fired[TEST_TIMERS_MAX];
+static unsigned Test_Fired_Count;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
+static void timer_fired(struct tmwheel_timer *timer, void *context)
+{
+    unsigned index = (unsigned)(uintptr_t)context;
+
+    zassert_true(&Test_Timer[index] == timer, NULL);
+    /* never early */
+    zassert_true((long)(Test_Now - timer->expires) >= 0, NULL);
+    Test_Fired[index] = true;
+    Test_Fired_Count++;
+}
+
+static void timer_periodic(struct tmwheel_timer *timer, void *context)
+{
+    (void)context;
+    Test_Fired_Count++;
+    tmwheel_timer_reset(timer);
+}
+
+static void timer_cancel_next(struct tmwheel_timer *timer, void *context)
+{
+    (void)timer;
+    Test_Fired_Count++;
+    tmwheel_timer_cancel((struct tmwheel_timer *)context);
+}
+
+static void timers_init(void)
+{
+    unsigned i;
+
+    tmwheel_init();
+    for (i = 0; i < TEST_TIMERS_MAX; i++) {
+        tmwheel_timer_init(&Test_Timer[i], timer_fired, (void *)(uintptr_t)i);
+        Test_Fired[i] = false;
+    }
+    Test_Fired_Count = 0;
+}
+
+/**
+ * @brief Test arming, expiring and cancelling timers on each level
+ */
+static void test_tmwheel_basic(void)
+{
+    unsigned count;
+
+    Test_Now = 1000;
+    timers_init();
+    zassert_equal(tmwheel_next(1000), 1000, NULL);
+    zassert_equal(tmwheel_run(), 0, NULL);
+    tmwheel_timer_set(&Test_Timer[0], 10);
+    tmwheel_timer_set(&Test_Timer[1], 100);
+    tmwheel_timer_set(&Test_Timer[2], 5000);
+    tmwheel_timer_set(&Test_Timer[3], 10000000UL);
+    /* beyond the reach of the wheel */
+    tmwheel_timer_set(&Test_Timer[4], 100000000UL);
+    zassert_equal(tmwheel_count(), 5, NULL);
+    zassert_true(tmwheel_timer_pending(&Test_Timer[0]), NULL);
+    zassert_false(tmwheel_timer_pending(&Test_Timer[5]), NULL);
+    zassert_equal(tmwheel_timer_remaining(&Test_Timer[1]), 100, NULL);
+    zassert_equal(tmwheel_timer_interval(&Test_Timer[2]), 5000, NULL);
+    zassert_equal(tmwheel_next(1000), 10, NULL);
+    zassert_equal(tmwheel_next(5), 5, NULL);
+    Test_Now += 9;
+    zassert_equal(tmwheel_run(), 0, NULL);
+    zassert_equal(tmwheel_next(1000), 1, NULL);
+    Test_Now += 1;
+    zassert_equal(tmwheel_run(), 1, NULL);
+    zassert_true(Test_Fired[0], NULL);
+    zassert_false(tmwheel_timer_pending(&Test_Timer[0]), NULL);
+    zassert_equal(tmwheel_next(1000), 90, NULL);
+    zassert_equal(tmwheel_next(ULONG_MAX), 90, NULL);
+    /* moving an armed timer */
+    tmwheel_timer_set(&Test_Timer[1], 20);
+    zassert_equal(tmwheel_count(), 4, NULL);
+    zassert_equal(tmwheel_next(1000), 20, NULL);
+    Test_Now += 5000;
+    count = tmwheel_run();
+    zassert_equal(count, 2, NULL);
+    zassert_true(Test_Fired[1], NULL);
+    zassert_true(Test_Fired[2], NULL);
+    zassert_equal(tmwheel_next(ULONG_MAX), 10000000UL - 5000UL - 10UL, NULL);
+    tmwheel_timer_cancel(&Test_Timer[3]);
+    tmwheel_timer_cancel(&Test_Timer[3]);
+    zassert_equal(tmwheel_count(), 1, NULL);
+    zassert_equal(
+        tmwheel_next(ULONG_MAX), 100000000UL - 5000UL - 10UL, NULL);
+    Test_Now += 100000000UL - 5000UL - 11UL;
+    zassert_equal(tmwheel_run(), 0, NULL);
+    zassert_equal(tmwheel_next(ULONG_MAX), 1, NULL);
+    Test_Now += 1;
+    zassert_equal(tmwheel_run(), 1, NULL);
+    zassert_true(Test_Fired[4], NULL);
+    zassert_false(Test_Fired[3], NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+}
+
+/**
+ * @brief Test periodic timers and callbacks that change other timers
+ */
+static void test_tmwheel_callback(void)
+{
+    Test_Now = ULONG_MAX - 100UL;
+    timers_init();
+    /* drift free across a clock wrap, even when run late */
+    tmwheel_timer_init(&Test_Timer[0], timer_periodic, NULL);
+    tmwheel_timer_set(&Test_Timer[0], 50);
+    Test_Now += 1000;
+    zassert_equal(tmwheel_run(), 20, NULL);
+    zassert_equal(Test_Fired_Count, 20, NULL);
+    zassert_equal(tmwheel_next(1000), 50, NULL);
+    tmwheel_timer_cancel(&Test_Timer[0]);
+    /* a callback cancels a timer due on the same tick */
+    Test_Fired_Count = 0;
+    tmwheel_timer_init(&Test_Timer[1], timer_cancel_next, &Test_Timer[2]);
+    tmwheel_timer_init(&Test_Timer[2], timer_cancel_next, &Test_Timer[1]);
+    tmwheel_timer_set(&Test_Timer[1], 30);
+    tmwheel_timer_set(&Test_Timer[2], 30);
+    Test_Now += 30;
+    zassert_equal(tmwheel_run(), 1, NULL);
+    zassert_equal(Test_Fired_Count, 1, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+}
+
+/**
+ * @brief Test many timers against a brute force search
+ */
+static void test_tmwheel_random(void)
+{
+    unsigned long earliest;
+    bool pending;
+    unsigned i, step;
+
+    srand(1);
+    Test_Now = 12345;
+    timers_init();
+    for (i = 0; i < TEST_TIMERS_MAX; i++) {
+        /* mostly short, some long */
+        if (i % 4) {
+            tmwheel_timer_set(&Test_Timer[i], (unsigned long)(rand() % 5000));
+        } else {
+            tmwheel_timer_set(
+                &Test_Timer[i], (unsigned long)(rand() % 30000000));
+        }
+    }
+    for (step = 0; step < 2000; step++) {
+        earliest = ULONG_MAX;
+        pending = false;
+        for (i = 0; i < TEST_TIMERS_MAX; i++) {
+            if (!Test_Fired[i]) {
+                pending = true;
+                if ((Test_Timer[i].expires - Test_Now) < earliest) {
+                    earliest = Test_Timer[i].expires - Test_Now;
+                }
+            }
+        }
+        if (!pending) {
+            break;
+        }
+        zassert_equal(tmwheel_next(ULONG_MAX), earliest, NULL);
+        /* sometimes sleep exactly until the deadline */
+        if (step % 3) {
+            Test_Now += earliest;
+        } else {
+            Test_Now += (unsigned long)(rand() % 100000);
+        }
+        tmwheel_run();
+        for (i = 0; i < TEST_TIMERS_MAX; i++) {
+            if ((long)(Test_Now - Test_Timer[i].expires) >= 0) {
+                zassert_true(Test_Fired[i], NULL);
+            }
+        }
+    }
+    zassert_equal(Test_Fired_Count, TEST_TIMERS_MAX, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(tmwheel_tests, ztest_unit_test(test_tmwheel_basic),
+        ztest_unit_test(test_tmwheel_callback),
+        ztest_unit_test(test_tmwheel_random));
+
+    ztest_run_test_suite(tmwheel_tests);
+}
@@ -0,0 +1,367 @@
+/**
+ * @file
+ * @brief test BACnet Transaction State Machine with pooled PDU buffers
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <bacnet/apdu.h>
+#include <bacnet/bacaddr.h>
+#include <bacnet/basic/service/h_apdu.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/basic/sys/tmwheel.h>
+#include <bacnet/basic/tsm/tsm.h>
+#include <bacnet/datalink/datalink.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+static uint8_t *Sent_PDU;
+static unsigned Sent_PDU_Len;
+static unsigned Sent_Count;
+static uint16_t Learned_APDU_Len;
+static BACNET_TSM_PDU_STATUS Learned_Status;
+static unsigned Learned_Count;
+static BACNET_ADDRESS Complete_Dest;
+static uint8_t Complete_Invoke_ID;
+static BACNET_TSM_TRANSACTION_STATUS Complete_Status;
+static unsigned Complete_Count;
+/* stub clock */
+static unsigned long Milliseconds = 1000;
+
+unsigned long mstimer_now(void)
+{
+    return Milliseconds;
+}
+
+int datalink_send_pdu(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    (void)dest;
+    (void)npdu_data;
+    Sent_PDU = pdu;
+    Sent_PDU_Len = pdu_len;
+    Sent_Count++;
+
+    return (int)pdu_len;
+}
+
+static void max_apdu_learn(
+    BACNET_ADDRESS *dest, uint16_t apdu_len, BACNET_TSM_PDU_STATUS status)
+{
+    (void)dest;
+    Learned_APDU_Len = apdu_len;
+    Learned_Status = status;
+    Learned_Count++;
+}
+
+static void tsm_complete(BACNET_ADDRESS *dest,
+    uint8_t invoke_id,
+    BACNET_TSM_TRANSACTION_STATUS status)
+{
+    bacnet_address_copy(&Complete_Dest, dest);
+    Complete_Invoke_ID = invoke_id;
+    Complete_Status = status;
+    Complete_Count++;
+}
+
+/**
+ * @brief Test a request encoded into its TSM buffer is sent again
+ *  from that buffer
+ */
+static void test_tsm_pdu_buffer(void)
+{
+    BACNET_ADDRESS dest = { 0 }, test_dest = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 }, test_npdu_data = { 0 };
+    uint8_t pdu[600] = { 0 }, test_pdu[MAX_PDU] = { 0 };
+    uint16_t test_pdu_len = 0;
+    uint8_t *buffer;
+    uint8_t invoke_id;
+
+    dest.mac_len = 1;
+    dest.mac[0] = 42;
+    npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
+    invoke_id = tsm_next_free_invokeID();
+    zassert_not_equal(invoke_id, 0, NULL);
+    zassert_is_null(tsm_transaction_pdu_buffer(0, 20), NULL);
+    zassert_is_null(tsm_transaction_pdu_buffer(invoke_id, 0), NULL);
+    buffer = tsm_transaction_pdu_buffer(invoke_id, 20);
+    zassert_not_null(buffer, NULL);
+    memset(buffer, 0xA5, 20);
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, buffer, 20);
+    zassert_true(tsm_get_transaction_pdu(invoke_id, &test_dest,
+                     &test_npdu_data, test_pdu, &test_pdu_len),
+        NULL);
+    zassert_equal(test_pdu_len, 20, NULL);
+    zassert_equal(memcmp(test_pdu, buffer, 20), 0, NULL);
+    zassert_equal(test_dest.mac[0], 42, NULL);
+    /* the retry is sent from the same buffer */
+    Sent_Count = 0;
+    tsm_timer_milliseconds(apdu_timeout());
+    zassert_equal(Sent_Count, 1, NULL);
+    zassert_equal(Sent_PDU, buffer, NULL);
+    zassert_equal(Sent_PDU_Len, 20, NULL);
+    tsm_free_invoke_id(invoke_id);
+    zassert_true(tsm_invoke_id_free(invoke_id), NULL);
+    /* a request from another buffer is copied into the pool */
+    invoke_id = tsm_next_free_invokeID();
+    memset(pdu, 0x5A, sizeof(pdu));
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, pdu, sizeof(pdu));
+    Sent_Count = 0;
+    tsm_timer_milliseconds(apdu_timeout());
+    zassert_equal(Sent_Count, 1, NULL);
+    zassert_not_equal(Sent_PDU, pdu, NULL);
+    zassert_equal(Sent_PDU_Len, sizeof(pdu), NULL);
+    zassert_equal(memcmp(Sent_PDU, pdu, sizeof(pdu)), 0, NULL);
+    tsm_free_invoke_id(invoke_id);
+}
+
+/**
+ * @brief Test the transactions when the pool has no buffer that fits
+ */
+static void test_tsm_pool_exhausted(void)
+{
+    BACNET_ADDRESS dest = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[600] = { 0 }, test_pdu[MAX_PDU] = { 0 };
+    uint16_t test_pdu_len = 0;
+    uint8_t invoke_id[3];
+    unsigned i;
+
+    npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
+    /* one medium and one large buffer can hold a large request */
+    for (i = 0; i < 3; i++) {
+        invoke_id[i] = tsm_next_free_invokeID();
+        zassert_not_equal(invoke_id[i], 0, NULL);
+    }
+    zassert_true(tsm_set_confirmed_unsegmented_transaction(
+                     invoke_id[0], &dest, &npdu_data, pdu, 400),
+        NULL);
+    zassert_true(tsm_set_confirmed_unsegmented_transaction(
+                     invoke_id[1], &dest, &npdu_data, pdu, 400),
+        NULL);
+    zassert_is_null(tsm_transaction_pdu_buffer(invoke_id[2], 400), NULL);
+    /* the transaction without a buffer fails, and its invoke ID is free */
+    zassert_false(tsm_set_confirmed_unsegmented_transaction(
+                      invoke_id[2], &dest, &npdu_data, pdu, 400),
+        NULL);
+    zassert_true(tsm_invoke_id_free(invoke_id[2]), NULL);
+    zassert_false(tsm_invoke_id_failed(invoke_id[2]), NULL);
+    zassert_true(tsm_get_transaction_pdu(
+                     invoke_id[0], &dest, &npdu_data, test_pdu, &test_pdu_len),
+        NULL);
+    zassert_true(tsm_get_transaction_pdu(
+                     invoke_id[1], &dest, &npdu_data, test_pdu, &test_pdu_len),
+        NULL);
+    zassert_false(tsm_get_transaction_pdu(
+                      invoke_id[2], &dest, &npdu_data, test_pdu, &test_pdu_len),
+        NULL);
+    /* only the transactions with a buffer are sent again */
+    Sent_Count = 0;
+    tsm_timer_milliseconds(apdu_timeout());
+    zassert_equal(Sent_Count, 2, NULL);
+    /* freeing a transaction returns its buffer */
+    tsm_free_invoke_id(invoke_id[0]);
+    invoke_id[2] = tsm_next_free_invokeID();
+    zassert_true(tsm_set_confirmed_unsegmented_transaction(
+                     invoke_id[2], &dest, &npdu_data, pdu, 400),
+        NULL);
+    tsm_free_invoke_id(invoke_id[1]);
+    tsm_free_invoke_id(invoke_id[2]);
+    /* small requests still fit */
+    for (i = 0; i < 3; i++) {
+        invoke_id[i] = tsm_next_free_invokeID();
+        zassert_not_null(tsm_transaction_pdu_buffer(invoke_id[i], 40), NULL);
+    }
+    for (i = 0; i < 3; i++) {
+        tsm_free_invoke_id(invoke_id[i]);
+    }
+}
+
+/**
+ * @brief Test the APDU size and outcome of requests are reported
+ */
+static void test_tsm_max_apdu(void)
+{
+    BACNET_ADDRESS dest = { 0 }, src = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[300] = { 0 };
+    uint8_t invoke_id[2];
+    int npdu_len;
+    unsigned i;
+
+    dest.mac_len = 1;
+    dest.mac[0] = 7;
+    dest.net = 5;
+    dest.len = 1;
+    dest.adr[0] = 9;
+    npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
+    /* the NPDU header to a remote network is not part of the APDU */
+    npdu_len = npdu_encode_pdu(pdu, &dest, NULL, &npdu_data);
+    zassert_true(npdu_len > 2, NULL);
+    tsm_set_max_apdu_handler(max_apdu_learn);
+    /* a reply from the destination */
+    invoke_id[0] = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id[0], &dest, &npdu_data, pdu, 100);
+    Learned_Count = 0;
+    tsm_transaction_reply(&dest, invoke_id[0], TSM_TRANSACTION_ACK);
+    zassert_equal(Learned_Count, 1, NULL);
+    zassert_equal(Learned_APDU_Len, 100 - npdu_len, NULL);
+    zassert_equal(Learned_Status, TSM_PDU_DELIVERED, NULL);
+    /* not from the destination */
+    tsm_transaction_reply(&src, invoke_id[0], TSM_TRANSACTION_TOO_LONG);
+    zassert_equal(Learned_Count, 1, NULL);
+    tsm_transaction_reply(&dest, invoke_id[0], TSM_TRANSACTION_TOO_LONG);
+    zassert_equal(Learned_Status, TSM_PDU_TOO_LONG, NULL);
+    tsm_free_invoke_id(invoke_id[0]);
+    /* the largest request to the network is rejected by a router */
+    invoke_id[0] = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id[0], &dest, &npdu_data, pdu, 100);
+    invoke_id[1] = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id[1], &dest, &npdu_data, pdu, sizeof(pdu));
+    Learned_Count = 0;
+    tsm_network_too_long(6);
+    zassert_equal(Learned_Count, 0, NULL);
+    tsm_network_too_long(5);
+    zassert_equal(Learned_Count, 1, NULL);
+    zassert_equal(Learned_APDU_Len, sizeof(pdu) - npdu_len, NULL);
+    zassert_equal(Learned_Status, TSM_PDU_TOO_LONG, NULL);
+    /* no reply after all the retries */
+    Learned_Count = 0;
+    for (i = 0; i <= apdu_retries(); i++) {
+        tsm_timer_milliseconds(apdu_timeout());
+    }
+    zassert_equal(Learned_Count, 2, NULL);
+    zassert_equal(Learned_Status, TSM_PDU_TIMEOUT, NULL);
+    zassert_true(tsm_invoke_id_failed(invoke_id[0]), NULL);
+    tsm_free_invoke_id(invoke_id[0]);
+    tsm_free_invoke_id(invoke_id[1]);
+    tsm_set_max_apdu_handler(NULL);
+}
+
+/**
+ * @brief Test the end of each request is reported once, with the
+ *  address the request was sent to
+ */
+static void test_tsm_complete(void)
+{
+    static BACNET_TSM_COMPLETE_NOTIFICATION notification = {
+        .callback = tsm_complete
+    };
+    BACNET_ADDRESS dest = { 0 }, src = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[20] = { 0 };
+    uint8_t invoke_id;
+    unsigned i;
+
+    dest.mac_len = 1;
+    dest.mac[0] = 3;
+    src.mac_len = 1;
+    src.mac[0] = 4;
+    npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
+    tsm_complete_notification_add(&notification);
+    tsm_complete_notification_add(&notification);
+    /* a reply */
+    invoke_id = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, pdu, sizeof(pdu));
+    Complete_Count = 0;
+    tsm_transaction_reply(&src, invoke_id, TSM_TRANSACTION_ERROR);
+    zassert_equal(Complete_Count, 1, NULL);
+    zassert_equal(Complete_Invoke_ID, invoke_id, NULL);
+    zassert_equal(Complete_Status, TSM_TRANSACTION_ERROR, NULL);
+    zassert_true(bacnet_address_same(&Complete_Dest, &dest), NULL);
+    tsm_free_invoke_id(invoke_id);
+    /* a reply to a free invoke ID */
+    tsm_transaction_reply(&dest, invoke_id, TSM_TRANSACTION_ACK);
+    tsm_transaction_reply(&dest, 0, TSM_TRANSACTION_ACK);
+    zassert_equal(Complete_Count, 1, NULL);
+    /* no reply after all the retries, and then a late reply */
+    invoke_id = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, pdu, sizeof(pdu));
+    Complete_Count = 0;
+    for (i = 0; i <= apdu_retries(); i++) {
+        tsm_timer_milliseconds(apdu_timeout());
+    }
+    zassert_equal(Complete_Count, 1, NULL);
+    zassert_equal(Complete_Invoke_ID, invoke_id, NULL);
+    zassert_equal(Complete_Status, TSM_TRANSACTION_TIMEOUT, NULL);
+    zassert_true(tsm_invoke_id_failed(invoke_id), NULL);
+    tsm_transaction_reply(&dest, invoke_id, TSM_TRANSACTION_ACK);
+    zassert_equal(Complete_Count, 1, NULL);
+    tsm_free_invoke_id(invoke_id);
+}
+
+/**
+ * @brief Test requests are sent again and fail from the timer wheel
+ */
+static void test_tsm_timer_wheel(void)
+{
+    BACNET_ADDRESS dest = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[20] = { 0 };
+    uint8_t invoke_id;
+    unsigned i;
+
+    npdu_encode_npdu_data(&npdu_data, true, MESSAGE_PRIORITY_NORMAL);
+    invoke_id = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, pdu, sizeof(pdu));
+    Sent_Count = 0;
+    Milliseconds += apdu_timeout() - 1;
+    tmwheel_run();
+    zassert_equal(Sent_Count, 0, NULL);
+    Milliseconds += 1;
+    tmwheel_run();
+    zassert_equal(Sent_Count, 1, NULL);
+    /* the same time seen by both timers is one retry */
+    Milliseconds += apdu_timeout();
+    tsm_timer_milliseconds(apdu_timeout());
+    tmwheel_run();
+    zassert_equal(Sent_Count, 2, NULL);
+    /* no reply after all the retries */
+    for (i = 2; i <= apdu_retries(); i++) {
+        Milliseconds += apdu_timeout();
+        tmwheel_run();
+    }
+    zassert_equal(Sent_Count, apdu_retries(), NULL);
+    zassert_true(tsm_invoke_id_failed(invoke_id), NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+    tsm_free_invoke_id(invoke_id);
+    /* a freed transaction is not sent again */
+    invoke_id = tsm_next_free_invokeID();
+    tsm_set_confirmed_unsegmented_transaction(
+        invoke_id, &dest, &npdu_data, pdu, sizeof(pdu));
+    tsm_free_invoke_id(invoke_id);
+    Sent_Count = 0;
+    Milliseconds += apdu_timeout();
+    tmwheel_run();
+    zassert_equal(Sent_Count, 0, NULL);
+    zassert_equal(tmwheel_count(), 0, NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(tsm_tests, ztest_unit_test(test_tsm_pdu_buffer),
+        ztest_unit_test(test_tsm_pool_exhausted),
+        ztest_unit_test(test_tsm_max_apdu),
+        ztest_unit_test(test_tsm_complete),
+        ztest_unit_test(test_tsm_timer_wheel));
+
+    ztest_run_test_suite(tsm_tests);
+}
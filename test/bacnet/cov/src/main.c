@@ -246,6 +246,68 @@ static void testCOVNotify(void)
     testCCOVNotifyData(invoke_id, &data);
 }
 
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(cov_tests, testCOVNotifyFind)
+#else
+static void testCOVNotifyFind(void)
+#endif
+{
+    uint8_t apdu[480] = { 0 };
+    int apdu_len = 0, len = 0, value_len = 0;
+    BACNET_COV_DATA data = { 0 };
+    BACNET_PROPERTY_VALUE value_list[3] = { { 0 } };
+    BACNET_APPLICATION_DATA_VALUE value = { 0 };
+
+    data.subscriberProcessIdentifier = 1;
+    data.initiatingDeviceIdentifier = 123;
+    data.monitoredObjectIdentifier.type = OBJECT_ANALOG_OUTPUT;
+    data.monitoredObjectIdentifier.instance = 321;
+    data.timeRemaining = 456;
+    cov_data_value_list_link(&data, &value_list[0], 3);
+    value_list[0].propertyIdentifier = PROP_PRIORITY_ARRAY;
+    value_list[0].propertyArrayIndex = 8;
+    bacapp_parse_application_data(
+        BACNET_APPLICATION_TAG_REAL, "42.0", &value_list[0].value);
+    value_list[0].priority = 8;
+    value_list[1].propertyIdentifier = PROP_PRESENT_VALUE;
+    value_list[1].propertyArrayIndex = BACNET_ARRAY_ALL;
+    bacapp_parse_application_data(
+        BACNET_APPLICATION_TAG_REAL, "21.0", &value_list[1].value);
+    value_list[1].priority = BACNET_NO_PRIORITY;
+    value_list[2].propertyIdentifier = PROP_STATUS_FLAGS;
+    value_list[2].propertyArrayIndex = BACNET_ARRAY_ALL;
+    bacapp_parse_application_data(
+        BACNET_APPLICATION_TAG_BIT_STRING, "0100", &value_list[2].value);
+    value_list[2].priority = BACNET_NO_PRIORITY;
+    apdu_len = cov_notify_encode_apdu(&apdu[0], &data);
+    zassert_true(apdu_len > 0, NULL);
+
+    len = cov_notify_property_value_find(
+        apdu, apdu_len, PROP_STATUS_FLAGS, BACNET_ARRAY_ALL, &value_len);
+    zassert_true(len > 0, NULL);
+    zassert_equal(
+        bacapp_decode_application_data(&apdu[len], value_len, &value),
+        value_len, NULL);
+    zassert_true(bacapp_same_value(&value_list[2].value, &value), NULL);
+    len = cov_notify_property_value_find(
+        apdu, apdu_len, PROP_PRIORITY_ARRAY, 8, &value_len);
+    zassert_true(len > 0, NULL);
+    zassert_equal(
+        bacapp_decode_application_data(&apdu[len], value_len, &value),
+        value_len, NULL);
+    zassert_true(bacapp_same_value(&value_list[0].value, &value), NULL);
+    len = cov_notify_property_value_find(
+        apdu, apdu_len, PROP_PRIORITY_ARRAY, 9, &value_len);
+    zassert_equal(len, 0, NULL);
+    len = cov_notify_property_value_find(
+        apdu, apdu_len, PROP_OUT_OF_SERVICE, BACNET_ARRAY_ALL, &value_len);
+    zassert_equal(len, 0, NULL);
+    /* truncated */
+    len = cov_notify_property_value_find(
+        apdu, apdu_len - 1, PROP_OUT_OF_SERVICE, BACNET_ARRAY_ALL, NULL);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+}
+
 static void testCOVSubscribeData(
     BACNET_SUBSCRIBE_COV_DATA *data, BACNET_SUBSCRIBE_COV_DATA *test_data)
 {
@@ -391,6 +453,7 @@ void test_main(void)
 {
     ztest_test_suite(
         cov_tests, ztest_unit_test(testCOVNotify),
+        ztest_unit_test(testCOVNotifyFind),
         ztest_unit_test(testCOVSubscribe),
         ztest_unit_test(testCOVSubscribeProperty));
 
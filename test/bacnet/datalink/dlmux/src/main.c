@@ -0,0 +1,211 @@
+/**
+ * @file
+ * @brief test BACnet datalink multiplexer
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <fcntl.h>
+#include <unistd.h>
+#include <zephyr/ztest.h>
+#include <bacnet/datalink/dlmux.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+/* each fake datalink reads one byte NPDUs from a pipe */
+static int Pipe_A[2] = { -1, -1 };
+static int Pipe_B[2] = { -1, -1 };
+static unsigned Polled_Pending;
+static unsigned Handled_Count;
+static uint16_t Handled_Net[16];
+static uint8_t Handled_Byte[16];
+static unsigned Send_Count_A;
+static unsigned Send_Count_B;
+
+static uint16_t pipe_receive(
+    int fd, BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu)
+{
+    (void)src;
+    if ((max_pdu > 0) && (read(fd, pdu, 1) == 1)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+static uint16_t receive_a(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout)
+{
+    (void)timeout;
+    return pipe_receive(Pipe_A[0], src, pdu, max_pdu);
+}
+
+static uint16_t receive_b(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout)
+{
+    (void)timeout;
+    return pipe_receive(Pipe_B[0], src, pdu, max_pdu);
+}
+
+static uint16_t receive_polled(
+    BACNET_ADDRESS *src, uint8_t *pdu, uint16_t max_pdu, unsigned timeout)
+{
+    (void)src;
+    (void)max_pdu;
+    (void)timeout;
+    if (Polled_Pending) {
+        Polled_Pending--;
+        pdu[0] = 0xCC;
+        return 1;
+    }
+
+    return 0;
+}
+
+static int send_a(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    (void)dest;
+    (void)npdu_data;
+    (void)pdu;
+    Send_Count_A++;
+    return (int)pdu_len;
+}
+
+static int send_b(BACNET_ADDRESS *dest,
+    BACNET_NPDU_DATA *npdu_data,
+    uint8_t *pdu,
+    unsigned pdu_len)
+{
+    (void)dest;
+    (void)npdu_data;
+    (void)pdu;
+    Send_Count_B++;
+    return (int)pdu_len;
+}
+
+static void npdu_handler(
+    uint16_t snet, BACNET_ADDRESS *src, uint8_t *pdu, uint16_t pdu_len)
+{
+    (void)src;
+    zassert_equal(pdu_len, 1, NULL);
+    if (Handled_Count < sizeof(Handled_Net) / sizeof(Handled_Net[0])) {
+        Handled_Net[Handled_Count] = snet;
+        Handled_Byte[Handled_Count] = pdu[0];
+    }
+    Handled_Count++;
+}
+
+static void pipe_open(int fds[2])
+{
+    zassert_equal(pipe(fds), 0, NULL);
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+}
+
+static void pipe_write(int fd, uint8_t value)
+{
+    zassert_equal(write(fd, &value, 1), 1, NULL);
+}
+
+/**
+ * @brief Test receiving from several datalinks with one wait
+ */
+static void test_dlmux_receive(void)
+{
+    BACNET_ADDRESS dest = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[4] = { 0 };
+    unsigned i;
+    int count;
+
+    pipe_open(Pipe_A);
+    pipe_open(Pipe_B);
+    zassert_false(dlmux_port_add(1, receive_a, send_a, Pipe_A[0], -1), NULL);
+    zassert_true(dlmux_init(npdu_handler), NULL);
+    zassert_true(dlmux_port_add(1, receive_a, send_a, Pipe_A[0], -1), NULL);
+    /* duplicate and reserved network numbers are refused */
+    zassert_false(dlmux_port_add(1, receive_b, send_b, Pipe_B[0], -1), NULL);
+    zassert_false(dlmux_port_add(0, receive_b, send_b, Pipe_B[0], -1), NULL);
+    zassert_false(
+        dlmux_port_add(BACNET_BROADCAST_NETWORK, receive_b, send_b, -1, -1),
+        NULL);
+    /* the same descriptor twice is accepted */
+    zassert_true(
+        dlmux_port_add(2, receive_b, send_b, Pipe_B[0], Pipe_B[0]), NULL);
+    zassert_equal(dlmux_port_count(), 2, NULL);
+    zassert_equal(dlmux_port_net(0), 1, NULL);
+    zassert_equal(dlmux_port_net(1), 2, NULL);
+    zassert_equal(dlmux_port_net(2), 0, NULL);
+    /* nothing pending */
+    Handled_Count = 0;
+    count = dlmux_task(0);
+    zassert_equal(count, 0, NULL);
+    /* one wait services both ports */
+    pipe_write(Pipe_A[1], 0xAA);
+    pipe_write(Pipe_B[1], 0xBB);
+    pipe_write(Pipe_B[1], 0xBD);
+    count = dlmux_task(100);
+    zassert_equal(count, 3, NULL);
+    zassert_equal(Handled_Count, 3, NULL);
+    for (i = 0; i < Handled_Count; i++) {
+        if (Handled_Byte[i] == 0xAA) {
+            zassert_equal(Handled_Net[i], 1, NULL);
+        } else {
+            zassert_equal(Handled_Net[i], 2, NULL);
+        }
+    }
+    /* a busy port is drained a burst at a time */
+    Handled_Count = 0;
+    for (i = 0; i < DLMUX_RECEIVE_BURST + 2; i++) {
+        pipe_write(Pipe_A[1], (uint8_t)i);
+    }
+    count = dlmux_task(100);
+    zassert_equal(count, DLMUX_RECEIVE_BURST, NULL);
+    count = dlmux_task(100);
+    zassert_equal(count, 2, NULL);
+    /* a port without a descriptor is polled */
+    zassert_true(dlmux_port_add(3, receive_polled, NULL, -1, -1), NULL);
+    Handled_Count = 0;
+    Polled_Pending = 1;
+    count = dlmux_task(1000);
+    zassert_equal(count, 1, NULL);
+    zassert_equal(Handled_Net[0], 3, NULL);
+    zassert_equal(Handled_Byte[0], 0xCC, NULL);
+    /* send to one network, or to all of them */
+    zassert_equal(
+        dlmux_send_pdu(2, &dest, &npdu_data, pdu, sizeof(pdu)), sizeof(pdu),
+        NULL);
+    zassert_equal(Send_Count_A, 0, NULL);
+    zassert_equal(Send_Count_B, 1, NULL);
+    zassert_equal(
+        dlmux_send_pdu(0, &dest, &npdu_data, pdu, sizeof(pdu)), sizeof(pdu),
+        NULL);
+    zassert_equal(Send_Count_A, 1, NULL);
+    zassert_equal(Send_Count_B, 2, NULL);
+    zassert_equal(
+        dlmux_send_pdu(3, &dest, &npdu_data, pdu, sizeof(pdu)), -1, NULL);
+    zassert_equal(
+        dlmux_send_pdu(9, &dest, &npdu_data, pdu, sizeof(pdu)), -1, NULL);
+    dlmux_cleanup();
+    zassert_equal(dlmux_port_count(), 0, NULL);
+    zassert_equal(dlmux_task(0), -1, NULL);
+    close(Pipe_A[0]);
+    close(Pipe_A[1]);
+    close(Pipe_B[0]);
+    close(Pipe_B[1]);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(dlmux_tests, ztest_unit_test(test_dlmux_receive));
+
+    ztest_run_test_suite(dlmux_tests);
+}
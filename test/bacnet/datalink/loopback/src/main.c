@@ -0,0 +1,205 @@
+/**
+ * @file
+ * @brief test BACnet in-memory loopback datalink
+ * @date 2026
+ *
+ * SPDX-License-Identifier: MIT
+ */
+#include <zephyr/ztest.h>
+#include <bacnet/basic/sys/mstimer.h>
+#include <bacnet/datalink/datalink.h>
+#include <bacnet/datalink/loopback.h>
+
+/**
+ * @addtogroup bacnet_tests
+ * @{
+ */
+
+static unsigned long Test_Now;
+
+/* the time base is under test control */
+unsigned long mstimer_now(void)
+{
+    return Test_Now;
+}
+
+/**
+ * @brief Test unicast and broadcast between virtual ports
+ */
+static void test_loopback_ports(void)
+{
+    BACNET_ADDRESS dest = { 0 }, src = { 0 }, my_address = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t rx[MAX_PDU] = { 0 };
+    uint16_t len;
+    unsigned i;
+
+    Test_Now = 0;
+    loopback_cleanup();
+    /* nothing selected */
+    zassert_equal(
+        loopback_send_pdu(&dest, &npdu_data, pdu, sizeof(pdu)), -1, NULL);
+    zassert_false(loopback_init("0"), NULL);
+    zassert_false(loopback_init("99"), NULL);
+    zassert_true(loopback_init("3"), NULL);
+    zassert_true(loopback_init("2"), NULL);
+    zassert_true(loopback_init(NULL), NULL);
+    zassert_equal(loopback_port_selected(), 1, NULL);
+    loopback_get_my_address(&my_address);
+    zassert_equal(my_address.mac_len, 1, NULL);
+    zassert_equal(my_address.mac[0], 1, NULL);
+    /* unicast from 1 to 2 */
+    dest.mac_len = 1;
+    dest.mac[0] = 2;
+    zassert_equal(loopback_send_pdu(&dest, &npdu_data, pdu, sizeof(pdu)),
+        sizeof(pdu), NULL);
+    zassert_equal(loopback_port_pending(2), 1, NULL);
+    zassert_equal(loopback_port_pending(3), 0, NULL);
+    /* broadcast from 1 reaches the other ports */
+    loopback_get_broadcast_address(&dest);
+    zassert_equal(loopback_send_pdu(&dest, &npdu_data, pdu, 4), 4, NULL);
+    zassert_equal(loopback_port_pending(1), 0, NULL);
+    zassert_equal(loopback_port_pending(2), 2, NULL);
+    zassert_equal(loopback_port_pending(3), 1, NULL);
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 0, NULL);
+    zassert_true(loopback_port_select(2), NULL);
+    len = loopback_receive(&src, rx, sizeof(rx), 0);
+    zassert_equal(len, sizeof(pdu), NULL);
+    zassert_mem_equal(rx, pdu, sizeof(pdu), NULL);
+    zassert_equal(src.mac_len, 1, NULL);
+    zassert_equal(src.mac[0], 1, NULL);
+    zassert_equal(src.net, 0, NULL);
+    len = loopback_receive(&src, rx, sizeof(rx), 0);
+    zassert_equal(len, 4, NULL);
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 0, NULL);
+    /* a full queue drops frames */
+    zassert_true(loopback_port_select(1), NULL);
+    dest.net = 0;
+    dest.mac_len = 1;
+    dest.mac[0] = 3;
+    for (i = 0; i < LOOPBACK_FRAMES_MAX + 2; i++) {
+        loopback_send_pdu(&dest, &npdu_data, pdu, sizeof(pdu));
+    }
+    zassert_equal(loopback_port_pending(3), LOOPBACK_FRAMES_MAX, NULL);
+    /* one frame was already queued by the broadcast */
+    zassert_equal(loopback_dropped_count(), 3, NULL);
+    /* a closed port is deselected and drops frames */
+    loopback_port_close(1);
+    zassert_equal(loopback_port_selected(), 0, NULL);
+    zassert_false(loopback_port_select(1), NULL);
+    zassert_true(loopback_port_select(2), NULL);
+    dest.mac[0] = 1;
+    loopback_send_pdu(&dest, &npdu_data, pdu, sizeof(pdu));
+    zassert_equal(loopback_dropped_count(), 4, NULL);
+    loopback_cleanup();
+    zassert_equal(loopback_port_pending(3), 0, NULL);
+}
+
+/**
+ * @brief Test latency, loss, and MTU
+ */
+static void test_loopback_conditions(void)
+{
+    BACNET_ADDRESS dest = { 0 }, src = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[MAX_PDU] = { 0 };
+    uint8_t rx[MAX_PDU] = { 0 };
+    unsigned i, received, first_received;
+
+    Test_Now = 1000;
+    loopback_cleanup();
+    zassert_true(loopback_init("2"), NULL);
+    zassert_true(loopback_init("1"), NULL);
+    dest.mac_len = 1;
+    dest.mac[0] = 2;
+    /* latency */
+    loopback_latency_set(10);
+    loopback_send_pdu(&dest, &npdu_data, pdu, 10);
+    Test_Now += 5;
+    loopback_send_pdu(&dest, &npdu_data, pdu, 20);
+    loopback_port_select(2);
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 0, NULL);
+    Test_Now += 5;
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 10, NULL);
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 0, NULL);
+    Test_Now += 5;
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), 20, NULL);
+    loopback_latency_set(0);
+    /* MTU */
+    loopback_port_select(1);
+    loopback_mtu_set(50);
+    zassert_equal(loopback_send_pdu(&dest, &npdu_data, pdu, 51), -1, NULL);
+    zassert_equal(loopback_send_pdu(&dest, &npdu_data, pdu, 50), 50, NULL);
+    loopback_mtu_set(UINT16_MAX);
+    zassert_equal(loopback_send_pdu(&dest, &npdu_data, pdu, MAX_PDU),
+        MAX_PDU, NULL);
+    /* a frame too big for the receive buffer is dropped */
+    loopback_port_select(2);
+    zassert_equal(loopback_receive(&src, rx, 10, 0), 0, NULL);
+    zassert_equal(loopback_port_pending(2), 1, NULL);
+    zassert_equal(loopback_receive(&src, rx, sizeof(rx), 0), MAX_PDU, NULL);
+    /* loss is repeatable for a seed */
+    first_received = 0;
+    for (i = 0; i < 2; i++) {
+        unsigned n;
+
+        loopback_loss_set(50, 12345);
+        received = 0;
+        for (n = 0; n < 200; n++) {
+            loopback_port_select(1);
+            loopback_send_pdu(&dest, &npdu_data, pdu, 1);
+            loopback_port_select(2);
+            if (loopback_receive(&src, rx, sizeof(rx), 0)) {
+                received++;
+            }
+        }
+        zassert_true(received > 50, NULL);
+        zassert_true(received < 150, NULL);
+        if (i == 0) {
+            first_received = received;
+        } else {
+            zassert_equal(received, first_received, NULL);
+        }
+    }
+    loopback_loss_set(100, 1);
+    loopback_port_select(1);
+    loopback_send_pdu(&dest, &npdu_data, pdu, 1);
+    zassert_equal(loopback_port_pending(2), 0, NULL);
+    loopback_cleanup();
+}
+
+/**
+ * @brief Test the datalink functions bound to the loopback datalink
+ */
+static void test_loopback_datalink(void)
+{
+    BACNET_ADDRESS dest = { 0 }, src = { 0 };
+    BACNET_NPDU_DATA npdu_data = { 0 };
+    uint8_t pdu[4] = { 0xAA, 0xBB, 0xCC, 0xDD };
+    uint8_t rx[MAX_PDU] = { 0 };
+
+    zassert_true(datalink_init("5"), NULL);
+    zassert_true(datalink_init("4"), NULL);
+    datalink_get_broadcast_address(&dest);
+    zassert_equal(datalink_send_pdu(&dest, &npdu_data, pdu, sizeof(pdu)),
+        sizeof(pdu), NULL);
+    loopback_port_select(5);
+    zassert_equal(
+        datalink_receive(&src, rx, sizeof(rx), 0), sizeof(pdu), NULL);
+    zassert_equal(src.mac[0], 4, NULL);
+    datalink_cleanup();
+    zassert_equal(loopback_port_selected(), 0, NULL);
+}
+
+/**
+ * @}
+ */
+void test_main(void)
+{
+    ztest_test_suite(loopback_tests, ztest_unit_test(test_loopback_ports),
+        ztest_unit_test(test_loopback_conditions),
+        ztest_unit_test(test_loopback_datalink));
+
+    ztest_run_test_suite(loopback_tests);
+}
@@ -38,3 +38,8 @@ int bip_send_pdu(
 {
     return 0;
 }
+
+unsigned long mstimer_now(void)
+{
+    return 0;
+}
@@ -6,6 +6,7 @@
  *
  * SPDX-License-Identifier: MIT
  */
+#include <string.h>
 #include <zephyr/ztest.h>
 #include <bacnet/property.h>
 
@@ -85,6 +86,75 @@ void testPropList(void)
     zassert_true(count > 0, NULL);
 }
 
+/**
+ * @brief Test the precomputed property list membership bitmap
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(property_tests, testPropListBitmap)
+#else
+void testPropListBitmap(void)
+#endif
+{
+    struct special_property_list_bitmap_t bitmap = { 0 };
+    struct special_property_list_t property_list = { 0 };
+    const int proprietary[] = { 512, 9999, -1 };
+    unsigned i = 0, j = 0;
+    bool status = false;
+
+    for (i = 0; i < OBJECT_PROPRIETARY_MIN; i++) {
+        property_list_special((BACNET_OBJECT_TYPE)i, &property_list);
+        property_list_bitmap_init(&bitmap, property_list.Required.pList,
+            property_list.Optional.pList, proprietary);
+        zassert_true(property_list_bitmap_same(&bitmap,
+                         property_list.Required.pList,
+                         property_list.Optional.pList, proprietary),
+            NULL);
+        zassert_false(property_list_bitmap_same(&bitmap, proprietary,
+                          property_list.Optional.pList, proprietary),
+            NULL);
+        zassert_equal(bitmap.List.Required.count,
+            property_list_count(property_list.Required.pList), NULL);
+        zassert_equal(bitmap.List.Optional.count,
+            property_list_count(property_list.Optional.pList), NULL);
+        zassert_equal(bitmap.List.Proprietary.count, 2, NULL);
+        for (j = 0; j <= PROP_RESERVED_RANGE_MAX; j++) {
+            status = property_lists_member(property_list.Required.pList,
+                property_list.Optional.pList, proprietary, j);
+            zassert_equal(
+                property_list_bitmap_member(&bitmap, j), status, NULL);
+        }
+        zassert_true(property_list_bitmap_member(&bitmap, 512), NULL);
+        zassert_true(property_list_bitmap_member(&bitmap, 9999), NULL);
+        zassert_false(property_list_bitmap_member(&bitmap, 513), NULL);
+        zassert_false(property_list_bitmap_member(&bitmap, -1), NULL);
+    }
+    zassert_false(property_list_bitmap_member(NULL, PROP_OBJECT_NAME), NULL);
+    /* built on first use, and rebuilt when the lists change */
+    memset(&bitmap, 0, sizeof(bitmap));
+    property_list_special(OBJECT_ANALOG_INPUT, &property_list);
+    zassert_true(property_lists_bitmap_member(&bitmap,
+                     property_list.Required.pList,
+                     property_list.Optional.pList, NULL, PROP_PRESENT_VALUE),
+        NULL);
+    zassert_true(property_list_bitmap_same(&bitmap,
+                     property_list.Required.pList,
+                     property_list.Optional.pList, NULL),
+        NULL);
+    zassert_false(property_lists_bitmap_member(&bitmap,
+                      property_list.Required.pList,
+                      property_list.Optional.pList, NULL, 512),
+        NULL);
+    zassert_true(property_lists_bitmap_member(&bitmap,
+                     property_list.Required.pList,
+                     property_list.Optional.pList, proprietary, 512),
+        NULL);
+    zassert_equal(bitmap.List.Proprietary.pList, proprietary, NULL);
+    zassert_true(property_lists_bitmap_member(NULL,
+                     property_list.Required.pList,
+                     property_list.Optional.pList, proprietary, 9999),
+        NULL);
+}
+
 /**
  * @}
  */
@@ -94,7 +164,8 @@ ZTEST_SUITE(property_tests, NULL, NULL, NULL, NULL, NULL);
 #else
 void test_main(void)
 {
-    ztest_test_suite(property_tests, ztest_unit_test(testPropList));
+    ztest_test_suite(property_tests, ztest_unit_test(testPropList),
+        ztest_unit_test(testPropListBitmap));
 
     ztest_run_test_suite(property_tests);
 }
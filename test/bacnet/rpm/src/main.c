@@ -421,6 +421,156 @@ static void testReadPropertyMultipleAck(void)
         &object_instance);
     zassert_equal(test_len, 0, NULL);
     zassert_equal(len, service_request_len, NULL);
+    /* skip-scan to a single property value */
+    len = rpm_ack_property_value_find(service_request, service_request_len,
+        OBJECT_ANALOG_INPUT, 33, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL,
+        &test_len);
+    zassert_true(len > 0, NULL);
+    zassert_equal(bacapp_decode_application_data(&service_request[len],
+                      test_len, &test_application_data),
+        test_len, NULL);
+    zassert_true(
+        bacapp_same_value(&application_data[2], &test_application_data), NULL);
+    len = rpm_ack_property_value_find(service_request, service_request_len,
+        OBJECT_DEVICE, 123, PROP_OBJECT_TYPE, BACNET_ARRAY_ALL, &test_len);
+    zassert_true(len > 0, NULL);
+    zassert_equal(bacapp_decode_application_data(&service_request[len],
+                      test_len, &test_application_data),
+        test_len, NULL);
+    zassert_true(
+        bacapp_same_value(&application_data[1], &test_application_data), NULL);
+    /* property-access-error, wrong object, and missing property */
+    len = rpm_ack_property_value_find(service_request, service_request_len,
+        OBJECT_ANALOG_INPUT, 33, PROP_DEADBAND, BACNET_ARRAY_ALL, &test_len);
+    zassert_equal(len, 0, NULL);
+    len = rpm_ack_property_value_find(service_request, service_request_len,
+        OBJECT_ANALOG_INPUT, 34, PROP_PRESENT_VALUE, BACNET_ARRAY_ALL,
+        &test_len);
+    zassert_equal(len, 0, NULL);
+    len = rpm_ack_property_value_find(service_request, service_request_len,
+        OBJECT_DEVICE, 123, PROP_OBJECT_NAME, BACNET_ARRAY_ALL, &test_len);
+    zassert_equal(len, 0, NULL);
+    /* truncated */
+    len = rpm_ack_property_value_find(service_request,
+        service_request_len - 1, OBJECT_DEVICE, 123, PROP_OBJECT_NAME,
+        BACNET_ARRAY_ALL, &test_len);
+    zassert_equal(len, BACNET_STATUS_ERROR, NULL);
+}
+/* property values reported by rpm_ack_object_property_process() */
+static unsigned Process_Count;
+static BACNET_READ_PROPERTY_DATA Process_Data[4];
+
+/**
+ * @brief Record one property value of a ReadPropertyMultiple-Ack
+ */
+static void test_rpm_ack_process_callback(
+    uint32_t device_id, BACNET_READ_PROPERTY_DATA *rp_data)
+{
+    zassert_equal(device_id, 123, NULL);
+    if (Process_Count < (sizeof(Process_Data) / sizeof(Process_Data[0]))) {
+        Process_Data[Process_Count] = *rp_data;
+    }
+    Process_Count++;
+}
+
+/**
+ * @brief Test processing every object of a ReadPropertyMultiple-Ack
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(rpm_tests, testReadPropertyMultipleAckProcess)
+#else
+static void testReadPropertyMultipleAckProcess(void)
+#endif
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    uint8_t application_data[16] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    int apdu_len = 0, len = 0;
+
+    rpmdata.object_type = OBJECT_ANALOG_INPUT;
+    rpmdata.object_instance = 1;
+    apdu_len = rpm_ack_encode_apdu_object_begin(&apdu[apdu_len], &rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+    len = encode_application_real(application_data, 1.0f);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, len);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+    rpmdata.object_type = OBJECT_BINARY_INPUT;
+    rpmdata.object_instance = 2;
+    apdu_len += rpm_ack_encode_apdu_object_begin(&apdu[apdu_len], &rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_PRESENT_VALUE, BACNET_ARRAY_ALL);
+    len = encode_application_enumerated(application_data, BINARY_ACTIVE);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, len);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_DEADBAND, BACNET_ARRAY_ALL);
+    apdu_len += rpm_ack_encode_apdu_object_property_error(
+        &apdu[apdu_len], ERROR_CLASS_PROPERTY, ERROR_CODE_UNKNOWN_PROPERTY);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+
+    Process_Count = 0;
+    rpm_ack_object_property_process(
+        apdu, apdu_len, 123, &rp_data, test_rpm_ack_process_callback);
+    zassert_equal(Process_Count, 3, NULL);
+    zassert_equal(Process_Data[0].object_type, OBJECT_ANALOG_INPUT, NULL);
+    zassert_equal(Process_Data[0].object_instance, 1, NULL);
+    zassert_equal(Process_Data[0].object_property, PROP_PRESENT_VALUE, NULL);
+    zassert_equal(Process_Data[0].error_code, ERROR_CODE_SUCCESS, NULL);
+    zassert_equal(Process_Data[1].object_type, OBJECT_BINARY_INPUT, NULL);
+    zassert_equal(Process_Data[1].object_instance, 2, NULL);
+    zassert_equal(Process_Data[1].object_property, PROP_PRESENT_VALUE, NULL);
+    zassert_equal(Process_Data[1].error_code, ERROR_CODE_SUCCESS, NULL);
+    zassert_equal(Process_Data[2].object_type, OBJECT_BINARY_INPUT, NULL);
+    zassert_equal(Process_Data[2].object_property, PROP_DEADBAND, NULL);
+    zassert_equal(Process_Data[2].error_class, ERROR_CLASS_PROPERTY, NULL);
+    zassert_equal(
+        Process_Data[2].error_code, ERROR_CODE_UNKNOWN_PROPERTY, NULL);
+}
+
+/**
+ * @brief Test processing a ReadPropertyMultiple-Ack property with an
+ *  empty value after a property with a value
+ */
+#if defined(CONFIG_ZTEST_NEW_API)
+ZTEST(rpm_tests, testReadPropertyMultipleAckProcessEmpty)
+#else
+static void testReadPropertyMultipleAckProcessEmpty(void)
+#endif
+{
+    uint8_t apdu[MAX_APDU] = { 0 };
+    uint8_t application_data[16] = { 0 };
+    BACNET_RPM_DATA rpmdata = { 0 };
+    BACNET_READ_PROPERTY_DATA rp_data = { 0 };
+    int apdu_len = 0, len = 0;
+
+    rpmdata.object_type = OBJECT_DEVICE;
+    rpmdata.object_instance = 123;
+    apdu_len = rpm_ack_encode_apdu_object_begin(&apdu[apdu_len], &rpmdata);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_DATABASE_REVISION, BACNET_ARRAY_ALL);
+    len = encode_application_unsigned(application_data, 42);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, len);
+    apdu_len += rpm_ack_encode_apdu_object_property(
+        &apdu[apdu_len], PROP_ACTIVE_COV_SUBSCRIPTIONS, BACNET_ARRAY_ALL);
+    apdu_len += rpm_ack_encode_apdu_object_property_value(
+        &apdu[apdu_len], application_data, 0);
+    apdu_len += rpm_ack_encode_apdu_object_end(&apdu[apdu_len]);
+
+    Process_Count = 0;
+    rpm_ack_object_property_process(
+        apdu, apdu_len, 123, &rp_data, test_rpm_ack_process_callback);
+    zassert_equal(Process_Count, 2, NULL);
+    zassert_equal(
+        Process_Data[0].object_property, PROP_DATABASE_REVISION, NULL);
+    zassert_equal(Process_Data[0].application_data_len, len, NULL);
+    zassert_equal(
+        Process_Data[1].object_property, PROP_ACTIVE_COV_SUBSCRIPTIONS, NULL);
+    zassert_equal(Process_Data[1].error_code, ERROR_CODE_SUCCESS, NULL);
+    zassert_equal(Process_Data[1].application_data_len, 0, NULL);
 }
 /**
  * @}
@@ -433,7 +583,9 @@ void test_main(void)
 {
     ztest_test_suite(
         rpm_tests, ztest_unit_test(testReadPropertyMultiple),
-        ztest_unit_test(testReadPropertyMultipleAck));
+        ztest_unit_test(testReadPropertyMultipleAck),
+        ztest_unit_test(testReadPropertyMultipleAckProcess),
+        ztest_unit_test(testReadPropertyMultipleAckProcessEmpty));
 
     ztest_run_test_suite(rpm_tests);
 }